@@ -12,10 +12,11 @@
 # Configure data layout for particle data
 
 # Available options
-set(PARTICLE_DATA_LAYOUT_VALUES "particle" "equation")
+set(PARTICLE_DATA_LAYOUT_VALUES "particle" "equation" "block")
 # Initialize all to off
 set(PARTICLE_DATA_LAYOUT_AS_PARTICLE_MAJOR off)  # 0
 set(PARTICLE_DATA_LAYOUT_AS_EQUATION_MAJOR off)  # 1
+set(PARTICLE_DATA_LAYOUT_AS_BLOCK_MAJOR off)  # 2
 # Set default and select from list
 set(PARTICLE_DATA_LAYOUT "particle" CACHE STRING "Particle data layout. Default: (particle-major). Available options: ${PARTICLE_DATA_LAYOUT_VALUES}(-major).")
 SET_PROPERTY (CACHE PARTICLE_DATA_LAYOUT PROPERTY STRINGS ${PARTICLE_DATA_LAYOUT_VALUES})
@@ -26,6 +27,8 @@ IF (${PARTICLE_DATA_LAYOUT_INDEX} EQUAL 0)
   set(PARTICLE_DATA_LAYOUT_AS_PARTICLE_MAJOR on)
 ELSEIF (${PARTICLE_DATA_LAYOUT_INDEX} EQUAL 1)
   set(PARTICLE_DATA_LAYOUT_AS_EQUATION_MAJOR on)
+ELSEIF (${PARTICLE_DATA_LAYOUT_INDEX} EQUAL 2)
+  set(PARTICLE_DATA_LAYOUT_AS_BLOCK_MAJOR on)
 ELSEIF (${PARTICLE_DATA_LAYOUT_INDEX} EQUAL -1)
   MESSAGE(FATAL_ERROR "Particle data layout '${PARTICLE_DATA_LAYOUT}' not supported, valid entries are ${PARTICLE_DATA_LAYOUT_VALUES}(-major).")
 ENDIF()
@@ -34,10 +37,11 @@ message(STATUS "Particle data layout: " ${PARTICLE_DATA_LAYOUT} "(-major)")
 # Configure data layout for mesh field data
 
 # Available options
-set(FIELD_DATA_LAYOUT_VALUES "field" "equation")
+set(FIELD_DATA_LAYOUT_VALUES "field" "equation" "block")
 # Initialize all to off
 set(FIELD_DATA_LAYOUT_AS_FIELD_MAJOR off)  # 0
 set(FIELD_DATA_LAYOUT_AS_EQUATION_MAJOR off)  # 1
+set(FIELD_DATA_LAYOUT_AS_BLOCK_MAJOR off)  # 2
 # Set default and select from list
 set(FIELD_DATA_LAYOUT "field" CACHE STRING "Mesh field data layout. Default: (field-major). Available options: ${FIELD_DATA_LAYOUT_VALUES}(-major).")
 SET_PROPERTY (CACHE FIELD_DATA_LAYOUT PROPERTY STRINGS ${FIELD_DATA_LAYOUT_VALUES})
@@ -48,7 +52,17 @@ IF (${FIELD_DATA_LAYOUT_INDEX} EQUAL 0)
   set(FIELD_DATA_LAYOUT_AS_FIELD_MAJOR on)
 ELSEIF (${FIELD_DATA_LAYOUT_INDEX} EQUAL 1)
   set(FIELD_DATA_LAYOUT_AS_EQUATION_MAJOR on)
+ELSEIF (${FIELD_DATA_LAYOUT_INDEX} EQUAL 2)
+  set(FIELD_DATA_LAYOUT_AS_BLOCK_MAJOR on)
 ELSEIF (${FIELD_DATA_LAYOUT_INDEX} EQUAL -1)
   MESSAGE(FATAL_ERROR "Mesh field data layout '${FIELD_DATA_LAYOUT}' not supported, valid entries are ${FIELD_DATA_LAYOUT_VALUES}(-major).")
 ENDIF()
 message(STATUS "Mesh field data layout: " ${FIELD_DATA_LAYOUT} "(-major)")
+
+# Configure block width for the blocked data layout
+
+set(DATA_LAYOUT_BLOCK_WIDTH 8 CACHE STRING "Number of unknowns per block in the block(-major) data layout. Default: 8.")
+if (NOT DATA_LAYOUT_BLOCK_WIDTH GREATER 0)
+  MESSAGE(FATAL_ERROR "Data layout block width must be positive, got '${DATA_LAYOUT_BLOCK_WIDTH}'.")
+endif()
+message(STATUS "Data layout block width: " ${DATA_LAYOUT_BLOCK_WIDTH})
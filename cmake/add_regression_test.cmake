@@ -28,6 +28,8 @@ endfunction()
 #                      [INPUTFILES file1 file2 ...]
 #                      [ARGS arg1 arg2 ...]
 #                      [LABELS label1 label2 ...]
+#                      [CHECKPOINT test]
+#                      [BASELINE_TEST test]
 #                      [TEXT_DIFF_PROG txtdiff]
 #                      [TEXT_BASELINE stat1.std stat2.std ...]
 #                      [TEXT_RESULT stat1.txt stat2.txt ...]
@@ -75,6 +77,12 @@ endfunction()
 #
 # CHECKPOINT test - Optional test with a checkpoint the test should restart from
 #
+# BASELINE_TEST test - Optional test whose results are used as baselines. If
+# given, TEXT_BASELINE and BIN_BASELINE name files produced by that test in its
+# run directory instead of files in the source dir. This is used to require
+# two runs of the same problem to agree, e.g., with a different number of
+# threads. Default: "".
+#
 # TEXT_DIFF_PROG txtdiff - Diff program used for textual diffs. Default:
 # numdiff.
 #
@@ -130,7 +138,7 @@ function(ADD_REGRESSION_TEST test_name executable)
 
   set(oneValueArgs NUMPES PPN TEXT_DIFF_PROG BIN_DIFF_PROG
                    FILECONV_PROG POSTPROCESS_PROG POSTPROCESS_PROG_OUTPUT
-                   CHECKPOINT)
+                   CHECKPOINT BASELINE_TEST)
   set(multiValueArgs INPUTFILES ARGS TEXT_BASELINE TEXT_RESULT BIN_BASELINE
                      BIN_RESULT LABELS POSTPROCESS_PROG_ARGS BIN_DIFF_PROG_ARGS
                      TEXT_DIFF_PROG_ARGS TEXT_DIFF_PROG_CONF BIN_DIFF_PROG_CONF
@@ -276,9 +284,14 @@ function(ADD_REGRESSION_TEST test_name executable)
 
   # Create list of files required to soft-link to build directory
   set(reqfiles)
-  foreach(file IN LISTS ARG_TEXT_DIFF_PROG_CONF ARG_INPUTFILES ARG_TEXT_BASELINE ARG_BIN_BASELINE ARG_BIN_DIFF_PROG_CONF)
+  foreach(file IN LISTS ARG_TEXT_DIFF_PROG_CONF ARG_INPUTFILES ARG_BIN_DIFF_PROG_CONF)
     list(APPEND reqfiles "${CMAKE_CURRENT_SOURCE_DIR}/${file}")
   endforeach()
+  if (NOT ARG_BASELINE_TEST)
+    foreach(file IN LISTS ARG_TEXT_BASELINE ARG_BIN_BASELINE)
+      list(APPEND reqfiles "${CMAKE_CURRENT_SOURCE_DIR}/${file}")
+    endforeach()
+  endif()
 
   # Softlink files required to build directory
   foreach(target ${reqfiles})
@@ -315,6 +328,36 @@ function(ADD_REGRESSION_TEST test_name executable)
 
   endif()
 
+  # Configure optional test whose results are used as baselines
+  if (ARG_BASELINE_TEST)
+
+    # Prefix executable and append REQUESTED_NUMPES to baseline test name
+    set(baseline_test
+        "${executable}:${ARG_BASELINE_TEST}_pe${REQUESTED_NUMPES}")
+    # In SMP mode, also append ppn to baseline test name
+    if (CHARM_SMP)
+      set(baseline_test "${baseline_test}_ppn${PPN}")
+    endif()
+
+    # Softlink results from baseline test as baselines. Since the results of
+    # this test may have the same filenames, the links are prefixed.
+    set(baselines)
+    foreach(baseline IN LISTS ARG_TEXT_BASELINE)
+      softlink( "${CMAKE_CURRENT_BINARY_DIR}/${baseline_test}/${baseline}"
+                "${workdir}/baseline.${baseline}" )
+      list(APPEND baselines "baseline.${baseline}")
+    endforeach()
+    set(ARG_TEXT_BASELINE ${baselines})
+    set(baselines)
+    foreach(baseline IN LISTS ARG_BIN_BASELINE)
+      softlink( "${CMAKE_CURRENT_BINARY_DIR}/${baseline_test}/${baseline}"
+                "${workdir}/baseline.${baseline}" )
+      list(APPEND baselines "baseline.${baseline}")
+    endforeach()
+    set(ARG_BIN_BASELINE ${baselines})
+
+  endif()
+
   # Do sainity check on and prepare to pass as cmake script arguments the
   # filenames of text baseline(s) and text result(s)
   if(ARG_TEXT_BASELINE OR ARG_TEXT_RESULT)
@@ -470,12 +513,15 @@ function(ADD_REGRESSION_TEST test_name executable)
 
   #message("'${test_name}' pass regexp: ${pass_regexp}, fail regexp: ${fail_regexp}")
 
+  # Tests whose output this test uses must run first
+  set(depends ${checkpoint} ${baseline_test})
+
   # Set test properties and instruct ctest to check textual diff output against
   # the regular expressions specified.
   set_tests_properties(${test_name} PROPERTIES ${test_properties}
                        PASS_REGULAR_EXPRESSION "${pass_regexp}"
                        FAIL_REGULAR_EXPRESSION "${fail_regexp}"
-                       DEPENDS "${checkpoint}")
+                       DEPENDS "${depends}")
 
   # Set labels cmake test property. The LABELS built-in cmake property is not
   # passed as part of test_properties above in set_test_properties as
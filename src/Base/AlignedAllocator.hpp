@@ -0,0 +1,71 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/AlignedAllocator.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Allocator returning memory aligned to a given boundary
+  \details   Allocator returning memory aligned to a given boundary, e.g., to
+    cache lines or the width of SIMD registers, for use with standard library
+    containers, e.g., std::vector< tk::real, tk::AlignedAllocator< tk::real > >.
+*/
+// *****************************************************************************
+#ifndef AlignedAllocator_h
+#define AlignedAllocator_h
+
+#include <new>
+#include <cstddef>
+
+namespace tk {
+
+//! Allocator returning memory aligned to a given boundary
+//! \tparam T Type of objects to allocate
+//! \tparam Align Alignment in bytes, must be a power of two
+template< class T, std::size_t Align = 64 >
+class AlignedAllocator {
+
+  static_assert( (Align & (Align-1)) == 0, "Alignment must be a power of 2" );
+  static_assert( Align >= alignof(T), "Alignment must not weaken alignof(T)" );
+
+  public:
+    using value_type = T;
+
+    //! Rebind allocator to another type keeping the alignment
+    template< class U >
+    struct rebind { using other = AlignedAllocator< U, Align >; };
+
+    //! Default constructor
+    AlignedAllocator() noexcept = default;
+
+    //! Converting constructor from allocator of another type
+    template< class U >
+    // cppcheck-suppress noExplicitConstructor
+    AlignedAllocator( const AlignedAllocator< U, Align >& ) noexcept {}
+
+    //! Allocate aligned memory
+    //! \param[in] n Number of objects to allocate memory for
+    //! \return Pointer to memory aligned to Align bytes
+    T* allocate( std::size_t n ) {
+      return static_cast< T* >(
+        ::operator new( n*sizeof(T), std::align_val_t( Align ) ) );
+    }
+
+    //! Deallocate memory allocated by allocate()
+    //! \param[in] p Pointer to memory to deallocate
+    void deallocate( T* p, std::size_t ) noexcept
+    { ::operator delete( p, std::align_val_t( Align ) ); }
+
+    //! Allocators compare equal as they are stateless
+    template< class U >
+    bool operator==( const AlignedAllocator< U, Align >& ) const noexcept
+    { return true; }
+    //! Allocators compare equal as they are stateless
+    template< class U >
+    bool operator!=( const AlignedAllocator< U, Align >& ) const noexcept
+    { return false; }
+};
+
+} // tk::
+
+#endif // AlignedAllocator_h
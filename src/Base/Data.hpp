@@ -7,7 +7,15 @@
              All rights reserved. See the LICENSE file for details.
   \brief     Generic data storage with different memory layouts
   \details   Generic data storage with different memory layouts. See also the
-    rationale discussed in the [design](layout.html) document.
+    rationale discussed in the [design](layout.html) document. In addition to
+    the unknown-major (array-of-structures) and equation-major
+    (structure-of-arrays) layouts, a blocked (array-of-structures-of-arrays)
+    layout is provided: unknowns are grouped into blocks of DataBlockWidth
+    unknowns and within a block all components of an unknown are stored
+    contiguously for the unknowns of the block. This keeps the values of a
+    component for consecutive unknowns contiguous (SIMD-lane friendly) while
+    keeping all components of an unknown close in memory. The last block is
+    padded to full width with zeros. Memory is aligned to 64 bytes.
 */
 // *****************************************************************************
 #ifndef Data_h
@@ -20,9 +28,11 @@
 #include <set>
 #include <algorithm>
 
+#include "QuinoaBuildConfig.hpp"
 #include "Types.hpp"
 #include "Keywords.hpp"
 #include "Exception.hpp"
+#include "AlignedAllocator.hpp"
 
 #include "NoWarning/pup_stl.hpp"
 
@@ -31,6 +41,14 @@ namespace tk {
 //! Tags for selecting data layout policies
 const uint8_t UnkEqComp = 0;
 const uint8_t EqCompUnk = 1;
+const uint8_t BlkEqCompUnk = 2;
+
+//! Number of unknowns in a block of the blocked data layout, BlkEqCompUnk
+#ifdef DATA_LAYOUT_BLOCK_WIDTH
+const std::size_t DataBlockWidth = DATA_LAYOUT_BLOCK_WIDTH;
+#else
+const std::size_t DataBlockWidth = 8;
+#endif
 
 //! Zero-runtime-cost data-layout wrappers with type-based compile-time dispatch
 template< uint8_t Layout >
@@ -50,7 +68,7 @@ class Data {
     //! \param[in] np Total number of properties, i.e., scalar variables or
     //!   components, per unknown
     explicit Data( ncomp_t nu, ncomp_t np ) :
-      m_vec( nu*np ),
+      m_vec( size( nu, np, int2type< Layout >() ) ),
       m_nunk( nu ),
       m_nprop( np ) {}
 
@@ -299,13 +317,18 @@ class Data {
       return extract( component, offset, N[0], N[1], N[2] );
     }
 
+    //! Type of underlying raw data: std::vector with aligned memory
+    using Vector = std::vector< tk::real, AlignedAllocator< tk::real > >;
+
     //! Const-ref accessor to underlying raw data as a std::vector
     //! \return Constant reference to underlying raw data
-    const std::vector< tk::real >& vec() const { return m_vec; }
+    //! \note With the blocked data layout this includes the zero padding of
+    //!   the last block.
+    const Vector& vec() const { return m_vec; }
 
     //! Non-const-ref accessor to underlying raw data as a std::vector
     //! \return Non-constant reference to underlying raw data
-    std::vector< tk::real >& vec() { return m_vec; }
+    Vector& vec() { return m_vec; }
 
     //! Compound operator-=
     //! \param[in] rhs Data object to subtract
@@ -382,9 +405,10 @@ class Data {
     Data< Layout >& operator/= ( const Data< Layout >& rhs ) {
       Assert( rhs.nunk() == m_nunk, "Incorrect number of unknowns" );
       Assert( rhs.nprop() == m_nprop, "Incorrect number of properties" );
-      std::transform( rhs.vec().cbegin(), rhs.vec().cend(),
-                      m_vec.cbegin(), m_vec.begin(),
-                      []( tk::real s, tk::real d ){ return d/s; } );
+      const auto* pr = rhs.vec().data();
+      auto* pv = m_vec.data();
+      ranges( [&]( std::size_t b, std::size_t e ){
+        for (auto i=b; i<e; ++i) pv[i] /= pr[i]; } );
       return *this;
     }
     //! Operator /
@@ -409,6 +433,39 @@ class Data {
     Data< Layout > operator/ ( tk::real rhs )
     const { return Data< Layout >( *this ) /= rhs; }
 
+    //! Assign y + a * x / d item by item in a single pass
+    //! \param[in] y Data object to add to
+    //! \param[in] a Scalar to multiply x with
+    //! \param[in] x Data object to add a scaled multiple of
+    //! \param[in] d Data object to divide x by
+    //! \return Reference to ourselves after the update
+    //! \details Equivalent to *this = y + a * x / d, but instead of creating
+    //!   a temporary Data object for each operator, the result is computed in
+    //!   a single pass over the operands without allocation, if *this already
+    //!   has the correct size. This is the form of an explicit time step
+    //!   (stage) with a diagonal (lumped) left hand side, e.g., u = un + dt *
+    //!   rhs / lhs. *this may alias any of the operands.
+    Data< Layout >& update( const Data< Layout >& y,
+                            tk::real a,
+                            const Data< Layout >& x,
+                            const Data< Layout >& d )
+    {
+      Assert( y.nunk() == x.nunk() && x.nunk() == d.nunk(),
+              "Incorrect number of unknowns" );
+      Assert( y.nprop() == x.nprop() && x.nprop() == d.nprop(),
+              "Incorrect number of properties" );
+      m_nunk = y.nunk();
+      m_nprop = y.nprop();
+      m_vec.resize( y.vec().size() );
+      const auto* py = y.vec().data();
+      const auto* px = x.vec().data();
+      const auto* pd = d.vec().data();
+      auto* pv = m_vec.data();
+      ranges( [&]( std::size_t b, std::size_t e ){
+        for (auto i=b; i<e; ++i) pv[i] = py[i] + a * px[i] / pd[i]; } );
+      return *this;
+    }
+
     //! Add new unknown at the end of the container
     //! \param[in] prop Vector of properties to initialize the new unknown with
     void push_back( const std::vector< tk::real >& prop )
@@ -424,6 +481,9 @@ class Data {
 
     //! Remove a number of unknowns
     //! \param[in] unknown Set of indices of unknowns to remove
+    //! \note Only implemented for the UnkEqComp and BlkEqCompUnk data
+    //!   layouts, as this operation would be too inefficient with the
+    //!   EqCompUnk data layout.
     void rm( const std::set< ncomp_t >& unknown ) {
       auto remove = [ &unknown ]( std::size_t i ) -> bool {
         if (unknown.find(i) != end(unknown)) return true;
@@ -434,10 +494,9 @@ class Data {
         while( remove(i) ) ++i;
         if (i >= m_nunk) break;
         for (ncomp_t p = 0; p<m_nprop; ++p)
-          m_vec[ last*m_nprop+p ] = m_vec[ i*m_nprop+p ];
+          operator()( last, p, 0 ) = operator()( i, p, 0 );
       }
-      m_vec.resize( last*m_nprop );
-      m_nunk -= unknown.size();
+      resize( m_nunk - unknown.size() );
     }
 
     //! Fill vector of unknowns with the same value
@@ -455,8 +514,12 @@ class Data {
 
     //! Fill full data storage with value
     //! \param[in] value Value to fill data with
-    void fill( tk::real value )
-    { std::fill( begin(m_vec), end(m_vec), value ); }
+    void fill( tk::real value ) {
+      ranges( [&]( std::size_t b, std::size_t e ){
+        std::fill( m_vec.begin() + static_cast< std::ptrdiff_t >( b ),
+                   m_vec.begin() + static_cast< std::ptrdiff_t >( e ),
+                   value ); } );
+    }
 
     //! Check if vector of unknowns is empty
     bool empty() const noexcept { return m_vec.empty(); }
@@ -470,7 +533,10 @@ class Data {
     //! \brief Pack/Unpack serialize member function
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er &p ) {
-      p | m_vec;
+      auto n = m_vec.size();
+      p | n;
+      if (p.isUnpacking()) m_vec.resize( n );
+      PUParray( p, m_vec.data(), n );
       p | m_nunk;
       p | m_nprop;
     }
@@ -517,6 +583,17 @@ class Data {
               "unknowns" );
       return m_vec[ (offset+component)*m_nunk + unknown ];
     }
+    const tk::real&
+    access( ncomp_t unknown, ncomp_t component, ncomp_t offset,
+            int2type< BlkEqCompUnk > ) const
+    {
+      Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
+              "component < number of properties" );
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      return m_vec[ ((unknown/DataBlockWidth)*m_nprop + offset + component) *
+                    DataBlockWidth + unknown%DataBlockWidth ];
+    }
 
     // Overloads for the various const ptr to physical variable accesses
     //! \details Requirement: offset + component < nprop, unknown < nunk,
@@ -540,6 +617,12 @@ class Data {
               "component < number of properties" );
       return m_vec.data() + (offset+component)*m_nunk;
     }
+    const tk::real*
+    cptr( ncomp_t component, ncomp_t offset, int2type< BlkEqCompUnk > ) const {
+      Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
+              "component < number of properties" );
+      return m_vec.data() + (offset+component)*DataBlockWidth;
+    }
 
     // Overloads for the various const physical variable accesses
     //!   Requirement: unknown < nunk, enforced with an assert in DEBUG mode,
@@ -563,11 +646,19 @@ class Data {
               "unknowns" );
       return *(pt + unknown);
     }
+    inline const tk::real&
+    var( const tk::real* const pt, ncomp_t unknown, int2type< BlkEqCompUnk > )
+    const {
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      return *(pt + (unknown/DataBlockWidth)*m_nprop*DataBlockWidth +
+                    unknown%DataBlockWidth);
+    }
 
     //! Add new unknown
     //! \param[in] prop Vector of properties to initialize the new unknown with
-    //! \note Only the UnkEqComp overload is provided as this operation would be
-    //!   too inefficient with the EqCompUnk data layout.
+    //! \note Not implemented for the EqCompUnk data layout as this operation
+    //!   would be too inefficient with the EqCompUnk data layout.
     void push_back( const std::vector< tk::real >& prop, int2type< UnkEqComp > )
     {
       Assert( prop.size() == m_nprop, "Incorrect number of properties" );
@@ -580,11 +671,20 @@ class Data {
     void push_back( const std::vector< tk::real >&, int2type< EqCompUnk > )
     { Throw( "Not implented. It would be inefficient" ); }
 
+    void push_back( const std::vector< tk::real >& prop,
+                    int2type< BlkEqCompUnk > )
+    {
+      Assert( prop.size() == m_nprop, "Incorrect number of properties" );
+      ncomp_t u = m_nunk;
+      resize( m_nunk+1, 0.0, int2type< BlkEqCompUnk >() );
+      for (ncomp_t i=0; i<m_nprop; ++i) operator()( u, i, 0 ) = prop[i];
+    }
+
     //! Resize data store to contain 'count' elements
     //! \param[in] count Resize store to contain 'count' elements
     //! \param[in] value Value to initialize new data with
-    //! \note Only the UnkEqComp overload is provided as this operation would be
-    //!   too inefficient with the EqCompUnk data layout.
+    //! \note Not implemented for the EqCompUnk data layout as this operation
+    //!   would be too inefficient with the EqCompUnk data layout.
     //! \note This works for both shrinking and enlarging, as this simply
     //!   translates to std::vector::resize().
     void resize( std::size_t count, tk::real value, int2type< UnkEqComp > ) {
@@ -596,6 +696,54 @@ class Data {
       Throw( "Not implemented. It would be inefficient" );
     }
 
+    void resize( std::size_t count, tk::real value, int2type< BlkEqCompUnk > ) {
+      auto n = m_nunk;
+      // when shrinking, zero the lanes of the removed unknowns in the new last
+      // block to keep the padding zero
+      auto z = std::min( n, size( count, 1, int2type< BlkEqCompUnk >() ) );
+      for (auto u=count; u<z; ++u)
+        for (ncomp_t p=0; p<m_nprop; ++p) operator()( u, p, 0 ) = 0.0;
+      m_vec.resize( size( count, m_nprop, int2type< BlkEqCompUnk >() ), 0.0 );
+      m_nunk = count;
+      for (auto u=n; u<count; ++u)
+        for (ncomp_t p=0; p<m_nprop; ++p) operator()( u, p, 0 ) = value;
+    }
+
+    // Overloads for the size of the underlying raw data
+    //! \param[in] nu Number of unknowns
+    //! \param[in] np Number of properties per unknown
+    //! \return Number of reals to store for nu unknowns and np properties
+    static std::size_t
+    size( std::size_t nu, std::size_t np, int2type< UnkEqComp > )
+    { return nu*np; }
+    static std::size_t
+    size( std::size_t nu, std::size_t np, int2type< EqCompUnk > )
+    { return nu*np; }
+    static std::size_t
+    size( std::size_t nu, std::size_t np, int2type< BlkEqCompUnk > )
+    { return (nu + DataBlockWidth - 1) / DataBlockWidth * DataBlockWidth * np; }
+
+    //! Call a function for the contiguous ranges of the raw data storing values
+    //! \param[in] f Function called as f( begin, end ) for the ranges of
+    //!   indices into the raw data that store values, i.e., excluding padding
+    //! \details Used by operations that must not operate on padding, e.g.,
+    //!   division, which would raise floating point exceptions on the zeros.
+    template< class F >
+    void ranges( F&& f ) const {
+      if constexpr( Layout == BlkEqCompUnk ) {
+        const auto nfull = m_nunk / DataBlockWidth;
+        const auto rem = m_nunk % DataBlockWidth;
+        if (nfull) f( std::size_t(0), nfull*m_nprop*DataBlockWidth );
+        if (rem)
+          for (ncomp_t p=0; p<m_nprop; ++p) {
+            auto b = (nfull*m_nprop + p)*DataBlockWidth;
+            f( b, b+rem );
+          }
+      } else {
+        f( std::size_t(0), m_vec.size() );
+      }
+    }
+
     // Overloads for the name-queries of data lauouts
     //! \return The name of the data layout used
     //! \see A. Alexandrescu, Modern C++ Design: Generic Programming and Design
@@ -604,8 +752,10 @@ class Data {
     { return "unknown-major"; }
     static std::string layout( int2type< EqCompUnk > )
     { return "equation-major"; }
+    static std::string layout( int2type< BlkEqCompUnk > )
+    { return "block-major"; }
 
-    std::vector< tk::real > m_vec;      //!< Data pointer
+    Vector m_vec;                       //!< Data pointer
     ncomp_t m_nunk;                     //!< Number of unknowns
     ncomp_t m_nprop;                    //!< Number of properties/unknown
 };
@@ -0,0 +1,441 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/FlatHash.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Fast integer hashing and open-addressing hash set and map
+  \details   Fast integer hashing and open-addressing hash set and map. The
+    hash functions are non-cryptographic: they mix the bits of integer keys
+    using a few multiplications and shifts. The containers tk::FlatHashSet and
+    tk::FlatHashMap store their entries in a single contiguous array, resolve
+    collisions by linear probing, and erase entries by shifting back the
+    entries that follow in the same probe sequence, so no tombstones are left
+    behind. Compared to std::unordered_set and std::unordered_map they do not
+    allocate per insert and lookups touch consecutive memory. They implement
+    the most commonly used subset of the interface of their standard library
+    counterparts, so they can stand in for them, with the following
+    differences: (1) keys and mapped values must be default constructible,
+    (2) any insert may invalidate all iterators and references, (3) erase
+    invalidates all iterators and references, and (4) the iteration order is
+    unspecified and differs from that of the standard containers.
+*/
+// *****************************************************************************
+#ifndef FlatHash_h
+#define FlatHash_h
+
+#include <array>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <type_traits>
+
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Mix the bits of a 64-bit integer
+//! \param[in] h Value to mix
+//! \return Mixed value: a bijection of h in which each input bit affects each
+//!   output bit with about equal probability
+//! \see Finalizer of MurmurHash3 by A. Appleby
+inline uint64_t hashmix( uint64_t h ) noexcept {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+//! Hash a fixed-size array of integers in the order given
+//! \tparam N Number of integers in array
+//! \param[in] a Array of integers to hash
+//! \return Hash value of the array
+//! \details Arrays that differ only in their last entry never collide.
+template< std::size_t N >
+std::size_t hasharray( const std::array< std::size_t, N >& a ) noexcept {
+  uint64_t h = 0x9e3779b97f4a7c15ULL;
+  for (auto x : a) h = hashmix( h ^ static_cast< uint64_t >( x ) );
+  return static_cast< std::size_t >( h );
+}
+
+namespace detail {
+
+//! Open-addressing hash table with linear probing, used for FlatHashSet and
+//! FlatHashMap
+//! \tparam Key Key type
+//! \tparam Slot Type stored in the table: Key for sets, std::pair< Key, T >
+//!   for maps
+//! \tparam Hash Hasher
+//! \tparam Eq Key equality comparator
+//! \tparam KeyOf Function class returning the key of a slot
+template< class Key, class Slot, class Hash, class Eq, class KeyOf >
+class FlatHashTable {
+
+  public:
+    //! Forward iterator over the used slots of the table
+    //! \tparam Const True for const_iterator
+    template< bool Const >
+    class Iterator {
+      friend class FlatHashTable;
+      template< bool > friend class Iterator;
+      using Table = std::conditional_t< Const, const FlatHashTable,
+                                        FlatHashTable >;
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Slot;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t< Const, const Slot*, Slot* >;
+        using reference = std::conditional_t< Const, const Slot&, Slot& >;
+
+        //! Default constructor
+        explicit Iterator() noexcept : m_table( nullptr ), m_i( 0 ) {}
+        //! Conversion from iterator to const_iterator
+        //! \param[in] i Iterator to convert
+        template< bool C = Const, class = std::enable_if_t< C > >
+        Iterator( const Iterator< false >& i ) noexcept :
+          m_table( i.m_table ), m_i( i.m_i ) {}
+
+        //! Dereference operator
+        //! \return Reference to slot pointed to
+        reference operator*() const { return m_table->m_slot[ m_i ]; }
+        //! Member access operator
+        //! \return Pointer to slot pointed to
+        pointer operator->() const { return &m_table->m_slot[ m_i ]; }
+        //! Pre-increment operator: advance to next used slot
+        //! \return Reference to this iterator
+        Iterator& operator++() { m_i = m_table->next( m_i+1 ); return *this; }
+        //! Post-increment operator: advance to next used slot
+        //! \return Copy of this iterator before the increment
+        Iterator operator++(int) { auto i = *this; ++*this; return i; }
+        //! Equality operator
+        //! \param[in] i Iterator to compare to
+        //! \return True if both iterators point to the same slot
+        bool operator==( const Iterator& i ) const { return m_i == i.m_i; }
+        //! Inequality operator
+        //! \param[in] i Iterator to compare to
+        //! \return True if the iterators point to different slots
+        bool operator!=( const Iterator& i ) const { return m_i != i.m_i; }
+
+      private:
+        Table* m_table;         //!< Table iterated over
+        std::size_t m_i;        //!< Slot index pointed to
+
+        //! Constructor pointing to a given slot
+        //! \param[in] t Table to iterate over
+        //! \param[in] i Slot index to point to
+        explicit Iterator( Table* t, std::size_t i ) : m_table(t), m_i(i) {}
+    };
+
+    using key_type = Key;
+    using value_type = Slot;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = Eq;
+    using iterator = Iterator< false >;
+    using const_iterator = Iterator< true >;
+
+    //! Constructor
+    //! \param[in] n Number of entries to reserve space for
+    explicit FlatHashTable( std::size_t n = 0 ) :
+      m_slot(), m_used(), m_size( 0 ), m_mask( 0 ) { reserve( n ); }
+
+    //! Number of entries stored
+    //! \return Number of entries stored
+    std::size_t size() const noexcept { return m_size; }
+
+    //! Query if the container is empty
+    //! \return True if no entries are stored
+    bool empty() const noexcept { return m_size == 0; }
+
+    //! Number of slots in the table
+    //! \return Number of slots, used and unused
+    std::size_t bucket_count() const noexcept { return m_slot.size(); }
+
+    /** @name Iterators */
+    ///@{
+    iterator begin() noexcept { return iterator( this, next(0) ); }
+    iterator end() noexcept { return iterator( this, m_slot.size() ); }
+    const_iterator begin() const noexcept
+    { return const_iterator( this, next(0) ); }
+    const_iterator end() const noexcept
+    { return const_iterator( this, m_slot.size() ); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    ///@}
+
+    //! Remove all entries keeping the allocated slots
+    void clear() {
+      std::fill( m_slot.begin(), m_slot.end(), Slot() );
+      std::fill( m_used.begin(), m_used.end(), 0 );
+      m_size = 0;
+    }
+
+    //! Allocate slots so that n entries can be stored without a rehash
+    //! \param[in] n Number of entries to reserve space for
+    void reserve( std::size_t n ) {
+      if (n == 0 || (n+1)*4 <= m_slot.size()*3) return;
+      std::size_t cap = 8;
+      while (cap*3 < (n+1)*4) cap *= 2;
+      rehash( cap );
+    }
+
+    //! Find entry with given key
+    //! \param[in] key Key to search for
+    //! \return Iterator to the entry found or end() if not found
+    iterator find( const Key& key ) { return iterator( this, locate(key) ); }
+
+    //! Find entry with given key
+    //! \param[in] key Key to search for
+    //! \return Const iterator to the entry found or end() if not found
+    const_iterator find( const Key& key ) const
+    { return const_iterator( this, locate(key) ); }
+
+    //! Count entries with given key
+    //! \param[in] key Key to search for
+    //! \return 1 if found, 0 if not found
+    std::size_t count( const Key& key ) const
+    { return locate(key) != m_slot.size(); }
+
+    //! Erase entry with given key
+    //! \param[in] key Key of entry to erase
+    //! \return Number of entries erased: 1 if found, 0 if not found
+    std::size_t erase( const Key& key ) {
+      auto i = locate( key );
+      if (i == m_slot.size()) return 0;
+      remove( i );
+      return 1;
+    }
+
+  protected:
+    //! Insert an entry if its key is not yet stored
+    //! \param[in] key Key of entry to insert
+    //! \param[in] make Function returning the slot to store if key not found
+    //! \return Pair of iterator to the entry with key and true if inserted
+    template< class Make >
+    std::pair< iterator, bool > insert_key( const Key& key, Make&& make ) {
+      if ((m_size+1)*4 > m_slot.size()*3)
+        rehash( m_slot.empty() ? 8 : m_slot.size()*2 );
+      auto i = home( key );
+      while (m_used[i]) {
+        if (Eq()( KeyOf()( m_slot[i] ), key ))
+          return { iterator(this,i), false };
+        i = (i+1) & m_mask;
+      }
+      m_slot[i] = make();
+      m_used[i] = 1;
+      ++m_size;
+      return { iterator(this,i), true };
+    }
+
+    //! Find slot index of entry with given key
+    //! \param[in] key Key to search for
+    //! \return Slot index of key, number of slots if not found
+    std::size_t locate( const Key& key ) const {
+      if (m_size == 0) return m_slot.size();
+      auto i = home( key );
+      while (m_used[i]) {
+        if (Eq()( KeyOf()( m_slot[i] ), key )) return i;
+        i = (i+1) & m_mask;
+      }
+      return m_slot.size();
+    }
+
+    std::vector< Slot > m_slot;         //!< Slots, used and unused
+    std::vector< char > m_used;         //!< 1 if slot is used, 0 if not
+
+  private:
+    std::size_t m_size;                 //!< Number of used slots
+    std::size_t m_mask;                 //!< Number of slots minus one
+
+    //! Find home slot index of a key
+    //! \param[in] key Key to compute home slot of
+    //! \return Slot index the probe sequence of key starts at
+    //! \details The hash is mixed once more so that hashers that return the
+    //!   key itself, e.g., std::hash for integers, spread entries over the
+    //!   table.
+    std::size_t home( const Key& key ) const {
+      return static_cast< std::size_t >( hashmix( Hash()( key ) ) ) & m_mask;
+    }
+
+    //! Find next used slot
+    //! \param[in] i Slot index to start searching at
+    //! \return Index of the first used slot not before i, number of slots if
+    //!   there is no such slot
+    std::size_t next( std::size_t i ) const noexcept {
+      while (i < m_used.size() && !m_used[i]) ++i;
+      return i;
+    }
+
+    //! Erase entry in a used slot shifting back entries that follow
+    //! \param[in] i Slot index to erase
+    void remove( std::size_t i ) {
+      auto j = i;
+      while (true) {
+        j = (j+1) & m_mask;
+        if (!m_used[j]) break;
+        // move entry j to the hole at i if its home is not in (i,j]
+        auto h = home( KeyOf()( m_slot[j] ) );
+        if (((j - h) & m_mask) >= ((j - i) & m_mask)) {
+          m_slot[i] = std::move( m_slot[j] );
+          i = j;
+        }
+      }
+      m_slot[i] = Slot();
+      m_used[i] = 0;
+      --m_size;
+    }
+
+    //! Reallocate slots and reinsert all entries
+    //! \param[in] cap New number of slots, must be a power of two
+    void rehash( std::size_t cap ) {
+      Assert( (cap & (cap-1)) == 0, "Number of slots must be a power of 2" );
+      std::vector< Slot > slot( cap );
+      std::vector< char > used( cap, 0 );
+      m_slot.swap( slot );
+      m_used.swap( used );
+      m_mask = cap - 1;
+      for (std::size_t j=0; j<used.size(); ++j)
+        if (used[j]) {
+          auto i = home( KeyOf()( slot[j] ) );
+          while (m_used[i]) i = (i+1) & m_mask;
+          m_slot[i] = std::move( slot[j] );
+          m_used[i] = 1;
+        }
+    }
+};
+
+//! Function class returning the key of a set entry
+struct SetKey {
+  //! \param[in] k Set entry
+  //! \return Key of set entry: the entry itself
+  template< class K > const K& operator()( const K& k ) const { return k; }
+};
+
+//! Function class returning the key of a map entry
+struct MapKey {
+  //! \param[in] p Map entry
+  //! \return Key of map entry: the first of the pair
+  template< class P > const auto& operator()( const P& p ) const
+  { return p.first; }
+};
+
+} // detail::
+
+//! Open-addressing hash set
+//! \tparam Key Key type
+//! \tparam Hash Hasher
+//! \tparam Eq Key equality comparator
+template< class Key,
+          class Hash = std::hash< Key >,
+          class Eq = std::equal_to< Key > >
+class FlatHashSet
+  : public detail::FlatHashTable< Key, Key, Hash, Eq, detail::SetKey > {
+
+  using Table = detail::FlatHashTable< Key, Key, Hash, Eq, detail::SetKey >;
+
+  public:
+    using Table::Table;
+
+    //! Constructor inserting keys from a range
+    //! \param[in] b Iterator to first key to insert
+    //! \param[in] e Iterator to one past the last key to insert
+    template< class It >
+    explicit FlatHashSet( It b, It e ) : Table() { insert( b, e ); }
+
+    //! Insert key
+    //! \param[in] key Key to insert
+    //! \return Pair of iterator to the entry with key and true if inserted
+    std::pair< typename Table::iterator, bool > insert( const Key& key )
+    { return this->insert_key( key, [&](){ return key; } ); }
+
+    //! Insert keys from a range
+    //! \param[in] b Iterator to first key to insert
+    //! \param[in] e Iterator to one past the last key to insert
+    template< class It >
+    void insert( It b, It e ) { for (; b!=e; ++b) insert( *b ); }
+
+    //! Construct key in place and insert it
+    //! \param[in] args Arguments to construct key with
+    //! \return Pair of iterator to the entry with key and true if inserted
+    template< class... Args >
+    std::pair< typename Table::iterator, bool > emplace( Args&&... args )
+    { return insert( Key( std::forward< Args >( args )... ) ); }
+};
+
+//! Open-addressing hash map
+//! \tparam Key Key type
+//! \tparam T Mapped type
+//! \tparam Hash Hasher
+//! \tparam Eq Key equality comparator
+template< class Key,
+          class T,
+          class Hash = std::hash< Key >,
+          class Eq = std::equal_to< Key > >
+class FlatHashMap
+  : public detail::FlatHashTable< Key, std::pair< Key, T >, Hash, Eq,
+                                  detail::MapKey > {
+
+  using Table = detail::FlatHashTable< Key, std::pair< Key, T >, Hash, Eq,
+                                       detail::MapKey >;
+
+  public:
+    using mapped_type = T;
+    using Table::Table;
+
+    //! Insert key and value if key is not yet stored
+    //! \param[in] v Pair of key and value to insert
+    //! \return Pair of iterator to the entry with key and true if inserted
+    std::pair< typename Table::iterator, bool >
+    insert( const std::pair< Key, T >& v )
+    { return this->insert_key( v.first, [&](){ return v; } ); }
+
+    //! Construct value in place if key is not yet stored
+    //! \param[in] key Key to insert
+    //! \param[in] args Arguments to construct value with
+    //! \return Pair of iterator to the entry with key and true if inserted
+    template< class... Args >
+    std::pair< typename Table::iterator, bool >
+    try_emplace( const Key& key, Args&&... args ) {
+      return this->insert_key( key, [&](){
+        return std::pair< Key, T >( std::piecewise_construct,
+                 std::forward_as_tuple( key ),
+                 std::forward_as_tuple( std::forward< Args >( args )... ) );
+      } );
+    }
+
+    //! Access value with key, inserting a default value if not yet stored
+    //! \param[in] key Key of value to access
+    //! \return Reference to value with key
+    T& operator[]( const Key& key ) { return try_emplace( key ).first->second; }
+
+    //! Access value with key
+    //! \param[in] key Key of value to access
+    //! \return Reference to value with key
+    //! \note Throws tk::Exception if key is not found
+    T& at( const Key& key ) {
+      auto i = this->locate( key );
+      if (i == this->m_slot.size()) Throw( "Key not found in FlatHashMap" );
+      return this->m_slot[i].second;
+    }
+
+    //! Access value with key
+    //! \param[in] key Key of value to access
+    //! \return Const reference to value with key
+    //! \note Throws tk::Exception if key is not found
+    const T& at( const Key& key ) const {
+      auto i = this->locate( key );
+      if (i == this->m_slot.size()) Throw( "Key not found in FlatHashMap" );
+      return this->m_slot[i].second;
+    }
+};
+
+} // tk::
+
+#endif // FlatHash_h
@@ -0,0 +1,84 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ParallelFor.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Split a loop among worker threads within a chare
+  \details   Split a loop among worker threads within a chare. A range of
+    indices, e.g., mesh elements, edges, or points, is split into contiguous
+    chunks whose sizes are multiples of a grain size and the chunks are
+    processed by OpenMP threads concurrently. If the code is built without
+    OpenMP (ENABLE_OPENMP is not defined), or if a single thread is requested,
+    the whole range is processed by the calling thread. Since the chunks only
+    depend on the range, the grain size, and the number of threads, and not on
+    the scheduling of threads, a loop body that only writes data owned by its
+    own indices yields bitwise identical results for any number of threads.
+*/
+// *****************************************************************************
+#ifndef ParallelFor_h
+#define ParallelFor_h
+
+#include <algorithm>
+#include <exception>
+
+#include "QuinoaBuildConfig.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Process a range of indices by chunks assigned to worker threads
+//! \tparam F Callable with signature void(std::size_t b, std::size_t e),
+//!   processing the indices [b,e)
+//! \param[in] nthread Number of worker threads to use
+//! \param[in] begin First index of the range
+//! \param[in] end One past the last index of the range
+//! \param[in] grain Grain size: chunk boundaries are at begin + k*grain, so
+//!   that blocking within a chunk relative to its first index, e.g., by SIMD
+//!   block size, is the same as blocking within the whole range
+//! \param[in] f Loop body to call for each chunk
+//! \details At most nthread chunks are formed, each consisting of a whole
+//!   number of grains (except possibly the last one), distributed as evenly
+//!   as possible. The loop body is called concurrently for different chunks,
+//!   so it must only write data owned by the indices of its chunk. An
+//!   exception thrown by the loop body is rethrown on the calling thread.
+template< class F >
+void parallel_for( [[maybe_unused]] std::size_t nthread,
+                   std::size_t begin,
+                   std::size_t end,
+                   std::size_t grain,
+                   F&& f )
+{
+  Assert( grain > 0, "Grain size must be positive" );
+
+  if (begin >= end) return;
+
+  #ifdef ENABLE_OPENMP
+  auto nblock = (end - begin + grain - 1) / grain;
+  auto nchunk = std::min( std::max( nthread, std::size_t(1) ), nblock );
+  if (nchunk > 1) {
+    std::exception_ptr error;
+    #pragma omp parallel for num_threads(static_cast<int>(nchunk)) \
+                             schedule(static,1)
+    for (std::size_t c=0; c<nchunk; ++c) {
+      auto b = begin + c*nblock/nchunk*grain;
+      auto e = std::min( end, begin + (c+1)*nblock/nchunk*grain );
+      try {
+        f( b, e );
+      } catch (...) {
+        #pragma omp critical
+        if (!error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception( error );
+    return;
+  }
+  #endif
+
+  f( begin, end );
+}
+
+} // tk::
+
+#endif // ParallelFor_h
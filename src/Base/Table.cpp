@@ -13,6 +13,7 @@
 // *****************************************************************************
 
 #include <utility>
+#include <algorithm>
 #include <stddef.h>
 
 #include "Table.hpp"
@@ -30,7 +31,7 @@ tk::sample( tk::real x, const tk::Table& table )
 //!   no extrapolation is performed. If x falls between the first/lowest and the
 //!   last/largest value in the table, linear interpolation is used to compute a
 //!   sample between the two closest x values of the table around the abscissa
-//!   given.
+//!   given, which are found by binary search.
 //! \return Sampled value from discrete table
 //! \note The x column in the table is assumed to be in increasing order.
 //! \see walker::invhts_eq_A005H, walker::prod_A005H for example tables
@@ -39,16 +40,83 @@ tk::sample( tk::real x, const tk::Table& table )
   Assert( !table.empty(), "Empty table to sample from" );
 
   if (x < table.front().first) return table.front().second;
+  if (!(x < table.back().first)) return table.back().second;
 
-  for (std::size_t i=0; i<table.size()-1; ++i) {
-    if (table[i].first < x && x < table[i+1].first) {
-      auto t1 = table[i].first;
-      auto y1 = table[i].second;
-      auto t2 = table[i+1].first;
-      auto y2 = table[i+1].second;
-      return y1 + (y2-y1)/(t2-t1)*(x-t1);
-    }
+  auto u = std::upper_bound( begin(table), end(table), x,
+             []( tk::real a, const auto& r ){ return a < r.first; } );
+  const auto& l = *(u-1);
+  return l.second + (u->second-l.second)/(u->first-l.first)*(x-l.first);
+}
+
+tk::IndexedTable::IndexedTable( const tk::Table& table ) :
+  m_table( table ),
+  m_bin(),
+  m_x0( 0.0 ),
+  m_rdx( 0.0 )
+// *****************************************************************************
+//  Constructor: index table
+//! \param[in] table tk::Table to index
+//! \details The number of bins equals the number of table rows, so that for
+//!   uniformly spaced rows a bin contains at most two rows.
+// *****************************************************************************
+{
+  Assert( !m_table.empty(), "Empty table to index" );
+  Assert( std::is_sorted( begin(m_table), end(m_table),
+            []( const auto& a, const auto& b ){ return a.first < b.first; } ),
+          "Table abscissas must be in increasing order" );
+
+  m_x0 = m_table.front().first;
+  const auto L = m_table.back().first - m_x0;
+  if (!(L > 0.0)) return;
+
+  const auto nbin = m_table.size();
+  m_rdx = static_cast< tk::real >( nbin ) / L;
+  m_bin.resize( nbin + 1 );
+  std::size_t i = 0;
+  for (std::size_t b=0; b<=nbin; ++b) {
+    const auto xb = m_x0 + static_cast< tk::real >( b ) / m_rdx;
+    while (i+1 < m_table.size() && !(xb < m_table[i+1].first)) ++i;
+    m_bin[b] = i;
   }
+}
+
+tk::real
+tk::IndexedTable::operator()( tk::real x ) const
+// *****************************************************************************
+//  Sample the table at x
+//! \param[in] x Value of abscissa at which to sample y = f(x)
+//! \return Sampled value from discrete table, see tk::sample()
+// *****************************************************************************
+{
+  Assert( !m_table.empty(), "Empty table to sample from" );
+
+  const auto& t = m_table;
+  if (x < t.front().first) return t.front().second;
+  if (!(x < t.back().first)) return t.back().second;
 
-  return table.back().second;
+  // Find bin of x, then the first row above x among the rows of the bin
+  const auto b = std::min( static_cast< std::size_t >( (x - m_x0) * m_rdx ),
+                           m_bin.size() - 2 );
+  auto i = m_bin[b];
+  while (i > 0 && x < t[i].first) --i;         // guard against round-off
+  const auto last = std::min( m_bin[b+1] + 2, t.size() );
+  auto u = std::upper_bound( t.cbegin() + static_cast< std::ptrdiff_t >( i+1 ),
+                             t.cbegin() + static_cast< std::ptrdiff_t >( last ),
+                             x, []( tk::real a, const auto& r ){
+                               return a < r.first; } );
+  while (!(x < u->first)) ++u;                 // guard against round-off
+  const auto& l = *(u-1);
+  return l.second + (u->second-l.second)/(u->first-l.first)*(x-l.first);
+}
+
+void
+tk::IndexedTable::sample( std::size_t n, const tk::real* x, tk::real* y ) const
+// *****************************************************************************
+//  Sample the table at multiple abscissas
+//! \param[in] n Number of abscissas to sample at
+//! \param[in] x Array of n abscissas at which to sample y = f(x)
+//! \param[in,out] y Array of n sampled values from discrete table
+// *****************************************************************************
+{
+  for (std::size_t i=0; i<n; ++i) y[i] = (*this)( x[i] );
 }
@@ -8,7 +8,11 @@
   \brief     Basic functionality for storing and sampling a discrete y = f(x)
              function
   \details   Basic functionality for storing and sampling a discrete y = f(x)
-             function.
+             function. tk::sample() samples a table by binary search.
+             tk::IndexedTable augments a table by an index of uniform bins
+             over its abscissa, so that sampling costs O(1) for tables with
+             (nearly) uniformly spaced rows, which makes it cheap enough to
+             sample a table for every particle.
 */
 // *****************************************************************************
 #ifndef Table_h
@@ -27,6 +31,41 @@ using Table = std::vector< std::pair< tk::real, tk::real > >;
 //! Sample a discrete y = f(x) function at x
 tk::real sample( tk::real x, const tk::Table& table );
 
+//! Discrete y = f(x) function with an index for fast sampling
+//! \details The abscissa range of the table is divided into uniform bins and
+//!   for each bin the index of the table row at or below the left end of the
+//!   bin is stored. Sampling at x then only needs to search the rows within
+//!   the bin x falls into. The results are the same as those of tk::sample().
+class IndexedTable {
+
+  public:
+    //! Default constructor: empty table
+    explicit IndexedTable() : m_table(), m_bin(), m_x0( 0.0 ), m_rdx( 0.0 ) {}
+
+    //! Constructor: index table
+    explicit IndexedTable( const tk::Table& table );
+
+    //! Constant accessor to the underlying table
+    //! \return Constant reference to the underlying table
+    const tk::Table& table() const noexcept { return m_table; }
+
+    //! Sample the table at x
+    tk::real operator()( tk::real x ) const;
+
+    //! Sample the table at multiple abscissas
+    void sample( std::size_t n, const tk::real* x, tk::real* y ) const;
+
+  private:
+    //! Table of the discrete function
+    tk::Table m_table;
+    //! Index of the table row at or below the left end of each bin
+    std::vector< std::size_t > m_bin;
+    //! Abscissa of the first table row
+    tk::real m_x0;
+    //! Inverse bin size
+    tk::real m_rdx;
+};
+
 } // tk::
 
 #endif // Table_h
@@ -305,6 +305,39 @@ determinant( const std::array< std::array< tk::real, 3 >, 3 >& a )
          + a[0][2] * (a[1][0]*a[2][1]-a[1][1]*a[2][0]) );
 }
 
+//! Compute the inverse of 3x3 matrix
+//!  \param[in] a 3x3 matrix
+//!  \return Inverse of the 3x3 matrix, computed as its adjugate divided by its
+//!    determinant
+inline std::array< std::array< tk::real, 3 >, 3 >
+inverse( const std::array< std::array< tk::real, 3 >, 3 >& a )
+{
+  auto de = determinant( a );
+
+  return {{ {{ (a[1][1]*a[2][2]-a[1][2]*a[2][1]) / de,
+              -(a[0][1]*a[2][2]-a[0][2]*a[2][1]) / de,
+               (a[0][1]*a[1][2]-a[0][2]*a[1][1]) / de }},
+            {{-(a[1][0]*a[2][2]-a[1][2]*a[2][0]) / de,
+               (a[0][0]*a[2][2]-a[0][2]*a[2][0]) / de,
+              -(a[0][0]*a[1][2]-a[0][2]*a[1][0]) / de }},
+            {{ (a[1][0]*a[2][1]-a[1][1]*a[2][0]) / de,
+              -(a[0][0]*a[2][1]-a[0][1]*a[2][0]) / de,
+               (a[0][0]*a[1][1]-a[0][1]*a[1][0]) / de }} }};
+}
+
+//! Multiply a 3x3 matrix with a 3x1 vector
+//!  \param[in] a 3x3 matrix
+//!  \param[in] b 3x1 vector
+//!  \return 3x1 vector a * b
+inline std::array< tk::real, 3 >
+matvec( const std::array< std::array< tk::real, 3 >, 3 >& a,
+        const std::array< tk::real, 3 >& b )
+{
+  return {{ a[0][0]*b[0] + a[0][1]*b[1] + a[0][2]*b[2],
+            a[1][0]*b[0] + a[1][1]*b[1] + a[1][2]*b[2],
+            a[2][0]*b[0] + a[2][1]*b[1] + a[2][2]*b[2] }};
+}
+
 //! Solve a 3x3 system of equations using Cramer's rule
 //!  \param[in] a 3x3 lhs matrix
 //!  \param[in] b 3x1 rhs matrix
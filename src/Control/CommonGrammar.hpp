@@ -146,6 +146,7 @@ namespace grm {
     SKIPBCWRONG,        //!< Skip BC incorrectly configured
     NONDISJOINTBC,      //!< Different BC types assigned to the same side set
     WRONGSIZE,          //!< Size of parameter vector incorrect
+    FLUXSCHEME,         //!< Flux function not supported by scheme
     HYDROTIMESCALES,    //!< Missing required hydrotimescales vector
     HYDROPRODUCTIONS,   //!< Missing required hydroproductions vector
     POSITION_DEPVAR,    //!< Missing required position model dependent variable
@@ -404,6 +405,11 @@ namespace grm {
       "to the same side set." },
     { MsgKey::WRONGSIZE, "Error in the preceding line or block. The size of "
       "the parameter vector is incorrect." },
+    { MsgKey::FLUXSCHEME, "The flux function selected for compflow is not "
+      "supported by the discretization scheme selected. ALECG supports "
+      "'rusanov' and 'hllc', DG does not support 'rusanov'. If no flux is "
+      "given, the default depends on the scheme, so specify the scheme before "
+      "the equation block." },
     { MsgKey::HYDROTIMESCALES, "Error in the preceding line or block. "
       "Specification of a 'hydrotimescales' vector missing." },
     { MsgKey::HYDROPRODUCTIONS, "Error in the preceding line or block. "
@@ -1756,6 +1762,9 @@ namespace grm {
                                                 tag::stat >,
                                          pegtl::alpha >,
                                 precision< use, tag::stat >,
+                                process< use< kw::onepass >,
+                                         Store< tag::discr, tag::onepass >,
+                                         pegtl::alpha >,
                                 parse_expectations > > {};
 
   //! Parse diagnostics ... end block
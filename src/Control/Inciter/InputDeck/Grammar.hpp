@@ -243,10 +243,17 @@ namespace grm {
       if (sysfct.empty() || sysfct.size() != neq.get< eq >())
         sysfct.push_back( 1 );
 
-      // Set default flux to HLLC if not specified
+      // Set default flux if not specified: Rusanov for node-centered schemes,
+      // HLLC for DG
       auto& flux = stack.template get< tag::param, eq, tag::flux >();
-      if (flux.empty() || flux.size() != neq.get< eq >())
-        flux.push_back( inciter::ctr::FluxType::HLLC );
+      if (flux.empty() || flux.size() != neq.get< eq >()) {
+        auto scheme = stack.template get< tag::discr, tag::scheme >();
+        if (scheme == inciter::ctr::SchemeType::DiagCG ||
+            scheme == inciter::ctr::SchemeType::ALECG)
+          flux.push_back( inciter::ctr::FluxType::Rusanov );
+        else
+          flux.push_back( inciter::ctr::FluxType::HLLC );
+      }
 
       // Verify that sysfctvar variables are within bounds (if specified) and
       // defaults if not
@@ -689,6 +696,17 @@ namespace grm {
       if (rc < 1 || rc > ncomps.nprop())
         Message< Stack, ERROR, MsgKey::LARGECOMP >( stack, in );
 
+      // Error out if a compflow flux is not supported by the scheme selected
+      const auto scheme = stack.template get< tag::discr, tag::scheme >();
+      for (auto f : stack.template get< tag::param, tag::compflow, tag::flux >())
+        if ( (scheme == inciter::ctr::SchemeType::ALECG &&
+              f != inciter::ctr::FluxType::Rusanov &&
+              f != inciter::ctr::FluxType::HLLC) ||
+             (scheme != inciter::ctr::SchemeType::DiagCG &&
+              scheme != inciter::ctr::SchemeType::ALECG &&
+              f == inciter::ctr::FluxType::Rusanov) )
+          Message< Stack, ERROR, MsgKey::FLUXSCHEME >( stack, in );
+
       // Ensure no different BC types are assigned to the same side set
       using PDETypes = inciter::ctr::parameters::Keys;
       using BCTypes = inciter::ctr::bc::Keys;
@@ -1125,6 +1143,7 @@ namespace deck {
            tk::grm::discrparam< use, kw::cfl, tag::cfl >,
            tk::grm::discrparam< use, kw::residual, tag::residual >,
            tk::grm::discrparam< use, kw::rescomp, tag::rescomp >,
+           tk::grm::discrparam< use, kw::nthread, tag::nthread >,
            tk::grm::process< use< kw::fcteps >,
                              tk::grm::Store< tag::discr, tag::fcteps > >,
            tk::grm::process< use< kw::fctclip >,
@@ -1152,6 +1171,8 @@ namespace deck {
                                      tag::scheme >,
                                    tk::grm::configure_scheme >,
            discroption< use, kw::limiter, inciter::ctr::Limiter, tag::limiter >,
+           discroption< use, kw::reorder_method, inciter::ctr::Reorder,
+                        tag::reorder_method >,
            tk::grm::discrparam< use, kw::cweight, tag::cweight >
          > {};
 
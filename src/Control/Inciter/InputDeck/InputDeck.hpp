@@ -182,9 +182,15 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::sysfctvar
                                  , kw::pelocal_reorder
                                  , kw::operator_reorder
+                                 , kw::reorder_method
+                                 , kw::access
+                                 , kw::rcm
+                                 , kw::hilbert
+                                 , kw::morton
                                  , kw::steady_state
                                  , kw::residual
                                  , kw::rescomp
+                                 , kw::nthread
                                  , kw::amr
                                  , kw::ale
                                  , kw::meshvelocity
@@ -233,6 +239,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::upwind
                                  , kw::ausm
                                  , kw::hll
+                                 , kw::rusanov
                                  , kw::limiter
                                  , kw::cweight
                                  , kw::nolimiter
@@ -293,9 +300,11 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
         std::numeric_limits< tk::real >::epsilon();
       get< tag::discr, tag::pelocal_reorder >() = false;
       get< tag::discr, tag::operator_reorder >() = false;
+      get< tag::discr, tag::reorder_method >() = ReorderType::ACCESS;
       get< tag::discr, tag::steady_state >() = false;
       get< tag::discr, tag::residual >() = 1.0e-8;
       get< tag::discr, tag::rescomp >() = 1;
+      get< tag::discr, tag::nthread >() = 1;
       get< tag::discr, tag::scheme >() = SchemeType::DiagCG;
       get< tag::discr, tag::ndof >() = 1;
       get< tag::discr, tag::limiter >() = LimiterType::NOLIMITER;
@@ -43,6 +43,7 @@ class Flux : public tk::Toggle< FluxType > {
                                   , kw::upwind
                                   , kw::ausm
                                   , kw::hll
+                                  , kw::rusanov
                                   >;
 
     //! \brief Options constructor
@@ -58,6 +59,7 @@ class Flux : public tk::Toggle< FluxType > {
         , { FluxType::UPWIND, kw::upwind::name() }
         , { FluxType::AUSM, kw::ausm::name() }
         , { FluxType::HLL, kw::hll::name() }
+        , { FluxType::Rusanov, kw::rusanov::name() }
         },
         //! keywords -> Enums
         { { kw::laxfriedrichs::string(), FluxType::LaxFriedrichs }
@@ -65,6 +67,7 @@ class Flux : public tk::Toggle< FluxType > {
         , { kw::upwind::string(), FluxType::UPWIND }
         , { kw::ausm::string(), FluxType::AUSM }
         , { kw::hll::string(), FluxType::HLL }
+        , { kw::rusanov::string(), FluxType::Rusanov }
         } )
     {}
 
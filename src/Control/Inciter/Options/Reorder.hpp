@@ -0,0 +1,68 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Inciter/Options/Reorder.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Local mesh node reordering options for inciter
+  \details   Local mesh node reordering options for inciter
+*/
+// *****************************************************************************
+#ifndef ReorderOptions_h
+#define ReorderOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.hpp"
+#include "Keywords.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+namespace ctr {
+
+//! Local mesh node reordering types
+enum class ReorderType : uint8_t { ACCESS
+                                 , RCM
+                                 , HILBERT
+                                 , MORTON };
+
+//! Pack/Unpack ReorderType: forward overload to generic enum class packer
+inline void operator|( PUP::er& p, ReorderType& e ) { PUP::pup( p, e ); }
+
+//! \brief Reorder options: outsource to base templated on enum type
+class Reorder : public tk::Toggle< ReorderType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::access
+                                  , kw::rcm
+                                  , kw::hilbert
+                                  , kw::morton
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit Reorder() :
+      tk::Toggle< ReorderType >(
+        //! Group, i.e., options, name
+        kw::reorder_method::name(),
+        //! Enums -> names (if defined, policy codes, if not, name)
+        { { ReorderType::ACCESS, kw::access::name() },
+          { ReorderType::RCM, kw::rcm::name() },
+          { ReorderType::HILBERT, kw::hilbert::name() },
+          { ReorderType::MORTON, kw::morton::name() } },
+        //! keywords -> Enums
+        { { kw::access::string(), ReorderType::ACCESS },
+          { kw::rcm::string(), ReorderType::RCM },
+          { kw::hilbert::string(), ReorderType::HILBERT },
+          { kw::morton::string(), ReorderType::MORTON } } )
+    {}
+
+};
+
+} // ctr::
+} // inciter::
+
+#endif // ReorderOptions_h
@@ -28,6 +28,7 @@
 #include "Inciter/Options/AMRError.hpp"
 #include "Inciter/Options/PrefIndicator.hpp"
 #include "Inciter/Options/MeshVelocity.hpp"
+#include "Inciter/Options/Reorder.hpp"
 #include "Options/PartitioningAlgorithm.hpp"
 #include "Options/TxtFloatFormat.hpp"
 #include "Options/FieldFile.hpp"
@@ -100,9 +101,11 @@ using discretization = tk::TaggedTuple< brigand::list<
   , tag::cfl,    kw::cfl::info::expect::type    //!< CFL coefficient
   , tag::pelocal_reorder, bool                  //!< PE-locality reordering
   , tag::operator_reorder, bool                 //!< Operator-access reordering
+  , tag::reorder_method, inciter::ctr::ReorderType //!< Reordering method
   , tag::steady_state, bool                     //!< March to steady state
   , tag::residual, kw::residual::info::expect::type //!< Convergence residual
   , tag::rescomp, kw::rescomp::info::expect::type //!< Convergence residual comp
+  , tag::nthread, kw::nthread::info::expect::type //!< Threads per chare
   , tag::fct,    bool                           //!< FCT on/off
   , tag::fctclip,bool                           //!< FCT clipping limiter on/off
   , tag::fcteps, kw::fcteps::info::expect::type //!< FCT small number
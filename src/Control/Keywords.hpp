@@ -1851,6 +1851,27 @@ struct statistics_info {
 };
 using statistics = keyword< statistics_info, TAOCPP_PEGTL_STRING("statistics") >;
 
+struct onepass_info {
+  static std::string name() { return "onepass"; }
+  static std::string shortDescription() { return
+    "Estimate central moments in a single pass over the particles"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in the statistics ... end block as "onepass true"
+    (or false) to estimate (or not) central moments from the sums of products of
+    the variables accumulated together with the ordinary moments. This
+    saves the second pass over all particles otherwise required to sum the
+    products of fluctuations about the means. To retain accuracy if the means
+    are large compared to the fluctuations, the variables are summed about a
+    reference value taken from a particle on each PE. Default: false.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using onepass = keyword< onepass_info, TAOCPP_PEGTL_STRING("onepass") >;
+
 struct history_output_info {
   static std::string name() { return "history_output"; }
   static std::string shortDescription() { return
@@ -4413,7 +4434,7 @@ struct operator_reorder_info {
     R"(This keyword is used in inciter as a keyword in the inciter...end block
     as "operator_reorder on" (or off) to do (or not do) a local mesh node
     reordering based on the PDE operator access pattern. This reordering is
-    optional.)";
+    optional. See also reorder_method to select other reordering methods.)";
   }
   struct expect {
     using type = bool;
@@ -4424,6 +4445,74 @@ struct operator_reorder_info {
 using operator_reorder =
   keyword< operator_reorder_info, TAOCPP_PEGTL_STRING("operator_reorder") >;
 
+struct access_info {
+  static std::string name() { return "access"; }
+  static std::string shortDescription() { return
+    "Select operator-access-pattern mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the mesh node reordering that numbers
+    mesh nodes in the order they are first accessed by the PDE operators. See
+    Control/Inciter/Options/Reorder.hpp for other valid options.)"; }
+};
+using access = keyword< access_info, TAOCPP_PEGTL_STRING("access") >;
+
+struct rcm_info {
+  static std::string name() { return "rcm"; }
+  static std::string shortDescription() { return
+    "Select reverse Cuthill-McKee mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the reverse Cuthill-McKee mesh node
+    reordering, which reduces the bandwidth of the node adjacency matrix.
+    See Control/Inciter/Options/Reorder.hpp for other valid options.)"; }
+};
+using rcm = keyword< rcm_info, TAOCPP_PEGTL_STRING("rcm") >;
+
+struct hilbert_info {
+  static std::string name() { return "hilbert"; }
+  static std::string shortDescription() { return
+    "Select Hilbert space-filling-curve mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the mesh node reordering that numbers
+    mesh nodes along a Hilbert space-filling curve through the node
+    coordinates. See Control/Inciter/Options/Reorder.hpp for other valid
+    options.)"; }
+};
+using hilbert = keyword< hilbert_info, TAOCPP_PEGTL_STRING("hilbert") >;
+
+struct morton_info {
+  static std::string name() { return "morton"; }
+  static std::string shortDescription() { return
+    "Select Morton space-filling-curve mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the mesh node reordering that numbers
+    mesh nodes along a Morton (Z-order) space-filling curve through the node
+    coordinates. See Control/Inciter/Options/Reorder.hpp for other valid
+    options.)"; }
+};
+using morton = keyword< morton_info, TAOCPP_PEGTL_STRING("morton") >;
+
+struct reorder_method_info {
+  static std::string name() { return "reorder_method"; }
+  static std::string shortDescription() { return
+    "Select local mesh node reordering method"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    to select the method used for local mesh node reordering if
+    operator_reorder is enabled. The default is 'access'. See
+    Control/Inciter/Options/Reorder.hpp for valid options.)"; }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + access::string() + "\' | \'"
+                  + rcm::string() + "\' | \'"
+                  + hilbert::string() + "\' | \'"
+                  + morton::string() + '\'';
+    }
+  };
+};
+using reorder_method =
+  keyword< reorder_method_info, TAOCPP_PEGTL_STRING("reorder_method") >;
+
 struct steady_state_info {
   static std::string name() { return "steady_state"; }
   static std::string shortDescription() { return "March to steady state"; }
@@ -4473,6 +4562,28 @@ struct rescomp_info {
 };
 using rescomp = keyword< rescomp_info, TAOCPP_PEGTL_STRING("rescomp") >;
 
+struct nthread_info {
+  static std::string name() { return "nthread"; }
+  static std::string shortDescription() { return
+    "Number of worker threads per chare"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the number of worker threads each chare
+    uses to compute the right-hand side of its PDEs as well as to limit and
+    reconstruct the solution. Loops over mesh entities are split into chunks
+    that are processed by worker threads concurrently. Contributions to mesh
+    nodes are gathered by their owner nodes in a fixed order, so the results
+    are bitwise identical for any number of threads. Threads are only used if
+    the code was built with OpenMP enabled (ENABLE_OPENMP), otherwise this
+    setting is ignored. The default is 1, i.e., no threading within a chare.)";
+  }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "uint"; }
+  };
+};
+using nthread = keyword< nthread_info, TAOCPP_PEGTL_STRING("nthread") >;
+
 struct group_info {
   static std::string name() { return "group"; }
   static std::string shortDescription() { return
@@ -6575,13 +6686,28 @@ struct hll_info {
 };
 using hll = keyword< hll_info, TAOCPP_PEGTL_STRING("hll") >;
 
+struct rusanov_info {
+  static std::string name() { return "Rusanov"; }
+  static std::string shortDescription() { return
+    "Select the Rusanov flux function"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the Rusanov flux function used for
+    edge-based continuous Galerkin (ALECG) spatial discretization used in
+    inciter. It is only used for single-material compressible flow with ALECG,
+    for which it is the default. See Control/Inciter/Options/Flux.hpp for other
+    valid options.)"; }
+};
+using rusanov = keyword< rusanov_info, TAOCPP_PEGTL_STRING("rusanov") >;
+
 struct flux_info {
   static std::string name() { return "Flux function"; }
   static std::string shortDescription() { return
     "Select flux function"; }
   static std::string longDescription() { return
     R"(This keyword is used to select a flux function, used for
-    discontinuous Galerkin (DG) spatial discretization used in inciter. See
+    discontinuous Galerkin (DG) and edge-based continuous Galerkin (ALECG)
+    spatial discretizations used in inciter. For single-material compressible
+    flow with ALECG, 'rusanov' (default) and 'hllc' are valid. See
     Control/Inciter/Options/Flux.hpp for valid options.)"; }
   struct expect {
     static std::string description() { return "string"; }
@@ -6590,7 +6716,8 @@ struct flux_info {
                   + hllc::string() + "\' | \'"
                   + upwind::string() + "\' | \'"
                   + ausm::string() + "\' | \'"
-                  + hll::string() + '\'';
+                  + hll::string() + "\' | \'"
+                  + rusanov::string() + '\'';
     }
   };
 };
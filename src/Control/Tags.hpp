@@ -64,6 +64,8 @@ struct pelocal_reorder {
   static std::string name() { return "pelocal_reorder"; } };
 struct operator_reorder {
   static std::string name() { return "operator_reorder"; } };
+struct reorder_method {
+  static std::string name() { return "reorder_method"; } };
 struct steady_state {
   static std::string name() { return "steady_state"; } };
 struct residual { static std::string name() { return "residual"; } };
@@ -94,6 +96,7 @@ struct ordinary {};
 struct central {};
 struct binsize { static std::string name() { return "binsize"; } };
 struct extent { static std::string name() { return "extent"; } };
+struct onepass { static std::string name() { return "onepass"; } };
 struct dirichlet { static std::string name() { return "dirichlet"; } };
 struct mixdirichlet { static std::string name() { return "mixdirichlet"; } };
 struct gendir { static std::string name() { return "gendir"; } };
@@ -232,6 +235,7 @@ struct farfield_velocity {
 struct bcfarfield { static std::string name() { return "bcfarfield"; } };
 struct component { static std::string name() { return "component"; } };
 struct rescomp { static std::string name() { return "residual component"; } };
+struct nthread { static std::string name() { return "nthread"; } };
 struct interval { static std::string name() { return "interval"; } };
 struct cmd { static std::string name() { return "cmd"; } };
 struct param { static std::string name() { return "param"; } };
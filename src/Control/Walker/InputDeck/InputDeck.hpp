@@ -55,6 +55,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::depvar
                                  , kw::title
                                  , kw::statistics
+                                 , kw::onepass
                                  , kw::interval
                                  , kw::pdfs
                                  , kw::filetype
@@ -250,6 +251,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
         std::numeric_limits< kw::nstep::info::expect::type >::max();
       get< tag::discr, tag::term >() = 1.0;
       get< tag::discr, tag::dt >() = 0.5;
+      get< tag::discr, tag::onepass >() = false;
       // Default txt floating-point output precision in digits
       get< tag::prec, tag::stat >() = std::cout.precision();
       get< tag::prec, tag::pdf >() = std::cout.precision();
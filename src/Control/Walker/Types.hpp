@@ -53,6 +53,7 @@ using discretization = tk::TaggedTuple< brigand::list<
   , tag::dt,        kw::dt::info::expect::type      //!< Size of time step
   , tag::binsize,   std::vector< std::vector< tk::real > >  //!< PDF binsizes
   , tag::extent,    std::vector< std::vector< tk::real > >  //!< PDF extents
+  , tag::onepass,   bool            //!< One-pass central moment estimation
 > >;
 
 //! ASCII output floating-point precision in digits
@@ -213,11 +213,14 @@ class MixMassFractionBeta {
     //! \param[in] dt Time step size
     //! \param[in] t Physical time of the simulation
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] rnd Buffer for Gaussian random numbers, reused across
+    //!   time steps
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real t,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& rnd )
     {
       // Update SDE coefficients
       coeff.update( m_depvar, m_dissipation_depvar, m_velocity_depvar,
@@ -227,11 +230,15 @@ class MixMassFractionBeta {
       const auto eps = std::numeric_limits< tk::real >::epsilon();
 
       // Advance particles
+      // Generate Gaussian random numbers with zero mean and unit variance for
+      // all particles at once
       const auto npar = particles.nunk();
+      rnd.resize( npar*m_ncomp );
+      m_rng.gaussian( stream, npar*m_ncomp, rnd.data() );
+
       for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        // Access Gaussian random numbers of particle
+        const tk::real* dW = rnd.data() + p*m_ncomp;
 
         // Access coupled particle velocity
         tk::real u = 0.0, v = 0.0, w = 0.0;
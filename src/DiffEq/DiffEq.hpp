@@ -18,6 +18,7 @@
 #define DiffEq_h
 
 #include <string>
+#include <vector>
 #include <functional>
 #include <memory>
 
@@ -80,8 +81,9 @@ class DiffEq {
                   int stream,
                   tk::real dt,
                   tk::real t,
-                  const std::map< tk::ctr::Product, tk::real >& moments ) const
-    { self->advance( particles, stream, dt, t, moments ); }
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& rnd ) const
+    { self->advance( particles, stream, dt, t, moments, rnd ); }
 
     //! Copy assignment
     DiffEq& operator=( const DiffEq& x )
@@ -106,7 +108,8 @@ class DiffEq {
                             int,
                             tk::real,
                             tk::real,
-                            const std::map< tk::ctr::Product, tk::real >& ) = 0;
+                            const std::map< tk::ctr::Product, tk::real >&,
+                            std::vector< tk::real >& ) = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -121,8 +124,9 @@ class DiffEq {
                     int stream,
                     tk::real dt,
                     tk::real t,
-                    const std::map< tk::ctr::Product, tk::real >& moments )
-      override { data.advance( particles, stream, dt, t, moments ); }
+                    const std::map< tk::ctr::Product, tk::real >& moments,
+                    std::vector< tk::real >& rnd )
+      override { data.advance( particles, stream, dt, t, moments, rnd ); }
       T data;
     };
 
@@ -113,22 +113,29 @@ class Dirichlet {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] rnd Buffer for Gaussian random numbers, reused across
+    //!   time steps
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& rnd )
     {
+      // Generate Gaussian random numbers with zero mean and unit variance for
+      // all particles at once
       const auto npar = particles.nunk();
+      rnd.resize( npar*m_ncomp );
+      m_rng.gaussian( stream, npar*m_ncomp, rnd.data() );
+
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Compute Nth scalar
         tk::real yn = 1.0 - particles(p, 0, m_offset);
         for (ncomp_t i=1; i<m_ncomp; ++i)
           yn -= particles( p, i, m_offset );
 
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        // Access Gaussian random numbers of particle
+        const tk::real* dW = rnd.data() + p*m_ncomp;
 
         // Advance first m_ncomp (K=N-1) scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
@@ -150,11 +150,14 @@ class MixDirichlet {
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] rnd Buffer for Gaussian random numbers, reused across
+    //!   time steps
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& rnd )
     {
       // Update SDE coefficients
       coeff.update( m_depvar, m_ncomp, m_norm, DENSITY_OFFSET, VOLUME_OFFSET,
@@ -164,11 +167,15 @@ class MixDirichlet {
       feholdexcept( &fe );
 
       // Advance particles
+      // Generate Gaussian random numbers with zero mean and unit variance for
+      // all particles at once
       const auto npar = particles.nunk();
+      rnd.resize( npar*m_ncomp );
+      m_rng.gaussian( stream, npar*m_ncomp, rnd.data() );
+
       for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        // Access Gaussian random numbers of particle
+        const tk::real* dW = rnd.data() + p*m_ncomp;
 
         // Advance all m_ncomp (=N=K+1) scalars
         auto& yn = particles( p, m_ncomp, m_offset );
@@ -89,11 +89,14 @@ class Dissipation {
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] rnd Buffer for Gaussian random numbers, reused across
+    //!   time steps
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& rnd )
     {
       using tk::ctr::lookup;
 
@@ -126,11 +129,15 @@ class Dissipation {
       // Update source based on coefficients policy
       Coefficients::src( Som );
 
+      // Generate Gaussian random numbers with zero mean and unit variance for
+      // all particles at once
       const auto npar = particles.nunk();
+      rnd.resize( npar*m_ncomp );
+      m_rng.gaussian( stream, npar*m_ncomp, rnd.data() );
+
       for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate a Gaussian random number with zero mean and unit variance
-        tk::real dW;
-        m_rng.gaussian( stream, m_ncomp, &dW );
+        // Access Gaussian random number of particle
+        tk::real dW = rnd[ p*m_ncomp ];
         // Advance particle frequency
         tk::real& Op = particles( p, 0, m_offset );
         tk::real d = 2.0*m_c3*m_c4*O*O*Op*dt;
@@ -83,7 +83,8 @@ class Position {
                   int,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& )
     {
       const auto npar = particles.nunk();
       for (auto p=decltype(npar){0}; p<npar; ++p) {
@@ -138,11 +138,14 @@ class Velocity {
     //! \param[in] dt Time step size
     //! \param[in] t Physical time of the simulation
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] rnd Buffer for Gaussian random numbers, reused across
+    //!   time steps
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real t,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& rnd )
     {
       using ctr::DepvarType;
       const auto epsilon = std::numeric_limits< tk::real >::epsilon();
@@ -195,11 +198,15 @@ class Velocity {
         }
       }
 
+      // Generate Gaussian random numbers with zero mean and unit variance for
+      // all particles at once
       const auto npar = particles.nunk();
+      rnd.resize( npar*m_ncomp );
+      m_rng.gaussian( stream, npar*m_ncomp, rnd.data() );
+
       for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        // Access Gaussian random numbers of particle
+        const tk::real* dW = rnd.data() + p*m_ncomp;
         // Access particle velocity
         tk::real& Up = particles( p, 0, m_offset );
         tk::real& Vp = particles( p, 1, m_offset );
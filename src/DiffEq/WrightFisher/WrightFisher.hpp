@@ -118,16 +118,26 @@ class WrightFisher {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] rnd Buffer for Gaussian random numbers, reused across
+    //!   time steps
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& rnd )
     {
       // Compute sum of coefficients
       const auto omega = std::accumulate( begin(m_omega), end(m_omega), 0.0 );
       const auto npar = particles.nunk();
 
+      // Generate Gaussian random numbers with zero mean and unit variance for
+      // all particles at once: the lower triangle of the first m_ncomp-1
+      // scalars needs (m_ncomp-1)*m_ncomp/2 numbers per particle
+      const auto nrnd = (m_ncomp-1)*m_ncomp/2;
+      rnd.resize( npar*nrnd );
+      m_rng.gaussian( stream, npar*nrnd, rnd.data() );
+
       #if defined(__clang__)
         #pragma clang diagnostic push
         #pragma clang diagnostic ignored "-Wvla"
@@ -220,6 +230,7 @@ class WrightFisher {
 
         // Advance the first m_ncomp (N-1) scalars
         if (info == 0) {
+          const tk::real* dW = rnd.data() + p*nrnd;
           ncomp_t i = 0;
           for (i=0; i<m_ncomp-1; ++i) {
             tk::real& par = particles( p, i, m_offset );
@@ -228,11 +239,7 @@ class WrightFisher {
             // Advance first m_ncomp (K=N-1) particles with Cholesky-decomposed
             // lower triangle (diffusion matrix)
             for (ncomp_t j=0; j<m_ncomp-1; ++j)
-              if (j<=i) {
-                tk::real dW;
-                m_rng.gaussian( stream, 1, &dW );
-                par += B[i][j] * sqrt(dt) * dW;
-              }
+              if (j<=i) par += B[i][j] * sqrt(dt) * (*dW++);
           }
           // Compute the (N-1)th scalar from unit-sum
           tk::real& par = particles( p, i, m_offset );
@@ -12,7 +12,6 @@
 // *****************************************************************************
 
 #include <array>
-#include <istream>
 #include <string>
 #include <vector>
 #include <cstddef>
@@ -31,26 +30,21 @@ ASCMeshReader::readHeader()
 //  Read ASC mesh header
 // *****************************************************************************
 {
-  std::string s;
-
   // ndim
-  m_inFile >> s;
+  auto s = m_tok.word();
   Assert( s == "*ndim", "Invalid keyword, expected: '*ndim'" );
-  int ndim;
-  m_inFile >> ndim;
+  [[maybe_unused]] auto ndim = m_tok.integer< int >();
   Assert( ndim == 3, "Only 3D meshes are supported" );
 
   // numNodeSets (throw away)
-  m_inFile >> s;
+  s = m_tok.word();
   Assert( s == "*numNodeSets", "Invalid keyword, expected: '*numNodeSets'" );
-  int nn;
-  m_inFile >> nn;
+  m_tok.integer< int >();
 
   // numSideSets (throw away)
-  m_inFile >> s;
+  s = m_tok.word();
   Assert( s == "*numSideSets", "Invalid keyword, expected: '*numSideSets'" );
-  int ns;
-  m_inFile >> ns;
+  m_tok.integer< int >();
 }
 
 void
@@ -75,25 +69,33 @@ ASCMeshReader::readNodes( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
-  std::string s;
-
-  m_inFile >> s;
+  auto s = m_tok.word();
   Assert( s == "*nodes", "Invalid keyword, expected: '*nodes'" );
-  int nnode;
-  m_inFile >> nnode;
+  auto nnode = m_tok.integer< int >();
   ErrChk( nnode > 0,
           "Number of nodes must be greater than zero in file " + m_filename  );
+  m_tok.skipLine();  // finish reading the line
+
+  auto n = static_cast< std::size_t >( nnode );
+  auto& x = mesh.x();
+  auto& y = mesh.y();
+  auto& z = mesh.z();
+  x.resize( n );
+  y.resize( n );
+  z.resize( n );
 
   // Read in node coordinates: x-coord y-coord z-coord, ignore node IDs, assume
   // sorted
-  for (int i=0; i<nnode; ++i) {
-    int n;
-    tk::real x, y, z;
-    m_inFile >> n >> x >> y >> z;
-    mesh.x().push_back( x );
-    mesh.y().push_back( y );
-    mesh.z().push_back( z );
-  }
+  m_tok.parallel( n,
+    [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+      for (auto i=first; i<last; ++i) {
+        c.integer< int >();
+        x[i] = c.real();
+        y[i] = c.real();
+        z[i] = c.real();
+        c.skipLine();
+      }
+    } );
 }
 
 void
@@ -103,28 +105,37 @@ ASCMeshReader::readElements( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
-  std::string s;
-
-  m_inFile >> s;
+  auto s = m_tok.word();
   Assert( s == "*cells", "Invalid keyword, expected: '*cells'" );
 
-  int nel;
-  m_inFile >> nel;
+  auto nel = m_tok.integer< int >();
   ErrChk( nel > 0,
           "Number of cells must be greater than zero in file " + m_filename  );
+  m_tok.skipLine();  // finish reading the line
 
   // Read in tetrahedra element tags and connectivity
-  for (int i=0; i<nel; ++i) {
-    int a, b, c;
-    std::array< std::size_t, 4 > n;
-    // ignore cell id, a, b
-    m_inFile >> a >> b >> c >> n[3] >> n[0] >> n[1] >> n[2];
-    mesh.tetinpoel().push_back( n[0] );
-    mesh.tetinpoel().push_back( n[1] );
-    // switch nodes 2 and 3 to enforce positive volume
-    mesh.tetinpoel().push_back( n[3] );
-    mesh.tetinpoel().push_back( n[2] );
-  }
+  auto& inpoel = mesh.tetinpoel();
+  inpoel.resize( static_cast< std::size_t >( nel ) * 4 );
+  m_tok.parallel( static_cast< std::size_t >( nel ),
+    [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+      for (auto i=first; i<last; ++i) {
+        // ignore cell id, a, b
+        c.integer< int >();
+        c.integer< int >();
+        c.integer< int >();
+        std::array< std::size_t, 4 > n;
+        n[3] = c.integer< std::size_t >();
+        n[0] = c.integer< std::size_t >();
+        n[1] = c.integer< std::size_t >();
+        n[2] = c.integer< std::size_t >();
+        inpoel[i*4+0] = n[0];
+        inpoel[i*4+1] = n[1];
+        // switch nodes 2 and 3 to enforce positive volume
+        inpoel[i*4+2] = n[3];
+        inpoel[i*4+3] = n[2];
+        c.skipLine();
+      }
+    } );
 
   // Shift node IDs to start from zero
   shiftToZero( mesh.tetinpoel() );
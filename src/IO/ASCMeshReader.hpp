@@ -16,6 +16,7 @@
 #include <iosfwd>
 
 #include "Reader.hpp"
+#include "MmapTokenizer.hpp"
 
 namespace tk {
 
@@ -29,12 +30,14 @@ class ASCMeshReader : public Reader {
   public:
     //! Constructor
     explicit ASCMeshReader( const std::string& filename ) :
-      Reader( filename ) {}
+      Reader( filename ), m_tok( filename ) {}
 
     //! Read ASC mesh
     void readMesh( UnsMesh& mesh );
 
   private:
+    MmapTokenizer m_tok;        //!< Memory-mapped file tokenizer
+
     //! Read header
     void readHeader();
 
@@ -11,6 +11,7 @@
 // *****************************************************************************
 
 #include <numeric>
+#include <algorithm>
 
 #include "NoWarning/exodusII.hpp"
 
@@ -150,14 +151,14 @@ ExodusIIMeshReader::readMeshPart(
   // Read this PE's chunk of the mesh node coordinates from file
   coord = readCoords( gid );
 
-  // Generate set of unique faces
-  tk::UnsMesh::FaceSet faces;
+  // Generate set of unique faces, with node ids in canonical order
+  tk::UnsMesh::CanonicalFaceSet faces( ginpoel.size()/2 );
   for (std::size_t e=0; e<ginpoel.size()/4; ++e)
     for (std::size_t f=0; f<4; ++f) {
       const auto& tri = tk::expofa[f];
-      faces.insert( {{{ ginpoel[ e*4+tri[0] ],
-                        ginpoel[ e*4+tri[1] ],
-                        ginpoel[ e*4+tri[2] ] }}} );
+      faces.insert( tk::UnsMesh::canonical< 3 >( {{ ginpoel[ e*4+tri[0] ],
+                                                   ginpoel[ e*4+tri[1] ],
+                                                   ginpoel[ e*4+tri[2] ] }} ) );
     }
 
   // Read triangle element connectivity (all triangle blocks in file)
@@ -168,7 +169,8 @@ ExodusIIMeshReader::readMeshPart(
   std::vector< std::size_t > triinp_own;
   std::size_t ltrid = 0;        // local triangle id
   for (std::size_t e=0; e<triinp.size()/3; ++e) {
-    auto i = faces.find( {{ triinp[e*3+0], triinp[e*3+1], triinp[e*3+2] }} );
+    auto i = faces.find( tk::UnsMesh::canonical< 3 >(
+               {{ triinp[e*3+0], triinp[e*3+1], triinp[e*3+2] }} ) );
     if (i != end(faces)) {
       m_tri[e] = ltrid++;       // generate global->local triangle ids
       triinp_own.push_back( triinp[e*3+0] );
@@ -180,15 +182,17 @@ ExodusIIMeshReader::readMeshPart(
 }
 
 std::array< std::vector< tk::real >, 3 >
-ExodusIIMeshReader::readCoords( const std::vector< std::size_t >& gid ) const
+ExodusIIMeshReader::readCoords( const std::vector< std::size_t >& gid,
+                                std::size_t maxgap ) const
 // *****************************************************************************
 //  Read coordinates of a number of mesh nodes from ExodusII file
 //! \param[in] gid Global node IDs whose coordinates to read
+//! \param[in] maxgap Maximum gap between node IDs merged into a single read
 //! \return Vector of node coordinates read from file
 // *****************************************************************************
 {
   // Read node coordinates from file with global node IDs given in gid
-  return readNodes( gid );
+  return readNodes( gid, maxgap );
 }
 
 std::size_t
@@ -301,17 +305,59 @@ ExodusIIMeshReader::readNode( std::size_t id,
 }
 
 std::array< std::vector< tk::real >, 3 >
-ExodusIIMeshReader::readNodes( const std::vector< std::size_t >& gid ) const
+ExodusIIMeshReader::readNodes( const std::vector< std::size_t >& gid,
+                               std::size_t maxgap ) const
 // *****************************************************************************
 //  Read coordinates of a number of mesh nodes from ExodusII file
 //! \param[in] gid Node IDs whose coordinates to read
+//! \param[in] maxgap Maximum gap between node IDs merged into a single read
 //! \return Mesh node coordinates
+//! \details Instead of reading the coordinates of the nodes one by one, the
+//!   node IDs are sorted and merged into contiguous ranges, allowing at most
+//!   maxgap unrequested nodes between two subsequent requested ones. Each range
+//!   is then read from file with a single partial-coordinate read into a
+//!   staging buffer, from which the requested coordinates are scattered to
+//!   their place in the output. Larger maxgap yields fewer but larger reads.
 // *****************************************************************************
 {
   std::vector< tk::real > px( gid.size() ), py( gid.size() ), pz( gid.size() );
 
-  std::size_t i=0;
-  for (auto g : gid) readNode( g, i++, px, py, pz );
+  // Order positions in gid by node ID, so that ranges can be read in order
+  std::vector< std::size_t > ord( gid.size() );
+  std::iota( begin(ord), end(ord), 0 );
+  std::sort( begin(ord), end(ord),
+    [&]( std::size_t a, std::size_t b ){ return gid[a] < gid[b]; } );
+
+  // Staging buffers for a contiguous range of node coordinates
+  std::vector< tk::real > x, y, z;
+
+  std::size_t b = 0;
+  while (b < ord.size()) {
+    // Extend range while the gap to the next requested node is small enough
+    auto e = b + 1;
+    while (e < ord.size() && gid[ord[e]] - gid[ord[e-1]] <= maxgap+1) ++e;
+    // Read coordinates of range of nodes [first,first+n)
+    auto first = gid[ ord[b] ];
+    auto n = gid[ ord[e-1] ] - first + 1;
+    x.resize( n );
+    y.resize( n );
+    z.resize( n );
+    ErrChk(
+      ex_get_partial_coord( m_inFile, static_cast<int64_t>(first)+1,
+                            static_cast<int64_t>(n),
+                            x.data(), y.data(), z.data() ) == 0,
+      "Failed to read coordinates of nodes " + std::to_string(first) + "-" +
+      std::to_string(first+n-1) + " from ExodusII file: " + m_filename );
+    // Scatter coordinates of the requested nodes in range
+    for (auto i=b; i<e; ++i) {
+      auto p = ord[i];
+      auto o = gid[p] - first;
+      px[p] = x[o];
+      py[p] = y[o];
+      pz[p] = z[o];
+    }
+    b = e;
+  }
 
   return {{ std::move(px), std::move(py), std::move(pz) }};
 }
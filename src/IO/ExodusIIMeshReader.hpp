@@ -41,6 +41,11 @@ const std::array< std::size_t, 2 > ExoNnpe {{ 4, 3 }};
 const std::array< std::array< std::size_t, 3 >, 4 >
   expofa{{ {{0,1,3}}, {{1,2,3}}, {{0,3,2}}, {{0,2,1}} }};
 
+//! Default maximum gap (in number of nodes) between node IDs merged into a
+//! single contiguous range when reading node coordinates in bulk
+//! \see ExodusIIMeshReader::readNodes()
+const std::size_t ExoMaxNodeGap = 64;
+
 //! ExodusII mesh-based data reader
 //! \details Mesh reader class facilitating reading from mesh-based field data
 //!   a file in ExodusII format.
@@ -77,7 +82,8 @@ class ExodusIIMeshReader {
 
     //! Read coordinates of a number of mesh nodes from ExodusII file
     std::array< std::vector< tk::real >, 3 >
-    readCoords( const std::vector< std::size_t >& gid ) const;
+    readCoords( const std::vector< std::size_t >& gid,
+                std::size_t maxgap = ExoMaxNodeGap ) const;
 
     //! Read face list of all side sets from ExodusII file
     void
@@ -102,7 +108,8 @@ class ExodusIIMeshReader {
 
     //! Read coordinates of a number of mesh nodes from ExodusII file
     std::array< std::vector< tk::real >, 3 >
-    readNodes( const std::vector< std::size_t >& gid ) const;
+    readNodes( const std::vector< std::size_t >& gid,
+               std::size_t maxgap = ExoMaxNodeGap ) const;
 
     //! Read element block IDs from file
     std::size_t readElemBlockIDs();
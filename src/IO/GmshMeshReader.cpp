@@ -15,10 +15,11 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
-#include <istream>
 #include <string>
 #include <utility>
 #include <vector>
+#include <map>
+#include <mutex>
 
 #include "UnsMesh.hpp"
 #include "GmshMeshReader.hpp"
@@ -40,9 +41,8 @@ GmshMeshReader::readMesh( UnsMesh& mesh )
 
   // Keep reading in sections until end of file. These sections can be in
   // arbitrary order, hence a while loop.
-  while ( !m_inFile.eof() ) {
-    std::string s;
-    getline( m_inFile, s );
+  while ( !m_tok.eof() ) {
+    auto s = m_tok.line();
     if ( s == "$Nodes" )
       readNodes( mesh );
     else if ( s == "$Elements" )
@@ -59,17 +59,17 @@ GmshMeshReader::readMeshFormat()
 // *****************************************************************************
 {
   using tk::operator<<;
-  std::string s;
 
   // Read in beginning of header: $MeshFormat
-  getline( m_inFile, s );
+  auto s = m_tok.line();
   ErrChk( s == "$MeshFormat",
           std::string("Unsupported mesh format '") + s + "' in file " +
           m_filename );
 
   // Read in "version-number file-type data-size"
-  int type;
-  m_inFile >> m_version >> type >> m_datasize;
+  m_version = m_tok.real();
+  auto type = m_tok.integer< int >();
+  m_datasize = m_tok.integer< int >();
   if (type == 0 )
     m_type = GmshFileType::ASCII;
   else if (type == 1 )
@@ -88,21 +88,21 @@ GmshMeshReader::readMeshFormat()
           std::string("Unsupported mesh datasize '") << m_datasize <<
           "' in file " << m_filename );
 
-  getline( m_inFile, s );  // finish reading the line
+  m_tok.skipLine();  // finish reading the line
 
   // if file is binary, binary-read in binary "one"
   if ( isBinary() ) {
     int one;
-    m_inFile.read( reinterpret_cast<char*>(&one), sizeof(int) );
+    m_tok.read( &one, sizeof(int) );
     #ifdef __bg__
     one = tk::swap_endian< int >( one );
     #endif
     ErrChk( one == 1, "Endianness does not match in file " + m_filename );
-    getline( m_inFile, s );  // finish reading the line
+    m_tok.skipLine();  // finish reading the line
   }
 
   // Read in end of header: $EndMeshFormat
-  getline( m_inFile, s );
+  s = m_tok.line();
   ErrChk( s == "$EndMeshFormat",
           "'$EndMeshFormat' keyword is missing in file " + m_filename );
 }
@@ -112,152 +112,210 @@ GmshMeshReader::readNodes( UnsMesh& mesh )
 // *****************************************************************************
 //  Read "$Nodes--$EndNodes" section
 //! \param[in] mesh Unstructured mesh object
+//! \details In ASCII files the node coordinates are parsed in parallel chunks
+//!   of lines.
 // *****************************************************************************
 {
   // Read in number of nodes in this node set
-  std::size_t nnode;
-  m_inFile >> nnode;
+  auto nnode = m_tok.integer< std::size_t >();
   ErrChk( nnode > 0,
           "Number of nodes must be greater than zero in file " + m_filename  );
-  std::string s;
-  if (isBinary()) getline( m_inFile, s );  // finish reading the line
+  m_tok.skipLine();  // finish reading the line
+
+  auto& x = mesh.x();
+  auto& y = mesh.y();
+  auto& z = mesh.z();
+  auto offset = x.size();
+  x.resize( offset + nnode );
+  y.resize( offset + nnode );
+  z.resize( offset + nnode );
 
   // Read in node ids and coordinates: node-number x-coord y-coord z-coord
-  for ( std::size_t i=0; i<nnode; ++i ) {
-    int id;
-    std::array< tk::real, 3 > coord;
-
-    if (isASCII()) {
-      m_inFile >> id >> coord[0] >> coord[1] >> coord[2];
-    } else {
-      m_inFile.read( reinterpret_cast<char*>(&id), sizeof(int) );
+  if (isASCII()) {
+
+    m_tok.parallel( nnode,
+      [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+        for (auto i=first; i<last; ++i) {
+          c.integer< int >();   // node id, ignored
+          x[offset+i] = c.real();
+          y[offset+i] = c.real();
+          z[offset+i] = c.real();
+          c.skipLine();
+        }
+      } );
+
+  } else {
+
+    for ( std::size_t i=0; i<nnode; ++i ) {
+      int id;
+      std::array< tk::real, 3 > coord;
+      m_tok.read( &id, sizeof(int) );
       #ifdef __bg__
       id = tk::swap_endian< int >( id );
       #endif
-      m_inFile.read( reinterpret_cast<char*>(coord.data()), 3*sizeof(double) );
+      m_tok.read( coord.data(), 3*sizeof(double) );
       #ifdef __bg__
       coord[0] = tk::swap_endian< double >( coord[0] );
       coord[1] = tk::swap_endian< double >( coord[1] );
       coord[2] = tk::swap_endian< double >( coord[2] );
       #endif
+      x[offset+i] = coord[0];
+      y[offset+i] = coord[1];
+      z[offset+i] = coord[2];
     }
+    m_tok.skipLine();  // finish reading the last line
 
-    mesh.x().push_back( coord[0] );
-    mesh.y().push_back( coord[1] );
-    mesh.z().push_back( coord[2] );
   }
-  getline( m_inFile, s );  // finish reading the last line
 
   // Read in end of header: $EndNodes
-  getline( m_inFile, s );
+  auto s = m_tok.line();
   ErrChk( s == "$EndNodes",
           "'$EndNodes' keyword is missing in file" + m_filename );
 }
 
+void
+GmshMeshReader::addElement( UnsMesh& mesh, int elmtype,
+                            const std::vector< std::size_t >& nodes ) const
+// *****************************************************************************
+//  Add element connectivity to mesh depending on element type
+//! \param[in] mesh Unstructured mesh object
+//! \param[in] elmtype Gmsh element type
+//! \param[in] nodes Element node list (connectivity)
+// *****************************************************************************
+{
+  using tk::operator<<;
+
+  switch ( elmtype ) {
+    case GmshElemType::LIN:
+      for (const auto& j : nodes) mesh.lininpoel().push_back( j );
+      break;
+    case GmshElemType::TRI:
+      for (const auto& j : nodes) mesh.triinpoel().push_back( j );
+      break;
+    case GmshElemType::TET:
+      for (const auto& j : nodes) mesh.tetinpoel().push_back( j );
+      break;
+    case GmshElemType::PNT:
+      break;     // ignore 1-node 'point element' type
+    default: Throw( std::string("Unsupported element type ") << elmtype <<
+                    " in mesh file: " << m_filename );
+  }
+}
+
 void
 GmshMeshReader::readElements( UnsMesh& mesh )
 // *****************************************************************************
 //  Read "$Elements--$EndElements" section
 //! \param[in] mesh Unstructured mesh object
+//! \details In ASCII files the element connectivity is parsed in parallel
+//!   chunks of lines, each chunk into its own partial mesh, which are then
+//!   concatenated in file order.
 // *****************************************************************************
 {
   using tk::operator<<;
 
-  std::string s;
-
   // Read in number of elements in this element set
-  int nel;
-  m_inFile >> nel;
+  auto nel = m_tok.integer< int >();
   ErrChk( nel > 0, "Number of elements must be greater than zero in file " +
           m_filename );
-  getline( m_inFile, s );  // finish reading the last line
+  m_tok.skipLine();  // finish reading the line
+
+  if (isASCII()) {
+
+    // Partial meshes parsed by chunks, keyed by the first line of the chunk
+    std::map< std::size_t, UnsMesh > part;
+    std::mutex mtx;
+
+    // Read in element ids, tags, and element connectivity (node list)
+    m_tok.parallel( static_cast< std::size_t >( nel ),
+      [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+        UnsMesh m;
+        std::vector< std::size_t > nodes;
+        for (auto i=first; i<last; ++i) {
+          // elm-number elm-type number-of-tags < tag > ... node-number-list
+          c.integer< int >();
+          auto elmtype = c.integer< int >();
+          auto ntags = c.integer< int >();
+          // Find element type, throw exception if not supported
+          const auto it = m_elemNodes.find( elmtype );
+          ErrChk( it != m_elemNodes.end(),
+                  std::string("Unsupported element type ") << elmtype <<
+                  " in mesh file: " << m_filename );
+          // Read and ignore element tags
+          for (int j=0; j<ntags; ++j) c.integer< int >();
+          // Read and add element node list (i.e. connectivity)
+          nodes.resize( static_cast< std::size_t >( it->second ) );
+          for (auto& j : nodes) j = c.integer< std::size_t >();
+          addElement( m, elmtype, nodes );
+          c.skipLine();
+        }
+        std::lock_guard< std::mutex > lock( mtx );
+        part.emplace( first, std::move(m) );
+      } );
+
+    // Concatenate partial meshes in file order
+    for (const auto& p : part) {
+      const auto& m = p.second;
+      mesh.lininpoel().insert( end(mesh.lininpoel()),
+                               begin(m.lininpoel()), end(m.lininpoel()) );
+      mesh.triinpoel().insert( end(mesh.triinpoel()),
+                               begin(m.triinpoel()), end(m.triinpoel()) );
+      mesh.tetinpoel().insert( end(mesh.tetinpoel()),
+                               begin(m.tetinpoel()), end(m.tetinpoel()) );
+    }
 
-  // Read in element ids, tags, and element connectivity (node list)
-  int n=1;
-  for (int i=0; i<nel; i+=n) {
-    int id, elmtype, ntags;
+  } else {
+
+    // Read in element ids, tags, and element connectivity (node list)
+    int n=1;
+    for (int i=0; i<nel; i+=n) {
+      int id, elmtype, ntags;
 
-    if (isASCII()) {
-      // elm-number elm-type number-of-tags < tag > ... node-number-list
-      m_inFile >> id >> elmtype >> ntags;
-    } else {
       // elm-type num-of-elm-follow number-of-tags
-      m_inFile.read( reinterpret_cast<char*>(&elmtype), sizeof(int) );
-      m_inFile.read( reinterpret_cast<char*>(&n), sizeof(int) );
-      m_inFile.read( reinterpret_cast<char*>(&ntags), sizeof(int) );
+      m_tok.read( &elmtype, sizeof(int) );
+      m_tok.read( &n, sizeof(int) );
+      m_tok.read( &ntags, sizeof(int) );
       #ifdef __bg__
       elmtype = tk::swap_endian< int >( elmtype );
       n = tk::swap_endian< int >( n );
       ntags = tk::swap_endian< int >( ntags );
       #endif
-    }
 
-    // Find element type, throw exception if not supported
-    const auto it = m_elemNodes.find( elmtype );
-    ErrChk( it != m_elemNodes.end(),
-            std::string("Unsupported element type ") << elmtype <<
-            " in mesh file: " << m_filename );
+      // Find element type, throw exception if not supported
+      const auto it = m_elemNodes.find( elmtype );
+      ErrChk( it != m_elemNodes.end(),
+              std::string("Unsupported element type ") << elmtype <<
+              " in mesh file: " << m_filename );
 
-    for (int e=0; e<n; ++e) {
-      // Read element id if binary
-      if (isBinary()) {
-        m_inFile.read( reinterpret_cast<char*>(&id), sizeof(int) );
+      for (int e=0; e<n; ++e) {
+        // Read element id
+        m_tok.read( &id, sizeof(int) );
         #ifdef __bg__
         id = tk::swap_endian< int >( id );
         #endif
-      }
 
-      // Read and ignore element tags
-      std::vector< int > tags( static_cast<std::size_t>(ntags), 0 );
-      if (isASCII()) {
-        for (std::size_t j=0; j<static_cast<std::size_t>(ntags); j++)
-          m_inFile >> tags[j];
-      } else {
-        m_inFile.read(
-          reinterpret_cast<char*>(tags.data()),
-          static_cast<std::streamsize>(
-            static_cast<std::size_t>(ntags) * sizeof(int) ) );
+        // Read and ignore element tags
+        std::vector< int > tags( static_cast<std::size_t>(ntags), 0 );
+        m_tok.read( tags.data(), static_cast<std::size_t>(ntags)*sizeof(int) );
         #ifdef __bg__
         for (auto& t : tags) t = tk::swap_endian< int >( t );
         #endif
-      }
 
-      // Read and add element node list (i.e. connectivity)
-      std::size_t nnode = static_cast< std::size_t >( it->second );
-      std::vector< std::size_t > nodes( nnode, 0 );
-      if (isASCII()) {
-        for (std::size_t j=0; j<nnode; j++)
-          m_inFile >> nodes[j];
-      } else {
+        // Read and add element node list (i.e. connectivity)
+        std::size_t nnode = static_cast< std::size_t >( it->second );
         std::vector< int > nds( nnode, 0 );
-        m_inFile.read(
-          reinterpret_cast< char* >( nds.data() ),
-          static_cast< std::streamsize >( nnode * sizeof(int) ) );
+        m_tok.read( nds.data(), nnode*sizeof(int) );
         #ifdef __bg__
         for (auto& j : nds) j = tk::swap_endian< int >( j );
         #endif
-        for (std::size_t j=0; j<nnode; j++)
-          nodes[j] = static_cast< std::size_t >( nds[j] );
-      }
-      // Put in element connectivity for different types of elements
-      switch ( elmtype ) {
-        case GmshElemType::LIN:
-          for (const auto& j : nodes) mesh.lininpoel().push_back( j );
-          break;
-        case GmshElemType::TRI:
-          for (const auto& j : nodes) mesh.triinpoel().push_back( j );
-          break;
-        case GmshElemType::TET:
-          for (const auto& j : nodes) mesh.tetinpoel().push_back( j );
-          break;
-        case GmshElemType::PNT:
-          break;     // ignore 1-node 'point element' type
-        default: Throw( std::string("Unsupported element type ") << elmtype <<
-                        " in mesh file: " << m_filename );
+        std::vector< std::size_t > nodes( begin(nds), end(nds) );
+        // Put in element connectivity for different types of elements
+        addElement( mesh, elmtype, nodes );
       }
     }
+    m_tok.skipLine();  // finish reading the last line
+
   }
-  getline( m_inFile, s );  // finish reading the last line
 
   // Shift node IDs to start from zero (gmsh likes one-based node ids)
   shiftToZero( mesh.lininpoel() );
@@ -265,7 +323,7 @@ GmshMeshReader::readElements( UnsMesh& mesh )
   shiftToZero( mesh.tetinpoel() );
 
   // Read in end of header: $EndNodes
-  getline( m_inFile, s );
+  auto s = m_tok.line();
   ErrChk( s == "$EndElements",
           "'$EndElements' keyword is missing in file" + m_filename );
 }
@@ -15,9 +15,11 @@
 
 #include <iosfwd>
 #include <map>
+#include <vector>
 
 #include "Types.hpp"
 #include "Reader.hpp"
+#include "MmapTokenizer.hpp"
 #include "GmshMeshIO.hpp"
 #include "Exception.hpp"
 
@@ -34,6 +36,7 @@ class GmshMeshReader : public Reader {
     //! Constructor
     explicit GmshMeshReader( const std::string& filename ) :
       Reader(filename),
+      m_tok( filename ),
       m_version( 0.0 ),                        // 0.0: uninitialized
       m_datasize( 0 ),                         //   0: uninitialized
       m_type( GmshFileType::UNDEFINED )        //  -1: uninitialized
@@ -52,6 +55,10 @@ class GmshMeshReader : public Reader {
     //! Read "$Elements--$EndElements" section
     void readElements( UnsMesh& mesh );
 
+    //! Add element connectivity to mesh depending on element type
+    void addElement( UnsMesh& mesh, int elmtype,
+                     const std::vector< std::size_t >& nodes ) const;
+
     //! Read "$PhysicalNames--$EndPhysicalNames" section
     void readPhysicalNames() __attribute__ ((noreturn));
 
@@ -68,6 +75,7 @@ class GmshMeshReader : public Reader {
       return m_type == GmshFileType::BINARY ? true : false;
     }
 
+    MmapTokenizer m_tok;                //!< Memory-mapped file tokenizer
     tk::real m_version;                 //!< Mesh version in mesh file
     int m_datasize;                     //!< Data size in mesh file
     GmshFileType m_type;                //!< Mesh file type: 0:ASCII, 1:binary
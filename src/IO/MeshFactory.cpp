@@ -132,6 +132,9 @@ writeUnsMesh( const tk::Print& print,
   if (reorder) {
     print.diagstart( "Reordering mesh nodes ..." );
 
+    // Bandwidth and profile of point adjacency before and after reordering
+    std::pair< std::size_t, std::size_t > bw{ 0, 0 }, pr{ 0, 0 };
+
     // If mesh has tetrahedra elements, reorder based on those
     if (!mesh.tetinpoel().empty()) {
 
@@ -143,6 +146,9 @@ writeUnsMesh( const tk::Print& print,
       tk::remap( mesh.x(), map );
       tk::remap( mesh.y(), map );
       tk::remap( mesh.z(), map );
+      const auto rpsup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+      bw = { tk::bandwidth( psup ), tk::bandwidth( rpsup ) };
+      pr = { tk::profile( psup ), tk::profile( rpsup ) };
 
     // If mesh has no tetrahedra elements, reorder based on triangle mesh if any
     } else if (!mesh.triinpoel().empty()) {
@@ -154,9 +160,16 @@ writeUnsMesh( const tk::Print& print,
       tk::remap( mesh.x(), map );
       tk::remap( mesh.y(), map );
       tk::remap( mesh.z(), map );
+      const auto rpsup = tk::genPsup( inpoel, 3, tk::genEsup( inpoel, 3 ) );
+      bw = { tk::bandwidth( psup ), tk::bandwidth( rpsup ) };
+      pr = { tk::profile( psup ), tk::profile( rpsup ) };
     }
 
     print.diagend( "done" );
+    print.diag( "Bandwidth: " + std::to_string( bw.first ) + " -> " +
+                std::to_string( bw.second ) + ", profile: " +
+                std::to_string( pr.first ) + " -> " +
+                std::to_string( pr.second ) );
     times.emplace_back( "Reorder mesh", t.dsec() );
     t.zero();
   }
@@ -0,0 +1,144 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/MmapTokenizer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Memory-mapped tokenizer for ASCII mesh readers
+  \details   Memory-mapped tokenizer for ASCII mesh readers.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "MmapTokenizer.hpp"
+
+using tk::TokenCursor;
+using tk::MmapTokenizer;
+
+tk::real
+TokenCursor::real()
+// *****************************************************************************
+//  Read a floating-point number
+//! \return Floating-point number parsed
+//! \details Numbers whose decimal significand fits into 2^53 and whose decimal
+//!   exponent is small enough are converted exactly by a single multiplication
+//!   or division by an exactly representable power of ten. This is the common
+//!   case for mesh coordinates. Other numbers fall back to std::strtod() on a
+//!   copy of the token, which yields the same correctly rounded result.
+// *****************************************************************************
+{
+  static const std::array< double, 23 > pow10{{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+    1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 }};
+
+  skipws();
+  auto b = m_p;
+
+  bool neg = false;
+  if (m_p != m_end && (*m_p == '-' || *m_p == '+')) neg = *m_p++ == '-';
+
+  // Accumulate significand digits, counting the position of the decimal point
+  uint64_t m = 0;
+  int exp10 = 0, ndig = 0;
+  bool any = false;
+  while (m_p != m_end && digit(*m_p)) {
+    any = true;
+    if (ndig < 19) { m = m*10 + static_cast<uint64_t>(*m_p-'0'); if (m) ++ndig; }
+    else ++exp10;
+    ++m_p;
+  }
+  if (m_p != m_end && *m_p == '.') {
+    ++m_p;
+    while (m_p != m_end && digit(*m_p)) {
+      any = true;
+      if (ndig < 19) {
+        m = m*10 + static_cast<uint64_t>(*m_p-'0');
+        if (m) ++ndig;
+        --exp10;
+      }
+      ++m_p;
+    }
+  }
+  ErrChk( any, "Failed to parse floating-point number at '" + context() + "'" );
+
+  // Exponent
+  if (m_p != m_end && (*m_p == 'e' || *m_p == 'E')) {
+    ++m_p;
+    bool eneg = false;
+    if (m_p != m_end && (*m_p == '-' || *m_p == '+')) eneg = *m_p++ == '-';
+    ErrChk( m_p != m_end && digit(*m_p),
+            "Failed to parse exponent at '" + context() + "'" );
+    int e = 0;
+    while (m_p != m_end && digit(*m_p)) {
+      if (e < 100000) e = e*10 + (*m_p - '0');
+      ++m_p;
+    }
+    exp10 += eneg ? -e : e;
+  }
+
+  // Fast path: exact conversion
+  if (m <= (uint64_t(1) << 53) && exp10 >= -22 && exp10 <= 22) {
+    auto v = static_cast< double >( m );
+    v = exp10 < 0 ? v / pow10[ static_cast<std::size_t>(-exp10) ]
+                  : v * pow10[ static_cast<std::size_t>(exp10) ];
+    return neg ? -v : v;
+  }
+
+  // Slow path: correctly rounded conversion of a null-terminated copy
+  std::string s( b, m_p );
+  return std::strtod( s.c_str(), nullptr );
+}
+
+MmapTokenizer::MmapTokenizer( const std::string& filename,
+                              std::size_t nthreads ) :
+  m_filename( filename ),
+  m_fd( -1 ),
+  m_size( 0 ),
+  m_map( nullptr ),
+  m_nthreads( std::max< std::size_t >( 1, nthreads ) )
+// *****************************************************************************
+//  Constructor: map file into memory
+//! \param[in] filename Name of file to map
+//! \param[in] nthreads Number of threads to use for parsing in parallel
+// *****************************************************************************
+{
+  m_fd = open( filename.c_str(), O_RDONLY );
+  ErrChk( m_fd >= 0, "Failed to open file: " + filename );
+
+  struct stat st;
+  ErrChk( fstat( m_fd, &st ) == 0 && S_ISREG( st.st_mode ),
+          "Failed to read from file: " + filename );
+  m_size = static_cast< std::size_t >( st.st_size );
+
+  if (m_size > 0) {
+    m_map = mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0 );
+    ErrChk( m_map != MAP_FAILED, "Failed to map file: " + filename );
+    // Hint the kernel that the file will be read front to back
+    madvise( m_map, m_size, MADV_SEQUENTIAL );
+  }
+
+  auto b = static_cast< const char* >( m_map );
+  static_cast< TokenCursor& >( *this ) = TokenCursor( b, b + m_size );
+}
+
+MmapTokenizer::~MmapTokenizer() noexcept
+// *****************************************************************************
+//  Destructor: unmap file
+//! \details Exception safety: no-throw guarantee: never throws exceptions.
+// *****************************************************************************
+{
+  if (m_map && m_map != MAP_FAILED && munmap( m_map, m_size ) != 0)
+    printf( ">>> WARNING: Failed to unmap file: %s\n", m_filename.c_str() );
+  if (m_fd >= 0 && close( m_fd ) != 0)
+    printf( ">>> WARNING: Failed to close file: %s\n", m_filename.c_str() );
+}
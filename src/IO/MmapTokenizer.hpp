@@ -0,0 +1,212 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/MmapTokenizer.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Memory-mapped tokenizer for ASCII mesh readers
+  \details   Memory-mapped tokenizer for ASCII mesh readers. The file is mapped
+    into memory once and parsed with hand-rolled integer and floating-point
+    parsers that do no locale handling. Sections consisting of a known number
+    of lines, e.g., node coordinates or element connectivity, can be parsed in
+    chunks by multiple threads.
+*/
+// *****************************************************************************
+#ifndef MmapTokenizer_h
+#define MmapTokenizer_h
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <type_traits>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Cursor into a character buffer with locale-free parsing of tokens
+//! \details A cursor does not own the buffer it parses. Whitespace is defined
+//!   as space, tab, carriage return, and newline.
+class TokenCursor {
+
+  public:
+    //! Constructor
+    //! \param[in] b Pointer to first character to parse
+    //! \param[in] e Pointer to one past the last character to parse
+    explicit TokenCursor( const char* b = nullptr, const char* e = nullptr ) :
+      m_p( b ), m_end( e ) {}
+
+    //! Query current position
+    //! \return Pointer to the next character to be parsed
+    const char* pos() const { return m_p; }
+
+    //! Query end of buffer
+    //! \return Pointer to one past the last character to parse
+    const char* end() const { return m_end; }
+
+    //! Set current position
+    //! \param[in] p Pointer to the next character to be parsed
+    void seek( const char* p ) { m_p = p; }
+
+    //! Query if the end of the buffer has been reached (ignoring whitespace)
+    //! \return True if only whitespace is left in the buffer
+    bool eof() { skipws(); return m_p == m_end; }
+
+    //! Skip whitespace
+    void skipws() { while (m_p != m_end && space(*m_p)) ++m_p; }
+
+    //! Skip the rest of the current line including the newline character
+    void skipLine() {
+      auto n = static_cast< const char* >(
+        std::memchr( m_p, '\n', static_cast< std::size_t >( m_end - m_p ) ) );
+      m_p = n ? n+1 : m_end;
+    }
+
+    //! Read the rest of the current line (without the line ending)
+    //! \return String containing the rest of the current line
+    std::string line() {
+      auto b = m_p;
+      skipLine();
+      auto e = m_p;
+      if (e != b && *(e-1) == '\n') --e;
+      if (e != b && *(e-1) == '\r') --e;
+      return std::string( b, e );
+    }
+
+    //! Read a whitespace-delimited word
+    //! \return String containing the next word
+    std::string word() {
+      skipws();
+      auto b = m_p;
+      while (m_p != m_end && !space(*m_p)) ++m_p;
+      return std::string( b, m_p );
+    }
+
+    //! Read an integer
+    //! \return Integer parsed
+    template< typename Int >
+    Int integer() {
+      static_assert( std::is_integral< Int >::value, "Integer type required" );
+      skipws();
+      bool neg = false;
+      if (m_p != m_end && (*m_p == '-' || *m_p == '+')) neg = *m_p++ == '-';
+      ErrChk( m_p != m_end && digit(*m_p), "Failed to parse integer at '" +
+              context() + "'" );
+      Int v = 0;
+      while (m_p != m_end && digit(*m_p))
+        v = static_cast< Int >( v*10 + static_cast< Int >( *m_p++ - '0' ) );
+      return neg ? static_cast< Int >( -v ) : v;
+    }
+
+    //! Read a floating-point number
+    tk::real real();
+
+    //! Unformatted read
+    //! \param[in] data Buffer to copy to
+    //! \param[in] count Number of bytes to copy
+    void read( void* data, std::size_t count ) {
+      ErrChk( static_cast< std::size_t >( m_end - m_p ) >= count,
+              "Unexpected end of buffer in unformatted read" );
+      std::memcpy( data, m_p, count );
+      m_p += count;
+    }
+
+  private:
+    const char* m_p;            //!< Current position
+    const char* m_end;          //!< One past the last character
+
+    //! Whitespace query
+    static bool space( char c )
+    { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    //! Decimal digit query
+    static bool digit( char c ) { return c >= '0' && c <= '9'; }
+
+    //! Return a few characters from the current position for error messages
+    std::string context() const {
+      auto n = std::min< std::ptrdiff_t >( 32, m_end - m_p );
+      return std::string( m_p, m_p + n );
+    }
+};
+
+//! Memory-mapped tokenizer for ASCII (and binary) mesh files
+//! \details The whole file is mapped into memory read-only and is parsed via a
+//!   tk::TokenCursor. Sections with a known number of lines can be parsed in
+//!   parallel using parallel().
+class MmapTokenizer : public TokenCursor {
+
+  public:
+    //! Constructor: map file into memory
+    explicit MmapTokenizer( const std::string& filename,
+      std::size_t nthreads = std::thread::hardware_concurrency() );
+
+    //! Destructor: unmap file
+    ~MmapTokenizer() noexcept;
+
+    //! Don't permit copy constructor
+    MmapTokenizer( const MmapTokenizer& ) = delete;
+    //! Don't permit copy assignment
+    MmapTokenizer& operator=( const MmapTokenizer& ) = delete;
+    //! Don't permit move constructor
+    MmapTokenizer( MmapTokenizer&& ) = delete;
+    //! Don't permit move assignment
+    MmapTokenizer& operator=( MmapTokenizer&& ) = delete;
+
+    //! Parse the next nline lines in parallel chunks
+    //! \param[in] nline Number of lines to parse
+    //! \param[in] fn Function to call for each chunk, with signature
+    //!   void( tk::TokenCursor& c, std::size_t first, std::size_t last ),
+    //!   parsing lines [first,last), relative to the current line, from c
+    //! \details The lines are split into chunks of approximately equal number
+    //!   of lines and each chunk is parsed by a different thread. Exceptions
+    //!   thrown by any of the threads are rethrown on the calling thread. After
+    //!   return the current position is at the beginning of the line following
+    //!   the nline lines parsed.
+    template< class Fn >
+    void parallel( std::size_t nline, Fn&& fn ) {
+      auto nchunk = std::max< std::size_t >( 1,
+        std::min( m_nthreads, nline / MinLinesPerChunk ) );
+      // Find beginnings of chunks of lines
+      auto chunk = nline / nchunk;
+      std::vector< const char* > start{ pos() };
+      std::vector< std::size_t > first{ 0 };
+      for (std::size_t c=1; c<=nchunk; ++c) {
+        auto n = c < nchunk ? chunk : nline - (nchunk-1)*chunk;
+        for (std::size_t l=0; l<n; ++l) skipLine();
+        start.push_back( pos() );
+        first.push_back( first.back() + n );
+      }
+      // Parse chunks in parallel, the calling thread parsing the first chunk
+      std::vector< std::exception_ptr > err( nchunk );
+      auto parse = [&]( std::size_t c ) {
+        try {
+          TokenCursor t( start[c], start[c+1] );
+          fn( t, first[c], first[c+1] );
+        } catch (...) { err[c] = std::current_exception(); }
+      };
+      std::vector< std::thread > threads;
+      for (std::size_t c=1; c<nchunk; ++c) threads.emplace_back( parse, c );
+      parse( 0 );
+      for (auto& t : threads) t.join();
+      for (const auto& e : err) if (e) std::rethrow_exception( e );
+    }
+
+  private:
+    //! Minimum number of lines per chunk worth spawning a thread for
+    static constexpr std::size_t MinLinesPerChunk = 4096;
+
+    const std::string m_filename;       //!< File name
+    int m_fd;                           //!< File descriptor
+    std::size_t m_size;                 //!< File size in bytes
+    void* m_map;                        //!< Pointer to mapped memory
+    std::size_t m_nthreads;             //!< Number of threads to parse with
+};
+
+} // tk::
+
+#endif // MmapTokenizer_h
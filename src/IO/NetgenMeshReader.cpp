@@ -10,8 +10,6 @@
 */
 // *****************************************************************************
 
-#include <array>
-#include <istream>
 #include <string>
 #include <vector>
 #include <cstddef>
@@ -44,22 +42,29 @@ NetgenMeshReader::readNodes( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
-  int nnode;
-  m_inFile >> nnode;
+  auto nnode = m_tok.integer< int >();
   ErrChk( nnode > 0,
           "Number of nodes must be greater than zero in file " + m_filename  );
+  m_tok.skipLine();  // finish reading the line
 
-  // Read in node coordinates: x-coord y-coord z-coord
-  for (int i=0; i<nnode; ++i) {
-    tk::real x, y, z;
-    m_inFile >> x >> y >> z;
-    mesh.x().push_back( x );
-    mesh.y().push_back( y );
-    mesh.z().push_back( z );
-  }
+  auto n = static_cast< std::size_t >( nnode );
+  auto& x = mesh.x();
+  auto& y = mesh.y();
+  auto& z = mesh.z();
+  x.resize( n );
+  y.resize( n );
+  z.resize( n );
 
-  std::string s;
-  getline( m_inFile, s );  // finish reading the last line
+  // Read in node coordinates: x-coord y-coord z-coord
+  m_tok.parallel( n,
+    [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+      for (auto i=first; i<last; ++i) {
+        x[i] = c.real();
+        y[i] = c.real();
+        z[i] = c.real();
+        c.skipLine();
+      }
+    } );
 }
 
 void
@@ -69,50 +74,54 @@ NetgenMeshReader::readElements( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
-  int nel;
-
   // Read in number of tetrahedra
-  m_inFile >> nel;
-  if (!m_inFile.eof()) {
+  if (!m_tok.eof()) {
+    auto nel = m_tok.integer< int >();
     ErrChk( nel > 0, "Number of tetrahedra (volume elements) must be greater "
                      "than zero in file " + m_filename );
-    std::string s;
-    getline( m_inFile, s );  // finish reading the last line
+    m_tok.skipLine();  // finish reading the line
 
     // Read in tetrahedra element tags and connectivity
-    for (int i=0; i<nel; ++i) {
-      int tag;
-      std::array< std::size_t, 4 > n;
-      // tag n[1-4]
-      m_inFile >> tag >> n[3] >> n[0] >> n[1] >> n[2];
-      mesh.tetinpoel().push_back( n[0] );
-      mesh.tetinpoel().push_back( n[1] );
-      mesh.tetinpoel().push_back( n[2] );
-      mesh.tetinpoel().push_back( n[3] );
-    }
+    auto& inpoel = mesh.tetinpoel();
+    inpoel.resize( static_cast< std::size_t >( nel ) * 4 );
+    m_tok.parallel( static_cast< std::size_t >( nel ),
+      [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+        for (auto i=first; i<last; ++i) {
+          // tag n[1-4]
+          c.integer< int >();
+          inpoel[i*4+3] = c.integer< std::size_t >();
+          inpoel[i*4+0] = c.integer< std::size_t >();
+          inpoel[i*4+1] = c.integer< std::size_t >();
+          inpoel[i*4+2] = c.integer< std::size_t >();
+          c.skipLine();
+        }
+      } );
 
     // Shift node IDs to start from zero
     shiftToZero( mesh.tetinpoel() );
   }
 
   // Read in number of triangles
-  m_inFile >> nel;
-  if (!m_inFile.eof()) {
+  if (!m_tok.eof()) {
+    auto nel = m_tok.integer< int >();
     ErrChk( nel > 0, "Number of triangles (surface elements) must be greater "
                      "than zero in file " + m_filename );
-    std::string s;
-    getline( m_inFile, s );  // finish reading the last line
+    m_tok.skipLine();  // finish reading the line
 
     // Read in triangle element tags and connectivity
-    for (int i=0; i<nel; ++i) {
-      int tag;
-      std::array< std::size_t, 3 > n;
-      // tag n[1-3]
-      m_inFile >> tag >> n[0] >> n[1] >> n[2];
-      mesh.triinpoel().push_back( n[0] );
-      mesh.triinpoel().push_back( n[1] );
-      mesh.triinpoel().push_back( n[2] );
-    }
+    auto& inpoel = mesh.triinpoel();
+    inpoel.resize( static_cast< std::size_t >( nel ) * 3 );
+    m_tok.parallel( static_cast< std::size_t >( nel ),
+      [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+        for (auto i=first; i<last; ++i) {
+          // tag n[1-3]
+          c.integer< int >();
+          inpoel[i*3+0] = c.integer< std::size_t >();
+          inpoel[i*3+1] = c.integer< std::size_t >();
+          inpoel[i*3+2] = c.integer< std::size_t >();
+          c.skipLine();
+        }
+      } );
 
     // Shift node IDs to start from zero
     shiftToZero( mesh.triinpoel() );
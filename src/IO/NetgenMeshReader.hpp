@@ -15,6 +15,7 @@
 #include <iosfwd>
 
 #include "Reader.hpp"
+#include "MmapTokenizer.hpp"
 
 namespace tk {
 
@@ -29,12 +30,14 @@ class NetgenMeshReader : public Reader {
   public:
     //! Constructor
     explicit NetgenMeshReader( const std::string& filename ) :
-      Reader( filename ) {}
+      Reader( filename ), m_tok( filename ) {}
 
     //! Read Netgen mesh
     void readMesh( UnsMesh& mesh );
 
   private:
+    MmapTokenizer m_tok;        //!< Memory-mapped file tokenizer
+
     //! Read nodes
     void readNodes( UnsMesh& mesh );
 
@@ -12,8 +12,6 @@
 */
 // *****************************************************************************
 
-#include <array>
-#include <istream>
 #include <string>
 #include <vector>
 #include <cstddef>
@@ -32,32 +30,28 @@ UGRIDMeshReader::readHeader()
 //  Read UGRID mesh header
 // *****************************************************************************
 {
-  std::string s;
-
   // Number_of_Nodes
-  m_inFile >> m_nnode;
+  m_nnode = m_tok.integer< std::size_t >();
 
   // Number_of_Surf_Trias
-  m_inFile >> m_ntri;
+  m_ntri = m_tok.integer< std::size_t >();
 
   // Number_of_Surf_Quads
-  int nquad;
-  m_inFile >> nquad;
+  m_tok.integer< int >();
 
   // Number_of_Vol_Tets
-  m_inFile >> m_ntet;
+  m_ntet = m_tok.integer< std::size_t >();
 
   // Number_of_Vol_Pents_5
-  int pent5;
-  m_inFile >> pent5;
+  m_tok.integer< int >();
 
   // Number_of_Vol_Pents_6
-  int pent6;
-  m_inFile >> pent6;
+  m_tok.integer< int >();
 
   // Number_of_Vol_Hexs
-  int nhex;
-  m_inFile >> nhex;
+  m_tok.integer< int >();
+
+  m_tok.skipLine();  // finish reading the line
 }
 
 void
@@ -82,14 +76,23 @@ UGRIDMeshReader::readNodes( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
+  auto& x = mesh.x();
+  auto& y = mesh.y();
+  auto& z = mesh.z();
+  x.resize( m_nnode );
+  y.resize( m_nnode );
+  z.resize( m_nnode );
+
   // Read in node coordinates: x-coord y-coord z-coord
-  for (std::size_t i=0; i<m_nnode; ++i) {
-    tk::real x, y, z;
-    m_inFile >> x >> y >> z;
-    mesh.x().push_back( x );
-    mesh.y().push_back( y );
-    mesh.z().push_back( z );
-  }
+  m_tok.parallel( m_nnode,
+    [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+      for (auto i=first; i<last; ++i) {
+        x[i] = c.real();
+        y[i] = c.real();
+        z[i] = c.real();
+        c.skipLine();
+      }
+    } );
 }
 
 void
@@ -100,31 +103,36 @@ UGRIDMeshReader::readElements( UnsMesh& mesh )
 // *****************************************************************************
 {
   // Read in triangle element connectivity
-  for (std::size_t i=0; i<m_ntri; ++i) {
-    std::array< std::size_t, 3 > n;
-    m_inFile >> n[0] >> n[1] >> n[2];
-    mesh.triinpoel().push_back( n[0] );
-    mesh.triinpoel().push_back( n[1] );
-    mesh.triinpoel().push_back( n[2] );
-  }
+  auto& triinpoel = mesh.triinpoel();
+  triinpoel.resize( m_ntri*3 );
+  m_tok.parallel( m_ntri,
+    [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+      for (auto i=first; i<last; ++i) {
+        for (std::size_t j=0; j<3; ++j)
+          triinpoel[i*3+j] = c.integer< std::size_t >();
+        c.skipLine();
+      }
+    } );
 
   // Read side sets of triangle elements
   for (std::size_t i=0; i<m_ntri; ++i) {
-    int setid;
-    m_inFile >> setid;
+    auto setid = m_tok.integer< int >();
     mesh.bface()[ setid ].push_back( m_ntet + i );
     mesh.faceid()[ setid ].push_back( 0 );
   }
+  m_tok.skipLine();  // finish reading the last line
 
   // Read in tetrahedra element connectivity
-  for (std::size_t i=0; i<m_ntet; ++i) {
-    std::array< std::size_t, 4 > n;
-    m_inFile >> n[0] >> n[1] >> n[2] >> n[3];
-    mesh.tetinpoel().push_back( n[0] );
-    mesh.tetinpoel().push_back( n[1] );
-    mesh.tetinpoel().push_back( n[2] );
-    mesh.tetinpoel().push_back( n[3] );
-  }
+  auto& tetinpoel = mesh.tetinpoel();
+  tetinpoel.resize( m_ntet*4 );
+  m_tok.parallel( m_ntet,
+    [&]( TokenCursor& c, std::size_t first, std::size_t last ){
+      for (auto i=first; i<last; ++i) {
+        for (std::size_t j=0; j<4; ++j)
+          tetinpoel[i*4+j] = c.integer< std::size_t >();
+        c.skipLine();
+      }
+    } );
 
   // Shift node IDs to start from zero
   shiftToZero( mesh.triinpoel() );
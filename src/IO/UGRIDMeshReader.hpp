@@ -17,6 +17,7 @@
 #include <iosfwd>
 
 #include "Reader.hpp"
+#include "MmapTokenizer.hpp"
 
 namespace tk {
 
@@ -30,12 +31,14 @@ class UGRIDMeshReader : public Reader {
   public:
     //! Constructor
     explicit UGRIDMeshReader( const std::string& filename ) :
-      Reader( filename ), m_nnode(0), m_ntet(0), m_ntri(0) {}
+      Reader( filename ), m_tok( filename ), m_nnode(0), m_ntet(0),
+      m_ntri(0) {}
 
     //! Read UGRID mesh
     void readMesh( UnsMesh& mesh );
 
   private:
+    MmapTokenizer m_tok;        //!< Memory-mapped file tokenizer
     std::size_t m_nnode;        //!< Number of nodes
     std::size_t m_ntet;         //!< Number of tetrahedra
     std::size_t m_ntri;         //!< Number of triangles
@@ -70,15 +70,17 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   m_bndel( Disc()->bndel() ),
   m_dfnorm(),
   m_dfnormc(),
+  m_chedge(),
   m_dfn(),
   m_esup( tk::genEsup( Disc()->Inpoel(), 4 ) ),
-  m_psup( tk::genPsup( Disc()->Inpoel(), 4, m_esup ) ),
+  m_edge( Disc()->Inpoel(), Disc()->Gid().size() ),
   m_u( m_disc[thisIndex].ckLocal()->Gid().size(),
        g_inputdeck.get< tag::component >().nprop() ),
   m_un( m_u.nunk(), m_u.nprop() ),
   m_lhs( m_u.nunk(), m_u.nprop() ),
   m_rhs( m_u.nunk(), m_u.nprop() ),
   m_chBndGrad( Disc()->Bid().size(), m_u.nprop()*3 ),
+  m_dirbcnode(),
   m_bcdir(),
   m_lhsc(),
   m_chBndGradc(),
@@ -93,6 +95,9 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   m_boxnodes(),
   m_edgenode(),
   m_edgeid(),
+  m_chbndpoin(),
+  m_intpoin(),
+  m_nchbndedge( 0 ),
   m_dtp( m_u.nunk(), 0.0 ),
   m_tp( m_u.nunk(), g_inputdeck.get< tag::discr, tag::t0 >() ),
   m_finished( 0 )
@@ -112,15 +117,32 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   // Perform optional operator-access-pattern mesh node reordering
   if (g_inputdeck.get< tag::discr, tag::operator_reorder >()) {
 
-    // Create new local ids based on access pattern of PDE operators
     std::unordered_map< std::size_t, std::size_t > map;
-    std::size_t n = 0;
+    const auto method = g_inputdeck.get< tag::discr, tag::reorder_method >();
 
-    for (std::size_t p=0; p<m_u.nunk(); ++p) {  // for each point p
-      if (map.find(p) == end(map)) map[p] = n++;
-      for (auto q : tk::Around(m_psup,p)) {     // for each edge p-q
-        if (map.find(q) == end(map)) map[q] = n++;
+    if (method == ctr::ReorderType::ACCESS) {
+
+      // Create new local ids based on access pattern of PDE operators
+      std::size_t n = 0;
+      for (std::size_t p=0; p<m_u.nunk(); ++p) {  // for each point p
+        if (map.find(p) == end(map)) map[p] = n++;
+        for (auto q : tk::Around(m_edge.psup(),p)) {  // for each edge p-q
+          if (map.find(q) == end(map)) map[q] = n++;
+        }
       }
+
+    } else {
+
+      // Create new local ids based on mesh graph or node coordinates
+      std::vector< std::size_t > order;
+      if (method == ctr::ReorderType::RCM)
+        order = tk::rcm( m_edge.psup() );
+      else
+        order = tk::spaceFillingCurve( d->Coord(),
+                  method == ctr::ReorderType::HILBERT ? tk::SFCType::HILBERT :
+                                                        tk::SFCType::MORTON );
+      for (std::size_t p=0; p<order.size(); ++p) map[p] = order[p];
+
     }
 
     Assert( map.size() == d->Gid().size(), "Map size mismatch" );
@@ -129,8 +151,8 @@ ALECG::ALECG( const CProxy_Discretization& disc,
     d->remap( map );
     // Recompute elements surrounding points
     m_esup = tk::genEsup( d->Inpoel(), 4 );
-    // Recompute points surrounding points
-    m_psup = tk::genPsup( d->Inpoel(), 4, m_esup );
+    // Rebuild edge list and points surrounding points
+    m_edge = tk::EdgeList( d->Inpoel(), d->Gid().size() );
     // Remap boundary triangle face connectivity
     tk::remap( m_triinpoel, map );
   }
@@ -181,29 +203,31 @@ ALECG::norm()
   dfnorm();
 }
 
-std::array< tk::real, 3 >
-ALECG::edfnorm( const tk::UnsMesh::Edge& edge,
-                const std::unordered_map< tk::UnsMesh::Edge,
-                        std::vector< std::size_t >,
-                        tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> >& esued )
+void
+ALECG::dfnorm()
 // *****************************************************************************
-//  Compute normal of dual-mesh associated to edge
-//! \param[in] edge Edge whose dual-face normal to compute given by local ids
-//! \param[in] inpoel Mesh element connectivity
-//! \param[in] esued Elements surrounding edges
-//! \return Dual-face normal for edge
+// Compute dual-face normals associated to edges
+//! \details Dual-face normals are assembled in a single pass over the
+//!   elements, adding the contribution of each element to its six edges via
+//!   the element-to-edge connectivity of the edge list. Normals are oriented
+//!   from the smaller to the larger global id of the edge end points, so that
+//!   partial sums on chare-boundary edges can be combined across chares.
 // *****************************************************************************
 {
   auto d = Disc();
   const auto& inpoel = d->Inpoel();
+  const auto& gid = d->Gid();
+  const auto& lid = d->Lid();
+  const auto& inedel = m_edge.inedel();
   const auto& coord = d->Coord();
   const auto& x = coord[0];
   const auto& y = coord[1];
   const auto& z = coord[2];
 
-  std::array< tk::real, 3 > n{ 0.0, 0.0, 0.0 };
+  m_dfnorm.assign( m_edge.nedge()*3, 0.0 );
 
-  for (auto e : tk::cref_find(esued,edge)) {
+  // Compute dual-face normals for domain edges
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
     // access node IDs
     const std::array< std::size_t, 4 >
       N{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] };
@@ -227,43 +251,43 @@ ALECG::edfnorm( const tk::UnsMesh::Edge& edge,
     // This can be written as J/(6*4). Eq (12) has a 1/2 multiplier.
     // This leads to J/48.
     auto J48 = J/48.0;
-    for (const auto& [a,b] : tk::lpoed) {
-      auto s = tk::orient( {N[a],N[b]}, edge );
+    for (std::size_t k=0; k<6; ++k) {
+      auto a = tk::lpoed[k][0];
+      auto b = tk::lpoed[k][1];
+      auto s = gid[N[a]] < gid[N[b]] ? 1.0 : -1.0;
+      auto n = m_dfnorm.data() + inedel[e*6+k]*3;
       for (std::size_t j=0; j<3; ++j)
         n[j] += J48 * s * (grad[a][j] - grad[b][j]);
     }
   }
 
-  return n;
-}
-
-void
-ALECG::dfnorm()
-// *****************************************************************************
-// Compute dual-face normals associated to edges
-// *****************************************************************************
-{
-  auto d = Disc();
-  const auto& inpoel = d->Inpoel();
-  const auto& gid = d->Gid();
-
-  // compute derived data structures
-  auto esued = tk::genEsued( inpoel, 4, tk::genEsup( inpoel, 4 ) );
-
-  // Compute dual-face normals for domain edges
-  for (std::size_t p=0; p<gid.size(); ++p)    // for each point p
-    for (auto q : tk::Around(m_psup,p))       // for each edge p-q
-      if (gid[p] < gid[q])
-        m_dfnorm[{gid[p],gid[q]}] = edfnorm( {p,q}, esued );
+  // Order chare-boundary edges shared with each neighbor chare by global ids
+  m_chedge.clear();
+  for (const auto& [c,edges] : d->EdgeCommMap()) {
+    std::vector< tk::UnsMesh::Edge > ge;
+    ge.reserve( edges.size() );
+    for (const auto& [p,q] : edges)
+      ge.push_back( {{ std::min(p,q), std::max(p,q) }} );
+    std::sort( begin(ge), end(ge) );
+    auto& ce = m_chedge[c];
+    ce.reserve( ge.size() );
+    for (const auto& [p,q] : ge) {
+      ce.push_back( m_edge.edge( tk::cref_find(lid,p), tk::cref_find(lid,q) ) );
+      Assert( ce.back() != tk::EdgeList::npos,
+              "Chare-boundary edge not found" );
+    }
+  }
 
   // Send our dual-face normal contributions to neighbor chares
-  if (d->EdgeCommMap().empty())
+  if (m_chedge.empty())
     comdfnorm_complete();
   else {
-    for (const auto& [c,edges] : d->EdgeCommMap()) {
-      decltype(m_dfnorm) exp;
-      for (const auto& e : edges) exp[e] = tk::cref_find(m_dfnorm,e);
-      thisProxy[c].comdfnorm( exp );
+    for (const auto& [c,edges] : m_chedge) {
+      std::vector< tk::real > exp( edges.size()*3 );
+      for (std::size_t i=0; i<edges.size(); ++i)
+        for (std::size_t j=0; j<3; ++j)
+          exp[i*3+j] = m_dfnorm[ edges[i]*3+j ];
+      thisProxy[c].comdfnorm( thisIndex, exp );
     }
   }
 
@@ -271,22 +295,19 @@ ALECG::dfnorm()
 }
 
 void
-ALECG::comdfnorm( const std::unordered_map< tk::UnsMesh::Edge,
-                    std::array< tk::real, 3 >,
-                    tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> >& dfnorm )
+ALECG::comdfnorm( int fromch, const std::vector< tk::real >& dfnorm )
 // *****************************************************************************
 // Receive contributions to dual-face normals on chare-boundaries
+//! \param[in] fromch Sender chare id
 //! \param[in] dfnorm Incoming partial sums of dual-face normals associated to
-//!   chare-boundary edges
+//!   chare-boundary edges shared with the sender, ordered by global ids
+//! \details Contributions are buffered per sender and only combined in
+//!   normfinal(), as they may arrive before this chare has (re-)computed its
+//!   edge list and the order of its chare-boundary edges.
 // *****************************************************************************
 {
   // Buffer up inccoming contributions to dual-face normals
-  for (const auto& [e,n] : dfnorm) {
-    auto& dfn = m_dfnormc[e];
-    dfn[0] += n[0];
-    dfn[1] += n[1];
-    dfn[2] += n[2];
-  }
+  m_dfnormc[ fromch ] = dfnorm;
 
   if (++m_ndfnorm == Disc()->EdgeCommMap().size()) {
     m_ndfnorm = 0;
@@ -597,6 +618,9 @@ ALECG::normfinal()
   // If farfield BC is set on a node, will not also set symmetry BC
   for (auto fn : m_farfieldbcnodes) m_symbcnodes.erase(fn);
 
+  // Find nodes at which Dirichlet BCs are set
+  m_dirbcnode = dirbcNodes( m_u.nprop(), lid, m_bnode, m_bcdir );
+
   // Apply symmetry BCs on initial conditions
   for (const auto& eq : g_cgpde)
     eq.symbc( m_u, d->Coord(), m_bnorm, m_symbcnodes );
@@ -610,75 +634,67 @@ ALECG::normfinal()
     if (m_symbcnodes.find(m_triinpoel[e*3+0]) != end(m_symbcnodes))
       m_symbctri[e] = 1;
 
-  // Count contributions to chare-boundary edges
-  std::unordered_map< tk::UnsMesh::Edge, std::size_t,
-    tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > edge_node_count;
-  for (const auto& [c,edges] : d->EdgeCommMap())
-    for (const auto& e : edges)
-      ++edge_node_count[e];
-
   // Combine and weigh communicated contributions to dual-face normals
-  for (auto& [e,n] : m_dfnormc) {
-    const auto& dfn = tk::cref_find( m_dfnorm, e );
-    n[0] += dfn[0];
-    n[1] += dfn[1];
-    n[2] += dfn[2];
-    auto count = static_cast< tk::real >( tk::cref_find( edge_node_count, e ) );
-    auto factor = 1.0/(count + 1.0);
-    for (auto & x : n) x *= factor;
+  const auto nedge = m_edge.nedge();
+  auto dfnormc = m_dfnorm;
+  std::vector< std::size_t > count( nedge, 0 );
+  for (const auto& [c,n] : m_dfnormc) {
+    const auto& edges = tk::cref_find( m_chedge, c );
+    Assert( n.size() == edges.size()*3, "Size mismatch" );
+    for (std::size_t i=0; i<edges.size(); ++i) {
+      ++count[ edges[i] ];
+      for (std::size_t j=0; j<3; ++j) dfnormc[ edges[i]*3+j ] += n[i*3+j];
+    }
   }
+  for (std::size_t e=0; e<nedge; ++e)
+    if (count[e]) {
+      auto factor = 1.0/(static_cast< tk::real >( count[e] ) + 1.0);
+      for (std::size_t j=0; j<3; ++j) dfnormc[e*3+j] *= factor;
+    }
 
-  // Generate list of unique edges
-  tk::UnsMesh::EdgeSet uedge;
+  // Split nodes into chare-boundary and internal nodes
+  std::vector< char > chbnd( m_u.nunk(), 0 );
+  for (const auto& [g,b] : d->Bid()) chbnd[ tk::cref_find(lid,g) ] = 1;
+  m_chbndpoin.clear();
+  m_intpoin.clear();
   for (std::size_t p=0; p<m_u.nunk(); ++p)
-    for (auto q : tk::Around(m_psup,p))
-      uedge.insert( {p,q} );
+    (chbnd[p] ? m_chbndpoin : m_intpoin).push_back( p );
 
-  // Flatten edge list
-  m_edgenode.resize( uedge.size() * 2 );
-  std::size_t f = 0;
+  // Flatten edge list, edges adjacent to chare-boundary nodes first, so that
+  // the rhs in chare-boundary nodes can be computed and sent first, and
+  // convert dual-face normals to streamable (and vectorizable) data structure
+  const auto& edgenode = m_edge.edgenode();
   const auto& gid = d->Gid();
-  for (auto&& [p,q] : uedge) {
-    if (gid[p] > gid[q]) {
-      m_edgenode[f+0] = std::move(q);
-      m_edgenode[f+1] = std::move(p);
-    } else {
-      m_edgenode[f+0] = std::move(p);
-      m_edgenode[f+1] = std::move(q);
+  m_nchbndedge = 0;
+  for (std::size_t e=0; e<nedge; ++e)
+    if (chbnd[ edgenode[e*2+0] ] || chbnd[ edgenode[e*2+1] ]) ++m_nchbndedge;
+  std::vector< std::size_t > eid( nedge );
+  m_edgenode.resize( nedge*2 );
+  m_dfn.resize( nedge*6 );      // 2 vectors per access
+  for (std::size_t e=0, f=0, i=m_nchbndedge; e<nedge; ++e) {
+    auto p = edgenode[e*2+0];
+    auto q = edgenode[e*2+1];
+    auto& k = chbnd[p] || chbnd[q] ? f : i;
+    if (gid[p] > gid[q]) std::swap( p, q );
+    m_edgenode[k*2+0] = p;
+    m_edgenode[k*2+1] = q;
+    for (std::size_t j=0; j<3; ++j) {
+      m_dfn[k*6+j] = m_dfnorm[e*3+j];
+      m_dfn[k*6+3+j] = dfnormc[e*3+j];
     }
-    f += 2;
-  }
-  tk::destroy(uedge);
-
-  // Convert dual-face normals to streamable (and vectorizable) data structure
-  m_dfn.resize( m_edgenode.size() * 3 );      // 2 vectors per access
-  std::unordered_map< tk::UnsMesh::Edge, std::size_t,
-                      tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > eid;
-  for (std::size_t e=0; e<m_edgenode.size()/2; ++e) {
-    auto p = m_edgenode[e*2+0];
-    auto q = m_edgenode[e*2+1];
-    eid[{p,q}] = e;
-    std::array< std::size_t, 2 > g{ gid[p], gid[q] };
-    auto n = tk::cref_find( m_dfnorm, g );
-    // figure out if this is an edge on the parallel boundary
-    auto nit = m_dfnormc.find( g );
-    auto m = ( nit != m_dfnormc.end() ) ? nit->second : n;
-    m_dfn[e*6+0] = n[0];
-    m_dfn[e*6+1] = n[1];
-    m_dfn[e*6+2] = n[2];
-    m_dfn[e*6+3] = m[0];
-    m_dfn[e*6+4] = m[1];
-    m_dfn[e*6+5] = m[2];
+    eid[e] = k++;
   }
 
   tk::destroy( m_dfnorm );
   tk::destroy( m_dfnormc );
 
   // Flatten edge id data structure
-  m_edgeid.resize( m_psup.first.size() );
+  const auto& psup = m_edge.psup();
+  const auto& nodeedge = m_edge.nodeedge();
+  m_edgeid.resize( psup.first.size() );
   for (std::size_t p=0,k=0; p<m_u.nunk(); ++p)
-    for (auto q : tk::Around(m_psup,p))
-      m_edgeid[k++] = tk::cref_find( eid, {p,q} );
+    for (auto i=psup.second[p]+1; i<=psup.second[p+1]; ++i)
+      m_edgeid[k++] = eid[ nodeedge[i] ];
 }
 
 void
@@ -777,26 +793,32 @@ ALECG::chBndGrad()
       m_chBndGrad);
 
   // Communicate gradients to other chares on chare-boundary
-  if (d->NodeCommMap().empty())        // in serial we are done
+  const auto& plan = d->NodeCommPlan();
+  if (plan.empty())        // in serial we are done
     comgrad_complete();
   else // send gradients contributions to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > g( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) g[ j++ ] = m_chBndGrad[ tk::cref_find(d->Bid(),i) ];
-      thisProxy[c].comChBndGrad( std::vector<std::size_t>(begin(n),end(n)), g );
-    }
+    for (std::size_t n=0; n<plan.size(); ++n)
+      thisProxy[ plan.chare(n) ].comChBndGrad( thisIndex,
+        tk::NodeCommPlan::pack( m_chBndGrad, plan.bid(n) ) );
+
+  // Evaluate user-specified Dirichlet boundary conditions while gradients are
+  // in flight
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  if (steady) for (auto& deltat : m_dtp) deltat *= rkcoef[m_stage];
+  match( d->T(), rkcoef[m_stage] * d->Dt(), m_tp, m_dtp, d->Coord(),
+         m_dirbcnode, m_bcdir );
+  if (steady) for (auto& deltat : m_dtp) deltat /= rkcoef[m_stage];
 
   owngrad_complete();
 }
 
 void
-ALECG::comChBndGrad( const std::vector< std::size_t >& gid,
-                     const std::vector< std::vector< tk::real > >& G )
+ALECG::comChBndGrad( int fromch, const std::vector< tk::real >& G )
 // *****************************************************************************
 //  Receive contributions to nodal gradients on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive grad contributions
+//! \param[in] fromch Sender chare id
 //! \param[in] G Partial contributions of gradients to chare-boundary nodes
+//!   shared with the sender in the order of the node communication plan
 //! \details This function receives contributions to m_chBndGrad, which stores
 //!   nodal gradients at mesh chare-boundary nodes. While m_chBndGrad stores
 //!   own contributions, m_chBndGradc collects the neighbor chare
@@ -804,13 +826,12 @@ ALECG::comChBndGrad( const std::vector< std::size_t >& gid,
 //!   m_chBndGradc is overlapped. The two are combined in rhs().
 // *****************************************************************************
 {
-  Assert( G.size() == gid.size(), "Size mismatch" );
+  const auto& plan = Disc()->NodeCommPlan();
 
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) m_chBndGradc[ gid[i] ] += G[i];
+  m_chBndGradc.resize( plan.size() );
+  m_chBndGradc[ plan.neighbor(fromch) ] = G;
 
-  if (++m_ngrad == Disc()->NodeCommMap().size()) {
+  if (++m_ngrad == plan.size()) {
     m_ngrad = 0;
     comgrad_complete();
   }
@@ -825,56 +846,50 @@ ALECG::rhs()
   auto d = Disc();
 
   // Combine own and communicated contributions to nodal gradients
-  for (const auto& [gid,g] : m_chBndGradc) {
-    auto bid = tk::cref_find( d->Bid(), gid );
-    for (ncomp_t c=0; c<m_chBndGrad.nprop(); ++c)
-      m_chBndGrad(bid,c,0) += g[c];
+  const auto& plan = d->NodeCommPlan();
+  for (std::size_t n=0; n<m_chBndGradc.size(); ++n) {
+    tk::NodeCommPlan::add( m_chBndGradc[n], plan.bid(n), m_chBndGrad );
+    m_chBndGradc[n].clear();    // clear receive buffer
   }
 
-  // clear gradients receive buffer
-  tk::destroy(m_chBndGradc);
-
   const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
 
   // Compute own portion of right-hand side for all equations
   auto prev_rkcoef = m_stage == 0 ? 0.0 : rkcoef[m_stage-1];
   if (steady)
     for (std::size_t p=0; p<m_tp.size(); ++p) m_tp[p] += prev_rkcoef * m_dtp[p];
+  // Communicate rhs to other chares on chare-boundary as soon as all
+  // equations have completed it in chare-boundary nodes, while the rhs in
+  // internal nodes is being computed
+  std::size_t nchbndrhs = 0;
+  auto chbndrhs = [&](){
+    if (++nchbndrhs < g_cgpde.size()) return;
+    if (plan.empty())        // in serial we are done
+      comrhs_complete();
+    else // send contributions of rhs to chare-boundary nodes to fellow chares
+      for (std::size_t n=0; n<plan.size(); ++n)
+        thisProxy[ plan.chare(n) ].comrhs( thisIndex,
+          tk::NodeCommPlan::pack( m_rhs, plan.lid(n) ) );
+  };
   for (const auto& eq : g_cgpde)
     eq.rhs( d->T() + prev_rkcoef * d->Dt(), d->Coord(), d->Inpoel(),
-            m_triinpoel, d->Gid(), d->Bid(), d->Lid(), m_dfn, m_psup, m_esup,
-            m_symbctri, d->Vol(), m_edgenode, m_edgeid, m_boxnodes, m_chBndGrad,
-            m_u, m_tp, d->Boxvol(), m_rhs );
+            m_triinpoel, d->Gid(), d->Bid(), d->Lid(), m_dfn, m_edge.psup(),
+            m_esup, m_symbctri, d->Vol(), m_edgenode, m_edgeid, m_chbndpoin,
+            m_intpoin, m_nchbndedge, chbndrhs, m_boxnodes, m_chBndGrad, m_u,
+            m_tp, d->Boxvol(), m_rhs );
   if (steady)
     for (std::size_t p=0; p<m_tp.size(); ++p) m_tp[p] -= prev_rkcoef * m_dtp[p];
 
-  // Query and match user-specified boundary conditions to side sets
-  if (steady) for (auto& deltat : m_dtp) deltat *= rkcoef[m_stage];
-  m_bcdir = match( m_u.nprop(), d->T(), rkcoef[m_stage] * d->Dt(),
-                   m_tp, m_dtp, d->Coord(), d->Lid(), m_bnode );
-  if (steady) for (auto& deltat : m_dtp) deltat /= rkcoef[m_stage];
-
-  // Communicate rhs to other chares on chare-boundary
-  if (d->NodeCommMap().empty())        // in serial we are done
-    comrhs_complete();
-  else // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > r( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) r[ j++ ] = m_rhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[c].comrhs( std::vector<std::size_t>(begin(n),end(n)), r );
-    }
-
   ownrhs_complete();
 }
 
 void
-ALECG::comrhs( const std::vector< std::size_t >& gid,
-               const std::vector< std::vector< tk::real > >& R )
+ALECG::comrhs( int fromch, const std::vector< tk::real >& R )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
+//! \param[in] fromch Sender chare id
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes shared
+//!   with the sender in the order of the node communication plan
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -882,14 +897,13 @@ ALECG::comrhs( const std::vector< std::size_t >& gid,
 //!   are combined in solve().
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
+  const auto& plan = Disc()->NodeCommPlan();
 
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) m_rhsc[ gid[i] ] += R[i];
+  m_rhsc.resize( plan.size() );
+  m_rhsc[ plan.neighbor(fromch) ] = R;
 
   // When we have heard from all chares we communicate with, this chare is done
-  if (++m_nrhs == Disc()->NodeCommMap().size()) {
+  if (++m_nrhs == plan.size()) {
     m_nrhs = 0;
     comrhs_complete();
   }
@@ -906,14 +920,12 @@ ALECG::solve()
   auto d = Disc();
 
   // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
+  const auto& plan = d->NodeCommPlan();
+  for (std::size_t n=0; n<m_rhsc.size(); ++n) {
+    tk::NodeCommPlan::add( m_rhsc[n], plan.lid(n), m_rhs );
+    m_rhsc[n].clear();    // clear receive buffer
   }
 
-  // clear receive buffer
-  tk::destroy(m_rhsc);
-
   const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
 
   // Set Dirichlet BCs for lhs and rhs
@@ -931,14 +943,15 @@ ALECG::solve()
   // Solve the sytem
   if (steady) {
 
-    for (std::size_t i=0; i<m_u.nunk(); ++i)
+    for (std::size_t i=0; i<m_u.nunk(); ++i) {
+      auto a = rkcoef[m_stage] * m_dtp[i];
       for (ncomp_t c=0; c<m_u.nprop(); ++c)
-        m_u(i,c,0) = m_un(i,c,0)
-          + rkcoef[m_stage] * m_dtp[i] * m_rhs(i,c,0) / m_lhs(i,c,0);
+        m_u(i,c,0) = m_un(i,c,0) + a * m_rhs(i,c,0) / m_lhs(i,c,0);
+    }
 
   } else {
 
-    m_u = m_un + rkcoef[m_stage] * d->Dt() * m_rhs / m_lhs;
+    m_u.update( m_un, rkcoef[m_stage] * d->Dt(), m_rhs, m_lhs );
 
   }
 
@@ -1084,6 +1097,12 @@ ALECG::resizePostAMR(
   m_rhs.resize( npoin, nprop );
   m_chBndGrad.resize( d->Bid().size(), nprop*3 );
 
+  // Regenerate derived data structures on the new mesh. Both elements
+  // surrounding points and the edge list (and points surrounding points) are
+  // rebuilt from scratch. Dual-face normals are then recomputed for all edges.
+  m_esup = tk::genEsup( d->Inpoel(), 4 );
+  m_edge.rebuild( d->Inpoel(), npoin );
+
   // Update solution on new mesh
   for (const auto& n : addedNodes)
     for (std::size_t c=0; c<nprop; ++c)
@@ -1094,6 +1113,9 @@ ALECG::resizePostAMR(
   m_bface = bface;
   m_triinpoel = tk::remap( triinpoel, d->Lid() );
 
+  // Find nodes at which Dirichlet BCs are set on new mesh
+  m_dirbcnode = dirbcNodes( nprop, d->Lid(), m_bnode, m_bcdir );
+
   auto meshid = d->MeshId();
   contribute( sizeof(std::size_t), &meshid, CkReduction::nop,
               CkCallback(CkReductionTarget(Transporter,resized), d->Tr()) );
@@ -30,6 +30,7 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "DerivedData.hpp"
+#include "EdgeList.hpp"
 #include "FluxCorrector.hpp"
 #include "NodeDiagnostics.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
@@ -112,10 +113,7 @@ class ALECG : public CBase_ALECG {
     void lhs();
 
     //! Receive contributions to duual-face normals on chare boundaries
-    void comdfnorm(
-      const std::unordered_map< tk::UnsMesh::Edge,
-              std::array< tk::real, 3 >,
-              tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> >& dfnorm );
+    void comdfnorm( int fromch, const std::vector< tk::real >& dfnorm );
 
     //! Receive boundary point normals on chare-boundaries
     void comnorm( const std::unordered_map< int,
@@ -126,12 +124,10 @@ class ALECG : public CBase_ALECG {
                  const std::vector< std::vector< tk::real > >& L );
 
     //! Receive contributions to gradients on chare-boundaries
-    void comChBndGrad( const std::vector< std::size_t >& gid,
-                       const std::vector< std::vector< tk::real > >& G );
+    void comChBndGrad( int fromch, const std::vector< tk::real >& G );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
+    void comrhs( int fromch, const std::vector< tk::real >& R );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a );
@@ -202,14 +198,16 @@ class ALECG : public CBase_ALECG {
       p | m_bndel;
       p | m_dfnorm;
       p | m_dfnormc;
+      p | m_chedge;
       p | m_dfn;
       p | m_esup;
-      p | m_psup;
+      p | m_edge;
       p | m_u;
       p | m_un;
       p | m_lhs;
       p | m_rhs;
       p | m_chBndGrad;
+      p | m_dirbcnode;
       p | m_bcdir;
       p | m_lhsc;
       p | m_chBndGradc;
@@ -224,6 +222,9 @@ class ALECG : public CBase_ALECG {
       p | m_boxnodes;
       p | m_edgenode;
       p | m_edgeid;
+      p | m_chbndpoin;
+      p | m_intpoin;
+      p | m_nchbndedge;
       p | m_dtp;
       p | m_tp;
       p | m_finished;
@@ -261,18 +262,20 @@ class ALECG : public CBase_ALECG {
     std::vector< std::size_t > m_triinpoel;
     //! Elements along mesh boundary
     std::vector< std::size_t > m_bndel;
-    //! Dual-face normals along edges
-    std::unordered_map< tk::UnsMesh::Edge, std::array< tk::real, 3 >,
-                        tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > m_dfnorm;
-    //! Receive buffer for dual-face normals along chare-boundary edges
-    std::unordered_map< tk::UnsMesh::Edge, std::array< tk::real, 3 >,
-                     tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > m_dfnormc;
+    //! Dual-face normals along edges, 3 components per edge id of m_edge
+    std::vector< tk::real > m_dfnorm;
+    //! \brief Receive buffer for dual-face normals along chare-boundary edges
+    //!   associated to sender chare ids, in the order of m_chedge
+    std::map< int, std::vector< tk::real > > m_dfnormc;
+    //! \brief Edge ids of chare-boundary edges associated to neighbor chare
+    //!   ids, ordered by global ids, which is the same on both sides
+    std::map< int, std::vector< std::size_t > > m_chedge;
     //! Streamable dual-face normals
     std::vector< tk::real > m_dfn;
     //! El;ements surrounding points
     std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_esup;
-    //! Points surrounding points
-    std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_psup;
+    //! Edge list, also storing points surrounding points
+    tk::EdgeList m_edge;
     //! Unknown/solution vector at mesh nodes
     tk::Fields m_u;
     //! Unknown/solution vector at mesh nodes at previous time
@@ -284,6 +287,10 @@ class ALECG : public CBase_ALECG {
     //! Nodal gradients at chare-boundary nodes
     tk::Fields m_chBndGrad;
     //! Boundary conditions evaluated and assigned to local mesh node IDs
+    //! \brief Local node ids at which Dirichlet BCs are set for each system
+    //!   of PDEs, found once for a mesh
+    std::vector< std::vector< std::size_t > > m_dirbcnode;
+    //! \brief Dirichlet boundary conditions at nodes, values updated in time
     //! \details Vector of pairs of bool and boundary condition value associated
     //!   to local mesh node IDs at which the user has set Dirichlet boundary
     //!   conditions for all PDEs integrated. The bool indicates whether the BC
@@ -294,13 +301,16 @@ class ALECG : public CBase_ALECG {
     //! Receive buffer for communication of the left hand side
     //! \details Key: chare id, value: lhs for all scalar components per node
     std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
-    //! Receive buffer for communication of the nodal gradients
-    //! \details Key: chare id, value: gradients for all scalar components per
-    //!   node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_chBndGradc;
-    //! Receive buffer for communication of the right hand side
-    //! \details Key: chare id, value: rhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
+    //! Receive buffers for communication of the nodal gradients
+    //! \details Outer index: neighbor index in Discretization::NodeCommPlan(),
+    //!   inner vector: gradients for all scalar components per shared node in
+    //!   the order of the plan
+    std::vector< std::vector< tk::real > > m_chBndGradc;
+    //! Receive buffers for communication of the right hand side
+    //! \details Outer index: neighbor index in Discretization::NodeCommPlan(),
+    //!   inner vector: rhs for all scalar components per shared node in the
+    //!   order of the plan
+    std::vector< std::vector< tk::real > > m_rhsc;
     //! Diagnostics object
     NodeDiagnostics m_diag;
     //! Face normals in boundary points associated to side sets
@@ -328,6 +338,12 @@ class ALECG : public CBase_ALECG {
     std::vector< std::size_t > m_edgenode;
     //! Edge ids in the order of access
     std::vector< std::size_t > m_edgeid;
+    //! Local ids of chare-boundary nodes
+    std::vector< std::size_t > m_chbndpoin;
+    //! Local ids of internal nodes, not on chare-boundary
+    std::vector< std::size_t > m_intpoin;
+    //! Number of edges adjacent to chare-boundary nodes, stored first
+    std::size_t m_nchbndedge;
     //! Time step size for each mesh node
     std::vector< tk::real > m_dtp;
     //! Physical time for each mesh node
@@ -341,13 +357,6 @@ class ALECG : public CBase_ALECG {
       return m_disc[ thisIndex ].ckLocal();
     }
 
-    //! Compute normal of dual-mesh associated to edge
-    std::array< tk::real, 3 >
-    edfnorm( const tk::UnsMesh::Edge& edge,
-             const std::unordered_map< tk::UnsMesh::Edge,
-                     std::vector< std::size_t >,
-                     tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> >& esued );
-
     //! Compute chare-boundary edges
     void bndEdges();
 
@@ -7,6 +7,8 @@
 
 #include "../Base/Types.hpp"
 #include "edge.hpp"
+#include "id_map.hpp"
+#include "edge_map.hpp"
 #include "UnsMesh.hpp"
 
 // TODO: Do we need to merge this with Base/Types.h?
@@ -34,7 +36,7 @@ using face_list_t  = std::array< face_ids_t, NUM_TET_FACES>;
 //using child_id_list_t = std::array<size_t, MAX_CHILDREN>;
 using child_id_list_t = std::vector<size_t>;
 
-using tet_list_t = std::map<size_t, tet_t>;
+using tet_list_t = id_map_t<tet_t>;
 
 using inpoel_t = std::vector< std::size_t >;     //!< Tetrahedron connectivity
 using node_list_t = std::vector<real_t>;
@@ -92,7 +94,7 @@ struct Edge_Refinement {
 
 // Complex types
 struct Edge_Refinement; // forward declare
-using edges_t = std::map<edge_t, Edge_Refinement>;
+using edges_t = edge_map_t<Edge_Refinement>;
 using edge_list_t  = std::array<edge_t, NUM_TET_EDGES>;
 using edge_list_ids_t  = std::array<std::size_t, NUM_TET_EDGES>;
 
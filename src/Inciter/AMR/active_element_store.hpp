@@ -1,18 +1,19 @@
 #ifndef AMR_active_element_store_h
 #define AMR_active_element_store_h
 
-#include <set>
 #include <cassert>
 
+#include "AMR/id_map.hpp"
+
 namespace AMR {
 
     class active_element_store_t {
         private:
-            std::set<size_t> active_elements;
+            id_set_t active_elements;
         public:
 
             //! Non-const-ref access to state
-            std::set<size_t>& data() { return active_elements; }
+            id_set_t& data() { return active_elements; }
 
             /**
              * @brief Function to add active elements
@@ -42,11 +43,7 @@ namespace AMR {
              */
             bool exists(size_t id) const
             {
-                if (active_elements.find(id) != active_elements.end())
-                {
-                    return true;
-                }
-                return false;
+                return active_elements.count(id);
             }
 
             void replace(size_t old_id, size_t new_id)
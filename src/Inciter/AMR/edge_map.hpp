@@ -0,0 +1,275 @@
+#ifndef AMR_edge_map_h
+#define AMR_edge_map_h
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+#include "edge.hpp"
+
+namespace AMR {
+
+    /**
+     * @brief Open-addressing hash map keyed by edge_t
+     *
+     * @details Replaces std::map< edge_t, V > for the edge store. Entries are
+     * stored in a single power-of-two sized array probed linearly, so a
+     * lookup touches one or two cache lines instead of walking a tree of
+     * individually allocated nodes. Erasure uses backward-shift deletion, so
+     * no tombstones accumulate over refinement/derefinement cycles. The
+     * interface follows std::map for the operations used by the AMR library
+     * and its callers (find, at, operator[], insert, emplace, erase, count,
+     * iteration yielding std::pair< edge_t, V >).
+     *
+     * Unlike std::map: iteration order is unspecified, insertion may
+     * invalidate references and iterators (on rehash), and erasure may
+     * invalidate references and iterators (entries shift back).
+     */
+    template< typename V >
+    class edge_map_t {
+        public:
+            using key_type = edge_t;
+            using mapped_type = V;
+            using value_type = std::pair< edge_t, V >;
+            using size_type = size_t;
+
+            //! Forward iterator over occupied slots
+            template< bool Const >
+            class iter_t {
+                template< bool > friend class iter_t;
+                friend class edge_map_t;
+                using map_t = typename std::conditional< Const,
+                  const edge_map_t, edge_map_t >::type;
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = typename edge_map_t::value_type;
+                    using difference_type = std::ptrdiff_t;
+                    using reference = typename std::conditional< Const,
+                      const value_type&, value_type& >::type;
+                    using pointer = typename std::conditional< Const,
+                      const value_type*, value_type* >::type;
+
+                    iter_t() : map(nullptr), i(0) {}
+
+                    //! Allow conversion from iterator to const_iterator
+                    operator iter_t< true >() const {
+                        return iter_t< true >( map, i );
+                    }
+
+                    reference operator*() const { return map->slot[i]; }
+                    pointer operator->() const { return &map->slot[i]; }
+
+                    iter_t& operator++() { ++i; skip(); return *this; }
+                    iter_t operator++(int) {
+                        auto it = *this;
+                        ++*this;
+                        return it;
+                    }
+
+                    bool operator==( const iter_t& it ) const {
+                        return i == it.i;
+                    }
+                    bool operator!=( const iter_t& it ) const {
+                        return i != it.i;
+                    }
+
+                private:
+                    map_t* map;
+                    size_t i;
+
+                    iter_t( map_t* m, size_t s ) : map(m), i(s) { skip(); }
+
+                    // Advance to the next occupied slot
+                    void skip() {
+                        while (i < map->used.size() && !map->used[i]) ++i;
+                    }
+            };
+
+            using iterator = iter_t< false >;
+            using const_iterator = iter_t< true >;
+
+            size_t size() const { return num; }
+            bool empty() const { return num == 0; }
+
+            //! Remove all entries, keeping the capacity
+            void clear() {
+                std::fill( used.begin(), used.end(), 0 );
+                num = 0;
+            }
+
+            //! Make room for at least n entries without rehashing
+            void reserve( size_t n ) {
+                size_t cap = MIN_CAPACITY;
+                while (cap * MAX_LOAD_NUM < n * MAX_LOAD_DEN) cap *= 2;
+                if (cap > slot.size()) rehash( cap );
+            }
+
+            iterator begin() { return iterator( this, 0 ); }
+            iterator end() { return iterator( this, slot.size() ); }
+            const_iterator begin() const { return const_iterator( this, 0 ); }
+            const_iterator end() const {
+                return const_iterator( this, slot.size() );
+            }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator cend() const { return end(); }
+
+            iterator find( const edge_t& key ) {
+                auto s = lookup( key );
+                return s == npos ? end() : iterator( this, s );
+            }
+            const_iterator find( const edge_t& key ) const {
+                auto s = lookup( key );
+                return s == npos ? end() : const_iterator( this, s );
+            }
+
+            size_t count( const edge_t& key ) const {
+                return lookup( key ) != npos;
+            }
+
+            V& at( const edge_t& key ) {
+                auto s = lookup( key );
+                if (s == npos) throw std::out_of_range( "edge_map_t::at" );
+                return slot[s].second;
+            }
+            const V& at( const edge_t& key ) const {
+                auto s = lookup( key );
+                if (s == npos) throw std::out_of_range( "edge_map_t::at" );
+                return slot[s].second;
+            }
+
+            V& operator[]( const edge_t& key ) {
+                return emplace( key ).first->second;
+            }
+
+            std::pair< iterator, bool > insert( const value_type& v ) {
+                return emplace( v.first, v.second );
+            }
+
+            /**
+             * @brief Construct a value in place if its key does not yet exist
+             *
+             * @param key Edge to insert
+             * @param args Arguments to forward to the constructor of V
+             *
+             * @return Iterator to the entry and a bool indicating whether
+             * the insertion took place (same as std::map::emplace)
+             */
+            template< typename... Args >
+            std::pair< iterator, bool > emplace( const edge_t& key,
+                                                 Args&&... args )
+            {
+                auto s = lookup( key );
+                if (s != npos) return { iterator( this, s ), false };
+                if ((num+1) * MAX_LOAD_DEN > slot.size() * MAX_LOAD_NUM)
+                    rehash( slot.empty() ? MIN_CAPACITY : 2*slot.size() );
+                s = home( key );
+                while (used[s]) s = (s+1) & (slot.size()-1);
+                slot[s] = value_type( key, V( std::forward<Args>(args)... ) );
+                used[s] = 1;
+                ++num;
+                return { iterator( this, s ), true };
+            }
+
+            /**
+             * @brief Erase entry by key using backward-shift deletion
+             *
+             * @param key Edge to erase
+             *
+             * @return Number of entries erased (0 or 1)
+             */
+            size_t erase( const edge_t& key ) {
+                auto i = lookup( key );
+                if (i == npos) return 0;
+                const auto mask = slot.size()-1;
+                auto j = i;
+                while (true) {
+                    j = (j+1) & mask;
+                    if (!used[j]) break;
+                    auto k = home( slot[j].first );
+                    // Move entry j into hole i if i lies cyclically in [k,j)
+                    if (((j - k) & mask) >= ((j - i) & mask)) {
+                        slot[i] = std::move( slot[j] );
+                        i = j;
+                    }
+                }
+                used[i] = 0;
+                slot[i].second = V();
+                --num;
+                return 1;
+            }
+
+        private:
+            static constexpr size_t npos = static_cast< size_t >( -1 );
+            static constexpr size_t MIN_CAPACITY = 16;
+            // Maximum load factor: MAX_LOAD_NUM / MAX_LOAD_DEN
+            static constexpr size_t MAX_LOAD_NUM = 3;
+            static constexpr size_t MAX_LOAD_DEN = 4;
+
+            std::vector< value_type > slot;     // entries
+            std::vector< char > used;           // used[i] != 0: slot i taken
+            size_t num = 0;                     // number of entries
+
+            //! Hash an edge given by its two (sorted) node ids
+            static size_t hash( const edge_t& e ) {
+                uint64_t h = static_cast< uint64_t >( e.first() ) *
+                               0x9E3779B97F4A7C15ULL;
+                h ^= static_cast< uint64_t >( e.second() ) +
+                       0x632BE59BD9B4E019ULL + (h << 6) + (h >> 2);
+                h ^= h >> 32;
+                h *= 0xD6E8FEB86659FD93ULL;
+                h ^= h >> 32;
+                return static_cast< size_t >( h );
+            }
+
+            //! Home slot of a key
+            size_t home( const edge_t& e ) const {
+                return hash(e) & (slot.size()-1);
+            }
+
+            //! Find the slot of a key, npos if not found
+            size_t lookup( const edge_t& key ) const {
+                if (slot.empty()) return npos;
+                auto s = home( key );
+                while (used[s]) {
+                    if (slot[s].first == key) return s;
+                    s = (s+1) & (slot.size()-1);
+                }
+                return npos;
+            }
+
+            //! Rebuild table with a new (power-of-two) capacity
+            void rehash( size_t cap ) {
+                std::vector< value_type > old_slot( cap );
+                std::vector< char > old_used( cap, 0 );
+                old_slot.swap( slot );
+                old_used.swap( used );
+                for (size_t i=0; i<old_slot.size(); ++i) {
+                    if (!old_used[i]) continue;
+                    auto s = home( old_slot[i].first );
+                    while (used[s]) s = (s+1) & (cap-1);
+                    slot[s] = std::move( old_slot[i] );
+                    used[s] = 1;
+                }
+            }
+    };
+
+    template< typename V >
+    typename edge_map_t< V >::iterator begin( edge_map_t< V >& m )
+    { return m.begin(); }
+    template< typename V >
+    typename edge_map_t< V >::iterator end( edge_map_t< V >& m )
+    { return m.end(); }
+    template< typename V >
+    typename edge_map_t< V >::const_iterator begin( const edge_map_t< V >& m )
+    { return m.begin(); }
+    template< typename V >
+    typename edge_map_t< V >::const_iterator end( const edge_map_t< V >& m )
+    { return m.end(); }
+}
+
+#endif // AMR_edge_map_h
@@ -10,7 +10,6 @@ namespace AMR {
 
     class edge_store_t {
         public:
-            // TODO: convert this to an unordered map with a custom hash (can lift from Quinoa)
             edges_t edges;
 
             // Node connectivity does this any way, but in a slightly less efficient way
@@ -75,7 +74,7 @@ namespace AMR {
 
             bool exists(edge_t key)
             {
-                if (edges.find(key) != edges.end())
+                if (edges.count(key))
                 {
                     return true;
                 }
@@ -122,7 +121,7 @@ namespace AMR {
             void add(edge_t key, Edge_Refinement e)
             {
                 // Add edge if it doesn't exist (default behavior of insert)
-                edges.insert( std::pair<edge_t, Edge_Refinement>(key, e));
+                edges.emplace(key, e);
 
                 // TODO: It may be worth adding a check here to ensure if we're
                 // trying to add a new edge that exists it should contain the
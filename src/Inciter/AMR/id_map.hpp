@@ -0,0 +1,389 @@
+#ifndef AMR_id_map_h
+#define AMR_id_map_h
+
+#include <vector>
+#include <deque>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <cstddef>
+
+namespace AMR {
+
+    /**
+     * @brief Sparse array indexed by element id, stored in fixed-size pages
+     *
+     * @details Element ids are never recycled by id_generator_t, so across
+     * refinement/derefinement cycles the largest id issued keeps growing
+     * while the number of live ids does not. Ids are stored in pages of
+     * PAGE_SIZE consecutive ids, allocated on first use and released when
+     * their last id is reset, so memory and iteration cost follow the live
+     * ids, plus one (empty) page table entry per PAGE_SIZE ids issued. The
+     * children of a parent get consecutive ids, so derefinement empties
+     * whole pages.
+     *
+     * @tparam V Value type, stored by value
+     * @tparam Empty Value marking an unused id
+     */
+    template< typename V, V Empty >
+    class id_pages_t {
+        public:
+            static constexpr size_t npos = static_cast< size_t >( -1 );
+
+            //! Value at id, Empty if unused
+            V get( size_t id ) const {
+                auto p = id >> SHIFT;
+                if (p >= page.size() || page[p].empty()) return Empty;
+                return page[p][ id & MASK ];
+            }
+
+            //! Set value at id, releasing its page if it becomes unused
+            void set( size_t id, V v ) {
+                auto p = id >> SHIFT;
+                if (p >= page.size()) {
+                    if (v == Empty) return;
+                    page.resize( p+1 );
+                    live.resize( p+1, 0 );
+                }
+                auto& pg = page[p];
+                if (pg.empty()) {
+                    if (v == Empty) return;
+                    pg.assign( PAGE_SIZE, Empty );
+                }
+                auto& o = pg[ id & MASK ];
+                if (o == Empty && v != Empty) ++live[p];
+                else if (o != Empty && v == Empty) --live[p];
+                o = v;
+                if (live[p] == 0) std::vector< V >().swap( pg );
+            }
+
+            //! Find the smallest used id not smaller than id, npos if none
+            size_t next( size_t id ) const {
+                for (auto p = id >> SHIFT; p < page.size(); ++p) {
+                    if (page[p].empty()) continue;
+                    const auto& pg = page[p];
+                    auto i = (p << SHIFT) < id ? id & MASK : 0;
+                    for (; i<PAGE_SIZE; ++i)
+                        if (pg[i] != Empty) return (p << SHIFT) + i;
+                }
+                return npos;
+            }
+
+            void clear() { page.clear(); live.clear(); }
+
+        private:
+            static constexpr size_t SHIFT = 10;
+            static constexpr size_t PAGE_SIZE = size_t(1) << SHIFT;
+            static constexpr size_t MASK = PAGE_SIZE - 1;
+
+            std::vector< std::vector< V > > page;   // empty: no used ids
+            std::vector< size_t > live;             // number of used ids
+    };
+
+    /**
+     * @brief Map from element ids to values, stored as dense vectors
+     *
+     * @details Element ids handed out by id_generator_t are unsigned
+     * integers, mostly consecutive, so instead of a node-based std::map
+     * this container keeps a paged array indexed by id, see id_pages_t,
+     * which points into a pool of (id, value) pairs. Slots in the pool freed
+     * by erase() are kept on a free list and reused by subsequent
+     * insertions, so the pool does not grow across refinement/derefinement
+     * cycles. Iteration visits entries in increasing id order, i.e., in the
+     * same order as std::map, and dereferences to std::pair< size_t, T >, so
+     * existing code using kv.first/kv.second, structured bindings, find(),
+     * and at() works unchanged.
+     *
+     * As with std::map, inserting while iterating is allowed: end() is a
+     * sentinel independent of the ids in use, and entries inserted with ids
+     * larger than the current one are visited by the ongoing iteration.
+     *
+     * The pool is a std::deque, so, as with std::map, insertion and erasure
+     * do not invalidate references to other values. Callers hold references
+     * to a parent's Refinement_State while adding its children.
+     */
+    template< typename T >
+    class id_map_t {
+        public:
+            using key_type = size_t;
+            using mapped_type = T;
+            using value_type = std::pair< size_t, T >;
+            using size_type = size_t;
+
+            //! Forward iterator over live entries in increasing id order
+            template< bool Const >
+            class iter_t {
+                template< bool > friend class iter_t;
+                friend class id_map_t;
+                using map_t =
+                  typename std::conditional< Const, const id_map_t, id_map_t >::type;
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = typename id_map_t::value_type;
+                    using difference_type = std::ptrdiff_t;
+                    using reference = typename std::conditional< Const,
+                      const value_type&, value_type& >::type;
+                    using pointer = typename std::conditional< Const,
+                      const value_type*, value_type* >::type;
+
+                    iter_t() : map(nullptr), id(0) {}
+
+                    //! Allow conversion from iterator to const_iterator
+                    operator iter_t< true >() const {
+                        return iter_t< true >( map, id );
+                    }
+
+                    reference operator*() const {
+                        return map->pool[ map->slot.get(id) ];
+                    }
+                    pointer operator->() const { return &**this; }
+
+                    iter_t& operator++() { ++id; skip(); return *this; }
+                    iter_t operator++(int) {
+                        auto i = *this;
+                        ++*this;
+                        return i;
+                    }
+
+                    bool operator==( const iter_t& i ) const {
+                        return id == i.id;
+                    }
+                    bool operator!=( const iter_t& i ) const {
+                        return id != i.id;
+                    }
+
+                private:
+                    map_t* map;
+                    size_t id;
+
+                    iter_t( map_t* m, size_t i ) : map(m), id(i) { skip(); }
+
+                    // Advance to the next live entry, or to end() (npos) if
+                    // there is none
+                    void skip() { if (id != npos) id = map->slot.next(id); }
+            };
+
+            using iterator = iter_t< false >;
+            using const_iterator = iter_t< true >;
+
+            size_t size() const { return num; }
+            bool empty() const { return num == 0; }
+
+            void clear() {
+                slot.clear();
+                pool.clear();
+                free_list.clear();
+                num = 0;
+            }
+
+            iterator begin() { return iterator( this, 0 ); }
+            iterator end() { return iterator( this, npos ); }
+            const_iterator begin() const { return const_iterator( this, 0 ); }
+            const_iterator end() const { return const_iterator( this, npos ); }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator cend() const { return end(); }
+
+            size_t count( size_t id ) const { return slot.get(id) != npos; }
+
+            iterator find( size_t id ) {
+                return count(id) ? iterator( this, id ) : end();
+            }
+            const_iterator find( size_t id ) const {
+                return count(id) ? const_iterator( this, id ) : end();
+            }
+
+            T& at( size_t id ) {
+                if (!count(id)) throw std::out_of_range( "id_map_t::at" );
+                return pool[ slot.get(id) ].second;
+            }
+            const T& at( size_t id ) const {
+                if (!count(id)) throw std::out_of_range( "id_map_t::at" );
+                return pool[ slot.get(id) ].second;
+            }
+
+            T& operator[]( size_t id ) {
+                return emplace( id ).first->second;
+            }
+
+            /**
+             * @brief Insert a value if its id does not yet exist
+             *
+             * @param v The (id, value) pair to insert
+             *
+             * @return Iterator to the entry and a bool indicating whether
+             * the insertion took place (same as std::map::insert)
+             */
+            std::pair< iterator, bool > insert( const value_type& v ) {
+                return emplace( v.first, v.second );
+            }
+
+            /**
+             * @brief Construct a value in place if its id does not yet exist
+             *
+             * @param id Id to insert
+             * @param args Arguments to forward to the constructor of T
+             *
+             * @return Iterator to the entry and a bool indicating whether
+             * the insertion took place (same as std::map::emplace)
+             */
+            template< typename... Args >
+            std::pair< iterator, bool > emplace( size_t id, Args&&... args ) {
+                if (count(id)) return { iterator( this, id ), false };
+                if (free_list.empty()) {
+                    slot.set( id, pool.size() );
+                    pool.emplace_back( id, T( std::forward<Args>(args)... ) );
+                } else {
+                    slot.set( id, free_list.back() );
+                    free_list.pop_back();
+                    pool[ slot.get(id) ] =
+                      value_type( id, T( std::forward<Args>(args)... ) );
+                }
+                ++num;
+                return { iterator( this, id ), true };
+            }
+
+            /**
+             * @brief Erase entry by id, returning its pool slot to the free
+             * list
+             *
+             * @param id Id to erase
+             *
+             * @return Number of entries erased (0 or 1)
+             */
+            size_t erase( size_t id ) {
+                if (!count(id)) return 0;
+                auto s = slot.get(id);
+                pool[s].second = T();   // release memory held by the value
+                free_list.push_back( s );
+                slot.set( id, npos );
+                --num;
+                return 1;
+            }
+
+        private:
+            static constexpr size_t npos = static_cast< size_t >( -1 );
+
+            id_pages_t< size_t, npos > slot;    // id -> index into pool
+            std::deque< value_type > pool;      // (id, value) storage
+            std::vector< size_t > free_list;    // unused indices into pool
+            size_t num = 0;                     // number of live entries
+    };
+
+    template< typename T >
+    typename id_map_t< T >::iterator begin( id_map_t< T >& m )
+    { return m.begin(); }
+    template< typename T >
+    typename id_map_t< T >::iterator end( id_map_t< T >& m )
+    { return m.end(); }
+    template< typename T >
+    typename id_map_t< T >::const_iterator begin( const id_map_t< T >& m )
+    { return m.begin(); }
+    template< typename T >
+    typename id_map_t< T >::const_iterator end( const id_map_t< T >& m )
+    { return m.end(); }
+
+    /**
+     * @brief Set of element ids stored as a dense vector of flags
+     *
+     * @details Replaces std::set< size_t > for the active element ids.
+     * Membership query, insertion, and erasure are a single paged array
+     * access, see id_pages_t. Iteration visits ids in increasing order and,
+     * as with id_map_t, ids inserted during iteration beyond the current one
+     * are visited.
+     */
+    class id_set_t {
+        public:
+            using key_type = size_t;
+            using value_type = size_t;
+            using size_type = size_t;
+
+            //! Forward iterator over the ids in the set in increasing order
+            class const_iterator {
+                friend class id_set_t;
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = size_t;
+                    using difference_type = std::ptrdiff_t;
+                    using reference = size_t;
+                    using pointer = const size_t*;
+
+                    const_iterator() : set(nullptr), id(0) {}
+
+                    size_t operator*() const { return id; }
+
+                    const_iterator& operator++() { ++id; skip(); return *this; }
+                    const_iterator operator++(int) {
+                        auto i = *this;
+                        ++*this;
+                        return i;
+                    }
+
+                    bool operator==( const const_iterator& i ) const {
+                        return id == i.id;
+                    }
+                    bool operator!=( const const_iterator& i ) const {
+                        return id != i.id;
+                    }
+
+                private:
+                    const id_set_t* set;
+                    size_t id;
+
+                    const_iterator( const id_set_t* s, size_t i ) :
+                      set(s), id(i) { skip(); }
+
+                    void skip() { if (id != npos) id = set->flag.next(id); }
+            };
+
+            using iterator = const_iterator;
+
+            size_t size() const { return num; }
+            bool empty() const { return num == 0; }
+
+            void clear() { flag.clear(); num = 0; }
+
+            const_iterator begin() const { return const_iterator( this, 0 ); }
+            const_iterator end() const { return const_iterator( this, npos ); }
+
+            size_t count( size_t id ) const { return flag.get(id); }
+
+            const_iterator find( size_t id ) const {
+                return count(id) ? const_iterator( this, id ) : end();
+            }
+
+            /**
+             * @brief Insert id into the set
+             *
+             * @param id Id to insert
+             *
+             * @return True if the id was inserted, false if it existed
+             */
+            bool insert( size_t id ) {
+                if (count(id)) return false;
+                flag.set( id, 1 );
+                ++num;
+                return true;
+            }
+
+            size_t erase( size_t id ) {
+                if (!count(id)) return 0;
+                flag.set( id, 0 );
+                --num;
+                return 1;
+            }
+
+        private:
+            static constexpr size_t npos = static_cast< size_t >( -1 );
+
+            id_pages_t< char, 0 > flag; // flag != 0: id is in set
+            size_t num = 0;             // number of ids in set
+    };
+
+    inline id_set_t::const_iterator begin( const id_set_t& s )
+    { return s.begin(); }
+    inline id_set_t::const_iterator end( const id_set_t& s )
+    { return s.end(); }
+}
+
+#endif // AMR_id_map_h
@@ -1,21 +1,21 @@
 #ifndef AMR_master_element_store_h
 #define AMR_master_element_store_h
 
-#include <map>
 #include <algorithm>
 #include <cassert>
 
 #include "Refinement_State.hpp"
+#include "AMR/id_map.hpp"
 #include "AMR/Loggers.hpp"                   // for trace_out
 
 namespace AMR {
 
     class master_element_store_t {
         private:
-            std::map<size_t, Refinement_State> master_elements;
+            id_map_t<Refinement_State> master_elements;
         public:
             //! Non-const-ref access to state
-            std::map<size_t, Refinement_State>& data() {
+            id_map_t<Refinement_State>& data() {
               return master_elements;
             }
 
@@ -50,7 +50,7 @@ namespace AMR {
                         parent_id
                 );
 
-                master_elements.insert( std::pair<size_t, Refinement_State>(element_number, d));
+                master_elements.insert( std::pair<size_t, Refinement_State>(element_number, d) );
 
                 return element_number;
             }
@@ -134,13 +134,7 @@ namespace AMR {
              */
             bool exists(size_t id) const
             {
-                auto f = master_elements.find(id);
-                if (f != master_elements.end())
-                {
-                    //trace_out << "master_elements " << id << " exists." << std::endl;
-                    return true;
-                }
-                return false;
+                return master_elements.count(id);
             }
 
             /**
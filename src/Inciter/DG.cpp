@@ -27,6 +27,7 @@
 #include "Refiner.hpp"
 #include "Limiter.hpp"
 #include "PrefIndicator.hpp"
+#include "Reconstruction.hpp"
 #include "Reorder.hpp"
 #include "Vector.hpp"
 #include "Around.hpp"
@@ -83,6 +84,7 @@ DG::DG( const CProxy_Discretization& disc,
   m_lhs( m_u.nunk(),
          g_inputdeck.get< tag::discr, tag::ndof >()*
          g_inputdeck.get< tag::component >().nprop() ),
+  m_invLhsLs(),
   m_rhs( m_u.nunk(), m_lhs.nprop() ),
   m_nfac( m_fd.Inpofa().size()/3 ),
   m_nunk( m_u.nunk() ),
@@ -478,18 +480,18 @@ DG::receivedChBndFaces()
 // *****************************************************************************
 {
   auto d = Disc();
-  tk::UnsMesh::FaceSet recvBndFace;
+  tk::UnsMesh::CanonicalFaceSet recvBndFace;
 
   // Collect chare-boundary faces that have been received and expected
   for (const auto& c : m_bndFace)
     for (const auto& f : c.second)
       if (m_expChBndFace.find(f.first) != end(m_expChBndFace))
-        recvBndFace.insert(f.first);
+        recvBndFace.insert( tk::UnsMesh::canonical( f.first ) );
 
    // Collect info on expected but not received faces
    std::stringstream msg;
    for (const auto& f : m_expChBndFace)
-     if (recvBndFace.find(f) == end(recvBndFace)) {
+     if (!recvBndFace.count( tk::UnsMesh::canonical(f) )) {
        const auto& x = m_coord[0];
        const auto& y = m_coord[1];
        const auto& z = m_coord[2];
@@ -974,25 +976,24 @@ DG::faceAdj()
     for([[maybe_unused]] const auto& i : n.second)
       Assert( i < m_fd.Esuel().size()/4, "Sender contains ghost tet id. " );
 
-  // Generate and store Esup data-structure in a map
+  // Generate and store Esup data-structure as linked lists
   auto esup = tk::genEsup(m_inpoel, 4);
-  for (std::size_t p=0; p<Disc()->Gid().size(); ++p)
+  auto npoin = Disc()->Gid().size();
+  m_esup.first.assign( 1, 0 );
+  m_esup.first.reserve( esup.first.size() );
+  m_esup.second.assign( npoin+1, 0 );
+  for (std::size_t p=0; p<npoin; ++p)
   {
     for (auto e : tk::Around(esup, p))
     {
       // since inpoel has been augmented with the face-ghost cell previously,
       // esup also contains cells which are not on this mesh-chunk, hence the
       // following test
-      if (e < m_fd.Esuel().size()/4) m_esup[p].push_back(e);
+      if (e < m_fd.Esuel().size()/4) m_esup.first.push_back(e);
     }
+    m_esup.second[p+1] = m_esup.first.size()-1;
   }
 
-  // Error checking on Esup map
-  for(const auto& p : m_esup)
-    for([[maybe_unused]] const auto& e : p.second)
-      Assert( e < m_fd.Esuel().size()/4, "Esup contains tet id greater than "
-      + std::to_string(m_fd.Esuel().size()/4-1) +" : "+ std::to_string(e) );
-
   auto meshid = Disc()->MeshId();
   contribute( sizeof(std::size_t), &meshid, CkReduction::nop,
     CkCallback(CkReductionTarget(Transporter,startEsup), Disc()->Tr()) );
@@ -1022,14 +1023,14 @@ DG::nodeNeighSetup()
       {
         auto pl = tk::cref_find(Disc()->Lid(), p);
         // fill in the esup for the chare-boundary
-        const auto& pesup = tk::cref_find(m_esup, pl);
-        bndEsup[p] = pesup;
+        auto& pesup = bndEsup[p];
 
         // fill a map with the element ids from esup as keys and geoElem as
         // values, and another map containing these elements associated with
         // the chare id with which they are node-neighbors.
-        for (const auto& e : pesup)
+        for (auto e : tk::Around(m_esup, pl))
         {
+          pesup.push_back(e);
           nodeBndCells[e] = m_geoElem[e];
 
           // add these esup-elements into map of elements along chare boundary
@@ -1105,16 +1106,34 @@ DG::adj()
 //    for problem setup.
 // *****************************************************************************
 {
-  // combine own and communicated contributions to elements surrounding points
-  for (auto& [p, elist] : m_esupc)
+  // combine own and communicated contributions to elements surrounding
+  // points, appending the ghost elements to the own elements of each point
+  if (!m_esupc.empty())
   {
-    auto& pesup = tk::ref_find(m_esup, p);
-    for ([[maybe_unused]] auto e : elist)
+    auto npoin = m_esup.second.size()-1;
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > > esup;
+    esup.first.reserve( m_esup.first.size() + tk::sumvalsize(m_esupc) );
+    esup.first.push_back( 0 );
+    esup.second.resize( npoin+1, 0 );
+    auto c = m_esupc.cbegin();
+    for (std::size_t p=0; p<npoin; ++p)
     {
-      Assert( e >= m_fd.Esuel().size()/4, "Non-ghost element received from "
-        "esup buffer." );
+      for (auto e : tk::Around(m_esup, p)) esup.first.push_back(e);
+      if (c != m_esupc.cend() && c->first == p)
+      {
+        for ([[maybe_unused]] auto e : c->second)
+        {
+          Assert( e >= m_fd.Esuel().size()/4, "Non-ghost element received "
+            "from esup buffer." );
+        }
+        esup.first.insert( end(esup.first), begin(c->second),
+                           end(c->second) );
+        ++c;
+      }
+      esup.second[p+1] = esup.first.size()-1;
     }
-    tk::concat< std::size_t >(std::move(elist), pesup);
+    Assert( c == m_esupc.cend(), "Esup buffer contains nonexistent point" );
+    m_esup = std::move(esup);
   }
 
   tk::destroy(m_ghostData);
@@ -1656,6 +1675,11 @@ DG::lhs()
 {
   for (const auto& eq : g_dgpde) eq.lhs( m_geoElem, m_lhs );
 
+  // Compute inverse of the lhs matrices of the least-squares reconstruction,
+  // which only depend on the geometry
+  if (g_inputdeck.get< tag::discr, tag::rdof >() > 1)
+    m_invLhsLs = tk::invLhsLeastSq_P0P1( m_fd, m_geoElem, m_geoFace );
+
   if (!m_initial) stage();
 }
 
@@ -1691,8 +1715,8 @@ DG::reco()
 
     // Reconstruct second-order solution and primitive quantities
     for (const auto& eq : g_dgpde)
-      eq.reconstruct( d->T(), m_geoFace, m_geoElem, m_fd, m_esup, m_inpoel,
-                      m_coord, m_u, m_p, m_volfracExtr );
+      eq.reconstruct( d->T(), m_geoFace, m_geoElem, m_fd, m_invLhsLs, m_esup,
+                      m_inpoel, m_coord, m_u, m_p, m_volfracExtr );
   }
 
   // Send reconstructed solution to neighboring chares
@@ -2042,17 +2066,19 @@ DG::solve( tk::real newdt )
             m_u, m_p, m_volfracExtr, m_ndof, m_rhs );
 
   // Explicit time-stepping using RK3 to discretize time-derivative
+  const auto a = rkcoef[0][m_stage];
+  const auto b = rkcoef[1][m_stage];
+  const auto dt = d->Dt();
   for(std::size_t e=0; e<m_nunk; ++e)
     for(std::size_t c=0; c<neq; ++c)
       for (std::size_t k=0; k<m_numEqDof[c]; ++k)
       {
         auto rmark = c*rdof+k;
         auto mark = c*ndof+k;
-        m_u(e, rmark, 0) =  rkcoef[0][m_stage] * m_un(e, rmark, 0)
-          + rkcoef[1][m_stage] * ( m_u(e, rmark, 0)
-            + d->Dt() * m_rhs(e, mark, 0)/m_lhs(e, mark, 0) );
-        if(fabs(m_u(e, rmark, 0)) < 1e-16)
-          m_u(e, rmark, 0) = 0;
+        auto& u = m_u(e, rmark, 0);
+        u = a * m_un(e, rmark, 0)
+          + b * ( u + dt * m_rhs(e, mark, 0)/m_lhs(e, mark, 0) );
+        if(fabs(u) < 1e-16) u = 0;
       }
 
   // Update primitives based on the evolved solution
@@ -2173,7 +2199,8 @@ DG::resizePostAMR(
   m_exptGhost.clear();
   m_sendGhost.clear();
   m_ghost.clear();
-  m_esup.clear();
+  tk::destroy(m_esup.first);
+  tk::destroy(m_esup.second);
 
   // Update solution on new mesh, P0 (cell center value) only for now
   m_un = m_u;
@@ -224,6 +224,7 @@ class DG : public CBase_DG {
       p | m_geoElem;
       p | m_volfracExtr;
       p | m_lhs;
+      p | m_invLhsLs;
       p | m_rhs;
       p | m_nfac;
       p | m_nunk;
@@ -314,6 +315,9 @@ class DG : public CBase_DG {
     tk::Fields m_volfracExtr;
     //! Left-hand side mass-matrix which is a diagonal matrix
     tk::Fields m_lhs;
+    //! \brief Inverse of the least-squares reconstruction lhs matrix of each
+    //!   element, only geometry dependent, recomputed with m_lhs
+    std::vector< std::array< std::array< tk::real, 3 >, 3 > > m_invLhsLs;
     //! Vector of right-hand side
     tk::Fields m_rhs;
     //! Counter for number of faces on this chare (including chare boundaries)
@@ -370,8 +374,9 @@ class DG : public CBase_DG {
     tk::UnsMesh::FaceSet m_expChBndFace;
     //! Incoming communication buffer during chare-boundary face communication
     std::unordered_map< int, tk::UnsMesh::FaceSet > m_infaces;
-    //! Elements (value) surrounding point (key) data-structure
-    std::map< std::size_t, std::vector< std::size_t > > m_esup;
+    //! \brief Elements surrounding points, including node-neighbor ghost
+    //!   elements, as linked lists, see tk::genEsup()
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_esup;
     //! Communication buffer for esup data-structure
     std::map< std::size_t, std::vector< std::size_t > > m_esupc;
     //! Elem output fields
@@ -62,6 +62,7 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
   m_ue( Disc()->Inpoel().size()/4, m_u.nprop() ),
   m_lhs( m_u.nunk(), m_u.nprop() ),
   m_rhs( m_u.nunk(), m_u.nprop() ),
+  m_dirbcnode(),
   m_bcdir(),
   m_lhsc(),
   m_rhsc(),
@@ -94,15 +95,32 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
 
     const auto& inpoel = d->Inpoel();
 
-    // Create new local ids based on access pattern of PDE operators
     std::unordered_map< std::size_t, std::size_t > map;
-    std::size_t n = 0;
+    const auto method = g_inputdeck.get< tag::discr, tag::reorder_method >();
 
-    for (std::size_t e=0; e<inpoel.size()/4; ++e)
-      for (std::size_t i=0; i<4; ++i) {
-        std::size_t o = inpoel[e*4+i];
-        if (map.find(o) == end(map)) map[o] = n++;
-      }
+    if (method == ctr::ReorderType::ACCESS) {
+
+      // Create new local ids based on access pattern of PDE operators
+      std::size_t n = 0;
+      for (std::size_t e=0; e<inpoel.size()/4; ++e)
+        for (std::size_t i=0; i<4; ++i) {
+          std::size_t o = inpoel[e*4+i];
+          if (map.find(o) == end(map)) map[o] = n++;
+        }
+
+    } else {
+
+      // Create new local ids based on mesh graph or node coordinates
+      std::vector< std::size_t > order;
+      if (method == ctr::ReorderType::RCM)
+        order = tk::rcm( tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) ) );
+      else
+        order = tk::spaceFillingCurve( d->Coord(),
+                  method == ctr::ReorderType::HILBERT ? tk::SFCType::HILBERT :
+                                                        tk::SFCType::MORTON );
+      for (std::size_t p=0; p<order.size(); ++p) map[p] = order[p];
+
+    }
 
     Assert( map.size() == d->Gid().size(), "Map size mismatch" );
 
@@ -252,6 +270,9 @@ DiagCG::normfinal()
     for (auto& [s,nodes] : m_symbcnodemap) nodes.erase(fn);
   }
 
+  // Find nodes at which Dirichlet BCs are set
+  m_dirbcnode = dirbcNodes( m_u.nprop(), lid, m_bnode, m_bcdir );
+
   // Signal the runtime system that the workers have been created
   std::vector< std::size_t > meshdata{ m_initial, d->MeshId() };
   contribute( meshdata, CkReduction::sum_ulong,
@@ -501,7 +522,6 @@ DiagCG::rhs()
 // *****************************************************************************
 {
   auto d = Disc();
-  const auto& lid = d->Lid();
   const auto& inpoel = d->Inpoel();
 
   // Sum nodal averages to elements (1st term of gather)
@@ -519,39 +539,33 @@ DiagCG::rhs()
   // Compute mass diffusion
   auto dif = d->FCT()->diff( *d, m_u );
 
-  // Query and match user-specified boundary conditions to side sets
-  m_bcdir = match( m_u.nprop(), d->T(), d->Dt(), m_tp, m_dtp, d->Coord(),
-                   lid, m_bnode );
+  // Evaluate user-specified Dirichlet boundary conditions
+  match( d->T(), d->Dt(), m_tp, m_dtp, d->Coord(), m_dirbcnode, m_bcdir );
 
   // Send rhs data on chare-boundary nodes to fellow chares
-  if (d->NodeCommMap().empty())
+  const auto& plan = d->NodeCommPlan();
+  if (plan.empty())
     comrhs_complete();
   else  // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > r( n.size() );
-      std::vector< std::vector< tk::real > > D( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) {
-        auto k = tk::cref_find( lid, i );
-        r[j] = m_rhs[k];
-        D[j] = dif[k];
-        ++j;
-      }
-      thisProxy[c].comrhs( std::vector<std::size_t>(begin(n),end(n)), r, D );
-    }
+    for (std::size_t n=0; n<plan.size(); ++n)
+      thisProxy[ plan.chare(n) ].comrhs( thisIndex,
+        tk::NodeCommPlan::pack( m_rhs, plan.lid(n) ),
+        tk::NodeCommPlan::pack( dif, plan.lid(n) ) );
 
   ownrhs_complete( dif );
 }
 
 void
-DiagCG::comrhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& R,
-                const std::vector< std::vector< tk::real > >& D )
+DiagCG::comrhs( int fromch,
+                const std::vector< tk::real >& R,
+                const std::vector< tk::real >& D )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
-//! \param[in] D Partial contributions to chare-boundary nodes
+//! \param[in] fromch Sender chare id
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes shared
+//!   with the sender in the order of the node communication plan
+//! \param[in] D Partial contributions of mass diffusion to chare-boundary
+//!   nodes shared with the sender in the order of the node communication plan
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -560,17 +574,17 @@ DiagCG::comrhs( const std::vector< std::size_t >& gid,
 //!   mass diffusion term of the right hand side vector at mesh nodes.
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
-  Assert( D.size() == gid.size(), "Size mismatch" );
+  Assert( R.size() == D.size(), "Size mismatch" );
 
-  using tk::operator+=;
+  const auto& plan = Disc()->NodeCommPlan();
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    m_rhsc[ gid[i] ] += R[i];
-    m_difc[ gid[i] ] += D[i];
-  }
+  auto n = plan.neighbor( fromch );
+  m_rhsc.resize( plan.size() );
+  m_difc.resize( plan.size() );
+  m_rhsc[n] = R;
+  m_difc[n] = D;
 
-  if (++m_nrhs == Disc()->NodeCommMap().size()) {
+  if (++m_nrhs == plan.size()) {
     m_nrhs = 0;
     comrhs_complete();
   }
@@ -587,22 +601,16 @@ DiagCG::solve( tk::Fields& dif )
 
   auto d = Disc();
 
-  // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
-  }
-
-  // Combine own and communicated contributions to mass diffusion
-  for (const auto& b : m_difc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) dif(lid,c,0) += b.second[c];
+  // Combine own and communicated contributions to rhs and mass diffusion
+  const auto& plan = d->NodeCommPlan();
+  for (std::size_t n=0; n<m_rhsc.size(); ++n) {
+    tk::NodeCommPlan::add( m_rhsc[n], plan.lid(n), m_rhs );
+    tk::NodeCommPlan::add( m_difc[n], plan.lid(n), dif );
+    // Clear receive buffers
+    m_rhsc[n].clear();
+    m_difc[n].clear();
   }
 
-  // Clear receive buffers
-  tk::destroy(m_rhsc);
-  tk::destroy(m_difc);
-
   // Set Dirichlet BCs for lhs and both low and high order rhs vectors. Note
   // that the low order rhs (more precisely the mass-diffusion term) is set to
   // zero instead of the solution increment at Dirichlet BCs, because for the
@@ -757,7 +765,7 @@ DiagCG::update( const tk::Fields& a, [[maybe_unused]] tk::Fields&& dul )
   if (g_inputdeck.get< tag::discr, tag::fct >())
     m_u = m_ul + a;
   else
-    m_u = m_u + m_du;
+    m_u += m_du;
 
   // Compute diagnostics, e.g., residuals
   auto diag_computed =
@@ -855,6 +863,9 @@ DiagCG::resizePostAMR(
   // Update physical-boundary node lists
   m_bnode = bnode;
 
+  // Find nodes at which Dirichlet BCs are set on new mesh
+  m_dirbcnode = dirbcNodes( nprop, d->Lid(), m_bnode, m_bcdir );
+
   // Resize FCT data structures
   d->FCT()->resize( npoin, nodeCommMap, d->Bid(), d->Lid(), d->Inpoel() );
 
@@ -126,9 +126,9 @@ class DiagCG : public CBase_DiagCG {
                  const std::vector< std::vector< tk::real > >& L );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R,
-                 const std::vector< std::vector< tk::real > >& D );
+    void comrhs( int fromch,
+                 const std::vector< tk::real >& R,
+                 const std::vector< tk::real >& D );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a, tk::Fields&& dul );
@@ -196,6 +196,7 @@ class DiagCG : public CBase_DiagCG {
       p | m_ue;
       p | m_lhs;
       p | m_rhs;
+      p | m_dirbcnode;
       p | m_bcdir;
       p | m_lhsc;
       p | m_rhsc;
@@ -249,6 +250,10 @@ class DiagCG : public CBase_DiagCG {
     //! Right-hand side vector (for the high order system)
     tk::Fields m_rhs;
     //! Boundary conditions evaluated and assigned to local mesh node IDs
+    //! \brief Local node ids at which Dirichlet BCs are set for each system
+    //!   of PDEs, found once for a mesh
+    std::vector< std::vector< std::size_t > > m_dirbcnode;
+    //! \brief Dirichlet boundary conditions at nodes, values updated in time
     //! \details Vector of pairs of bool and boundary condition value associated
     //!   to local mesh node IDs at which the user has set Dirichlet boundary
     //!   conditions for all PDEs integrated. The bool indicates whether the BC
@@ -258,10 +263,16 @@ class DiagCG : public CBase_DiagCG {
       std::vector< std::pair< bool, tk::real > > > m_bcdir;
     //! Receive buffer for communication of the left hand side
     std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
-    //! Receive buffer for communication of the right hand side
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
-    //! Receive buffer for communication of mass diffusion on the hand side
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_difc;
+    //! Receive buffers for communication of the right hand side
+    //! \details Outer index: neighbor index in Discretization::NodeCommPlan(),
+    //!   inner vector: rhs for all scalar components per shared node in the
+    //!   order of the plan
+    std::vector< std::vector< tk::real > > m_rhsc;
+    //! Receive buffers for communication of mass diffusion on the hand side
+    //! \details Outer index: neighbor index in Discretization::NodeCommPlan(),
+    //!   inner vector: mass diffusion for all scalar components per shared
+    //!   node in the order of the plan
+    std::vector< std::vector< tk::real > > m_difc;
     //! Total mesh volume
     tk::real m_vol;
     //! Face normals in boundary points associated to side sets
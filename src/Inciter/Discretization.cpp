@@ -68,6 +68,7 @@ Discretization::Discretization(
   m_el( tk::global2local( ginpoel ) ),     // fills m_inpoel, m_gid, m_lid
   m_coord( setCoord( coordmap ) ),
   m_nodeCommMap(),
+  m_nodeCommPlan(),
   m_edgeCommMap(),
   m_meshvol( 0.0 ),
   m_v( m_gid.size(), 0.0 ),
@@ -119,6 +120,9 @@ Discretization::Discretization(
   tk::unique( c );
   m_bid = tk::assignLid( c );
 
+  // Build plan for exchanging data at chare-boundary nodes
+  m_nodeCommPlan = tk::NodeCommPlan( m_nodeCommMap, m_lid, m_bid );
+
   // Find host elements of user-specified points where time histories are
   // saved, and save the shape functions evaluated at the point locations
   const auto& pt = g_inputdeck.get< tag::history, tag::point >();
@@ -143,11 +147,14 @@ Discretization::Discretization(
     m_fct[ thisIndex ].insert( m_nchare, m_gid.size(), nprop,
                                m_nodeCommMap, m_bid, m_lid, m_inpoel );
 
-  // Insert ConjugrateGradients solver chare array element if needed
+  // Insert ConjugrateGradients solver chare array element if needed. The
+  // smoother's Dirichlet rows make the system nonsymmetric, on which pipelined
+  // CG is unstable, so keep the default (classic, unpreconditioned) options.
   if (ALE()) {
     const auto& [A,x,b] = LaplacianSmoother();
     m_conjugategradients[ thisIndex ].insert( A, x, b, 10, 1.0e-3,
-                                              m_gid, m_lid, m_nodeCommMap );
+                                              m_gid, m_lid, m_nodeCommMap,
+                                              tk::CGOptions() );
   }
 
   // Register mesh with mesh-transfer lib
@@ -477,6 +484,9 @@ Discretization::resizePostAMR( const tk::UnsMesh::Chunk& chunk,
       if (m_bid.find( g ) == end(m_bid))
         m_bid[ g ] = bid++;
 
+  // Rebuild plan for exchanging data at chare-boundary nodes
+  m_nodeCommPlan = tk::NodeCommPlan( m_nodeCommMap, m_lid, m_bid );
+
   // Clear receive buffer that will be used for collecting nodal volumes
   m_volc.clear();
 
@@ -583,6 +593,9 @@ Discretization::remap(
     newcoord[2][n] = m_coord[2][o];
   }
   m_coord = std::move( newcoord );
+
+  // Rebuild plan for exchanging data at chare-boundary nodes
+  m_nodeCommPlan = tk::NodeCommPlan( m_nodeCommMap, m_lid, m_bid );
 }
 
 void
@@ -23,6 +23,7 @@
 #include "PDFReducer.hpp"
 #include "UnsMesh.hpp"
 #include "CommMap.hpp"
+#include "NodeCommPlan.hpp"
 #include "History.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
@@ -234,6 +235,9 @@ class Discretization : public CBase_Discretization {
     //! Node communication map accessor as const-ref
     const tk::NodeCommMap& NodeCommMap() const { return m_nodeCommMap; }
 
+    //! Node communication plan accessor as const-ref
+    const tk::NodeCommPlan& NodeCommPlan() const { return m_nodeCommPlan; }
+
     //! Edge communication map accessor as const-ref
     const tk::EdgeCommMap& EdgeCommMap() const { return m_edgeCommMap; }
     //@}
@@ -369,6 +373,7 @@ class Discretization : public CBase_Discretization {
       }
       p | m_coord;
       p | m_nodeCommMap;
+      p | m_nodeCommPlan;
       p | m_edgeCommMap;
       p | m_meshvol;
       p | m_v;
@@ -460,6 +465,9 @@ class Discretization : public CBase_Discretization {
     //! \brief Global mesh node IDs bordering the mesh chunk held by fellow
     //!   Discretization chares associated to their chare IDs
     tk::NodeCommMap m_nodeCommMap;
+    //! \brief Local and chare-boundary ids of nodes shared with fellow
+    //!   Discretization chares, see tk::NodeCommPlan
+    tk::NodeCommPlan m_nodeCommPlan;
     //! \brief Edges with global node IDs bordering the mesh chunk held by
     //!   fellow Discretization chares associated to their chare IDs
     tk::EdgeCommMap m_edgeCommMap;
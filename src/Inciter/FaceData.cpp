@@ -13,6 +13,13 @@
 #include "Reorder.hpp"
 #include "DerivedData.hpp"
 #include "FaceData.hpp"
+#include "Inciter/InputDeck/InputDeck.hpp"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
 
 using inciter::FaceData;
 
@@ -30,7 +37,8 @@ FaceData::FaceData(
 // *****************************************************************************
 {
   auto esup = tk::genEsup( inpoel, 4 );
-  m_esuel = tk::genEsuelTet( inpoel, esup );
+  m_esuel = tk::genEsuelTet( inpoel, esup,
+              g_inputdeck.get< tag::discr, tag::nthread >() );
   auto nbfac = tk::sumvalsize( m_bface );
   m_nipfac = tk::genNipfac( 4, nbfac, m_esuel );
   m_inpofa = tk::genInpofaTet( m_nipfac, nbfac, inpoel, m_triinpoel, m_esuel );
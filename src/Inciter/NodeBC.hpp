@@ -23,16 +23,24 @@
 
 namespace inciter {
 
+//! Find nodes at which user-specified Dirichlet BCs are set on side sets
+std::vector< std::vector< std::size_t > >
+dirbcNodes( tk::ctr::ncomp_t ncomp,
+            const std::unordered_map< std::size_t, std::size_t >& lid,
+            const std::map< int, std::vector< std::size_t > >& bnode,
+            std::unordered_map< std::size_t,
+              std::vector< std::pair< bool, tk::real > > >& bcdir );
+
 //! Match user-specified boundary conditions at nodes for side sets
-std::unordered_map< std::size_t, std::vector< std::pair< bool, tk::real > > >
-match( tk::ctr::ncomp_t ncomp,
-       tk::real t,
+void
+match( tk::real t,
        tk::real dt,
        const std::vector< tk::real >& tp,
        const std::vector< tk::real >& dtp,
        const tk::UnsMesh::Coords& coord,
-       const std::unordered_map< std::size_t, std::size_t >& lid,
-       const std::map< int, std::vector< std::size_t > >& sidenodes );
+       const std::vector< std::vector< std::size_t > >& dirbcnode,
+       std::unordered_map< std::size_t,
+         std::vector< std::pair< bool, tk::real > > >& bcdir );
 
 //! \brief Verify that the change in the solution at those nodes where
 //!   Dirichlet boundary conditions are set is exactly the amount the BCs
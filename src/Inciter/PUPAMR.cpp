@@ -63,6 +63,27 @@ void PUP::pup( PUP::er &p, AMR::edge_t& e )
   p | e.get_data();
 }
 
+void PUP::pup( PUP::er &p, AMR::id_set_t& s )
+// *****************************************************************************
+//  Pack/Unpack id_set_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] s id_set_t object reference
+// *****************************************************************************
+{
+  auto n = s.size();
+  p | n;
+  if (p.isUnpacking()) {
+    s.clear();
+    for (std::size_t i=0; i<n; ++i) {
+      std::size_t id;
+      p | id;
+      s.insert( id );
+    }
+  } else {
+    for (auto id : s) p | id;
+  }
+}
+
 void PUP::pup( PUP::er &p, AMR::active_element_store_t& a )
 // *****************************************************************************
 //  Pack/Unpack active_element_store_t
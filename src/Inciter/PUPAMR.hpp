@@ -25,6 +25,8 @@
 #include "AMR/refinement.hpp"
 #include "AMR/master_element_store.hpp"
 #include "AMR/id_generator.hpp"
+#include "AMR/id_map.hpp"
+#include "AMR/edge_map.hpp"
 
 //! Extensions to Charm++'s Pack/Unpack routines
 namespace PUP {
@@ -69,6 +71,83 @@ void pup( PUP::er &p, AMR::edge_t& e );
 inline void operator|( PUP::er& p, AMR::edge_t& e ) { pup(p,e); }
 //@}
 
+/** @name Charm++ pack/unpack serializer member functions for id_map_t */
+///@{
+//! Pack/Unpack id_map_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] m id_map_t object reference
+//! \details Only the live (id, value) pairs are packed. Unpacking reinserts
+//!   them, which compacts the value pool and drops the free list.
+template< class T >
+void pup( PUP::er &p, AMR::id_map_t< T >& m ) {
+  auto n = m.size();
+  p | n;
+  if (p.isUnpacking()) {
+    m.clear();
+    for (std::size_t i=0; i<n; ++i) {
+      std::size_t id;
+      T v;
+      p | id;
+      p | v;
+      m.emplace( id, std::move(v) );
+    }
+  } else {
+    for (auto& kv : m) {
+      p | kv.first;
+      p | kv.second;
+    }
+  }
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] m id_map_t object reference
+template< class T >
+inline void operator|( PUP::er& p, AMR::id_map_t< T >& m ) { pup(p,m); }
+//@}
+
+/** @name Charm++ pack/unpack serializer member functions for id_set_t */
+///@{
+//! Pack/Unpack id_set_t
+void pup( PUP::er &p, AMR::id_set_t& s );
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] s id_set_t object reference
+inline void operator|( PUP::er& p, AMR::id_set_t& s ) { pup(p,s); }
+//@}
+
+/** @name Charm++ pack/unpack serializer member functions for edge_map_t */
+///@{
+//! Pack/Unpack edge_map_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] m edge_map_t object reference
+template< class V >
+void pup( PUP::er &p, AMR::edge_map_t< V >& m ) {
+  auto n = m.size();
+  p | n;
+  if (p.isUnpacking()) {
+    m.clear();
+    m.reserve( n );
+    for (std::size_t i=0; i<n; ++i) {
+      AMR::edge_t e;
+      V v;
+      p | e;
+      p | v;
+      m.emplace( e, std::move(v) );
+    }
+  } else {
+    for (auto& kv : m) {
+      p | kv.first;
+      p | kv.second;
+    }
+  }
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] m edge_map_t object reference
+template< class V >
+inline void operator|( PUP::er& p, AMR::edge_map_t< V >& m ) { pup(p,m); }
+//@}
+
 /** @name Charm++ pack/unpack serializer member functions for marked_refinements_store_t */
 ///@{
 //! Pack/Unpack marked_refinements_store_t
@@ -345,7 +345,8 @@ Refiner::bndEdges()
   // Generate boundary edges of our mesh chunk
   std::unordered_map< int, EdgeSet > chbedges;
   auto esup = tk::genEsup( m_inpoel, 4 );         // elements surrounding points
-  auto esuel = tk::genEsuelTet( m_inpoel, esup ); // elems surrounding elements
+  auto esuel = tk::genEsuelTet( m_inpoel, esup,   // elems surrounding elements
+                 g_inputdeck.get< tag::discr, tag::nthread >() );
   for (std::size_t e=0; e<esuel.size()/4; ++e) {
     auto mark = e*4;
     for (std::size_t f=0; f<4; ++f) {
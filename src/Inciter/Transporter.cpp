@@ -1181,6 +1181,9 @@ Transporter::pdfstat( CkReductionMsg* msg )
   creator | pdf;
   delete msg;
 
+  // Move dense bins to the maps for output
+  for (auto& p : pdf) p.flush();
+
   auto id = std::to_string(meshid);
 
   // Create new PDF file (overwrite if exists)
@@ -0,0 +1,61 @@
+// *****************************************************************************
+/*!
+  \file      src/LinearSolver/CGOptions.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Options for the distributed conjugate gradients linear solver
+  \details   Options for the distributed conjugate gradients linear solver.
+    These are only exposed via the API, i.e., passed by the caller inserting
+    the solver, and not configurable from the input file. The ALE mesh
+    smoother in Inciter uses the defaults: unpreconditioned classic CG.
+*/
+// *****************************************************************************
+#ifndef CGOptions_h
+#define CGOptions_h
+
+#include <cstdint>
+
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Preconditioner types for the conjugate gradients linear solver
+enum class CGPrecond : uint8_t {
+  NONE=0,       //!< No preconditioning
+  JACOBI,       //!< Diagonal (Jacobi) preconditioning
+  ILU0          //!< Block-Jacobi, one block per chare, each with ILU(0)
+};
+
+//! Pack/Unpack CGPrecond: forward overload to generic enum class packer
+inline void operator|( PUP::er& p, CGPrecond& e ) { PUP::pup( p, e ); }
+
+//! Options for the conjugate gradients linear solver
+struct CGOptions {
+  //! Preconditioner
+  CGPrecond precond = CGPrecond::NONE;
+  //! True: pipelined CG, a single non-blocking reduction per iteration
+  bool pipelined = false;
+  //! True: sparse matrix-vector products using SELL-C-sigma storage
+  bool sell = false;
+
+  /** @name Pack/unpack (Charm++ serialization) routines */
+  ///@{
+  //! \brief Pack/Unpack serialize member function
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  void pup( PUP::er &p ) {
+    p | precond;
+    p | pipelined;
+    p | sell;
+  }
+  //! \brief Pack/Unpack serialize operator|
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  //! \param[in,out] o CGOptions object reference
+  friend void operator|( PUP::er& p, CGOptions& o ) { o.pup(p); }
+  ///@}
+};
+
+} // tk::
+
+#endif // CGOptions_h
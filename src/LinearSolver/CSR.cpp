@@ -10,6 +10,8 @@
 */
 // *****************************************************************************
 
+#include <limits>
+
 #include "Exception.hpp"
 #include "CSR.hpp"
 
@@ -35,10 +37,10 @@ try :
   const auto& psup1 = psup.first;
   const auto& psup2 = psup.second;
 
-  // Calculate number of nonzeros in each block row (rnz), total number of
-  // nonzeros (nnz), and fill in row indices (ia)
+  // Calculate number of nonzeros in each block row (rnz) and total number of
+  // nonzeros (nnz)
   std::size_t nnz, i;
-  for (ia[0]=1, nnz=i=0; i<psup2.size()-1; ++i) {
+  for (nnz=i=0; i<psup2.size()-1; ++i) {
     // add up and store nonzeros of row i (only upper triangular part)
     std::size_t j;
     for (rnz[i]=1, j=psup2[i]+1; j<=psup2[i+1]; ++j)
@@ -46,11 +48,18 @@ try :
 
     // add up total number of nonzeros
     nnz += rnz[i] * ncomp;
+  }
+
+  // Row indices are 1-based, so the last one is nnz+1, which must be
+  // representable before narrowing any of them
+  ErrChk( nnz < std::numeric_limits< index_t >::max(),
+          "Number of sparse matrix nonzeros exceeds the range of indices" );
 
-    // fill up row index
+  // fill up row indices
+  ia[0] = 1;
+  for (i=0; i<rnz.size(); ++i)
     for (std::size_t k=0; k<ncomp; ++k)
-      ia[i*ncomp+k+1] = ia[i*ncomp+k] + rnz[i];
-  }
+      ia[i*ncomp+k+1] = ia[i*ncomp+k] + static_cast< index_t >( rnz[i] );
 
   // Allocate storage for matrix values and column indices
   a.resize( nnz, 0.0 );
@@ -60,10 +69,11 @@ try :
   for (i=0; i<rnz.size(); ++i)
     for (std::size_t k=0; k<ncomp; ++k) {
       auto itmp = i*ncomp+k;
-      ja[ia[itmp]-1] = itmp+1;  // put in column index of diagonal
+      // put in column index of diagonal
+      ja[ia[itmp]-1] = static_cast< index_t >( itmp+1 );
       for (std::size_t n=1, j=psup2[i]+1; j<=psup2[i+1]; ++j) {
         // put in column index of an off-diagonal
-	ja[ia[itmp]-1+(n++)] = psup1[j]*ncomp+k+1;
+	ja[ia[itmp]-1+(n++)] = static_cast< index_t >( psup1[j]*ncomp+k+1 );
       }
     }
 
@@ -158,11 +168,38 @@ CSR::mult( const std::vector< real >& x, std::vector< real >& r ) const
 //!   combining the rows stored on multiple partitions.
 // *****************************************************************************
 {
-  std::fill( begin(r), end(r), 0.0 );
+  Assert( x.size() >= rsize() && r.size() >= rsize(), "Size mismatch" );
+
+  // Accumulate each row in a register, access data via raw pointers
+  const auto nrow = rsize();
+  const auto pi = ia.data();
+  const auto pj = ja.data();
+  const auto pa = a.data();
+  const auto px = x.data();
+
+  for (std::size_t i=0; i<nrow; ++i) {
+    real s = 0.0;
+    for (auto j=pi[i]-1; j<pi[i+1]-1; ++j) s += pa[j] * px[ pj[j]-1 ];
+    r[i] = s;
+  }
+}
+
+std::vector< tk::real >
+CSR::diag() const
+// *****************************************************************************
+//  Extract the diagonal of the matrix
+//! \return Vector of diagonal entries, one for each row
+//! \note In parallel, this is only the own contribution to the diagonal on
+//!   rows stored on multiple partitions.
+// *****************************************************************************
+{
+  std::vector< real > d( rsize(), 0.0 );
 
-  for (std::size_t i=0; i<rnz.size()*ncomp; ++i)
+  for (std::size_t i=0; i<d.size(); ++i)
     for (std::size_t j=ia[i]-1; j<ia[i+1]-1; ++j)
-      r[i] += a[j] * x[ja[j]-1];
+      if (ja[j] == i+1) d[i] = a[j];
+
+  return d;
 }
 
 std::ostream&
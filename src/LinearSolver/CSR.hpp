@@ -6,7 +6,11 @@
              2019-2021 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Compressed sparse row (CSR) storage for a sparse matrix
-  \details   Compressed sparse row (CSR) storage for a sparse matrix.
+  \details   Compressed sparse row (CSR) storage for a sparse matrix. Row
+    pointers and column indices are stored as 32-bit integers, halving the
+    memory traffic of indices in sparse matrix-vector products compared to
+    64-bit indices. This limits the number of nonzeros per partition (chare) to
+    2^32-1, which is not a practical limitation.
 */
 // *****************************************************************************
 #ifndef CSR_h
@@ -14,6 +18,7 @@
 
 #include <vector>
 #include <ostream>
+#include <cstdint>
 
 #include "NoWarning/pup_stl.hpp"
 
@@ -26,6 +31,9 @@ namespace tk {
 class CSR {
 
   public:
+    //! Type of row pointers and column indices
+    using index_t = std::uint32_t;
+
     //! \brief Constructor: Create a CSR symmetric matrix with ncomp scalar
     //!   components, storing only the upper triangular part
     explicit CSR( std::size_t nc,
@@ -57,12 +65,22 @@ class CSR {
     //! Multiply CSR matrix with vector from the right: r = A * x
     void mult( const std::vector< real >& x, std::vector< real >& r ) const;
 
+    //! Extract the diagonal of the matrix
+    std::vector< real > diag() const;
+
     //! Access real size of matrix
     std::size_t rsize() const { return rnz.size()*ncomp; }
 
     //! Access the number of scalar components per non-zero matrix entry
     std::size_t Ncomp() const { return ncomp; }
 
+    //! Access row pointers (1-based)
+    const std::vector< index_t >& rowptr() const { return ia; }
+    //! Access column indices (1-based)
+    const std::vector< index_t >& colidx() const { return ja; }
+    //! Access nonzero matrix values
+    const std::vector< real >& values() const { return a; }
+
     //! Write out CSR as stored
     std::ostream& write_stored( std::ostream &os ) const;
     //! Write out CSR nonzero structure
@@ -94,8 +112,8 @@ class CSR {
   private:
     std::size_t ncomp;                  //!< Number of scalars per non-zero
     std::vector< std::size_t > rnz;     //!< Number of nonzeros in each row
-    std::vector< std::size_t > ia;      //!< Row pointers
-    std::vector< std::size_t > ja;      //!< Column indices
+    std::vector< index_t > ia;          //!< Row pointers
+    std::vector< index_t > ja;          //!< Column indices
     std::vector< real > a;              //!< Nonzero matrix values
 };
 
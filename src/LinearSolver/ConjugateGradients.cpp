@@ -9,25 +9,61 @@
   \details   Charm++ chare array for asynchronous distributed
     conjugate gradients linear solver.
   \see Y. Saad, Iterative Methods for Sparse Linear Systems: Second Edition,
-    ISBN 9780898718003, 2003, Algorithm 6.18, conjugate gradients to solve the
-    linear system A * x = b, reproduced here:
+    ISBN 9780898718003, 2003, Algorithm 9.1, preconditioned conjugate
+    gradients to solve the linear system A * x = b, reproduced here:
 
-    Compute r0:=b-A*x0, p0:=r0                  see residual(), normb()
+    Compute r0:=b-A*x0, u0:=M^{-1}r0, p0:=u0    see residual(), u()
     For j=0,1,..., until convergence, do
-      alpha_j := (r_j,r_j) / (Ap_j,p_j)         see next(), qAp(), q(), pq()
-      x_{j+1} := x_j + alpha_j p_j              see normres()
+      alpha_j := (r_j,u_j) / (Ap_j,p_j)         see rho(), q(), pq()
+      x_{j+1} := x_j + alpha_j p_j              see pq()
       r_{j+1} := r_j - alpha_j A p_j            see pq()
-      beta_j := (r_{j+1},r_{j+1}) / (r_j,r_j)   see normres()
-      p_{j+1} := r_{j+1} + beta_j p_j           see rho()
+      u_{j+1} := M^{-1} r_{j+1}                 see pq(), u()
+      beta_j := (r_{j+1},u_{j+1}) / (r_j,u_j)   see rho()
+      p_{j+1} := u_{j+1} + beta_j p_j           see rho()
     end
+
+    The dot products (r,r), used for the convergence test, and (r,u) are
+    computed by a single reduction.
+
+  \see P. Ghysels, W. Vanroose, Hiding global synchronization latency in the
+    preconditioned Conjugate Gradient algorithm, Parallel Computing,
+    40(7):224-238, 2014, Algorithm 3, pipelined preconditioned conjugate
+    gradients, reproduced here:
+
+    Compute r0:=b-A*x0, u0:=M^{-1}r0, w0:=A*u0  see residual(), u(), w()
+    For j=0,1,..., until convergence, do
+      gamma_j := (r_j,u_j), delta := (w_j,u_j)  see pnext(), dots()
+      m_j := M^{-1} w_j                         see pnext(), m()
+      n_j := A m_j                              see m(), n()
+      if j > 0
+        beta_j := gamma_j / gamma_{j-1}
+        alpha_j := gamma_j / (delta - beta_j gamma_j / alpha_{j-1})
+      else
+        beta_j := 0, alpha_j := gamma_j / delta
+      z_j := n_j + beta_j z_{j-1}               see n()
+      q_j := m_j + beta_j q_{j-1}
+      s_j := w_j + beta_j s_{j-1}
+      p_j := u_j + beta_j p_{j-1}
+      x_{j+1} := x_j + alpha_j p_j
+      r_{j+1} := r_j - alpha_j s_j
+      u_{j+1} := u_j - alpha_j q_j
+      w_{j+1} := w_j - alpha_j z_j
+    end
+
+    The single reduction per iteration, computing gamma, delta, and (r,r) for
+    the convergence test, is non-blocking: it overlaps with computing m and n,
+    including their communication on chare-boundaries.
 */
 // *****************************************************************************
 
+#include <array>
+#include <cmath>
 #include <numeric>
-#include <iostream>     // NOT NEEDED AFTER DEBUGGED, LEAVE FOR NOW
+#include <algorithm>
 
 #include "Exception.hpp"
 #include "ConjugateGradients.hpp"
+#include "ContainerUtil.hpp"
 #include "Vector.hpp"
 
 using tk::ConjugateGradients;
@@ -40,20 +76,34 @@ ConjugateGradients::ConjugateGradients(
   tk::real tol,
   const std::vector< std::size_t >& gid,
   const std::unordered_map< std::size_t, std::size_t >& lid,
-  const NodeCommMap& nodecommmap ) :
+  const NodeCommMap& nodecommmap,
+  const CGOptions& opt ) :
   m_A( A ),
+  m_S(),
+  m_M(),
+  m_opt( opt ),
   m_x( x ),
   m_b( b ),
   m_gid( gid ),
   m_lid( lid ),
   m_nodeCommMap( nodecommmap ),
+  m_own(),
+  m_shared(),
+  m_sharedpos(),
   m_r( m_A.rsize(), 0.0 ),
   m_rc(),
+  m_dc(),
   m_nr( 0 ),
+  m_u( m_A.rsize(), 0.0 ),
+  m_zh(),
   m_p( m_A.rsize(), 0.0 ),
   m_q( m_A.rsize(), 0.0 ),
-  m_qc(),
-  m_nq( 0 ),
+  m_qh(),
+  m_w(),
+  m_m(),
+  m_n(),
+  m_z(),
+  m_s(),
   m_initialized(),
   m_solved(),
   m_normb( 0.0 ),
@@ -62,7 +112,10 @@ ConjugateGradients::ConjugateGradients(
   m_tol( tol ),
   m_rho( 0.0 ),
   m_rho0( 0.0 ),
-  m_alpha( 0.0 )
+  m_alpha( 0.0 ),
+  m_gamma( 0.0 ),
+  m_delta( 0.0 ),
+  m_rr( 0.0 )
 // *****************************************************************************
 //  Constructor
 //! \param[in] A Left hand side matrix of the linear system to solve in Ax=b
@@ -74,6 +127,7 @@ ConjugateGradients::ConjugateGradients(
 //! \param[in] lid Local node ids associated to global ones
 //! \param[in] nodecommmap Global mesh node IDs shared with other chares
 //!   associated to their chare IDs
+//! \param[in] opt Solver options
 // *****************************************************************************
 {
   // Fill in gid and lid for serial solve
@@ -86,6 +140,50 @@ ConjugateGradients::ConjugateGradients(
   Assert( m_A.rsize() == m_gid.size()*A.Ncomp(), "Size mismatch" );
   Assert( m_x.size() == m_gid.size()*A.Ncomp(), "Size mismatch" );
   Assert( m_b.size() == m_gid.size()*A.Ncomp(), "Size mismatch" );
+
+  auto dof = m_A.Ncomp();
+
+  // Find rows owned by this chare, contributing to dot products
+  for (std::size_t i=0; i<m_A.rsize(); ++i)
+    if (!slave(m_nodeCommMap,m_gid[i/dof],thisIndex)) m_own.push_back( i );
+
+  // Find chare-boundary nodes and the nodes shared with each fellow chare
+  // ordered by global node ID, which is the same on both sides
+  std::unordered_map< std::size_t, std::size_t > spos;
+  for (const auto& [c,n] : m_nodeCommMap) {
+    std::vector< std::size_t > g( begin(n), end(n) );
+    std::sort( begin(g), end(g) );
+    auto& pos = m_sharedpos[c];
+    for (auto i : g) {
+      auto l = tk::cref_find( m_lid, i );
+      auto it = spos.find( l );
+      if (it == end(spos)) {
+        it = spos.emplace( l, m_shared.size() ).first;
+        m_shared.push_back( l );
+      }
+      pos.push_back( it->second );
+    }
+  }
+  m_rc.resize( m_shared.size()*dof, 0.0 );
+  for (auto h : { &m_zh, &m_qh }) {
+    h->buf.assign( 2, std::vector< tk::real >( m_shared.size()*dof, 0.0 ) );
+    h->cnt.assign( 2, 0 );
+    h->seq = 0;
+  }
+  if (m_opt.precond != CGPrecond::NONE)
+    m_dc.resize( m_shared.size()*dof, 0.0 );
+
+  // Allocate auxiliary vectors of pipelined CG
+  if (m_opt.pipelined) {
+    m_w.resize( m_A.rsize(), 0.0 );
+    m_m.resize( m_A.rsize(), 0.0 );
+    m_n.resize( m_A.rsize(), 0.0 );
+    m_z.resize( m_A.rsize(), 0.0 );
+    m_s.resize( m_A.rsize(), 0.0 );
+  }
+
+  // Convert matrix to SELL-C-sigma storage if configured
+  if (m_opt.sell) m_S = SELL( m_A );
 }
 
 void
@@ -102,29 +200,132 @@ ConjugateGradients::init( CkCallback c )
   residual();
 
   // initiate computing norm of right hand side
-  dot( m_b, m_b,
-       CkCallback( CkReductionTarget(ConjugateGradients,normb), thisProxy ) );
+  auto d = dot( m_b, m_b );
+  contribute( sizeof(tk::real), &d, CkReduction::sum_double,
+    CkCallback( CkReductionTarget(ConjugateGradients,normb), thisProxy ) );
 }
 
-void
+tk::real
 ConjugateGradients::dot( const std::vector< tk::real >& a,
-                         const std::vector< tk::real >& b,
-                         CkCallback c )
+                         const std::vector< tk::real >& b ) const
 // *****************************************************************************
-//  Initiate computation of dot product of two vectors
+//  Compute own contribution to the dot product of two vectors
 //! \param[in] a 1st vector of dot product
 //! \param[in] b 2nd vector of dot product
-//! \param[in] c Callback to target with the final result
+//! \return Sum of products over the rows owned by this chare
 // *****************************************************************************
 {
   Assert( a.size() == b.size(), "Size mismatch" );
 
   tk::real d = 0.0;
-  for (std::size_t i=0; i<a.size(); ++i)
-    if (!slave(m_nodeCommMap,m_gid[i],thisIndex))
-      d += a[i]*b[i];
+  for (auto i : m_own) d += a[i]*b[i];
+  return d;
+}
+
+void
+ConjugateGradients::mult( const std::vector< tk::real >& x,
+                          std::vector< tk::real >& y ) const
+// *****************************************************************************
+//  Compute own contribution to matrix-vector product: y = A * x
+//! \param[in] x Vector to multiply matrix with from the right
+//! \param[in,out] y Result vector of product y = A * x
+// *****************************************************************************
+{
+  if (m_opt.sell) m_S.mult( x, y ); else m_A.mult( x, y );
+}
+
+std::vector< tk::real >
+ConjugateGradients::pack( const std::vector< std::size_t >& pos,
+                          const std::vector< tk::real >& v ) const
+// *****************************************************************************
+//  Collect values of a vector at nodes shared with a fellow chare
+//! \param[in] pos Indices into m_shared of nodes shared with the fellow chare
+//! \param[in] v Vector whose values to collect
+//! \return Values of v at the shared nodes, all components of a node together
+// *****************************************************************************
+{
+  auto dof = m_A.Ncomp();
+  std::vector< tk::real > c( pos.size()*dof );
+  for (std::size_t j=0; j<pos.size(); ++j) {
+    auto i = m_shared[ pos[j] ];
+    for (std::size_t d=0; d<dof; ++d) c[j*dof+d] = v[i*dof+d];
+  }
+  return c;
+}
+
+void
+ConjugateGradients::unpack( int fromch,
+                            const std::vector< tk::real >& c,
+                            std::vector< tk::real >& buf ) const
+// *****************************************************************************
+//  Add values received from a fellow chare to a receive buffer
+//! \param[in] fromch Sender chare ID
+//! \param[in] c Values received, see pack()
+//! \param[in,out] buf Receive buffer with values at chare-boundary nodes
+// *****************************************************************************
+{
+  auto dof = m_A.Ncomp();
+  const auto& pos = tk::cref_find( m_sharedpos, fromch );
+  Assert( c.size() == pos.size()*dof, "Size mismatch" );
 
-  contribute( sizeof(tk::real), &d, CkReduction::sum_double, c );
+  for (std::size_t j=0; j<pos.size(); ++j)
+    for (std::size_t d=0; d<dof; ++d) buf[pos[j]*dof+d] += c[j*dof+d];
+}
+
+void
+ConjugateGradients::assemble( std::vector< tk::real >& buf,
+                              std::vector< tk::real >& v ) const
+// *****************************************************************************
+//  Add receive buffer to a vector at chare-boundary nodes and zero buffer
+//! \param[in,out] buf Receive buffer with values at chare-boundary nodes
+//! \param[in,out] v Vector to add received values to
+// *****************************************************************************
+{
+  auto dof = m_A.Ncomp();
+  for (std::size_t j=0; j<m_shared.size(); ++j)
+    for (std::size_t d=0; d<dof; ++d) {
+      v[ m_shared[j]*dof+d ] += buf[j*dof+d];
+      buf[j*dof+d] = 0.0;
+    }
+}
+
+bool
+ConjugateGradients::receive( Halo& h,
+                             int fromch,
+                             std::size_t seq,
+                             const std::vector< tk::real >& c )
+// *****************************************************************************
+//  Receive contributions to an exchange of a sequence
+//! \param[in,out] h Receive buffers of the sequence of exchanges
+//! \param[in] fromch Sender chare ID
+//! \param[in] seq Sequence number of the exchange the contributions belong to
+//! \param[in] c Values received, see pack()
+//! \return True if all contributions to the exchange to be assembled next
+//!   have arrived
+// *****************************************************************************
+{
+  Assert( seq == h.seq || seq == h.seq+1, "Exchange out of sequence" );
+
+  unpack( fromch, c, h.buf[seq%2] );
+  return ++h.cnt[seq%2] == m_nodeCommMap.size() && seq == h.seq;
+}
+
+bool
+ConjugateGradients::assemble( Halo& h, std::vector< tk::real >& v )
+// *****************************************************************************
+//  Assemble the current exchange of a sequence into a vector
+//! \param[in,out] h Receive buffers of the sequence of exchanges
+//! \param[in,out] v Vector to add received values to
+//! \return True if all contributions to the next exchange have already
+//!   arrived
+// *****************************************************************************
+{
+  auto i = h.seq % 2;
+  assemble( h.buf[i], v );
+  h.cnt[i] = 0;
+  ++h.seq;
+
+  return !m_nodeCommMap.empty() && h.cnt[1-i] == m_nodeCommMap.size();
 }
 
 void
@@ -142,47 +343,41 @@ void
 ConjugateGradients::residual()
 // *****************************************************************************
 //  Initiate A * x for computing the initial residual, r = b - A * x
+//! \details If preconditioned, the diagonal of the matrix is also assembled
+//!   across chares, as required to set up the preconditioner.
 // *****************************************************************************
 {
   // Compute own contribution to r = A * x
-  m_A.mult( m_x, m_r );
+  mult( m_x, m_r );
 
   // Send partial product on chare-boundary nodes to fellow chares
   if (m_nodeCommMap.empty()) {
     comres_complete();
   } else {
-    auto dof = m_A.Ncomp();
-    for (const auto& [c,n] : m_nodeCommMap) {
-      std::vector< std::vector< tk::real > > rc( n.size() );
-      std::size_t j = 0;
-      for (auto g : n) {
-        std::vector< tk::real > nr( dof );
-        auto lid = tk::cref_find( m_lid, g );
-        for (std::size_t d=0; d<dof; ++d) nr[d] = m_r[ lid*dof+d ];
-        rc[j++] = std::move(nr);
-      }
-      thisProxy[c].comres( std::vector<std::size_t>(begin(n),end(n)), rc );
-    }
+    std::vector< tk::real > d;
+    if (m_opt.precond != CGPrecond::NONE) d = m_A.diag();
+    for (const auto& [c,pos] : m_sharedpos)
+      thisProxy[c].comres( thisIndex, pack(pos,m_r),
+                           d.empty() ? d : pack(pos,d) );
   }
 
   ownres_complete();
 }
 
 void
-ConjugateGradients::comres( const std::vector< std::size_t >& gid,
-                            const std::vector< std::vector< tk::real > >& rc )
+ConjugateGradients::comres( int fromch,
+                            const std::vector< tk::real >& rc,
+                            const std::vector< tk::real >& dc )
 // *****************************************************************************
-//  Receive contributions to A * x on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive contributions
-//! \param[in] rc Partial contributions at chare-boundary nodes
+//  Receive contributions to A * x and diag(A) on chare-boundaries
+//! \param[in] fromch Sender chare ID
+//! \param[in] rc Partial contributions to A * x at chare-boundary nodes
+//! \param[in] dc Partial contributions to diag(A) at chare-boundary nodes,
+//!   empty if not preconditioned
 // *****************************************************************************
 {
-  Assert( rc.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i)
-    m_rc[ gid[i] ] += rc[i];
+  unpack( fromch, rc, m_rc );
+  if (!dc.empty()) unpack( fromch, dc, m_dc );
 
   if (++m_nr == m_nodeCommMap.size()) {
     m_nr = 0;
@@ -197,17 +392,19 @@ ConjugateGradients::initres()
 // *****************************************************************************
 {
   // Combine own and communicated contributions to r = A * x
-  auto dof = m_A.Ncomp();
-  for (const auto& [gid,r] : m_rc) {
-    auto lid = tk::cref_find( m_lid, gid );
-    for (std::size_t c=0; c<dof; ++c) m_r[lid*dof+c] += r[c];
-  }
-  tk::destroy( m_rc );
+  assemble( m_rc, m_r );
 
   // Finish computing initial residual, r = b - A * x
   for (auto& r : m_r) r *= -1.0;
   m_r += m_b;
 
+  // Set up preconditioner with diagonal combined across chares
+  if (m_opt.precond != CGPrecond::NONE) {
+    auto d = m_A.diag();
+    if (!m_dc.empty()) assemble( m_dc, d );
+    m_M = Preconditioner( m_opt.precond, m_A, d );
+  }
+
   m_initialized.send( CkDataMsg::buildNew( sizeof(tk::real), &m_normb ) );
 }
 
@@ -216,94 +413,148 @@ ConjugateGradients::solve( CkCallback c )
 // *****************************************************************************
 //  Solve linear system
 //! \param[in] c Call to continue with after solve is complete
+//! \details The callback receives two reals: the L2 norm of the residual and
+//!   the number of iterations taken.
 // *****************************************************************************
 {
   m_solved = c;
   m_it = 0;
-  next();
+
+  // initiate computing u = M^{-1} r
+  thisProxy[ thisIndex ].wait4u();
+  precond( m_r, m_u );
+}
+
+void
+ConjugateGradients::precond( const std::vector< tk::real >& v,
+                             std::vector< tk::real >& z )
+// *****************************************************************************
+//  Initiate applying the preconditioner: z = M^{-1} v
+//! \param[in] v Vector to apply the preconditioner to
+//! \param[in,out] z Preconditioned vector
+//! \details Jacobi yields the same value on all chares sharing a node, since
+//!   it uses the diagonal combined across chares, so it needs no
+//!   communication. With block-Jacobi each chare applies the inverse of its
+//!   own block and the results are summed on chare-boundary nodes, which is
+//!   an additive Schwarz preconditioner without overlap, symmetric as
+//!   required by conjugate gradients.
+// *****************************************************************************
+{
+  m_M.apply( v, z );
+
+  // Send partial result on chare-boundary nodes to fellow chares
+  if (m_nodeCommMap.empty() || m_opt.precond != CGPrecond::ILU0) {
+    comz_complete();
+  } else {
+    for (const auto& [c,pos] : m_sharedpos)
+      thisProxy[c].comz( thisIndex, m_zh.seq, pack(pos,z) );
+  }
+
+  ownz_complete();
 }
 
 void
-ConjugateGradients::next()
+ConjugateGradients::comz( int fromch,
+                          std::size_t seq,
+                          const std::vector< tk::real >& zc )
 // *****************************************************************************
-//  Start next linear solver iteration
+//  Receive contributions to a preconditioned vector on chare-boundaries
+//! \param[in] fromch Sender chare ID
+//! \param[in] seq Sequence number of the exchange
+//! \param[in] zc Partial contributions at chare-boundary nodes
 // *****************************************************************************
 {
-  // initiate computing rho = (r,r)
-  dot( m_r, m_r,
-       CkCallback( CkReductionTarget(ConjugateGradients,rho), thisProxy ) );
+  if (receive( m_zh, fromch, seq, zc )) comz_complete();
+}
+
+void
+ConjugateGradients::u()
+// *****************************************************************************
+// Finish computing u = M^{-1} r
+// *****************************************************************************
+{
+  // Combine own and communicated contributions to u = M^{-1} r
+  if (m_opt.precond == CGPrecond::ILU0 && assemble( m_zh, m_u ))
+    comz_complete();
+
+  if (m_opt.pipelined) {
+
+    // initiate computing w = A * u
+    thisProxy[ thisIndex ].wait4w();
+    spmv( m_u, m_w );
+
+  } else {
+
+    // initiate computing (r,r) and rho = (r,u) in a single reduction
+    std::vector< tk::real > d{ dot( m_r, m_r ), dot( m_r, m_u ) };
+    contribute( d, CkReduction::sum_double,
+      CkCallback( CkReductionTarget(ConjugateGradients,rho), thisProxy ) );
+
+  }
 }
 
 void
-ConjugateGradients::rho( tk::real r )
+ConjugateGradients::rho( tk::real rr, tk::real ru )
 // *****************************************************************************
-// Compute rho = (r,r)
-//! \param[in] r Dot product, rho = (r,r) (aggregated across all chares)
+// Receive dot products (r,r) and (r,u) of classic CG
+//! \param[in] rr Dot product, (r,r) (aggregated across all chares)
+//! \param[in] ru Dot product, rho = (r,u) (aggregated across all chares)
 // *****************************************************************************
 {
-  m_rho = r;
+  auto norm = std::sqrt( rr );
+
+  if (m_it > 0 && (m_it >= m_maxit || norm <= m_tol*m_normb)) {
+    done( norm );
+    return;
+  }
+
+  m_rho = ru;
   if (m_it == 0) m_alpha = 0.0; else m_alpha = m_rho/m_rho0;
   m_rho0 = m_rho;
 
-  // compute p = r + alpha * p
-  for (std::size_t i=0; i<m_p.size(); ++i) m_p[i] = m_r[i] + m_alpha * m_p[i];
+  // compute p = u + alpha * p
+  for (std::size_t i=0; i<m_p.size(); ++i) m_p[i] = m_u[i] + m_alpha * m_p[i];
 
   // initiate computing q = A * p
   thisProxy[ thisIndex ].wait4q();
-  qAp();
+  spmv( m_p, m_q );
 }
 
-
 void
-ConjugateGradients::qAp()
+ConjugateGradients::spmv( const std::vector< tk::real >& x,
+                          std::vector< tk::real >& y )
 // *****************************************************************************
-//  Initiate computing q = A * p
+//  Initiate computing a matrix-vector product: y = A * x
+//! \param[in] x Vector to multiply matrix with from the right
+//! \param[in,out] y Result vector of product y = A * x
 // *****************************************************************************
 {
-  // Compute own contribution to q = A * p
-  m_A.mult( m_p, m_q );
+  // Compute own contribution to y = A * x
+  mult( x, y );
 
   // Send partial product on chare-boundary nodes to fellow chares
   if (m_nodeCommMap.empty()) {
     comq_complete();
   } else {
-    auto dof = m_A.Ncomp();
-    for (const auto& [c,n] : m_nodeCommMap) {
-      std::vector< std::vector< tk::real > > qc( n.size() );
-      std::size_t j = 0;
-      for (auto g : n) {
-        std::vector< tk::real > nq( dof );
-        auto lid = tk::cref_find( m_lid, g );
-        for (std::size_t d=0; d<dof; ++d) nq[d] = m_q[ lid*dof+d ];
-        qc[j++] = std::move(nq);
-      }
-      thisProxy[c].comq( std::vector<std::size_t>(begin(n),end(n)), qc );
-    }
+    for (const auto& [c,pos] : m_sharedpos)
+      thisProxy[c].comq( thisIndex, m_qh.seq, pack(pos,y) );
   }
 
   ownq_complete();
 }
 
 void
-ConjugateGradients::comq( const std::vector< std::size_t >& gid,
-                          const std::vector< std::vector< tk::real > >& qc )
+ConjugateGradients::comq( int fromch,
+                          std::size_t seq,
+                          const std::vector< tk::real >& qc )
 // *****************************************************************************
-//  Receive contributions to q = A * p on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive contributions
+//  Receive contributions to a matrix-vector product on chare-boundaries
+//! \param[in] fromch Sender chare ID
+//! \param[in] seq Sequence number of the exchange
 //! \param[in] qc Partial contributions at chare-boundary nodes
 // *****************************************************************************
 {
-  Assert( qc.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i)
-    m_qc[ gid[i] ] += qc[i];
-
-  if (++m_nq == m_nodeCommMap.size()) {
-    m_nq = 0;
-    comq_complete();
-  }
+  if (receive( m_qh, fromch, seq, qc )) comq_complete();
 }
 
 void
@@ -312,17 +563,13 @@ ConjugateGradients::q()
 // Finish computing q = A * p
 // *****************************************************************************
 {
-  // Combine own and communicated contributions to r = A * x
-  auto dof = m_A.Ncomp();
-  for (const auto& [gid,q] : m_qc) {
-    auto lid = tk::cref_find( m_lid, gid );
-    for (std::size_t c=0; c<dof; ++c) m_q[lid*dof+c] += q[c];
-  }
-  tk::destroy( m_qc );
+  // Combine own and communicated contributions to q = A * p
+  if (assemble( m_qh, m_q )) comq_complete();
 
   // initiate computing (p,q)
-  dot( m_p, m_q,
-       CkCallback( CkReductionTarget(ConjugateGradients,pq), thisProxy ) );
+  auto d = dot( m_p, m_q );
+  contribute( sizeof(tk::real), &d, CkReduction::sum_double,
+    CkCallback( CkReductionTarget(ConjugateGradients,pq), thisProxy ) );
 }
 
 void
@@ -336,40 +583,132 @@ ConjugateGradients::pq( tk::real d )
 
   m_alpha = m_rho / d;
 
-  // compute r = r - alpha * q
-  for (std::size_t i=0; i<m_r.size(); ++i) m_r[i] -= m_alpha * m_q[i];
+  // advance solution: x = x + alpha * p, and residual: r = r - alpha * q
+  for (std::size_t i=0; i<m_r.size(); ++i) {
+    m_x[i] += m_alpha * m_p[i];
+    m_r[i] -= m_alpha * m_q[i];
+  }
+
+  ++m_it;
 
-  // initiate computing norm of residual: (r,r)
-  dot( m_r, m_r,
-       CkCallback( CkReductionTarget(ConjugateGradients,normres), thisProxy ) );
+  // initiate computing u = M^{-1} r
+  thisProxy[ thisIndex ].wait4u();
+  precond( m_r, m_u );
 }
 
 void
-ConjugateGradients::normres( tk::real r )
+ConjugateGradients::w()
 // *****************************************************************************
-// Compute norm of residual: (r,r)
-//! \param[in] r Dot product, (r,r) (aggregated across all chares)
+// Pipelined CG: finish computing w = A * u
 // *****************************************************************************
 {
-  auto norm = std::sqrt( r );
+  // Combine own and communicated contributions to w = A * u
+  if (assemble( m_qh, m_w )) comq_complete();
 
-  // advance solution: x = x + alpha * p
-  for (std::size_t i=0; i<m_x.size(); ++i) m_x[i] += m_alpha * m_p[i];
+  pnext();
+}
 
-  ++m_it;
+void
+ConjugateGradients::pnext()
+// *****************************************************************************
+// Pipelined CG: start next iteration
+//! \details The reduction computing gamma = (r,u), delta = (w,u), and (r,r) is
+//!   started first, and its result is only waited for after computing
+//!   m = M^{-1} w and n = A * m, including communication.
+// *****************************************************************************
+{
+  thisProxy[ thisIndex ].wait4n();
+
+  // initiate computing gamma, delta, and (r,r) in a single reduction
+  std::vector< tk::real > d{ dot( m_r, m_u ), dot( m_w, m_u ), dot( m_r, m_r ) };
+  contribute( d, CkReduction::sum_double,
+    CkCallback( CkReductionTarget(ConjugateGradients,dots), thisProxy ) );
+
+  // initiate computing m = M^{-1} w
+  thisProxy[ thisIndex ].wait4m();
+  precond( m_w, m_m );
+}
+
+void
+ConjugateGradients::dots( tk::real gamma, tk::real delta, tk::real rr )
+// *****************************************************************************
+// Receive dot products (r,u), (w,u), and (r,r) of pipelined CG
+//! \param[in] gamma Dot product, (r,u) (aggregated across all chares)
+//! \param[in] delta Dot product, (w,u) (aggregated across all chares)
+//! \param[in] rr Dot product, (r,r) (aggregated across all chares)
+// *****************************************************************************
+{
+  m_rho0 = m_gamma;     // save gamma of previous iteration
+  m_gamma = gamma;
+  m_delta = delta;
+  m_rr = rr;
+  dots_complete();
+}
+
+void
+ConjugateGradients::m()
+// *****************************************************************************
+// Pipelined CG: finish computing m = M^{-1} w
+// *****************************************************************************
+{
+  // Combine own and communicated contributions to m = M^{-1} w
+  if (m_opt.precond == CGPrecond::ILU0 && assemble( m_zh, m_m ))
+    comz_complete();
+
+  // initiate computing n = A * m
+  spmv( m_m, m_n );
+}
 
-  if (m_it < m_maxit && norm > m_tol*m_normb) {
-    //std::cout << "ch:" << thisIndex << ", it:" << m_it << ": " << norm << " >? " << m_tol*m_normb << '\n';
-    next();
+void
+ConjugateGradients::n()
+// *****************************************************************************
+// Pipelined CG: finish computing n = A * m and update vectors
+// *****************************************************************************
+{
+  // Combine own and communicated contributions to n = A * m
+  if (assemble( m_qh, m_n )) comq_complete();
+
+  auto norm = std::sqrt( m_rr );
+
+  if (m_it > 0 && (m_it >= m_maxit || norm <= m_tol*m_normb)) {
+    done( norm );
+    return;
+  }
+
+  tk::real beta = 0.0;
+  if (m_it == 0) {
+    Assert( std::abs(m_delta) > 1.0e-14, "Conjugate Gradients: (w,u) zero" );
+    m_alpha = m_gamma / m_delta;
   } else {
-     //std::cout << thisIndex << "x: ";
-     ////std::size_t j=0; for (auto i : m_x) std::cout << m_gid[j++] << ':' << i << ' ';
-     //for (auto i : m_x) std::cout << i << ' ';
-     //std::cout << '\n';
-     //std::cout << "ch:" << thisIndex << ", it:" << m_it << ": " << norm << '\n';
-     m_solved.send( CkDataMsg::buildNew( sizeof(tk::real), &norm ) );
+    beta = m_gamma / m_rho0;
+    m_alpha = m_gamma / (m_delta - beta * m_gamma / m_alpha);
+  }
+
+  for (std::size_t i=0; i<m_x.size(); ++i) {
+    m_z[i] = m_n[i] + beta * m_z[i];
+    m_q[i] = m_m[i] + beta * m_q[i];
+    m_s[i] = m_w[i] + beta * m_s[i];
+    m_p[i] = m_u[i] + beta * m_p[i];
+    m_x[i] += m_alpha * m_p[i];
+    m_r[i] -= m_alpha * m_s[i];
+    m_u[i] -= m_alpha * m_q[i];
+    m_w[i] -= m_alpha * m_z[i];
   }
+
+  ++m_it;
+
+  pnext();
 }
 
+void
+ConjugateGradients::done( tk::real norm )
+// *****************************************************************************
+// Finish solve
+//! \param[in] norm L2 norm of the residual
+// *****************************************************************************
+{
+  std::array< tk::real, 2 > r{{ norm, static_cast< tk::real >( m_it ) }};
+  m_solved.send( CkDataMsg::buildNew( sizeof(r), r.data() ) );
+}
 
 #include "NoWarning/conjugategradients.def.h"
@@ -16,13 +16,24 @@
     The implementation uses the Charm++ runtime system and is fully
     asynchronous, overlapping computation and communication. The algorithm
     utilizes the structured dagger (SDAG) Charm++ functionality.
+
+    The solver optionally uses a preconditioner (Jacobi or block-Jacobi with
+    ILU(0) blocks), the pipelined variant of conjugate gradients, which
+    requires a single global reduction per iteration that overlaps with a
+    preconditioner application and a matrix-vector product, and sparse
+    matrix-vector products in SELL-C-sigma storage, see tk::CGOptions.
 */
 // *****************************************************************************
 #ifndef ConjugateGradients_h
 #define ConjugateGradients_h
 
+#include <map>
+
 #include "Types.hpp"
 #include "CSR.hpp"
+#include "SELL.hpp"
+#include "Preconditioner.hpp"
+#include "CGOptions.hpp"
 
 #include "NoWarning/conjugategradients.decl.h"
 
@@ -58,7 +69,8 @@ class ConjugateGradients : public CBase_ConjugateGradients {
       tk::real stop_tol,
       const std::vector< std::size_t >& gid,
       const std::unordered_map< std::size_t, std::size_t >& lid,
-      const NodeCommMap& nodecommmap );
+      const NodeCommMap& nodecommmap,
+      const CGOptions& opt );
 
     //! Migrate constructor
     //explicit ConjugateGradients( CkMigrateMessage* ) {}
@@ -72,22 +84,29 @@ class ConjugateGradients : public CBase_ConjugateGradients {
     //! Compute the norm of the right hand side
     void normb( tk::real n );
 
-    //! Compute rho = (r,r)
-    void rho( tk::real r );
+    //! Receive dot products (r,r) and (r,u) of classic CG
+    void rho( tk::real rr, tk::real ru );
+
+    //! Receive contributions to r = b - A * x and diag(A) on chare-boundaries
+    void comres( int fromch,
+                 const std::vector< tk::real >& rc,
+                 const std::vector< tk::real >& dc );
 
-    //! Receive contributions to r = b - A * x on chare-boundaries
-    void comres( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& rc );
+    //! Receive contributions to a preconditioned vector on chare-boundaries
+    void comz( int fromch,
+               std::size_t seq,
+               const std::vector< tk::real >& zc );
 
-    //! Receive contributions to q = A * p on chare-boundaries
-    void comq( const std::vector< std::size_t >& gid,
-               const std::vector< std::vector< tk::real > >& qc );
+    //! Receive contributions to a matrix-vector product on chare-boundaries
+    void comq( int fromch,
+               std::size_t seq,
+               const std::vector< tk::real >& qc );
 
     //! Compute the dot product (p,q)
     void pq( tk::real n );
 
-    //! Compute the norm of the residual: (r,r)
-    void normres( tk::real r );
+    //! Receive dot products (r,u), (w,u), and (r,r) of pipelined CG
+    void dots( tk::real gamma, tk::real delta, tk::real rr );
 
     /** @name Pack/unpack (Charm++ serialization) routines */
     ///@{
@@ -95,18 +114,31 @@ class ConjugateGradients : public CBase_ConjugateGradients {
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er &p ) override {
       p | m_A;
+      p | m_S;
+      p | m_M;
+      p | m_opt;
       p | m_x;
       p | m_b;
       p | m_gid;
       p | m_lid;
       p | m_nodeCommMap;
+      p | m_own;
+      p | m_shared;
+      p | m_sharedpos;
       p | m_r;
       p | m_rc;
+      p | m_dc;
       p | m_nr;
+      p | m_u;
+      p | m_zh;
       p | m_p;
       p | m_q;
-      p | m_qc;
-      p | m_nq;
+      p | m_qh;
+      p | m_w;
+      p | m_m;
+      p | m_n;
+      p | m_z;
+      p | m_s;
       p | m_initialized;
       p | m_solved;
       p | m_normb;
@@ -116,6 +148,9 @@ class ConjugateGradients : public CBase_ConjugateGradients {
       p | m_rho;
       p | m_rho0;
       p | m_alpha;
+      p | m_gamma;
+      p | m_delta;
+      p | m_rr;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -124,8 +159,37 @@ class ConjugateGradients : public CBase_ConjugateGradients {
     ///@}
 
   private:
+    //! \brief Receive buffers for communication of a sequence of vectors on
+    //!   chare-boundaries
+    //! \details In pipelined CG consecutive exchanges are not separated by a
+    //!   global reduction, so a fellow chare may already send contributions to
+    //!   the next exchange before all contributions to the current one have
+    //!   arrived. Contributions are therefore double-buffered by the parity of
+    //!   the sequence number of the exchange they belong to.
+    struct Halo {
+      //! Receive buffers, values at chare-boundary nodes, see m_shared
+      std::vector< std::vector< tk::real > > buf;
+      //! Number of fellow chares received from, for each buffer
+      std::vector< std::size_t > cnt;
+      //! Sequence number of the exchange to be assembled next
+      std::size_t seq;
+      //! Pack/Unpack serialize member function
+      //! \param[in,out] p Charm++'s PUP::er serializer object reference
+      void pup( PUP::er& p ) { p | buf; p | cnt; p | seq; }
+      //! Pack/Unpack serialize operator|
+      //! \param[in,out] p Charm++'s PUP::er serializer object reference
+      //! \param[in,out] h Halo object reference
+      friend void operator|( PUP::er& p, Halo& h ) { h.pup(p); }
+    };
+
     //! Sparse matrix
     CSR m_A;
+    //! Sparse matrix in SELL-C-sigma storage if configured
+    SELL m_S;
+    //! Preconditioner
+    Preconditioner m_M;
+    //! Solver options
+    CGOptions m_opt;
     //! Solution/unknown
     std::vector< tk::real > m_x;
     //! Right hand side
@@ -136,20 +200,43 @@ class ConjugateGradients : public CBase_ConjugateGradients {
     std::unordered_map< std::size_t, std::size_t > m_lid;
     //! Global mesh node IDs shared with other chares associated to chare IDs
     NodeCommMap m_nodeCommMap;
-    //! Auxiliary vector for CG solve
+    //! Rows owned by this chare, contributing to dot products
+    std::vector< std::size_t > m_own;
+    //! Local node IDs of chare-boundary nodes
+    std::vector< std::size_t > m_shared;
+    //! \brief Indices into m_shared of the nodes shared with fellow chares,
+    //!   ordered by global node ID, associated to chare IDs
+    //! \details Both sides of a chare-boundary order the shared nodes the same
+    //!   way, so communication buffers contain values only.
+    std::map< int, std::vector< std::size_t > > m_sharedpos;
+    //! Residual
     std::vector< tk::real > m_r;
     //! Receive buffer for communication of r = b - A * x
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rc;
+    std::vector< tk::real > m_rc;
+    //! Receive buffer for communication of diag(A)
+    std::vector< tk::real > m_dc;
     //! Counter for assembling m_r
     std::size_t m_nr;
-    //! Auxiliary vector for CG solve
+    //! Preconditioned residual, u = M^{-1} r
+    std::vector< tk::real > m_u;
+    //! Receive buffers for communication of preconditioned vectors
+    Halo m_zh;
+    //! Search direction
     std::vector< tk::real > m_p;
-    //! Auxiliary vector for CG solve
+    //! Classic CG: q = A * p, pipelined CG: auxiliary vector, q = M^{-1} s
     std::vector< tk::real > m_q;
-    //! Receive buffer for communication of q = A * p
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_qc;
-    //! Counter for assembling m_q
-    std::size_t m_nq;
+    //! Receive buffers for communication of matrix-vector products
+    Halo m_qh;
+    //! Pipelined CG: w = A * u
+    std::vector< tk::real > m_w;
+    //! Pipelined CG: m = M^{-1} w
+    std::vector< tk::real > m_m;
+    //! Pipelined CG: n = A * m
+    std::vector< tk::real > m_n;
+    //! Pipelined CG: auxiliary vector, z = A * q
+    std::vector< tk::real > m_z;
+    //! Pipelined CG: auxiliary vector, s = A * p
+    std::vector< tk::real > m_s;
     //! Charm++ callback to continue with when the initialization is complete
     CkCallback m_initialized;
     //! Charm++ callback to continue with when the solve is complete
@@ -168,24 +255,70 @@ class ConjugateGradients : public CBase_ConjugateGradients {
     tk::real m_rho0;
     //! Helper scalar for CG algorithm
     tk::real m_alpha;
+    //! Pipelined CG: dot product (r,u)
+    tk::real m_gamma;
+    //! Pipelined CG: dot product (w,u)
+    tk::real m_delta;
+    //! Pipelined CG: dot product (r,r)
+    tk::real m_rr;
+
+    //! Compute own contribution to the dot product of two vectors
+    tk::real dot( const std::vector< tk::real >& a,
+                  const std::vector< tk::real >& b ) const;
+
+    //! Compute own contribution to matrix-vector product: y = A * x
+    void mult( const std::vector< tk::real >& x, std::vector< tk::real >& y )
+    const;
 
-    //! Initiate computationa of dot product of two vectors
-    void dot( const std::vector< tk::real >& a,
-              const std::vector< tk::real >& b,
-              CkCallback c );
+    //! Collect values of a vector at nodes shared with a fellow chare
+    std::vector< tk::real > pack( const std::vector< std::size_t >& pos,
+                                  const std::vector< tk::real >& v ) const;
+
+    //! Add values received from a fellow chare to a receive buffer
+    void unpack( int fromch,
+                 const std::vector< tk::real >& c,
+                 std::vector< tk::real >& buf ) const;
+
+    //! Add receive buffer to a vector at chare-boundary nodes and zero buffer
+    void assemble( std::vector< tk::real >& buf, std::vector< tk::real >& v )
+    const;
+
+    //! Receive contributions to an exchange of a sequence
+    bool receive( Halo& h,
+                  int fromch,
+                  std::size_t seq,
+                  const std::vector< tk::real >& c );
+
+    //! Assemble the current exchange of a sequence into a vector
+    bool assemble( Halo& h, std::vector< tk::real >& v );
 
     //! Initiate A * x for computing the initial residual, r = b - A * x
     void residual();
     //! Compute the initial residual, r = b - A * x
     void initres();
 
-    //! Initiate computing q = A * p
-    void qAp();
+    //! Initiate applying the preconditioner: z = M^{-1} v
+    void precond( const std::vector< tk::real >& v,
+                  std::vector< tk::real >& z );
+    //! Finish computing u = M^{-1} r
+    void u();
+
+    //! Initiate computing a matrix-vector product: y = A * x
+    void spmv( const std::vector< tk::real >& x, std::vector< tk::real >& y );
     //! Finish computing q = A * p
     void q();
 
-    //! Start next linear solver iteration
-    void next();
+    //! Pipelined CG: finish computing w = A * u
+    void w();
+    //! Pipelined CG: start next iteration
+    void pnext();
+    //! Pipelined CG: finish computing m = M^{-1} w
+    void m();
+    //! Pipelined CG: finish computing n = A * m and update vectors
+    void n();
+
+    //! Finish solve
+    void done( tk::real norm );
 };
 
 } // tk::
@@ -0,0 +1,147 @@
+// *****************************************************************************
+/*!
+  \file      src/LinearSolver/Preconditioner.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Preconditioners for the conjugate gradients linear solver
+  \details   Preconditioners for the conjugate gradients linear solver.
+  \see Y. Saad, Iterative Methods for Sparse Linear Systems: Second Edition,
+    ISBN 9780898718003, 2003, Algorithm 10.4, ILU(0).
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <algorithm>
+
+#include "Exception.hpp"
+#include "Preconditioner.hpp"
+
+using tk::Preconditioner;
+
+Preconditioner::Preconditioner( CGPrecond type,
+                                const CSR& A,
+                                const std::vector< real >& diag ) :
+  m_type( type ),
+  m_dinv(),
+  m_ia(),
+  m_ja(),
+  m_dpos(),
+  m_lu()
+// *****************************************************************************
+//  Constructor: set up preconditioner
+//! \param[in] type Preconditioner type
+//! \param[in] A Sparse matrix (part stored on this partition)
+//! \param[in] diag Diagonal of the matrix. In parallel this must contain the
+//!   contributions from all partitions on rows shared by multiple partitions,
+//!   and it replaces the diagonal of A in the ILU(0) factorization, which
+//!   keeps the factorization nonsingular on partitions without Dirichlet
+//!   boundary conditions.
+// *****************************************************************************
+{
+  Assert( diag.size() == A.rsize(), "Size mismatch" );
+
+  if (m_type == CGPrecond::JACOBI) {
+
+    m_dinv.resize( diag.size() );
+    for (std::size_t i=0; i<diag.size(); ++i) {
+      Assert( std::abs(diag[i]) > 0.0, "Zero diagonal in Jacobi" );
+      m_dinv[i] = 1.0 / diag[i];
+    }
+
+  } else if (m_type == CGPrecond::ILU0) {
+
+    ilu0( A, diag );
+
+  }
+}
+
+void
+Preconditioner::ilu0( const CSR& A, const std::vector< real >& diag )
+// *****************************************************************************
+//  Compute ILU(0) factorization
+//! \param[in] A Sparse matrix (part stored on this partition)
+//! \param[in] diag Diagonal of the matrix to use instead of that of A
+//! \details The factors are computed row by row (IKJ variant) in place of a
+//!   copy of the matrix values, keeping only the entries at the nonzero
+//!   positions of A. Column indices of CSR are sorted within rows, so the
+//!   strictly lower triangular entries of a row precede the diagonal.
+// *****************************************************************************
+{
+  const auto& ia = A.rowptr();
+  const auto& ja = A.colidx();
+  const auto nrow = A.rsize();
+
+  // Convert to 0-based indexing and find diagonal positions
+  m_ia.resize( ia.size() );
+  for (std::size_t i=0; i<ia.size(); ++i) m_ia[i] = ia[i] - 1;
+  m_ja.resize( ja.size() );
+  for (std::size_t j=0; j<ja.size(); ++j) m_ja[j] = ja[j] - 1;
+  m_lu = A.values();
+  m_dpos.resize( nrow );
+  for (std::size_t i=0; i<nrow; ++i) {
+    auto b = m_ja.cbegin() + m_ia[i], e = m_ja.cbegin() + m_ia[i+1];
+    auto d = std::lower_bound( b, e, i );
+    Assert( d != e && *d == i, "Missing diagonal in ILU(0)" );
+    m_dpos[i] = static_cast< CSR::index_t >( d - m_ja.cbegin() );
+    m_lu[ m_dpos[i] ] = diag[i];
+  }
+
+  // Position of column j in the current row, if it is a nonzero
+  const auto none = static_cast< CSR::index_t >( ja.size() );
+  std::vector< CSR::index_t > pos( nrow, none );
+
+  for (std::size_t i=0; i<nrow; ++i) {
+    for (auto j=m_ia[i]; j<m_ia[i+1]; ++j) pos[ m_ja[j] ] = j;
+    for (auto j=m_ia[i]; j<m_dpos[i]; ++j) {
+      auto k = m_ja[j];
+      m_lu[j] /= m_lu[ m_dpos[k] ];     // l_ik = a_ik / u_kk
+      for (auto l=m_dpos[k]+1; l<m_ia[k+1]; ++l)
+        if (pos[ m_ja[l] ] != none) m_lu[ pos[m_ja[l]] ] -= m_lu[j] * m_lu[l];
+    }
+    ErrChk( std::abs(m_lu[m_dpos[i]]) > 0.0, "Zero pivot in ILU(0)" );
+    for (auto j=m_ia[i]; j<m_ia[i+1]; ++j) pos[ m_ja[j] ] = none;
+  }
+
+  m_dinv.resize( nrow );
+  for (std::size_t i=0; i<nrow; ++i) m_dinv[i] = 1.0 / m_lu[ m_dpos[i] ];
+}
+
+void
+Preconditioner::apply( const std::vector< real >& r, std::vector< real >& z )
+const
+// *****************************************************************************
+//  Apply preconditioner: z = M^{-1} r
+//! \param[in] r Vector to apply the preconditioner to
+//! \param[in,out] z Preconditioned vector
+// *****************************************************************************
+{
+  Assert( z.size() == r.size(), "Size mismatch" );
+
+  if (m_type == CGPrecond::NONE) {
+
+    std::copy( begin(r), end(r), begin(z) );
+
+  } else if (m_type == CGPrecond::JACOBI) {
+
+    for (std::size_t i=0; i<r.size(); ++i) z[i] = m_dinv[i] * r[i];
+
+  } else if (m_type == CGPrecond::ILU0) {
+
+    const auto nrow = m_dpos.size();
+    // Forward solve L y = r, L unit lower triangular, y stored in z
+    for (std::size_t i=0; i<nrow; ++i) {
+      auto s = r[i];
+      for (auto j=m_ia[i]; j<m_dpos[i]; ++j) s -= m_lu[j] * z[ m_ja[j] ];
+      z[i] = s;
+    }
+    // Backward solve U z = y
+    for (auto i=nrow; i-->0; ) {
+      auto s = z[i];
+      for (auto j=m_dpos[i]+1; j<m_ia[i+1]; ++j) s -= m_lu[j] * z[ m_ja[j] ];
+      z[i] = s * m_dinv[i];
+    }
+
+  }
+}
@@ -0,0 +1,89 @@
+// *****************************************************************************
+/*!
+  \file      src/LinearSolver/Preconditioner.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Preconditioners for the conjugate gradients linear solver
+  \details   Preconditioners for the conjugate gradients linear solver. A
+    preconditioner is set up from the part of a sparse matrix stored on a
+    partition (chare) and applies z = M^{-1} r using only data on that
+    partition. Jacobi uses the inverse of the diagonal. Block-Jacobi uses an
+    incomplete LU factorization without fill, ILU(0), of the partition's
+    matrix. For a symmetric matrix with symmetric sparsity pattern, ILU(0)
+    equals the incomplete Cholesky factorization, IC(0), in LDL^T form, so the
+    preconditioner is symmetric as required by conjugate gradients.
+*/
+// *****************************************************************************
+#ifndef Preconditioner_h
+#define Preconditioner_h
+
+#include <vector>
+
+#include "NoWarning/pup_stl.hpp"
+
+#include "Types.hpp"
+#include "CSR.hpp"
+#include "CGOptions.hpp"
+
+namespace tk {
+
+//! Preconditioner for the conjugate gradients linear solver
+class Preconditioner {
+
+  public:
+    //! Constructor: set up preconditioner
+    explicit Preconditioner( CGPrecond type,
+                             const CSR& A,
+                             const std::vector< real >& diag );
+
+    //! Empty constructor for Charm++
+    explicit Preconditioner() = default;
+
+    //! Apply preconditioner: z = M^{-1} r
+    void apply( const std::vector< real >& r, std::vector< real >& z ) const;
+
+    //! Query preconditioner type
+    //! \return Preconditioner type
+    CGPrecond type() const { return m_type; }
+
+    /** @name Pack/unpack (Charm++ serialization) routines */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_type;
+      p | m_dinv;
+      p | m_ia;
+      p | m_ja;
+      p | m_dpos;
+      p | m_lu;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c Preconditioner object reference
+    friend void operator|( PUP::er& p, Preconditioner& c ) { c.pup(p); }
+    ///@}
+
+  private:
+    //! Preconditioner type
+    CGPrecond m_type = CGPrecond::NONE;
+    //! Inverse of the diagonal (JACOBI) or of the diagonal of U (ILU0)
+    std::vector< real > m_dinv;
+    //! Row pointers (0-based) of ILU(0) factors
+    std::vector< CSR::index_t > m_ia;
+    //! Column indices (0-based) of ILU(0) factors
+    std::vector< CSR::index_t > m_ja;
+    //! Position of diagonal entries in each row of ILU(0) factors
+    std::vector< CSR::index_t > m_dpos;
+    //! ILU(0) factors: L (unit diagonal not stored) and U, in place of A
+    std::vector< real > m_lu;
+
+    //! Compute ILU(0) factorization
+    void ilu0( const CSR& A, const std::vector< real >& diag );
+};
+
+} // tk::
+
+#endif // Preconditioner_h
@@ -0,0 +1,106 @@
+// *****************************************************************************
+/*!
+  \file      src/LinearSolver/SELL.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Sliced ELLPACK (SELL-C-sigma) storage for a sparse matrix
+  \details   Sliced ELLPACK (SELL-C-sigma) storage for a sparse matrix.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+
+#include "Exception.hpp"
+#include "SELL.hpp"
+
+using tk::SELL;
+
+SELL::SELL( const CSR& A, std::size_t sigma ) :
+  m_perm( A.rsize() ),
+  m_cs( 1, 0 ),
+  m_col(),
+  m_val()
+// *****************************************************************************
+//  Constructor: convert a CSR matrix to SELL-C-sigma
+//! \param[in] A Sparse matrix in CSR format to convert
+//! \param[in] sigma Sorting window: rows are sorted by decreasing length within
+//!   windows of sigma rows. Rounded up to a multiple of the chunk height, C.
+//!   Larger windows reduce padding but scatter the result further.
+// *****************************************************************************
+{
+  const auto& ia = A.rowptr();
+  const auto& ja = A.colidx();
+  const auto& a = A.values();
+
+  const auto nrow = m_perm.size();
+  auto len = [&]( std::size_t i ){ return ia[i+1] - ia[i]; };
+
+  // Sort rows by decreasing length within windows of sigma rows
+  sigma = std::max( C, (sigma + C - 1) / C * C );
+  std::iota( begin(m_perm), end(m_perm), 0 );
+  for (std::size_t w=0; w<nrow; w+=sigma)
+    std::stable_sort( m_perm.begin() + static_cast< std::ptrdiff_t >( w ),
+      m_perm.begin() + static_cast< std::ptrdiff_t >( std::min(w+sigma,nrow) ),
+      [&]( index_t i, index_t j ){ return len(i) > len(j); } );
+
+  // Compute chunk widths and offsets
+  const auto nchunk = (nrow + C - 1) / C;
+  m_cs.resize( nchunk+1 );
+  for (std::size_t k=0; k<nchunk; ++k) {
+    std::size_t width = 0;
+    for (std::size_t l=k*C; l<std::min((k+1)*C,nrow); ++l)
+      width = std::max( width, std::size_t(len(m_perm[l])) );
+    ErrChk( m_cs[k] + width*C < std::numeric_limits< index_t >::max(),
+            "Number of SELL matrix entries exceeds the range of indices" );
+    m_cs[k+1] = static_cast< index_t >( m_cs[k] + width*C );
+  }
+
+  // Store values column-major within chunks, pad with zeros referring to the
+  // first column to keep the product free of branches
+  m_col.resize( m_cs.back(), 0 );
+  m_val.resize( m_cs.back(), 0.0 );
+  for (std::size_t k=0; k<nchunk; ++k)
+    for (std::size_t l=k*C; l<std::min((k+1)*C,nrow); ++l) {
+      auto i = m_perm[l];
+      for (std::size_t j=0; j<len(i); ++j) {
+        auto s = m_cs[k] + j*C + l%C;
+        m_col[s] = ja[ia[i]-1+j] - 1;
+        m_val[s] = a[ia[i]-1+j];
+      }
+    }
+}
+
+void
+SELL::mult( const std::vector< real >& x, std::vector< real >& r ) const
+// *****************************************************************************
+//  Multiply matrix with vector from the right: r = A * x
+//! \param[in] x Vector to multiply matrix with from the right
+//! \param[in] r Result vector of product r = A * x
+//! \details The inner loop over the C rows of a chunk has unit stride in the
+//!   matrix values and no dependencies, so the compiler vectorizes it.
+//! \note This is only complete in serial. In paralell, this computes the own
+//!   contributions to the product, so it must be followed by communication
+//!   combining the rows stored on multiple partitions.
+// *****************************************************************************
+{
+  Assert( x.size() >= rsize() && r.size() >= rsize(), "Size mismatch" );
+
+  const auto nrow = rsize();
+  const auto pc = m_col.data();
+  const auto pv = m_val.data();
+  const auto px = x.data();
+
+  for (std::size_t k=0; k<m_cs.size()-1; ++k) {
+    std::array< real, C > s;
+    s.fill( 0.0 );
+    for (std::size_t j=m_cs[k]; j<m_cs[k+1]; j+=C)
+      for (std::size_t l=0; l<C; ++l) s[l] += pv[j+l] * px[ pc[j+l] ];
+    for (std::size_t l=0; l<std::min(C,nrow-k*C); ++l)
+      r[ m_perm[k*C+l] ] = s[l];
+  }
+}
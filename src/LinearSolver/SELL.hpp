@@ -0,0 +1,88 @@
+// *****************************************************************************
+/*!
+  \file      src/LinearSolver/SELL.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Sliced ELLPACK (SELL-C-sigma) storage for a sparse matrix
+  \details   Sliced ELLPACK (SELL-C-sigma) storage for a sparse matrix. Rows
+    are grouped into chunks of C rows, and the nonzeros of a chunk are stored
+    column-major, padded to the longest row of the chunk, so that the sparse
+    matrix-vector product operates on C rows at a time with unit-stride access
+    to the matrix values, which vectorizes. To reduce padding, rows are sorted
+    by decreasing length within windows of sigma rows.
+  \see M. Kreutzer, G. Hager, G. Wellein, H. Fehske, A.R. Bishop, A unified
+    sparse matrix data format for efficient general sparse matrix-vector
+    multiplication on modern processors with wide SIMD units, SIAM Journal on
+    Scientific Computing, 36(5):C401-C423, 2014.
+*/
+// *****************************************************************************
+#ifndef SELL_h
+#define SELL_h
+
+#include <vector>
+#include <cstdint>
+
+#include "NoWarning/pup_stl.hpp"
+
+#include "Types.hpp"
+#include "CSR.hpp"
+
+namespace tk {
+
+//! Sliced ELLPACK (SELL-C-sigma) storage for a sparse matrix
+class SELL {
+
+  public:
+    //! Chunk height: number of rows processed together
+    static constexpr std::size_t C = 8;
+
+    //! Type of chunk pointers, column indices, and row permutation
+    using index_t = CSR::index_t;
+
+    //! Constructor: convert a CSR matrix to SELL-C-sigma
+    explicit SELL( const CSR& A, std::size_t sigma = 32*C );
+
+    //! Empty constructor for Charm++
+    explicit SELL() = default;
+
+    //! Multiply matrix with vector from the right: r = A * x
+    void mult( const std::vector< real >& x, std::vector< real >& r ) const;
+
+    //! Access real size of matrix
+    std::size_t rsize() const { return m_perm.size(); }
+
+    //! Access number of values stored including padding
+    std::size_t nstored() const { return m_val.size(); }
+
+    /** @name Pack/unpack (Charm++ serialization) routines */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_perm;
+      p | m_cs;
+      p | m_col;
+      p | m_val;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s SELL object reference
+    friend void operator|( PUP::er& p, SELL& s ) { s.pup(p); }
+    ///@}
+
+  private:
+    //! Original row index of the rows in sorted order
+    std::vector< index_t > m_perm;
+    //! Offsets of chunks into m_col and m_val
+    std::vector< index_t > m_cs;
+    //! Column indices (0-based) stored column-major within chunks
+    std::vector< index_t > m_col;
+    //! Nonzero matrix values stored column-major within chunks
+    std::vector< real > m_val;
+};
+
+} // tk::
+
+#endif // SELL_h
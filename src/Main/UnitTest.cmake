@@ -20,13 +20,16 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Base/TestException.cpp
                ../../tests/unit/Base/TestExceptionMPI.cpp
                ../../tests/unit/Base/TestFactory.cpp
+               ../../tests/unit/Base/TestFlatHash.cpp
                ../../tests/unit/Base/TestFlip_map.cpp
                ../../tests/unit/Base/TestHas.cpp
                ../../tests/unit/Base/TestPrint.cpp
                ../../tests/unit/Base/TestProcessControl.cpp
+               ../../tests/unit/Base/TestParallelFor.cpp
                ../../tests/unit/Base/TestPUPUtil.cpp
                ../../tests/unit/Base/TestReader.cpp
                ../../tests/unit/Base/TestPrintUtil.cpp
+               ../../tests/unit/Base/TestTable.cpp
                ../../tests/unit/Base/TestTaggedTuple.cpp
                ../../tests/unit/Base/TestTaggedTuplePrint.cpp
                ../../tests/unit/Base/TestTaggedTupleDeepPrint.cpp
@@ -44,23 +47,32 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Control/TestToggle.cpp
                ../../tests/unit/${TestScheme}
                ../../tests/unit/${TestError}
+               ../../tests/unit/${TestAMRContainers}
                ../../tests/unit/IO/TestExodusIIMeshReader.cpp
                ../../tests/unit/IO/TestMesh.cpp
                ../../tests/unit/IO/TestMeshReader.cpp
+               ../../tests/unit/IO/TestMmapTokenizer.cpp
                ../../tests/unit/LoadBalance/TestLinearMap.cpp
                ../../tests/unit/LoadBalance/TestLoadDistributor.cpp
                ../../tests/unit/LoadBalance/TestUnsMeshMap.cpp
                ../../tests/unit/LinearSolver/TestCSR.cpp
                ../../tests/unit/LinearSolver/TestConjugateGradients.cpp
                ../../tests/unit/Mesh/TestAround.cpp
+               ../../tests/unit/Mesh/TestBVH.cpp
                ../../tests/unit/Mesh/TestDerivedData.cpp
                ../../tests/unit/Mesh/TestDerivedData_MPISingle.cpp
+               ../../tests/unit/Mesh/TestEdgeList.cpp
                ../../tests/unit/Mesh/TestGradients.cpp
+               ../../tests/unit/Mesh/TestNodeCommPlan.cpp
                ../../tests/unit/Mesh/TestReorder.cpp
+               ../../tests/unit/${TestStiffenedGas}
+               ../../tests/unit/${TestQuadratureTable}
                ../../tests/unit/${TestMKLRNG}
                ../../tests/unit/${TestRNGSSE}
                ../../tests/unit/RNG/TestRNG.cpp
-               ../../tests/unit/RNG/TestRandom123.cpp)
+               ../../tests/unit/RNG/TestRandom123.cpp
+               ../../tests/unit/Statistics/TestStatistics.cpp
+               ../../tests/unit/Statistics/TestUniPDF.cpp)
 
 target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}
@@ -74,6 +86,18 @@ target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${PROJECT_BINARY_DIR}/../UnitTest
                            ${PROJECT_BINARY_DIR}/../IO)
 
+# The quadrature tables are tested without linking the Integrate library,
+# since the rest of that library depends on inciter's input deck
+if (ENABLE_INCITER)
+  target_sources(${UNITTEST_EXECUTABLE} PRIVATE
+                 ${QUINOA_SOURCE_DIR}/PDE/Integrate/Basis.cpp
+                 ${QUINOA_SOURCE_DIR}/PDE/Integrate/Quadrature.cpp
+                 ${QUINOA_SOURCE_DIR}/PDE/Integrate/QuadratureTable.cpp)
+  target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
+                             ${QUINOA_SOURCE_DIR}/PDE
+                             ${QUINOA_SOURCE_DIR}/Inciter)
+endif()
+
 config_executable(${UNITTEST_EXECUTABLE})
 
 target_link_libraries(${UNITTEST_EXECUTABLE}
@@ -81,6 +105,7 @@ target_link_libraries(${UNITTEST_EXECUTABLE}
                       Config
                       Init
                       RNG
+                      Statistics
                       ${MESHREFINEMENT}
                       UnitTest
                       UnitTestControl
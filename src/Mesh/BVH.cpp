@@ -0,0 +1,166 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/BVH.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Bounding volume hierarchy for point location in tetrahedron meshes
+  \details   Bounding volume hierarchy for point location in tetrahedron meshes.
+*/
+// *****************************************************************************
+
+#include <numeric>
+#include <algorithm>
+
+#include "BVH.hpp"
+#include "Exception.hpp"
+
+using tk::BVH;
+
+void
+BVH::build( const std::array< std::vector< tk::real >, 3 >& coord,
+            const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Build hierarchy from scratch
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \details The tree is built top-down. Each node is split at the median of
+//!   the element centroids along the longest extent of the centroids, which
+//!   yields a balanced tree. Nodes are appended in depth-first order so that
+//!   the left child of a node immediately follows it.
+// *****************************************************************************
+{
+  Assert( inpoel.size() % 4 == 0, "Size of inpoel must be divisible by 4" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  auto nelem = inpoel.size()/4;
+
+  m_node.clear();
+  m_elem.resize( nelem );
+  std::iota( begin(m_elem), end(m_elem), 0 );
+  if (nelem == 0) return;
+
+  // Compute element centroids (times 4)
+  std::vector< tk::real > cen( nelem*3 );
+  for (std::size_t e=0; e<nelem; ++e) {
+    const auto A = inpoel[e*4+0];
+    const auto B = inpoel[e*4+1];
+    const auto C = inpoel[e*4+2];
+    const auto D = inpoel[e*4+3];
+    cen[e*3+0] = x[A] + x[B] + x[C] + x[D];
+    cen[e*3+1] = y[A] + y[B] + y[C] + y[D];
+    cen[e*3+2] = z[A] + z[B] + z[C] + z[D];
+  }
+
+  // Nodes remaining to be built: element range, parent, and whether the node
+  // is the right child of its parent
+  struct Task { std::size_t first, last, parent; bool right; };
+  std::vector< Task > task{ { 0, nelem, 0, false } };
+  m_node.reserve( 2*nelem/LeafSize + 1 );
+
+  while (!task.empty()) {
+    auto t = task.back();
+    task.pop_back();
+
+    auto idx = m_node.size();
+    if (t.right) m_node[ t.parent ].first = idx;
+    m_node.push_back( {} );
+    bound( t.first, t.last, coord, inpoel, m_node.back() );
+
+    auto n = t.last - t.first;
+    if (n <= LeafSize) {
+      m_node[idx].first = t.first;
+      m_node[idx].count = n;
+      continue;
+    }
+
+    // Find longest extent of centroids in range
+    std::array< tk::real, 3 > lo, hi;
+    lo.fill( std::numeric_limits< tk::real >::max() );
+    hi.fill( std::numeric_limits< tk::real >::lowest() );
+    for (auto i=t.first; i<t.last; ++i)
+      for (std::size_t d=0; d<3; ++d) {
+        lo[d] = std::min( lo[d], cen[ m_elem[i]*3+d ] );
+        hi[d] = std::max( hi[d], cen[ m_elem[i]*3+d ] );
+      }
+    std::size_t dir = 0;
+    for (std::size_t d=1; d<3; ++d)
+      if (hi[d]-lo[d] > hi[dir]-lo[dir]) dir = d;
+
+    // Split at median centroid along longest extent
+    auto mid = t.first + n/2;
+    std::nth_element( m_elem.begin() + static_cast< std::ptrdiff_t >( t.first ),
+                      m_elem.begin() + static_cast< std::ptrdiff_t >( mid ),
+                      m_elem.begin() + static_cast< std::ptrdiff_t >( t.last ),
+                      [&]( std::size_t a, std::size_t b ){
+                        return cen[a*3+dir] < cen[b*3+dir]; } );
+
+    m_node[idx].count = 0;
+    task.push_back( { mid, t.last, idx, true } );       // right child
+    task.push_back( { t.first, mid, idx, false } );     // left child: next
+  }
+}
+
+void
+BVH::refit( const std::array< std::vector< tk::real >, 3 >& coord,
+            const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Update bounding boxes after mesh motion keeping the tree structure
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \details Refitting is cheaper than rebuilding and keeps queries correct for
+//!   any node motion, though the tree may become less efficient for large
+//!   deformations. Since children always follow their parents, a single
+//!   reverse pass over the nodes updates children before their parents.
+// *****************************************************************************
+{
+  Assert( inpoel.size()/4 == m_elem.size(),
+          "Number of elements changed since BVH has been built" );
+
+  for (auto i=m_node.size(); i-->0; ) {
+    auto& n = m_node[i];
+    if (n.count) {
+      bound( n.first, n.first+n.count, coord, inpoel, n );
+    } else {
+      const auto& l = m_node[i+1];
+      const auto& r = m_node[n.first];
+      for (std::size_t d=0; d<3; ++d) {
+        n.lo[d] = std::min( l.lo[d], r.lo[d] );
+        n.hi[d] = std::max( l.hi[d], r.hi[d] );
+      }
+    }
+  }
+}
+
+void
+BVH::bound( std::size_t first,
+            std::size_t last,
+            const std::array< std::vector< tk::real >, 3 >& coord,
+            const std::vector< std::size_t >& inpoel,
+            Node& n ) const
+// *****************************************************************************
+//  Compute bounding box of a range of elements into a node
+//! \param[in] first Index of first element in m_elem to bound
+//! \param[in] last Index of one past the last element in m_elem to bound
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in,out] n Tree node whose bounding box to compute
+// *****************************************************************************
+{
+  n.lo.fill( std::numeric_limits< tk::real >::max() );
+  n.hi.fill( std::numeric_limits< tk::real >::lowest() );
+  for (auto i=first; i<last; ++i) {
+    auto e = m_elem[i];
+    for (std::size_t a=0; a<4; ++a) {
+      auto p = inpoel[e*4+a];
+      for (std::size_t d=0; d<3; ++d) {
+        n.lo[d] = std::min( n.lo[d], coord[d][p] );
+        n.hi[d] = std::max( n.hi[d], coord[d][p] );
+      }
+    }
+  }
+}
@@ -0,0 +1,125 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/BVH.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Bounding volume hierarchy for point location in tetrahedron meshes
+  \details   Bounding volume hierarchy (BVH) of axis-aligned bounding boxes
+    for point location in tetrahedron meshes. The hierarchy is a binary tree
+    built top-down by median splits along the longest extent of the element
+    centroids and stored as a flat array of nodes in depth-first order. A point
+    query visits only the nodes whose bounding box contains the point, so
+    locating a point costs O(log(nelem)) instead of O(nelem).
+*/
+// *****************************************************************************
+#ifndef BVH_h
+#define BVH_h
+
+#include <array>
+#include <vector>
+#include <limits>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Bounding volume hierarchy over the elements of a tetrahedron mesh
+class BVH {
+
+  public:
+    //! Value returned by find() if no element is found
+    static constexpr std::size_t npos =
+      std::numeric_limits< std::size_t >::max();
+
+    //! Default constructor: empty hierarchy
+    explicit BVH() : m_node(), m_elem() {}
+
+    //! Constructor: build hierarchy
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    explicit BVH( const std::array< std::vector< tk::real >, 3 >& coord,
+                  const std::vector< std::size_t >& inpoel )
+      : m_node(), m_elem() { build( coord, inpoel ); }
+
+    //! Build hierarchy from scratch, e.g., after mesh refinement
+    void build( const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoel );
+
+    //! Update bounding boxes after mesh motion keeping the tree structure
+    void refit( const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoel );
+
+    //! Query if the hierarchy is empty
+    //! \return True if no elements have been indexed
+    bool empty() const noexcept { return m_elem.empty(); }
+
+    //! Number of elements indexed
+    //! \return Number of elements in the hierarchy
+    std::size_t nelem() const noexcept { return m_elem.size(); }
+
+    //! Find element containing a point
+    //! \param[in] p Point coordinates
+    //! \param[in] inside Function called as bool inside( std::size_t e ) for
+    //!   candidate elements e whose bounding box contains the point, returning
+    //!   true if element e contains the point
+    //! \return Id of the first element for which inside() returned true, npos
+    //!   if none was found
+    template< class Inside >
+    std::size_t find( const std::array< tk::real, 3 >& p, Inside&& inside )
+    const {
+      if (m_node.empty()) return npos;
+      std::array< std::size_t, MaxDepth > stack;
+      std::size_t top = 0;
+      stack[ top++ ] = 0;
+      while (top) {
+        const auto& n = m_node[ stack[--top] ];
+        if (p[0] < n.lo[0] || p[0] > n.hi[0] ||
+            p[1] < n.lo[1] || p[1] > n.hi[1] ||
+            p[2] < n.lo[2] || p[2] > n.hi[2]) continue;
+        if (n.count) {
+          for (auto i=n.first; i<n.first+n.count; ++i)
+            if (inside( m_elem[i] )) return m_elem[i];
+        } else {
+          stack[ top++ ] = n.first;
+          stack[ top++ ] = static_cast< std::size_t >( &n - m_node.data() ) + 1;
+        }
+      }
+      return npos;
+    }
+
+  private:
+    //! Maximum number of elements in a leaf
+    static constexpr std::size_t LeafSize = 4;
+    //! Traversal stack size, sufficient for the depth of median-split trees
+    static constexpr std::size_t MaxDepth = 128;
+
+    //! Tree node
+    //! \details The left child of an internal node immediately follows the
+    //!   node. For internal nodes first is the index of the right child and
+    //!   count is zero, for leaves [first,first+count) is the range of
+    //!   elements in m_elem.
+    struct Node {
+      std::array< tk::real, 3 > lo;     //!< Lower corner of bounding box
+      std::array< tk::real, 3 > hi;     //!< Upper corner of bounding box
+      std::size_t first;                //!< Right child or first element
+      std::size_t count;                //!< Number of elements in leaf
+    };
+
+    //! Tree nodes in depth-first order
+    std::vector< Node > m_node;
+    //! Element ids ordered so that leaves refer to contiguous ranges
+    std::vector< std::size_t > m_elem;
+
+    //! Compute bounding box of a range of elements into a node
+    void bound( std::size_t first,
+                std::size_t last,
+                const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoel,
+                Node& n ) const;
+};
+
+} // tk::
+
+#endif // BVH_h
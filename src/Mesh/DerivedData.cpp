@@ -11,8 +11,8 @@
 */
 // *****************************************************************************
 
-#include <set>
 #include <map>
+#include <limits>
 #include <iterator>
 #include <numeric>
 #include <algorithm>
@@ -28,6 +28,7 @@
 #include "DerivedData.hpp"
 #include "ContainerUtil.hpp"
 #include "Vector.hpp"
+#include "ParallelFor.hpp"
 
 namespace tk {
 
@@ -237,6 +238,154 @@ genPsup( const std::vector< std::size_t >& inpoel,
   return std::make_pair( std::move(psup1), std::move(psup2) );
 }
 
+static std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+genStars( const std::vector< std::size_t >& inpoel,
+          std::size_t nnpe,
+          std::size_t npoin,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& esup )
+// *****************************************************************************
+//  Generate stars of unique edges in compressed sparse row format
+//! \param[in] inpoel Inteconnectivity of points and elements
+//! \param[in] nnpe Number of nodes per element (3 or 4)
+//! \param[in] npoin Number of points in mesh connectivity
+//! \param[in] esup Elements surrounding points as linked lists, see tk::genEsup
+//! \return Row indices (npoin+1) and spikes of stars, i.e., the end-point ids,
+//!   q, of edges with point ids p < q, are spikes[ row[p] ... row[p+1]-1 ]
+//! \details Stars are generated in two passes, first counting, then filling
+//!   the spikes, both visiting points q in increasing order and appending q to
+//!   the stars of the points p < q surrounding q. Because of this visiting
+//!   order the spikes of each star end up sorted without sorting.
+// *****************************************************************************
+{
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  // allocate a temporary array, only used locally
+  std::vector< std::size_t > lpoin( npoin );
+
+  // call f(p,q) for all unique points p < q surrounding points q
+  auto lower = [&]( auto f ){
+    std::fill( begin(lpoin), end(lpoin), 0 );
+    for (std::size_t q=0; q<npoin; ++q)
+      for (std::size_t i=esup2[q]+1; i<=esup2[q+1]; ++i)
+        for (std::size_t n=0; n<nnpe; ++n) {
+          auto p = inpoel[ esup1[i] * nnpe + n ];
+          if (p < q && lpoin[p] != q+1) {
+            f( p, q );
+            lpoin[p] = q+1;
+          }
+        }
+  };
+
+  // count spikes of stars and compute row indices
+  std::vector< std::size_t > row( npoin+1, 0 );
+  lower( [&]( std::size_t p, std::size_t ){ ++row[p+1]; } );
+  std::partial_sum( begin(row), end(row), begin(row) );
+
+  // fill spikes of stars in increasing order
+  std::vector< std::size_t > spike( row.back() ),
+                             pos( begin(row), std::prev(end(row)) );
+  lower( [&]( std::size_t p, std::size_t q ){ spike[ pos[p]++ ] = q; } );
+
+  return std::make_pair( std::move(row), std::move(spike) );
+}
+
+template< class Op >
+static void
+mergeEsup( const std::vector< std::size_t >& inpoel,
+           std::size_t nnpe,
+           const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& esup,
+           std::size_t e,
+           std::vector< std::size_t >& head,
+           Op op )
+// *****************************************************************************
+//  Merge the elements surrounding the points of an element
+//! \param[in] inpoel Inteconnectivity of points and elements
+//! \param[in] nnpe Number of nodes per element
+//! \param[in] esup Elements surrounding points as linked lists, see tk::genEsup
+//! \param[in] e Element whose points' surrounding elements to merge
+//! \param[in,out] head Work array, storing positions in esup.first
+//! \param[in] op Callable with signature void(std::size_t g, std::size_t s),
+//!   called for each unique element g surrounding the points of element e in
+//!   increasing order of g, with s the number of points of e surrounded by g
+//! \details tk::genEsup stores the elements surrounding each point in
+//!   increasing order, so the nnpe lists are merged without sorting.
+// *****************************************************************************
+{
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  head.resize( nnpe );
+  for (std::size_t n=0; n<nnpe; ++n) head[n] = esup2[ inpoel[e*nnpe+n] ] + 1;
+
+  // true if list of point n has not yet been exhausted
+  auto more = [&]( std::size_t n ){
+    return head[n] <= esup2[ inpoel[e*nnpe+n]+1 ];
+  };
+
+  while (true) {
+    auto g = std::numeric_limits< std::size_t >::max();
+    for (std::size_t n=0; n<nnpe; ++n)
+      if (more(n)) g = std::min( g, esup1[head[n]] );
+    if (g == std::numeric_limits< std::size_t >::max()) return;
+    std::size_t s = 0;
+    for (std::size_t n=0; n<nnpe; ++n)
+      if (more(n) && esup1[head[n]] == g) {
+        ++s;
+        do ++head[n]; while (more(n) && esup1[head[n]] == g);
+      }
+    op( g, s );
+  }
+}
+
+template< class Gen >
+static std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+genLists( std::size_t nelem, std::size_t nthread, Gen gen )
+// *****************************************************************************
+//  Generate linked lists storing a variable number of ids for each element
+//! \param[in] nelem Number of elements
+//! \param[in] nthread Number of threads to use
+//! \param[in] gen Callable with signature void(std::size_t e,
+//!   std::vector< std::size_t >& work, std::vector< std::size_t >& ids),
+//!   appending the ids of element e to ids, using work as a work array
+//! \return Linked lists storing ids of elements, with a single zero in front
+//! \details The elements are split into at most nthread contiguous chunks,
+//!   each appending to its own buffers, which are then concatenated in order
+//!   of the chunks, so the result does not depend on the number of threads.
+// *****************************************************************************
+{
+  nthread = std::max( nthread, std::size_t(1) );
+  auto grain = std::max( (nelem + nthread - 1) / nthread, std::size_t(1) );
+  auto nchunk = (nelem + grain - 1) / grain;
+
+  // ids and number of ids of elements generated by each chunk
+  std::vector< std::vector< std::size_t > > ids( nchunk ), cnt( nchunk );
+
+  tk::parallel_for( nthread, 0, nelem, grain,
+    [&]( std::size_t b, std::size_t e ){
+      auto& i = ids[ b/grain ];
+      auto& c = cnt[ b/grain ];
+      std::vector< std::size_t > work;
+      c.reserve( e-b );
+      for (auto el=b; el<e; ++el) {
+        auto size = i.size();
+        gen( el, work, i );
+        c.push_back( i.size() - size );
+      }
+    } );
+
+  std::vector< std::size_t > l1( 1, 0 ), l2( 1, 0 );
+  l2.reserve( nelem+1 );
+  for (std::size_t c=0; c<nchunk; ++c) {
+    l1.insert( end(l1), begin(ids[c]), end(ids[c]) );
+    for (auto n : cnt[c]) l2.push_back( l2.back() + n );
+  }
+
+  return std::make_pair( std::move(l1), std::move(l2) );
+}
+
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEdsup( const std::vector< std::size_t >& inpoel,
           std::size_t nnpe,
@@ -302,42 +451,17 @@ genEdsup( const std::vector< std::size_t >& inpoel,
   Assert( *minmax.first == 0, "node ids should start from zero" );
   auto npoin = *minmax.second + 1;
 
-  auto& esup1 = esup.first;
-  auto& esup2 = esup.second;
-
-  // allocate and fill with zeros a temporary array, only used locally
-  std::vector< std::size_t > lpoin( npoin, 0 );
-
-  // map to contain stars, a point associated to points connected with edges
-  // storing only the end-point id, q, of point ids p < q
-  std::map< std::size_t, std::vector< std::size_t > > star;
-
-  // generate edge connectivity and store as stars where center id < spike id
-  for (std::size_t p=0; p<npoin; ++p)
-    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
-      for (std::size_t n=0; n<nnpe; ++n) {
-        auto q = inpoel[ esup1[i] * nnpe + n ];
-        if (q != p && lpoin[q] != p+1) {
-          if (p < q) star[p].push_back(q);
-          lpoin[q] = p+1;
-        }
-      }
+  // generate stars where center id < spike id, spikes sorted
+  auto [ row, spike ] = genStars( inpoel, nnpe, npoin, esup );
 
-  // linked lists (vectors) to store edges surrounding points and their indices
-  std::vector< std::size_t > edsup1( 1, 0 ), edsup2( 1, 0 );
-
-  // sort non-center points of each star and store nodes and indices in vectors
-  for (auto& p : star) {
-    std::sort( begin(p.second), end(p.second) );
-    edsup2.push_back( edsup2.back() + p.second.size() );
-    edsup1.insert( end(edsup1), begin(p.second), end(p.second) );
-  }
-  // fill up index array with the last index for points with no new edges
-  for (std::size_t i=0; i<npoin-star.size(); ++i)
-    edsup2.push_back( edsup2.back() );
+  // linked lists (vectors) to store edges surrounding points and their indices:
+  // with a single zero in front of the spikes, the row indices of the stars
+  // are the end-indices of the stars, including points with no new edges
+  std::vector< std::size_t > edsup1( 1, 0 );
+  edsup1.insert( end(edsup1), begin(spike), end(spike) );
 
   // Return (move out) linked lists
-  return std::make_pair( std::move(edsup1), std::move(edsup2) );
+  return std::make_pair( std::move(edsup1), std::move(row) );
 }
 
 std::vector< std::size_t >
@@ -404,39 +528,18 @@ genInpoed( const std::vector< std::size_t >& inpoel,
   Assert( *minmax.first == 0, "node ids should start from zero" );
   auto npoin = *minmax.second + 1;
 
-  auto& esup1 = esup.first;
-  auto& esup2 = esup.second;
-
-  // allocate and fill with zeros a temporary array, only used locally
-  std::vector< std::size_t > lpoin( npoin, 0 );
+  // generate stars where center id < spike id, spikes sorted
+  auto [ row, spike ] = genStars( inpoel, nnpe, npoin, esup );
 
-  // map to contain stars, a point associated to points connected with edges,
-  // storing only the end-point id, q, of point ids p < q
-  std::map< std::size_t, std::vector< std::size_t > > star;
+  // linear vector to store edge connectivity
+  std::vector< std::size_t > inpoed( spike.size()*2 );
 
-  // generate edge connectivity and store as stars where center id < spike id
+  // store both start and end points of each star in linear vector
   for (std::size_t p=0; p<npoin; ++p)
-    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
-      for (std::size_t n=0; n<nnpe; ++n) {
-        auto q = inpoel[ esup1[i] * nnpe + n ];
-        if (q != p && lpoin[q] != p+1) {
-          if (p < q) star[p].push_back( q );
-          lpoin[q] = p+1;
-        }
-      }
-
-  // linear vector to store edge connectivity and their indices
-  std::vector< std::size_t > inpoed;
-
-  // sort non-center points of each star and store both start and end points of
-  // each star in linear vector
-  for (auto& p : star) {
-    std::sort( begin(p.second), end(p.second) );
-    for (auto e : p.second) {
-      inpoed.push_back( p.first );
-      inpoed.push_back( e );
+    for (auto i=row[p]; i<row[p+1]; ++i) {
+      inpoed[i*2] = p;
+      inpoed[i*2+1] = spike[i];
     }
-  }
 
   // Return (move out) linear vector
   return inpoed;
@@ -446,7 +549,8 @@ std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEsupel( const std::vector< std::size_t >& inpoel,
            std::size_t nnpe,
            const std::pair< std::vector< std::size_t >,
-                            std::vector< std::size_t > >& esup )
+                            std::vector< std::size_t > >& esup,
+           std::size_t nthread )
 // *****************************************************************************
 //  Generate derived data structure, elements surrounding points of elements
 //! \param[in] inpoel Inteconnectivity of points and elements. These are the
@@ -459,6 +563,7 @@ genEsupel( const std::vector< std::size_t >& inpoel,
 //!   and { 10, 14, 13, 12 }.
 //! \param[in] nnpe Number of nodes per element
 //! \param[in] esup Elements surrounding points as linked lists, see tk::genEsup
+//! \param[in] nthread Number of threads to use
 //! \return Linked lists storing elements surrounding points of elements
 //! \warning It is not okay to call this function with an empty container for
 //!   inpoel or esup.first or esup.second or a non-positive number of nodes per
@@ -491,38 +596,25 @@ genEsupel( const std::vector< std::size_t >& inpoel,
   Assert( !esup.second.empty(),
           "Attempt to call genEsupel() with empty esup2" );
 
-  auto& esup1 = esup.first;
-  auto& esup2 = esup.second;
-
-  // linked lists storing elements surrounding points of elements, put in a
-  // single zero in both
-  std::vector< std::size_t > esupel2( 1, 0 ), esupel1( 1, 0 );
-
-  std::size_t e = 0;
-  std::set< std::size_t > esuel;
-  for (auto p : inpoel) {       // loop over all points of all elements
-    // collect unique element ids of elements surrounding points of element
-    for (auto i=esup2[p]+1; i<=esup2[p+1]; ++i) esuel.insert( esup1[i] );
-    if (++e%nnpe == 0) {        // when finished checking all nodes of element
-      // erase element whose surrounding elements are considered
-      esuel.erase( e/nnpe-1 );
-      // store unique element ids in esupel1
-      esupel1.insert( end(esupel1), begin(esuel), end(esuel) );
-      // store end-index for element used to address into esupel1
-      esupel2.push_back( esupel2.back() + esuel.size() );
-      esuel.clear();
-    }
-  }
-
-  // Return (move out) linked lists
-  return std::make_pair( std::move(esupel1), std::move(esupel2) );
+  // linked lists storing elements surrounding points of elements: unique
+  // element ids surrounding the points of each element, except itself
+  return genLists( inpoel.size()/nnpe, nthread,
+    [&]( std::size_t e, std::vector< std::size_t >& work,
+         std::vector< std::size_t >& ids )
+    {
+      mergeEsup( inpoel, nnpe, esup, e, work,
+                 [&]( std::size_t g, std::size_t ){
+                   if (g != e) ids.push_back( g );
+                 } );
+    } );
 }
 
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEsuel( const std::vector< std::size_t >& inpoel,
           std::size_t nnpe,
           const std::pair< std::vector< std::size_t >,
-                           std::vector< std::size_t > >& esup )
+                           std::vector< std::size_t > >& esup,
+          std::size_t nthread )
 // *****************************************************************************
 //  Generate derived data structure, elements surrounding elements
 //! \param[in] inpoel Inteconnectivity of points and elements. These are the
@@ -535,6 +627,7 @@ genEsuel( const std::vector< std::size_t >& inpoel,
 //!   and { 10, 14, 13, 12 }.
 //! \param[in] nnpe Number of nodes per element
 //! \param[in] esup Elements surrounding points as linked lists, see tk::genEsup
+//! \param[in] nthread Number of threads to use
 //! \return Linked lists storing elements surrounding elements
 //! \warning It is not okay to call this function with an empty container for
 //!   inpoel or esup.first or esup.second; it will throw an exception.
@@ -566,45 +659,17 @@ genEsuel( const std::vector< std::size_t >& inpoel,
   Assert( !esup.second.empty(),
           "Attempt to call genEsuel() with empty esuel2" );
 
-  auto& esup1 = esup.first;
-  auto& esup2 = esup.second;
-
-  auto nelem = inpoel.size()/nnpe;
-
-  // lambda that returns 1 if elements hel and gel share a face
-  auto adj = [ &inpoel, nnpe ]( std::size_t hel, std::size_t gel ) -> bool {
-    std::size_t sp = 0;
-    for (std::size_t h=0; h<nnpe; ++h)
-      for (std::size_t g=0; g<nnpe; ++g)
-        if (inpoel[hel*nnpe+h] == inpoel[gel*nnpe+g]) ++sp;
-    if (sp == nnpe-1) return true; else return false;
-  };
-
-  // map to associate unique elements and their surrounding elements
-  std::map< std::size_t, std::vector< std::size_t > > es;
-
-  for (std::size_t e=0; e<nelem; ++e) {
-    std::set< std::size_t > faces; // will collect elem ids of shared faces
-    for (std::size_t n=0; n<nnpe; ++n) {
-      auto i = inpoel[ e*nnpe+n ];
-      for (auto j=esup2[i]+1; j<=esup2[i+1]; ++j)
-        if (adj( e, esup1[j] )) faces.insert( esup1[j] );
-    }
-    // store element ids of shared faces
-    for (auto j : faces) es[e].push_back(j);
-  }
-
-  // storing elements surrounding elements
-  std::vector< std::size_t > esuel1( 1, 0 ), esuel2( 1, 0 );
-
-  // store elements surrounding elements in linked lists
-  for (const auto& e : es) {
-    esuel2.push_back( esuel2.back() + e.second.size() );
-    esuel1.insert( end(esuel1), begin(e.second), end(e.second) );
-  }
-
-  // Return (move out) linked lists
-  return std::make_pair( std::move(esuel1), std::move(esuel2) );
+  // linked lists storing elements surrounding elements: elements sharing a
+  // face, i.e., nnpe-1 points, with an element
+  return genLists( inpoel.size()/nnpe, nthread,
+    [&]( std::size_t e, std::vector< std::size_t >& work,
+         std::vector< std::size_t >& ids )
+    {
+      mergeEsup( inpoel, nnpe, esup, e, work,
+                 [&]( std::size_t g, std::size_t s ){
+                   if (s == nnpe-1) ids.push_back( g );
+                 } );
+    } );
 }
 
 std::vector< std::size_t >
@@ -682,48 +747,33 @@ genInedel( const std::vector< std::size_t >& inpoel,
   // linked lists edsup1 and edsup2, this function takes inpoed as an argument,
   // and so edsup2 is temporarily generated here to avoid a brute-force search.
 
-  // map to contain stars, a point associated to points connected with edges
-  // storing only the end-point id, q, of point ids p < q
-  std::map< std::size_t, std::vector< std::size_t > > star;
-
-  // generate stars from inpoed; starting with zero, every even is a star
-  // center, every odd is a spike
-  for (std::size_t i=0; i<inpoed.size()/2; ++i)
-    star[ inpoed[i*2] ].push_back( inpoed[i*2+1] );
+  // count spikes of stars from inpoed; starting with zero, every even is a
+  // star center, every odd is a spike
+  std::vector< std::size_t > edsup2( npoin+1, 0 );
+  for (std::size_t i=0; i<inpoed.size()/2; ++i) ++edsup2[ inpoed[i*2]+1 ];
 
-  // store index of star centers in vector; assume non-center points of each
-  // star have already been sorted
-  std::vector< std::size_t > edsup2( 1, 0 );
-  for (const auto& p : star) edsup2.push_back(edsup2.back() + p.second.size());
-  // fill up index array with the last index for points with no new edges
-  for (std::size_t i=0; i<npoin-star.size(); ++i)
-    edsup2.push_back( edsup2.back() );
-  star.clear();
+  // store end-index of stars, including points with no new edges; assume
+  // non-center points of each star have already been sorted
+  std::partial_sum( begin(edsup2), end(edsup2), begin(edsup2) );
 
   // Second, generate edges of elements
 
   auto nelem = inpoel.size()/nnpe;
 
-  // map associating elem id with vector of edge ids
-  std::map< std::size_t, std::vector< std::size_t > > edges;
+  // linear vector to store the edge ids of all elements
+  std::vector< std::size_t > inedel;
+  inedel.reserve( nelem*nnpe*(nnpe-1)/2 );
 
-  // generate map of elements associated to edge ids
+  // store edge ids of elements in element order
   for (std::size_t e=0; e<nelem; ++e)
     for (std::size_t n=0; n<nnpe; ++n) {
       auto p = inpoel[e*nnpe+n];
       for (auto i=edsup2[p]+1; i<=edsup2[p+1]; ++i)
          for (std::size_t j=0; j<nnpe; ++j)
             if (inpoed[(i-1)*2+1] == inpoel[e*nnpe+j])
-              edges[e].push_back( i-1 );
+              inedel.push_back( i-1 );
     }
 
-  // linear vector to store the edge ids of all elements
-  std::vector< std::size_t > inedel( sumvalsize(edges) );
-
-  // store edge ids of elements in linear vector
-  std::size_t j = 0;
-  for (const auto& e : edges) for (auto p : e.second) inedel[ j++ ] = p;
-
   // Return (move out) vector
   return inedel;
 }
@@ -788,39 +838,29 @@ genEsued( const std::vector< std::size_t >& inpoel,
   auto& esup1 = esup.first;
   auto& esup2 = esup.second;
 
-  // allocate and fill with zeros a temporary array, only used locally
-  std::vector< std::size_t > lpoin( npoin, 0 );
-
-  // lambda that returns true if element e contains edge (p < q)
-  auto has = [ &inpoel, nnpe ]( std::size_t e, std::size_t p, std::size_t q ) {
-    int sp = 0;
-    for (std::size_t n=0; n<nnpe; ++n)
-      if (inpoel[e*nnpe+n] == p || inpoel[e*nnpe+n] == q) ++sp;
-    return sp == 2;
-  };
+  // generate stars where center id < spike id
+  auto [ row, spike ] = genStars( inpoel, nnpe, npoin, esup );
 
   // map to associate edges to unique surrounding element ids
   std::unordered_map< UnsMesh::Edge, std::vector< std::size_t >,
                       UnsMesh::Hash<2>, UnsMesh::Eq<2> > esued;
+  esued.reserve( spike.size() );
 
-  // generate edges and associated vector of unique surrounding element ids
+  // elements surrounding edge p < q are the elements surrounding both p and q;
+  // since the elements surrounding points are sorted, so is their intersection
+  auto elems = [&]( std::size_t p ){
+    return std::make_pair( begin(esup1) + static_cast< long >( esup2[p]+1 ),
+                           begin(esup1) + static_cast< long >( esup2[p+1]+1 ) );
+  };
   for (std::size_t p=0; p<npoin; ++p)
-    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
-      for (std::size_t n=0; n<nnpe; ++n) {
-        auto q = inpoel[ esup1[i] * nnpe + n ];
-        if (q != p && lpoin[q] != p+1) {
-          if (p < q) {  // for edge given point ids p < q
-            for (std::size_t j=esup2[p]+1; j<=esup2[p+1]; ++j ) {
-              auto e = esup1[j];
-              if (has(e,p,q)) esued[{p,q}].push_back(e);
-            }
-          }
-          lpoin[q] = p+1;
-        }
-      }
-
-  // sort element ids surrounding edges for each edge
-  for (auto& p : esued) std::sort( begin(p.second), end(p.second) );
+    for (auto i=row[p]; i<row[p+1]; ++i) {
+      auto q = spike[i];
+      auto [ pb, pe ] = elems( p );
+      auto [ qb, qe ] = elems( q );
+      std::vector< std::size_t > surr;
+      std::set_intersection( pb, pe, qb, qe, std::back_inserter(surr) );
+      esued.emplace( UnsMesh::Edge{{p,q}}, std::move(surr) );
+    }
 
   // Return elements surrounding edges data structure
   return esued;
@@ -939,7 +979,8 @@ genNbfacTet( std::size_t tnbfac,
 std::vector< int >
 genEsuelTet( const std::vector< std::size_t >& inpoel,
              const std::pair< std::vector< std::size_t >,
-                              std::vector< std::size_t > >& esup )
+                              std::vector< std::size_t > >& esup,
+             std::size_t nthread )
 // *****************************************************************************
 //  Generate derived data structure, elements surrounding elements
 //  as a fixed length data structure as a full vector, including
@@ -954,6 +995,7 @@ genEsuelTet( const std::vector< std::size_t >& inpoel,
 //!   specifies two tetrahedra whose vertices (node ids) are { 12, 14, 9, 11 },
 //!   and { 10, 14, 13, 12 }.
 //! \param[in] esup Elements surrounding points as linked lists, see tk::genEsup
+//! \param[in] nthread Number of threads to use
 //! \return Vector storing elements surrounding elements
 //! \warning It is not okay to call this function with an empty container for
 //!   inpoel or esup.first or esup.second; it will throw an exception.
@@ -971,6 +1013,8 @@ genEsuelTet( const std::vector< std::size_t >& inpoel,
 //!   \code{.cpp}
 //!     auto nelem = inpoel.size()/nnpe;
 //!   \endcode
+//!   Each element only stores its own surrounding elements, so elements are
+//!   processed by nthread threads concurrently, see tk::parallel_for.
 // *****************************************************************************
 {
   Assert( !inpoel.empty(), "Attempt to call genEsuelTet() on empty container" );
@@ -982,7 +1026,7 @@ genEsuelTet( const std::vector< std::size_t >& inpoel,
   auto& esup2 = esup.second;
 
   // set tetrahedron geometry
-  std::size_t nnpe(4), nfpe(4), nnpf(3);
+  const std::size_t nnpe(4), nfpe(4), nnpf(3);
 
   Assert( inpoel.size()%nnpe == 0, "Size of inpoel must be divisible by four" );
 
@@ -993,61 +1037,39 @@ genEsuelTet( const std::vector< std::size_t >& inpoel,
   auto npoin = *minmax.second + 1;
 
   std::vector< int > esuelTet(nfpe*nelem, -1);
-  std::vector< std::size_t > lhelp(nnpf,0),
-                             lpoin(npoin,0);
-
-  for (std::size_t e=0; e<nelem; ++e)
-  {
-    auto mark = nnpe*e;
-    for (std::size_t fe=0; fe<nfpe; ++fe)
-    {
-      // array which stores points on this face
-      lhelp[0] = inpoel[mark+lpofa[fe][0]];
-      lhelp[1] = inpoel[mark+lpofa[fe][1]];
-      lhelp[2] = inpoel[mark+lpofa[fe][2]];
 
-      // mark in this array
-      lpoin[lhelp[0]] = 1;
-      lpoin[lhelp[1]] = 1;
-      lpoin[lhelp[2]] = 1;
-
-      // select a point on this face
-      auto ipoin = lhelp[0];
-
-      // loop over elements around this point
-      for (std::size_t j=esup2[ipoin]+1; j<=esup2[ipoin+1]; ++j )
-      {
-        auto jelem = esup1[j];
-        // if this jelem is not e itself then proceed
-        if (jelem != e)
-        {
-          for (std::size_t fj=0; fj<nfpe; ++fj)
-          {
-            std::size_t icoun(0);
-            for (std::size_t jnofa=0; jnofa<nnpf; ++jnofa)
-            {
-              auto markj = jelem*nnpe;
-              auto jpoin = inpoel[markj+lpofa[fj][jnofa]];
-              if (lpoin[jpoin] == 1) { ++icoun; }
-            }
-            //store esuel if
-            if (icoun == nnpf)
-            {
-              auto markf = nfpe*e;
-              esuelTet[markf+fe] = static_cast<int>(jelem);
-
-              markf = nfpe*jelem;
-              esuelTet[markf+fj] = static_cast<int>(e);
+  tk::parallel_for( nthread, 0, nelem, 1,
+    [&]( std::size_t begin, std::size_t end ){
+      // allocate and fill with zeros a temporary array, only used locally
+      std::vector< std::size_t > lpoin( npoin, 0 );
+      for (std::size_t e=begin; e<end; ++e) {
+        auto mark = nnpe*e;
+        for (std::size_t fe=0; fe<nfpe; ++fe) {
+          // mark points on this face
+          for (std::size_t n=0; n<nnpf; ++n)
+            lpoin[ inpoel[mark+lpofa[fe][n]] ] = 1;
+
+          // loop over elements around a point on this face
+          auto ipoin = inpoel[mark+lpofa[fe][0]];
+          for (std::size_t j=esup2[ipoin]+1; j<=esup2[ipoin+1]; ++j) {
+            auto jelem = esup1[j];
+            // if this jelem is not e itself and contains all points of this
+            // face, store it as the element across the face
+            if (jelem != e) {
+              std::size_t icoun(0);
+              for (std::size_t n=0; n<nnpe; ++n)
+                icoun += lpoin[ inpoel[jelem*nnpe+n] ];
+              if (icoun == nnpf)
+                esuelTet[nfpe*e+fe] = static_cast< int >( jelem );
             }
           }
+
+          // reset this array
+          for (std::size_t n=0; n<nnpf; ++n)
+            lpoin[ inpoel[mark+lpofa[fe][n]] ] = 0;
         }
       }
-      // reset this array
-      lpoin[lhelp[0]] = 0;
-      lpoin[lhelp[1]] = 0;
-      lpoin[lhelp[2]] = 0;
-    }
-  }
+    } );
 
   return esuelTet;
 }
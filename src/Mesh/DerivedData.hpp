@@ -157,14 +157,16 @@ std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEsupel( const std::vector< std::size_t >& inpoel,
            std::size_t nnpe,
            const std::pair< std::vector< std::size_t >,
-                            std::vector< std::size_t > >& esup );
+                            std::vector< std::size_t > >& esup,
+           std::size_t nthread = 1 );
 
 //! Generate derived data structure, elements surrounding elements
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEsuel( const std::vector< std::size_t >& inpoel,
           std::size_t nnpe,
           const std::pair< std::vector< std::size_t >,
-                           std::vector< std::size_t > >& esup );
+                           std::vector< std::size_t > >& esup,
+          std::size_t nthread = 1 );
 
 //! \brief Generate derived data structure, elements surrounding elements
 //!   as a fixed length data structure as a full vector, including boundary
@@ -172,7 +174,8 @@ genEsuel( const std::vector< std::size_t >& inpoel,
 std::vector< int >
 genEsuelTet( const std::vector< std::size_t >& inpoel,
              const std::pair< std::vector< std::size_t >,
-                              std::vector< std::size_t > >& esup );
+                              std::vector< std::size_t > >& esup,
+             std::size_t nthread = 1 );
 
 //! Generate derived data structure, edges of elements
 std::vector< std::size_t >
@@ -0,0 +1,133 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/EdgeList.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Compact edge list of a tetrahedron mesh
+  \details   Compact edge list of a tetrahedron mesh.
+*/
+// *****************************************************************************
+
+#include <algorithm>
+
+#include "EdgeList.hpp"
+#include "DerivedData.hpp"
+#include "Exception.hpp"
+
+using tk::EdgeList;
+
+void
+EdgeList::rebuild( const std::vector< std::size_t >& inpoel, std::size_t npoin )
+// *****************************************************************************
+//  Rebuild edge list after the mesh changed
+//! \param[in] inpoel Mesh element connectivity (tetrahedra)
+//! \param[in] npoin Number of mesh nodes
+//! \details This is not an incremental update: all element edges are bucketed
+//!   again, so the cost is that of building the edge list, O(nelem). Edge ids
+//!   are assigned in the order of the end points, so the id of an edge that
+//!   exists both before and after the mesh changed is not kept in general.
+// *****************************************************************************
+{
+  Assert( inpoel.size() % 4 == 0, "Size of inpoel must be divisible by 4" );
+  Assert( std::all_of( begin(inpoel), end(inpoel),
+            [npoin]( std::size_t p ){ return p < npoin; } ),
+          "Node id in connectivity exceeds the number of points" );
+
+  const auto nelem = inpoel.size()/4;
+
+  // Bucket element edges by their smaller node id, CSR-style
+  std::vector< std::size_t > row( npoin+1, 0 );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (const auto& [a,b] : lpoed)
+      ++row[ std::min( inpoel[e*4+a], inpoel[e*4+b] ) + 1 ];
+  for (std::size_t p=0; p<npoin; ++p) row[p+1] += row[p];
+  std::vector< std::size_t > nb( row.back() ), pos( begin(row), end(row)-1 );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (const auto& [a,b] : lpoed) {
+      auto p = inpoel[e*4+a], q = inpoel[e*4+b];
+      if (p > q) std::swap( p, q );
+      nb[ pos[p]++ ] = q;
+    }
+
+  // Sort and make unique within each bucket, compacting in place
+  std::size_t nedge = 0;
+  for (std::size_t p=0; p<npoin; ++p) {
+    auto b = begin(nb) + static_cast< long >( row[p] );
+    auto e = begin(nb) + static_cast< long >( row[p+1] );
+    std::sort( b, e );
+    e = std::unique( b, e );
+    row[p] = nedge;
+    for (auto i=b; i!=e; ++i) nb[ nedge++ ] = *i;
+  }
+  row[npoin] = nedge;
+  nb.resize( nedge );
+
+  // Store end points of edges, numbered in the order of the buckets
+  std::vector< std::size_t > edgenode( nedge*2 );
+  for (std::size_t p=0; p<npoin; ++p)
+    for (auto i=row[p]; i<row[p+1]; ++i) {
+      edgenode[ i*2+0 ] = p;
+      edgenode[ i*2+1 ] = nb[i];
+    }
+
+  // Generate points and edges surrounding points from buckets. Since points
+  // are visited in increasing order, and each bucket is sorted, neighbors with
+  // smaller ids are added before those with larger ids, keeping rows sorted.
+  std::pair< std::vector< std::size_t >, std::vector< std::size_t > > psup;
+  psup.second.resize( npoin+1, 0 );
+  for (std::size_t p=0; p<npoin; ++p)
+    for (auto i=row[p]; i<row[p+1]; ++i) {
+      ++psup.second[p+1];
+      ++psup.second[nb[i]+1];
+    }
+  for (std::size_t p=0; p<npoin; ++p) psup.second[p+1] += psup.second[p];
+  psup.first.resize( psup.second.back()+1, 0 );
+  std::vector< std::size_t > nodeedge( psup.first.size(), npos );
+  pos.assign( begin(psup.second), end(psup.second)-1 );
+  for (std::size_t p=0; p<npoin; ++p)
+    for (auto i=row[p]; i<row[p+1]; ++i) {
+      auto q = nb[i];
+      auto j = ++pos[p];
+      psup.first[j] = q;
+      nodeedge[j] = i;
+      j = ++pos[q];
+      psup.first[j] = p;
+      nodeedge[j] = i;
+    }
+
+  // Find edge ids of element edges
+  std::vector< std::size_t > inedel( nelem*6 );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t k=0; k<6; ++k) {
+      auto p = inpoel[e*4+lpoed[k][0]], q = inpoel[e*4+lpoed[k][1]];
+      if (p > q) std::swap( p, q );
+      auto b = begin(nb) + static_cast< long >( row[p] );
+      auto i = std::lower_bound( b, begin(nb) + static_cast< long >(row[p+1]),
+                                 q );
+      inedel[e*6+k] = static_cast< std::size_t >( i - begin(nb) );
+    }
+
+  m_edgenode = std::move( edgenode );
+  m_psup = std::move( psup );
+  m_nodeedge = std::move( nodeedge );
+  m_inedel = std::move( inedel );
+}
+
+std::size_t
+EdgeList::edge( std::size_t p, std::size_t q ) const
+// *****************************************************************************
+//  Find edge id of an edge given by its end points
+//! \param[in] p Local id of one end point
+//! \param[in] q Local id of the other end point
+//! \return Edge id of edge p-q, npos if there is no such edge
+// *****************************************************************************
+{
+  if (p >= npoin()) return npos;
+  auto b = begin(m_psup.first) + static_cast< long >( m_psup.second[p]+1 );
+  auto e = begin(m_psup.first) + static_cast< long >( m_psup.second[p+1]+1 );
+  auto i = std::lower_bound( b, e, q );
+  if (i == e || *i != q) return npos;
+  return m_nodeedge[ static_cast< std::size_t >( i - begin(m_psup.first) ) ];
+}
@@ -0,0 +1,117 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/EdgeList.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Compact edge list of a tetrahedron mesh
+  \details   Compact edge list of a tetrahedron mesh. The unique edges of the
+    mesh are numbered and stored as flat arrays: the two end points of each
+    edge (edge-to-node), the points and edges surrounding each point in
+    compressed sparse row form (node-to-edge), and the six edges of each
+    element (element-to-edge) in the order of tk::lpoed. The node-to-edge
+    arrays use the layout of tk::genPsup(), so they can be iterated with
+    tk::Around, and are sorted by the node id at the other end of the edge.
+    The edge list is built without hashing edges: element edges are bucketed
+    by their smaller node id and sorted within each bucket, and edges are
+    numbered in this order. The edge list is kept by its owner across time
+    steps and, after the mesh changes, e.g., after mesh refinement, rebuilt
+    from scratch, at the cost of building it.
+*/
+// *****************************************************************************
+#ifndef EdgeList_h
+#define EdgeList_h
+
+#include <vector>
+#include <limits>
+#include <utility>
+
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Compact edge list of a tetrahedron mesh
+class EdgeList {
+
+  public:
+    //! Value returned by edge() if there is no such edge
+    static constexpr std::size_t npos =
+      std::numeric_limits< std::size_t >::max();
+
+    //! Default constructor: empty edge list
+    explicit EdgeList() : m_edgenode(), m_psup(), m_nodeedge(), m_inedel() {}
+
+    //! Constructor: build edge list from mesh connectivity
+    //! \param[in] inpoel Mesh element connectivity (tetrahedra)
+    //! \param[in] npoin Number of mesh nodes
+    explicit EdgeList( const std::vector< std::size_t >& inpoel,
+                       std::size_t npoin )
+      : m_edgenode(), m_psup(), m_nodeedge(), m_inedel()
+    { rebuild( inpoel, npoin ); }
+
+    //! Rebuild edge list after the mesh changed
+    void rebuild( const std::vector< std::size_t >& inpoel, std::size_t npoin );
+
+    //! Number of edges
+    //! \return Number of unique edges in the mesh
+    std::size_t nedge() const noexcept { return m_edgenode.size()/2; }
+
+    //! Number of points
+    //! \return Number of mesh nodes the edge list was built for
+    std::size_t npoin() const noexcept
+    { return m_psup.second.empty() ? 0 : m_psup.second.size()-1; }
+
+    //! Find edge id of an edge given by its end points
+    std::size_t edge( std::size_t p, std::size_t q ) const;
+
+    //! Edge-to-node connectivity
+    //! \return End points of all edges, two per edge, the smaller id first,
+    //!   edges ordered by their smaller, then their larger end point
+    const std::vector< std::size_t >& edgenode() const { return m_edgenode; }
+
+    //! Points surrounding points
+    //! \return Points surrounding points in the layout of tk::genPsup()
+    const std::pair< std::vector< std::size_t >, std::vector< std::size_t > >&
+    psup() const { return m_psup; }
+
+    //! Node-to-edge connectivity
+    //! \return Edge ids of the edges surrounding points, parallel to
+    //!   psup().first: edge nodeedge()[i] connects point p to psup().first[i]
+    const std::vector< std::size_t >& nodeedge() const { return m_nodeedge; }
+
+    //! Element-to-edge connectivity
+    //! \return Edge ids of the edges of all elements, six per element, in the
+    //!   order of tk::lpoed
+    const std::vector< std::size_t >& inedel() const { return m_inedel; }
+
+    /** @name Pack/Unpack: Serialize EdgeList object for Charm++ */
+    ///@{
+    //! Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_edgenode;
+      p | m_psup;
+      p | m_nodeedge;
+      p | m_inedel;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] e EdgeList object reference
+    friend void operator|( PUP::er& p, EdgeList& e ) { e.pup(p); }
+    ///@}
+
+  private:
+    //! End points of edges, two per edge, the smaller id first
+    std::vector< std::size_t > m_edgenode;
+    //! Points surrounding points, sorted, in the layout of tk::genPsup()
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_psup;
+    //! Edge ids parallel to m_psup.first
+    std::vector< std::size_t > m_nodeedge;
+    //! Edge ids of element edges, six per element, in the order of tk::lpoed
+    std::vector< std::size_t > m_inedel;
+};
+
+} // tk::
+
+#endif // EdgeList_h
@@ -0,0 +1,109 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/NodeCommPlan.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Precompiled plan for exchanging data at chare-boundary nodes
+  \details   Precompiled plan for exchanging data at chare-boundary nodes.
+*/
+// *****************************************************************************
+
+#include <algorithm>
+
+#include "NodeCommPlan.hpp"
+#include "ContainerUtil.hpp"
+#include "Exception.hpp"
+
+using tk::NodeCommPlan;
+
+NodeCommPlan::NodeCommPlan(
+  const NodeCommMap& nodeCommMap,
+  const std::unordered_map< std::size_t, std::size_t >& lid,
+  const std::unordered_map< std::size_t, std::size_t >& bid ) :
+  m_chare(),
+  m_lid(),
+  m_bid()
+// *****************************************************************************
+//  Constructor: build plan from node communication map
+//! \param[in] nodeCommMap Node communication map: global ids of nodes shared
+//!   with fellow chares associated to chare ids
+//! \param[in] lid Global->local node ids
+//! \param[in] bid Global->chare-boundary node ids
+// *****************************************************************************
+{
+  // Order neighbors by chare id so that the plan does not depend on hashing
+  m_chare.reserve( nodeCommMap.size() );
+  for (const auto& [c,n] : nodeCommMap) m_chare.push_back( c );
+  std::sort( begin(m_chare), end(m_chare) );
+
+  m_lid.resize( m_chare.size() );
+  m_bid.resize( m_chare.size() );
+  for (std::size_t n=0; n<m_chare.size(); ++n) {
+    const auto& nodes = tk::cref_find( nodeCommMap, m_chare[n] );
+    // Order shared nodes by global id, which is the same on both sides
+    std::vector< std::size_t > gid( begin(nodes), end(nodes) );
+    std::sort( begin(gid), end(gid) );
+    m_lid[n].reserve( gid.size() );
+    m_bid[n].reserve( gid.size() );
+    for (auto g : gid) {
+      m_lid[n].push_back( tk::cref_find( lid, g ) );
+      m_bid[n].push_back( tk::cref_find( bid, g ) );
+    }
+  }
+}
+
+std::size_t
+NodeCommPlan::neighbor( int chare ) const
+// *****************************************************************************
+//  Find neighbor index of a chare id
+//! \param[in] chare Chare id to find
+//! \return Neighbor index n, for which chare(n) == chare
+// *****************************************************************************
+{
+  auto it = std::lower_bound( begin(m_chare), end(m_chare), chare );
+  Assert( it != end(m_chare) && *it == chare,
+          "Chare " + std::to_string(chare) + " is not a neighbor" );
+  return static_cast< std::size_t >( it - begin(m_chare) );
+}
+
+std::vector< tk::real >
+NodeCommPlan::pack( const tk::Fields& f, const std::vector< std::size_t >& id )
+// *****************************************************************************
+//  Gather data at shared nodes into a contiguous buffer
+//! \param[in] f Data to gather from, indexed by id
+//! \param[in] id Ids of nodes to gather, lid(n) or bid(n) depending on how f
+//!   is indexed
+//! \return Buffer with all components of f at the nodes in id, with the
+//!   components of a node stored contiguously
+// *****************************************************************************
+{
+  const auto ncomp = f.nprop();
+  std::vector< tk::real > buf( id.size() * ncomp );
+  auto b = buf.data();
+  for (auto i : id)
+    for (std::size_t c=0; c<ncomp; ++c)
+      *b++ = f(i,c,0);
+  return buf;
+}
+
+void
+NodeCommPlan::add( const std::vector< tk::real >& buf,
+                   const std::vector< std::size_t >& id,
+                   tk::Fields& f )
+// *****************************************************************************
+//  Add data from a contiguous buffer to shared nodes
+//! \param[in] buf Buffer as created by pack() on a neighbor chare
+//! \param[in] id Ids of nodes to add to, lid(n) or bid(n) depending on how f
+//!   is indexed
+//! \param[in,out] f Data to add to, indexed by id
+// *****************************************************************************
+{
+  const auto ncomp = f.nprop();
+  Assert( buf.size() == id.size() * ncomp, "Size mismatch" );
+  auto b = buf.data();
+  for (auto i : id)
+    for (std::size_t c=0; c<ncomp; ++c)
+      f(i,c,0) += *b++;
+}
@@ -0,0 +1,113 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/NodeCommPlan.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Precompiled plan for exchanging data at chare-boundary nodes
+  \details   Precompiled plan for exchanging data at chare-boundary nodes.
+    A node communication map associates the global ids of the nodes shared
+    with fellow chares to chare ids. Sending data based on the map requires
+    a hash lookup of the local id of every node and the global ids to be sent
+    along. A NodeCommPlan resolves the local and chare-boundary ids of the
+    shared nodes once, ordered by their global ids, so that both chares on
+    either side of a chare boundary agree on the order of the nodes. Data can
+    then be exchanged in contiguous buffers without global ids, packed and
+    unpacked by indexing. The plan must be rebuilt whenever the node
+    communication map or the local ids change, e.g., after mesh refinement.
+*/
+// *****************************************************************************
+#ifndef NodeCommPlan_h
+#define NodeCommPlan_h
+
+#include <vector>
+#include <unordered_map>
+
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "CommMap.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Precompiled plan for exchanging data at chare-boundary nodes
+class NodeCommPlan {
+
+  public:
+    //! Default constructor: empty plan, no neighbor chares
+    explicit NodeCommPlan() : m_chare(), m_lid(), m_bid() {}
+
+    //! Constructor: build plan from node communication map
+    explicit NodeCommPlan(
+      const NodeCommMap& nodeCommMap,
+      const std::unordered_map< std::size_t, std::size_t >& lid,
+      const std::unordered_map< std::size_t, std::size_t >& bid );
+
+    //! Number of neighbor chares
+    //! \return Number of chares we share nodes with
+    std::size_t size() const noexcept { return m_chare.size(); }
+
+    //! Query if there are no neighbor chares
+    //! \return True if we share no nodes with other chares
+    bool empty() const noexcept { return m_chare.empty(); }
+
+    //! Chare id of a neighbor
+    //! \param[in] n Neighbor index, n < size()
+    //! \return Chare id of neighbor n
+    int chare( std::size_t n ) const { return m_chare[n]; }
+
+    //! Find neighbor index of a chare id
+    std::size_t neighbor( int chare ) const;
+
+    //! Local ids of the nodes shared with a neighbor
+    //! \param[in] n Neighbor index, n < size()
+    //! \return Local node ids shared with neighbor n in the order of the plan
+    const std::vector< std::size_t >& lid( std::size_t n ) const
+    { return m_lid[n]; }
+
+    //! Chare-boundary ids of the nodes shared with a neighbor
+    //! \param[in] n Neighbor index, n < size()
+    //! \return Chare-boundary node ids shared with neighbor n in the order of
+    //!   the plan
+    const std::vector< std::size_t >& bid( std::size_t n ) const
+    { return m_bid[n]; }
+
+    //! Gather data at shared nodes into a contiguous buffer
+    static std::vector< tk::real >
+    pack( const tk::Fields& f, const std::vector< std::size_t >& id );
+
+    //! Add data from a contiguous buffer to shared nodes
+    static void
+    add( const std::vector< tk::real >& buf,
+         const std::vector< std::size_t >& id,
+         tk::Fields& f );
+
+    /** @name Pack/Unpack: Serialize NodeCommPlan object for Charm++ */
+    ///@{
+    //! Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_chare;
+      p | m_lid;
+      p | m_bid;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c NodeCommPlan object reference
+    friend void operator|( PUP::er& p, NodeCommPlan& c ) { c.pup(p); }
+    ///@}
+
+  private:
+    //! Neighbor chare ids in increasing order
+    std::vector< int > m_chare;
+    //! Local ids of nodes shared with each neighbor ordered by global id
+    std::vector< std::vector< std::size_t > > m_lid;
+    //! Chare-boundary ids of nodes shared with each neighbor ordered by
+    //! global id
+    std::vector< std::vector< std::size_t > > m_bid;
+};
+
+} // tk::
+
+#endif // NodeCommPlan_h
@@ -16,6 +16,9 @@
 #include <map>
 #include <tuple>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 
 #include "Reorder.hpp"
 #include "Exception.hpp"
@@ -216,47 +219,263 @@ renumber( const std::pair< std::vector< std::size_t >,
 //  Reorder mesh points with the advancing front technique
 //! \param[in] psup Points surrounding points
 //! \return Mapping created by renumbering (reordering)
+//! \details The front is a single queue of points, so the cost is linear in
+//!   the number of edges. If the graph is not connected, a new front is
+//!   started from the lowest point id not yet numbered.
 // *****************************************************************************
 {
   // Find out number of nodes in graph
   auto npoin = psup.second.size()-1;
 
   // Construct mapping using advancing front
-  std::vector< int > hpoin( npoin, -1 ), lpoin( npoin, 0 );
-  std::vector< std::size_t > map( npoin, 0 );
-  hpoin[0] = 0;
-  lpoin[0] = 1;
-  std::size_t num = 1;
-  while (num < npoin) {
-    std::size_t cnt = 0;
-    std::size_t i = 0;
-    std::vector< int > kpoin( npoin, -1 );
-    int p;
-    while ((p = hpoin[i]) != -1) {
-      ++i;
-      auto P = static_cast< std::size_t >( p );
-      for (auto j=psup.second[P]+1; j<=psup.second[P+1]; ++j) {
+  const auto npos = std::numeric_limits< std::size_t >::max();
+  std::vector< std::size_t > map( npoin, npos ), front;
+  front.reserve( npoin );
+  std::size_t num = 0;
+  for (std::size_t s=0; s<npoin; ++s) {
+    if (map[s] != npos) continue;
+    map[s] = num++;
+    front.push_back( s );
+    for (auto i=front.size()-1; i<front.size(); ++i) {
+      auto p = front[i];
+      for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
         auto q = psup.first[j];
-        if (lpoin[q] != 1) {    // consider points not yet counted
+        if (map[q] == npos) {   // consider points not yet counted
           map[q] = num++;
-          kpoin[cnt] = static_cast< int >( q ); // register point as counted
-          lpoin[q] = 1;                         // register the point as counted
-          ++cnt;
+          front.push_back( q );
         }
       }
     }
-    hpoin = kpoin;
   }
 
-//   // Construct new->old id map
-//   std::size_t i = 0;
-//   std::vector< std::size_t > oldmap( npoin );
-//   for (auto n : map) oldmap[n] = i++;
+  // Return old->new map
+  return map;
+}
+
+std::vector< std::size_t >
+rcm( const std::pair< std::vector< std::size_t >,
+                      std::vector< std::size_t > >& psup )
+// *****************************************************************************
+//  Reorder mesh points with the reverse Cuthill-McKee algorithm
+//! \param[in] psup Points surrounding points
+//! \return Mapping created by renumbering (reordering), old->new ids
+//! \details Each connected component is numbered by a breadth-first search
+//!   starting from a pseudo-peripheral point found by the algorithm of George
+//!   and Liu, visiting the neighbors of a point in increasing order of their
+//!   degree. The final order is the reverse of the order of the visits, which
+//!   yields a small bandwidth and profile of the point adjacency matrix.
+//! \see A. George, J.W.H. Liu, An implementation of a pseudoperipheral node
+//!   finder, ACM Trans. Math. Softw. 5(3), 1979.
+// *****************************************************************************
+{
+  auto npoin = psup.second.size()-1;
+  auto deg = [&]( std::size_t p ){ return psup.second[p+1] - psup.second[p]; };
+
+  // Breadth-first search from point r returning the eccentricity of r and a
+  // point of minimum degree on the last level
+  const auto npos = std::numeric_limits< std::size_t >::max();
+  std::vector< std::size_t > seen( npoin, npos ), queue;
+  queue.reserve( npoin );
+  std::size_t stamp = 0;
+  auto bfs = [&]( std::size_t r ) {
+    queue.clear();
+    queue.push_back( r );
+    seen[r] = stamp;
+    std::size_t ecc = 0, head = 0, far = r;
+    while (head < queue.size()) {
+      auto last = queue.size();
+      far = queue[head];
+      for (auto i=head; i<last; ++i) {
+        auto p = queue[i];
+        if (deg(p) < deg(far)) far = p;
+        for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
+          auto q = psup.first[j];
+          if (seen[q] != stamp) {
+            seen[q] = stamp;
+            queue.push_back( q );
+          }
+        }
+      }
+      head = last;
+      if (head < queue.size()) ++ecc;
+    }
+    ++stamp;
+    return std::make_pair( ecc, far );
+  };
+
+  // Number points in Cuthill-McKee order, storing the position in map
+  std::vector< std::size_t > map( npoin, npos ), order;
+  order.reserve( npoin );
+  for (std::size_t s=0; s<npoin; ++s) {
+    if (map[s] != npos) continue;
+
+    // Find pseudo-peripheral point of the component of s
+    auto r = s;
+    auto [ecc, far] = bfs( r );
+    for (;;) {
+      auto [e, f] = bfs( far );
+      if (e <= ecc) break;
+      r = far;
+      ecc = e;
+      far = f;
+    }
+
+    // Advance front from r visiting neighbors in increasing degree
+    map[r] = order.size();
+    order.push_back( r );
+    for (auto i=order.size()-1; i<order.size(); ++i) {
+      auto p = order[i];
+      auto b = order.size();
+      for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
+        auto q = psup.first[j];
+        if (map[q] == npos) {
+          map[q] = order.size();
+          order.push_back( q );
+        }
+      }
+      std::sort( order.begin() + static_cast< std::ptrdiff_t >( b ),
+                 order.end(),
+                 [&]( std::size_t a, std::size_t c ){
+                   return deg(a) < deg(c) || (deg(a) == deg(c) && a < c); } );
+      for (auto k=b; k<order.size(); ++k) map[ order[k] ] = k;
+    }
+  }
+
+  // Reverse the order
+  for (auto& m : map) m = npoin - 1 - m;
 
-  // Return old->new and new->old maps
   return map;
 }
 
+std::vector< std::size_t >
+spaceFillingCurve( const std::array< std::vector< real >, 3 >& coord,
+                   SFCType type )
+// *****************************************************************************
+//  Reorder mesh points along a space-filling curve
+//! \param[in] coord Point coordinates
+//! \param[in] type Type of space-filling curve
+//! \return Mapping created by renumbering (reordering), old->new ids
+//! \details The bounding box of the points is scaled uniformly onto a grid of
+//!   2^21 cells in each direction and the points are sorted by the position
+//!   of their cell along the curve, encoded in a 63-bit key. The Hilbert
+//!   curve is computed by transforming the cell coordinates to the transpose
+//!   of the Hilbert index, which is then bit-interleaved the same way as the
+//!   Morton (Z-order) key.
+//! \see J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 381,
+//!   2004.
+// *****************************************************************************
+{
+  Assert( coord[0].size() == coord[1].size() &&
+          coord[0].size() == coord[2].size(), "Size mismatch" );
+
+  auto npoin = coord[0].size();
+  if (npoin == 0) return {};
+
+  // Number of bits per coordinate and the largest cell coordinate
+  constexpr std::size_t nbit = 21;
+  constexpr std::uint64_t maxcell = (std::uint64_t(1) << nbit) - 1;
+
+  // Compute uniform scaling of the bounding box to cell coordinates
+  std::array< real, 3 > lo;
+  real len = 0.0;
+  for (std::size_t d=0; d<3; ++d) {
+    auto [mn,mx] = std::minmax_element( begin(coord[d]), end(coord[d]) );
+    lo[d] = *mn;
+    len = std::max( len, *mx - *mn );
+  }
+  const auto scale = len > 0.0 ? static_cast< real >( maxcell ) / len : 0.0;
+
+  // Spread the lower 21 bits of x apart by two zero bits
+  auto spread = []( std::uint64_t x ) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+  };
+
+  // Compute keys along curve
+  std::vector< std::uint64_t > key( npoin );
+  for (std::size_t p=0; p<npoin; ++p) {
+    std::array< std::uint64_t, 3 > X;
+    for (std::size_t d=0; d<3; ++d)
+      X[d] = std::min( maxcell,
+               static_cast< std::uint64_t >( (coord[d][p] - lo[d]) * scale ) );
+    if (type == SFCType::HILBERT) {
+      // Inverse undo excess work
+      for (auto Q = maxcell/2+1; Q > 1; Q >>= 1) {
+        auto P = Q - 1;
+        for (std::size_t d=0; d<3; ++d)
+          if (X[d] & Q) {
+            X[0] ^= P;
+          } else {
+            auto t = (X[0] ^ X[d]) & P;
+            X[0] ^= t;
+            X[d] ^= t;
+          }
+      }
+      // Gray encode
+      X[1] ^= X[0];
+      X[2] ^= X[1];
+      std::uint64_t t = 0;
+      for (auto Q = maxcell/2+1; Q > 1; Q >>= 1) if (X[2] & Q) t ^= Q - 1;
+      for (auto& x : X) x ^= t;
+    }
+    key[p] = spread(X[0]) << 2 | spread(X[1]) << 1 | spread(X[2]);
+  }
+
+  // Sort points by their keys
+  std::vector< std::size_t > order( npoin );
+  std::iota( begin(order), end(order), 0 );
+  std::stable_sort( begin(order), end(order),
+    [&]( std::size_t a, std::size_t b ){ return key[a] < key[b]; } );
+
+  // Return old->new map
+  std::vector< std::size_t > map( npoin );
+  for (std::size_t i=0; i<npoin; ++i) map[ order[i] ] = i;
+  return map;
+}
+
+std::size_t
+bandwidth( const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& psup )
+// *****************************************************************************
+//  Compute bandwidth of the point adjacency matrix
+//! \param[in] psup Points surrounding points
+//! \return Largest difference between the ids of two neighbor points
+// *****************************************************************************
+{
+  std::size_t b = 0;
+  for (std::size_t p=0; p<psup.second.size()-1; ++p)
+    for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
+      auto q = psup.first[j];
+      b = std::max( b, p > q ? p-q : q-p );
+    }
+  return b;
+}
+
+std::size_t
+profile( const std::pair< std::vector< std::size_t >,
+                          std::vector< std::size_t > >& psup )
+// *****************************************************************************
+//  Compute profile of the point adjacency matrix
+//! \param[in] psup Points surrounding points
+//! \return Sum of the distances of the rows of the lower triangle of the point
+//!   adjacency matrix from the diagonal to their leftmost nonzero
+// *****************************************************************************
+{
+  std::size_t s = 0;
+  for (std::size_t p=0; p<psup.second.size()-1; ++p) {
+    auto m = p;
+    for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j)
+      m = std::min( m, psup.first[j] );
+    s += p - m;
+  }
+  return s;
+}
+
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid )
 // *****************************************************************************
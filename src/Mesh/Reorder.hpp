@@ -19,6 +19,7 @@
 #include <map>
 #include <cstddef>
 #include <array>
+#include <cstdint>
 
 #include "Types.hpp"
 
@@ -61,6 +62,29 @@ std::vector< std::size_t >
 renumber( const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& psup );
 
+//! Reorder mesh points with the reverse Cuthill-McKee algorithm
+std::vector< std::size_t >
+rcm( const std::pair< std::vector< std::size_t >,
+                      std::vector< std::size_t > >& psup );
+
+//! Space-filling curve types
+enum class SFCType : uint8_t { MORTON, HILBERT };
+
+//! Reorder mesh points along a space-filling curve
+std::vector< std::size_t >
+spaceFillingCurve( const std::array< std::vector< real >, 3 >& coord,
+                   SFCType type );
+
+//! Compute bandwidth of the point adjacency matrix
+std::size_t
+bandwidth( const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& psup );
+
+//! Compute profile of the point adjacency matrix
+std::size_t
+profile( const std::pair< std::vector< std::size_t >,
+                          std::vector< std::size_t > >& psup );
+
 //! Assign local ids to global ids
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid );
@@ -21,31 +21,15 @@
 #include <unordered_set>
 #include <unordered_map>
 
-#include "NoWarning/sip_hash.hpp"
-
 #include "Types.hpp"
 #include "ContainerUtil.hpp"
+#include "FlatHash.hpp"
 
 namespace tk {
 
-//! Highway hash "secret" key
-//! \note No reason for these particular numbers, taken from highwayhash tests.
-static constexpr highwayhash::HH_U64 hh_key[2] =
-  { 0x0706050403020100ULL, 0x0F0E0D0C0B0A0908ULL };
-
 //! 3D unstructured mesh class
 class UnsMesh {
 
-  private:
-    //! Union to access an C-style array of std::size_t as an array of bytes
-    //! \tparam N Number of entries to hold
-    //! \see UnsMesh::Hash
-    template< std::size_t N >
-    union Shaper {
-      char bytes[ N*sizeof(std::size_t) ];
-      std::size_t sizets[ N ];
-    };
-
   public:
     using Coords = std::array< std::vector< real >, 3 >;
     using Coord = std::array< real, 3 >;
@@ -69,6 +53,20 @@ class UnsMesh {
     using Tet = std::array< std::size_t, 4 >;
     ///@}
 
+    //! Put node IDs of an element primitive in canonical (ascending) order
+    //! \tparam N Number of nodes describing element primitive. E.g., Edge:2,
+    //!    Face:3, Tet:4.
+    //! \param[in] p Array of node IDs of element primitive
+    //! \return Node IDs sorted in ascending order
+    template< std::size_t N >
+    static std::array< std::size_t, N >
+    canonical( std::array< std::size_t, N > p ) noexcept {
+      for (std::size_t i=1; i<N; ++i)
+        for (std::size_t j=i; j>0 && p[j-1]>p[j]; --j)
+          std::swap( p[j-1], p[j] );
+      return p;
+    }
+
     //! Hash function class for element primitives, given by node IDs
     //! \tparam N Number of nodes describing element primitive. E.g., Edge:2,
     //!    Face:3, Tet:4.
@@ -80,11 +78,7 @@ class UnsMesh {
       //! \note The order of the nodes does not matter: the IDs are sorted
       //!   before the hash is computed.
       std::size_t operator()( const std::array< std::size_t, N >& p ) const {
-        using highwayhash::SipHash;
-        Shaper< N > shaper;
-        for (std::size_t i=0; i<N; ++i) shaper.sizets[i] = p[i];
-        std::sort( std::begin(shaper.sizets), std::end(shaper.sizets) );
-        return SipHash( hh_key, shaper.bytes, N*sizeof(std::size_t) );
+        return hasharray( canonical( p ) );
       }
     };
 
@@ -102,10 +96,25 @@ class UnsMesh {
       bool operator()( const std::array< std::size_t, N >& l,
                        const std::array< std::size_t, N >& r ) const
       {
-        std::array< std::size_t, N > s = l, p = r;
-        std::sort( begin(s), end(s) );
-        std::sort( begin(p), end(p) );
-        return s == p;
+        return canonical( l ) == canonical( r );
+      }
+    };
+
+    //! Hash function class for element primitives in canonical order
+    //! \tparam N Number of nodes describing element primitive. E.g., Edge:2,
+    //!    Face:3, Tet:4.
+    //! \details Unlike Hash, this does not sort the node IDs, so it must only
+    //!   be used with keys passed through canonical(). Equality of such keys
+    //!   is then determined by std::equal_to without sorting either.
+    template< std::size_t N >
+    struct CanonicalHash {
+      //! Function call operator computing hash of node IDs
+      //! \param[in] p Array of node IDs of element primitive, in canonical
+      //!   order
+      //! \return Hash value of node IDs
+      std::size_t operator()( const std::array< std::size_t, N >& p ) const {
+        Assert( canonical(p) == p, "Node IDs not in canonical order" );
+        return hasharray( p );
       }
     };
 
@@ -118,6 +127,12 @@ class UnsMesh {
     //! Unique set of tets
     using TetSet = std::unordered_set< Tet, Hash<4>, Eq<4> >;
 
+    //! Unique flat set of edges whose node IDs are in canonical order
+    using CanonicalEdgeSet = FlatHashSet< Edge, CanonicalHash<2> >;
+
+    //! Unique flat set of faces whose node IDs are in canonical order
+    using CanonicalFaceSet = FlatHashSet< Face, CanonicalHash<3> >;
+
     /** @name Constructors */
     ///@{
     //! Constructor without initializing anything
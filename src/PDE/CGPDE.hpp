@@ -157,6 +157,10 @@ class CGPDE {
       const std::vector< real >& vol,
       const std::vector< std::size_t >& edgenode,
       const std::vector< std::size_t >& edgeid,
+      const std::vector< std::size_t >& chbndpoin,
+      const std::vector< std::size_t >& intpoin,
+      std::size_t nchbndedge,
+      const std::function< void() >& chbndrhs,
       const std::unordered_set< std::size_t >& boxnodes,
       const tk::Fields& G,
       const tk::Fields& U,
@@ -164,7 +168,8 @@ class CGPDE {
       real V,
       tk::Fields& R ) const
     { self->rhs( t, coord, inpoel, triinpoel, gid, bid, lid, dfn, psup, esup,
-                 symbctri, vol, edgenode, edgeid, boxnodes, G, U, tp, V, R ); }
+                 symbctri, vol, edgenode, edgeid, chbndpoin, intpoin,
+                 nchbndedge, chbndrhs, boxnodes, G, U, tp, V, R ); }
 
     //! Public interface for computing the minimum time step size
     real dt( const std::array< std::vector< real >, 3 >& coord,
@@ -180,16 +185,24 @@ class CGPDE {
              std::vector< real >& dtp ) const
     { self->dt( it, vol, U, dtp ); }
 
-    //! \brief Public interface for querying Dirichlet boundary condition values
-    //!  set by the user on a given side set for all components in a PDE system
-    std::map< std::size_t, std::vector< std::pair<bool,real> > >
+    //! \brief Public interface for querying nodes at which the user has set
+    //!   Dirichlet boundary conditions
+    std::vector< std::size_t >
+    dirbcNodes( const std::map< int, std::vector< std::size_t > >& bnode ) const
+    { return self->dirbcNodes( bnode ); }
+
+    //! \brief Public interface for evaluating Dirichlet boundary condition
+    //!   values for all components in a PDE system
+    void
     dirbc( real t,
            real deltat,
            const std::vector< real >& tp,
            const std::vector< real >& dtp,
-           const std::pair< const int, std::vector< std::size_t > >& sides,
-           const std::array< std::vector< real >, 3 >& coord ) const
-    { return self->dirbc( t, deltat, tp, dtp, sides, coord ); }
+           const std::vector< std::size_t >& nodes,
+           const std::array< std::vector< real >, 3 >& coord,
+           std::unordered_map< std::size_t,
+             std::vector< std::pair< bool, real > > >& bc ) const
+    { self->dirbc( t, deltat, tp, dtp, nodes, coord, bc ); }
 
     //! Public interface to set symmetry boundary conditions at nodes
     void
@@ -303,6 +316,10 @@ class CGPDE {
         const std::vector< real >&,
         const std::vector< std::size_t >&,
         const std::vector< std::size_t >&,
+        const std::vector< std::size_t >&,
+        const std::vector< std::size_t >&,
+        std::size_t,
+        const std::function< void() >&,
         const std::unordered_set< std::size_t >&,
         const tk::Fields&,
         const tk::Fields&,
@@ -317,13 +334,16 @@ class CGPDE {
                        const std::vector< real > &,
                        const tk::Fields&,
                        std::vector< real >& ) const = 0;
-      virtual std::map< std::size_t, std::vector< std::pair<bool,real> > >
-      dirbc( real,
-             real,
-             const std::vector< real >&,
-             const std::vector< real >&,
-             const std::pair< const int, std::vector< std::size_t > >&,
-             const std::array< std::vector< real >, 3 >& ) const = 0;
+      virtual std::vector< std::size_t > dirbcNodes(
+        const std::map< int, std::vector< std::size_t > >& ) const = 0;
+      virtual void dirbc( real,
+        real,
+        const std::vector< real >&,
+        const std::vector< real >&,
+        const std::vector< std::size_t >&,
+        const std::array< std::vector< real >, 3 >&,
+        std::unordered_map< std::size_t,
+          std::vector< std::pair< bool, real > > >& ) const = 0;
       virtual void symbc(
         tk::Fields& U,
         const std::array< std::vector< real >, 3 >&,
@@ -403,6 +423,10 @@ class CGPDE {
         const std::vector< real >& vol,
         const std::vector< std::size_t >& edgenode,
         const std::vector< std::size_t >& edgeid,
+        const std::vector< std::size_t >& chbndpoin,
+        const std::vector< std::size_t >& intpoin,
+        std::size_t nchbndedge,
+        const std::function< void() >& chbndrhs,
         const std::unordered_set< std::size_t >& boxnodes,
         const tk::Fields& G,
         const tk::Fields& U,
@@ -410,7 +434,8 @@ class CGPDE {
         real V,
         tk::Fields& R ) const override
       { data.rhs( t, coord, inpoel, triinpoel, gid, bid, lid, dfn, psup, esup,
-                  symbctri, vol, edgenode, edgeid, boxnodes, G, U, tp, V, R ); }
+                  symbctri, vol, edgenode, edgeid, chbndpoin, intpoin,
+                  nchbndedge, chbndrhs, boxnodes, G, U, tp, V, R ); }
       real dt( const std::array< std::vector< real >, 3 >& coord,
                const std::vector< std::size_t >& inpoel,
                tk::real t,
@@ -421,14 +446,18 @@ class CGPDE {
                const tk::Fields& U,
                std::vector< real >& dtp ) const override
       { data.dt( it, vol, U, dtp ); }
-      std::map< std::size_t, std::vector< std::pair<bool,real> > >
-      dirbc( real t,
-             real deltat,
-             const std::vector< real >& tp,
-             const std::vector< real >& dtp,
-             const std::pair< const int, std::vector< std::size_t > >& sides,
-             const std::array< std::vector< real >, 3 >& coord ) const
-        override { return data.dirbc( t, deltat, tp, dtp, sides, coord ); }
+      std::vector< std::size_t > dirbcNodes(
+        const std::map< int, std::vector< std::size_t > >& bnode ) const
+        override { return data.dirbcNodes( bnode ); }
+      void dirbc( real t,
+        real deltat,
+        const std::vector< real >& tp,
+        const std::vector< real >& dtp,
+        const std::vector< std::size_t >& nodes,
+        const std::array< std::vector< real >, 3 >& coord,
+        std::unordered_map< std::size_t,
+          std::vector< std::pair< bool, real > > >& bc ) const
+        override { data.dirbc( t, deltat, tp, dtp, nodes, coord, bc ); }
       void symbc(
         tk::Fields& U,
         const std::array< std::vector< real >, 3 >& coord,
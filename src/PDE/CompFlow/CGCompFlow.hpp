@@ -17,16 +17,20 @@
 #include <algorithm>
 #include <unordered_set>
 #include <unordered_map>
+#include <functional>
 
 #include "DerivedData.hpp"
 #include "Exception.hpp"
 #include "Vector.hpp"
+#include "ContainerUtil.hpp"
+#include "ParallelFor.hpp"
 #include "EoS/EoS.hpp"
 #include "Mesh/Around.hpp"
 #include "Reconstruction.hpp"
 #include "Problem/FieldOutput.hpp"
 #include "Problem/BoxInitialization.hpp"
 #include "Riemann/Rusanov.hpp"
+#include "Riemann/HLLC.hpp"
 #include "NodeBC.hpp"
 #include "EoS/EoS.hpp"
 #include "History.hpp"
@@ -57,6 +61,8 @@ class CompFlow {
     static constexpr real muscl_const = 1.0/3.0;
     static constexpr real muscl_m1 = 1.0 - muscl_const;
     static constexpr real muscl_p1 = 1.0 + muscl_const;
+    //! Number of edges processed together by the ALECG edge flux kernel
+    static constexpr std::size_t edgeblock = 64;
 
   public:
     //! \brief Constructor
@@ -68,6 +74,9 @@ class CompFlow {
       m_offset( g_inputdeck.get< tag::component >().offset< eq >(c) ),
       m_stagCnf( g_inputdeck.specialBC< eq, tag::bcstag >( c ) ),
       m_skipCnf( g_inputdeck.specialBC< eq, tag::bcskip >( c ) ),
+      m_flux( g_inputdeck.get< param, eq, tag::flux >().size() > c ?
+              g_inputdeck.get< param, eq, tag::flux >()[c] :
+              ctr::FluxType::Rusanov ),
       m_fr( g_inputdeck.get< param, eq, tag::farfield_density >().size() > c ?
             g_inputdeck.get< param, eq, tag::farfield_density >()[c] : 1.0 ),
       m_fp( g_inputdeck.get< param, eq, tag::farfield_pressure >().size() > c ?
@@ -210,6 +219,7 @@ class CompFlow {
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
+      const auto& mat = eos< eq >( m_system );
 
       // 1st stage: update element values from node values (gather-add)
       for (std::size_t e=0; e<inpoel.size()/4; ++e) {
@@ -251,9 +261,8 @@ class CompFlow {
         // pressure
         std::array< real, 4 > p;
         for (std::size_t a=0; a<4; ++a)
-          p[a] = eos_pressure< eq >
-                   ( m_system, u[0][a], u[1][a]/u[0][a], u[2][a]/u[0][a],
-                     u[3][a]/u[0][a], u[4][a] );
+          p[a] = mat.pressure( u[0][a], u[1][a]/u[0][a], u[2][a]/u[0][a],
+                               u[3][a]/u[0][a], u[4][a] );
 
         // sum flux contributions to element
         real d = deltat/2.0;
@@ -310,9 +319,8 @@ class CompFlow {
         for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
 
         // pressure
-        auto p = eos_pressure< eq >
-                   ( m_system, ue[0], ue[1]/ue[0], ue[2]/ue[0], ue[3]/ue[0],
-                     ue[4] );
+        auto p = mat.pressure( ue[0], ue[1]/ue[0], ue[2]/ue[0], ue[3]/ue[0],
+                               ue[4] );
 
         // scatter-add flux contributions to rhs at nodes
         real d = deltat * J/6.0;
@@ -446,6 +454,12 @@ class CompFlow {
     //! \param[in] vol Nodal volumes
     //! \param[in] edgenode Local node IDs of edges
     //! \param[in] edgeid Edge ids in the order of access
+    //! \param[in] chbndpoin Local ids of chare-boundary nodes
+    //! \param[in] intpoin Local ids of internal nodes, not on chare-boundary
+    //! \param[in] nchbndedge Number of edges adjacent to chare-boundary nodes,
+    //!   stored first in edgenode
+    //! \param[in] chbndrhs Function to call once the right-hand side is
+    //!   complete in chare-boundary nodes
     //! \param[in] boxnodes Mesh node ids within user-defined box
     //! \param[in] G Nodal gradients
     //! \param[in] U Solution vector at recent time step
@@ -468,6 +482,10 @@ class CompFlow {
               const std::vector< real >& vol,
               const std::vector< std::size_t >& edgenode,
               const std::vector< std::size_t >& edgeid,
+              const std::vector< std::size_t >& chbndpoin,
+              const std::vector< std::size_t >& intpoin,
+              std::size_t nchbndedge,
+              const std::function< void() >& chbndrhs,
               const std::unordered_set< std::size_t >& boxnodes,
               const tk::Fields& G,
               const tk::Fields& U,
@@ -489,9 +507,6 @@ class CompFlow {
       // zero right hand side for all components
       for (ncomp_t c=0; c<m_ncomp; ++c) R.fill( c, m_offset, 0.0 );
 
-      // compute domain-edge integral
-      domainint( coord, gid, edgenode, edgeid, psup, dfn, U, Grad, R );
-
       // compute boundary integrals
       bndint( coord, triinpoel, symbctri, U, R );
 
@@ -506,6 +521,10 @@ class CompFlow {
 
       // compute optional source integral
       src( coord, inpoel, t, tp, R );
+
+      // compute domain-edge integral, chare-boundary nodes first
+      domainint( coord, gid, edgenode, edgeid, psup, dfn, U, Grad, chbndpoin,
+                 intpoin, nchbndedge, chbndrhs, R );
     }
 
     //! Compute the minimum time step size
@@ -532,7 +551,8 @@ class CompFlow {
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
-      // ratio of specific heats
+      // equation of state and ratio of specific heats
+      const auto& mat = eos< eq >( m_system );
       auto g = g_inputdeck.get< tag::param, eq, tag::gamma >()[0][0];
       // compute the minimum dt across all elements we own
       real mindt = std::numeric_limits< real >::max();
@@ -557,9 +577,9 @@ class CompFlow {
           auto& rv = u[2][j];    // rho * v
           auto& rw = u[3][j];    // rho * w
           auto& re = u[4][j];    // rho * e
-          auto p = eos_pressure< eq >( m_system, r, ru/r, rv/r, rw/r, re );
+          auto p = mat.pressure( r, ru/r, rv/r, rw/r, re );
           if (p < 0) p = 0.0;
-          auto c = eos_soundspeed< eq >( m_system, r, p );
+          auto c = mat.soundspeed( r, p );
           auto v = std::sqrt((ru*ru + rv*rv + rw*rw)/r/r) + c; // char. velocity
 
           // energy source propagation velocity
@@ -600,20 +620,33 @@ class CompFlow {
              const tk::Fields& U,
              std::vector< tk::real >& dtp ) const
     {
-      for (std::size_t i=0; i<U.nunk(); ++i) {
-        // compute cubic root of element volume as the characteristic length
-        const auto L = std::cbrt( vol[i] );
-        // access solution at node p at recent time step
-        const auto u = U[i];
-        // compute pressure
-        auto p = eos_pressure< eq >
-                   ( m_system, u[0], u[1]/u[0], u[2]/u[0], u[3]/u[0], u[4] );
-        if (p < 0) p = 0.0;
-        auto c = eos_soundspeed< eq >( m_system, u[0], p );
-        // characteristic velocity
-        auto v = std::sqrt((u[1]*u[1] + u[2]*u[2] + u[3]*u[3])/u[0]/u[0]) + c;
-        // compute dt for node
-        dtp[i] = L / v * g_inputdeck.get< tag::discr, tag::cfl >();
+      const auto& mat = eos< eq >( m_system );
+      const auto cfl = g_inputdeck.get< tag::discr, tag::cfl >();
+      std::array< const real*, m_ncomp > up;
+      for (ncomp_t c=0; c<m_ncomp; ++c) up[c] = U.cptr( c, m_offset );
+
+      // evaluate the equation of state for blocks of nodes at a time
+      constexpr std::size_t B = 64;
+      real u[m_ncomp][B], p[B], a[B];
+      for (std::size_t b=0; b<U.nunk(); b+=B) {
+        const auto n = std::min( B, U.nunk()-b );
+        // gather solution at nodes of block at recent time step
+        for (ncomp_t c=0; c<m_ncomp; ++c)
+          for (std::size_t j=0; j<n; ++j) u[c][j] = U.var( up[c], b+j );
+        // compute pressure and speed of sound
+        mat.pressure( n, u[0], u[1], u[2], u[3], u[4], nullptr, p );
+        #pragma omp simd
+        for (std::size_t j=0; j<n; ++j) p[j] = std::max( p[j], 0.0 );
+        mat.soundspeed( n, u[0], p, nullptr, a );
+        for (std::size_t j=0; j<n; ++j) {
+          // compute cubic root of element volume as the characteristic length
+          const auto L = std::cbrt( vol[b+j] );
+          // characteristic velocity
+          auto v = std::sqrt( (u[1][j]*u[1][j] + u[2][j]*u[2][j] +
+                               u[3][j]*u[3][j]) / u[0][j] / u[0][j] ) + a[j];
+          // compute dt for node
+          dtp[b+j] = L / v * cfl;
+        }
       }
     }
 
@@ -640,49 +673,67 @@ class CompFlow {
       return v;
     }
 
-    //! \brief Query Dirichlet boundary condition value on a given side set for
-    //!    all components in this PDE system
+    //! Query nodes at which Dirichlet boundary conditions are set
+    //! \param[in] bnode Local node IDs associated to side set IDs
+    //! \return Unique (local) node IDs at which the user has set Dirichlet
+    //!   boundary conditions for this PDE system on any of the side sets
+    std::vector< std::size_t >
+    dirbcNodes( const std::map< int, std::vector< std::size_t > >& bnode ) const
+    {
+      using tag::param; using tag::bcdir;
+      std::vector< std::size_t > nodes;
+      const auto& ubc = g_inputdeck.get< param, eq, tag::bc, bcdir >();
+      if (!ubc.empty()) {
+        Assert( ubc.size() > 0, "Indexing out of Dirichlet BC eq-vector" );
+        for (const auto& b : ubc[0]) {
+          auto s = bnode.find( std::stoi(b) );
+          if (s != end(bnode))
+            nodes.insert( end(nodes), begin(s->second), end(s->second) );
+        }
+      }
+      tk::unique( nodes );
+      return nodes;
+    }
+
+    //! Evaluate Dirichlet boundary condition values for all components in
+    //! this PDE system
     //! \param[in] t Physical time
     //! \param[in] deltat Time step size
     //! \param[in] tp Physical time for each mesh node
     //! \param[in] dtp Time step size for each mesh node
-    //! \param[in] ss Pair of side set ID and (local) node IDs on the side set
+    //! \param[in] nodes Local node IDs at which to set Dirichlet BCs, as
+    //!   returned by dirbcNodes()
     //! \param[in] coord Mesh node coordinates
-    //! \return Vector of pairs of bool and boundary condition value associated
-    //!   to mesh node IDs at which Dirichlet boundary conditions are set. Note
-    //!   that instead of the actual boundary condition value, we return the
-    //!   increment between t+deltat and t, since that is what the solution requires
-    //!   as we solve for the soution increments and not the solution itself.
-    std::map< std::size_t, std::vector< std::pair<bool,real> > >
+    //! \param[in,out] bc Vector of pairs of bool and boundary condition value
+    //!   associated to mesh node IDs at which Dirichlet boundary conditions are
+    //!   set. Must already contain all nodes. Note that instead of the actual
+    //!   boundary condition value, we store the increment between t+deltat and
+    //!   t, since that is what the solution requires as we solve for the
+    //!   soution increments and not the solution itself.
+    void
     dirbc( real t,
            real deltat,
            const std::vector< tk::real >& tp,
            const std::vector< tk::real >& dtp,
-           const std::pair< const int, std::vector< std::size_t > >& ss,
-           const std::array< std::vector< real >, 3 >& coord ) const
+           const std::vector< std::size_t >& nodes,
+           const std::array< std::vector< real >, 3 >& coord,
+           std::unordered_map< std::size_t,
+             std::vector< std::pair< bool, real > > >& bc ) const
     {
-      using tag::param; using tag::bcdir;
-      using NodeBC = std::vector< std::pair< bool, real > >;
-      std::map< std::size_t, NodeBC > bc;
-      const auto& ubc = g_inputdeck.get< param, eq, tag::bc, bcdir >();
       const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
-      if (!ubc.empty()) {
-        Assert( ubc.size() > 0, "Indexing out of Dirichlet BC eq-vector" );
-        const auto& x = coord[0];
-        const auto& y = coord[1];
-        const auto& z = coord[2];
-        for (const auto& b : ubc[0])
-          if (std::stoi(b) == ss.first)
-            for (auto n : ss.second) {
-              Assert( x.size() > n, "Indexing out of coordinate array" );
-              if (steady) { t = tp[n]; deltat = dtp[n]; }
-              auto s = solinc( m_system, m_ncomp, x[n], y[n], z[n],
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      for (auto n : nodes) {
+        Assert( x.size() > n, "Indexing out of coordinate array" );
+        if (steady) { t = tp[n]; deltat = dtp[n]; }
+        const auto s = solinc( m_system, m_ncomp, x[n], y[n], z[n],
                                t, deltat, Problem::initialize );
-              bc[n] = {{ {true,s[0]}, {true,s[1]}, {true,s[2]}, {true,s[3]},
-                         {true,s[4]} }};
-            }
+        auto& nbc = tk::ref_find( bc, n );
+        Assert( nbc.size() >= m_offset+m_ncomp, "Size of NodeBC incorrect" );
+        for (ncomp_t c=0; c<m_ncomp; ++c)
+          nbc[m_offset+c] = { true, s[c] };
       }
-      return bc;
     }
 
     //! Set symmetry boundary conditions at nodes
@@ -740,6 +791,7 @@ class CompFlow {
       const auto& y = coord[1];
       const auto& z = coord[2];
       const auto& fbc = g_inputdeck.get<param, eq, tag::bc, tag::bcfarfield>();
+      const auto& mat = eos< eq >( m_system );
       if (fbc.size() > m_system)               // use farbcs for this system
         for (auto p : nodes)                   // for all farfieldbc nodes
           if (!skipPoint(x[p],y[p],z[p]))
@@ -755,28 +807,25 @@ class CompFlow {
                   auto& re = U(p,4,m_offset);
                   auto vn =
                     (ru*i->second[0] + rv*i->second[1] + rw*i->second[2]) / r;
-                  auto a = eos_soundspeed< eq >( m_system, r,
-                    eos_pressure< eq >( m_system, r, ru/r, rv/r, rw/r, re ) );
+                  auto a = mat.soundspeed( r,
+                             mat.pressure( r, ru/r, rv/r, rw/r, re ) );
                   auto M = vn / a;
                   if (M <= -1.0) {                      // supersonic inflow
                     r  = m_fr;
                     ru = m_fr * m_fu[0];
                     rv = m_fr * m_fu[1];
                     rw = m_fr * m_fu[2];
-                    re = eos_totalenergy< eq >
-                           ( m_system, m_fr, m_fu[0], m_fu[1], m_fu[2], m_fp );
+                    re = mat.totalenergy( m_fr, m_fu[0], m_fu[1], m_fu[2],
+                                          m_fp );
                   } else if (M > -1.0 && M < 0.0) {     // subsonic inflow
                     r  = m_fr;
                     ru = m_fr * m_fu[0];
                     rv = m_fr * m_fu[1];
                     rw = m_fr * m_fu[2];
-                    re =
-                    eos_totalenergy< eq >( m_system, m_fr, m_fu[0], m_fu[1],
-                      m_fu[2], eos_pressure< eq >( m_system, r, ru/r, rv/r,
-                                                   rw/r, re ) );
+                    re = mat.totalenergy( m_fr, m_fu[0], m_fu[1], m_fu[2],
+                           mat.pressure( r, ru/r, rv/r, rw/r, re ) );
                   } else if (M >= 0.0 && M < 1.0) {     // subsonic outflow
-                    re = eos_totalenergy< eq >( m_system, r, ru/r, rv/r, rw/r,
-                                                m_fp );
+                    re = mat.totalenergy( r, ru/r, rv/r, rw/r, m_fp );
                   }
                 }
               }
@@ -825,6 +874,8 @@ class CompFlow {
     const std::tuple< std::vector< real >, std::vector< real > > m_stagCnf;
     //! Skip BC user configuration: point coordinates and radii
     const std::tuple< std::vector< real >, std::vector< real > > m_skipCnf;
+    //! Riemann flux function used by ALECG
+    const ctr::FluxType m_flux;
     const real m_fr;                    //!< Farfield density
     const real m_fp;                    //!< Farfield pressure
     const std::vector< real > m_fu;     //!< Farfield velocity
@@ -968,7 +1019,22 @@ class CompFlow {
     //! \param[in] dfn Dual-face normals
     //! \param[in] U Solution vector at recent time step
     //! \param[in] G Nodal gradients
+    //! \param[in] chbndpoin Local ids of chare-boundary nodes
+    //! \param[in] intpoin Local ids of internal nodes, not on chare-boundary
+    //! \param[in] nchbndedge Number of edges adjacent to chare-boundary nodes,
+    //!   stored first in edgenode
+    //! \param[in] chbndrhs Function to call once the right-hand side is
+    //!   complete in chare-boundary nodes
     //! \param[in,out] R Right-hand side vector computed
+    //! \details The integral is first computed in the edges adjacent to and
+    //!   summed to the chare-boundary nodes, so that their contributions can be
+    //!   sent to fellow chares by chbndrhs() while the integral in the rest of
+    //!   the edges and in the internal nodes is computed. Both the edge fluxes
+    //!   and their sums to points are split among the worker threads
+    //!   configured per chare. Each thread only writes the fluxes of its own
+    //!   edges and the rhs of its own points, gathering the fluxes of the
+    //!   edges surrounding a point in the fixed order of psup, so the result
+    //!   is bitwise identical for any number of threads.
     void domainint( const std::array< std::vector< real >, 3 >& coord,
                     const std::vector< std::size_t >& gid,
                     const std::vector< std::size_t >& edgenode,
@@ -978,86 +1044,185 @@ class CompFlow {
                     const std::vector< real >& dfn,
                     const tk::Fields& U,
                     const tk::Fields& G,
+                    const std::vector< std::size_t >& chbndpoin,
+                    const std::vector< std::size_t >& intpoin,
+                    std::size_t nchbndedge,
+                    const std::function< void() >& chbndrhs,
                     tk::Fields& R ) const
     {
-      // domain-edge integral: compute fluxes in edges
-      std::vector< real > dflux( edgenode.size()/2 * m_ncomp );
-
-      // access node coordinates
-      const auto& x = coord[0];
-      const auto& y = coord[1];
-      const auto& z = coord[2];
-
-      #pragma omp simd
-      for (std::size_t e=0; e<edgenode.size()/2; ++e) {
-        auto p = edgenode[e*2+0];
-        auto q = edgenode[e*2+1];
-
-        // compute primitive variables at edge-end points
-        real rL  = U(p,0,m_offset);
-        real ruL = U(p,1,m_offset) / rL;
-        real rvL = U(p,2,m_offset) / rL;
-        real rwL = U(p,3,m_offset) / rL;
-        real reL = U(p,4,m_offset) / rL - 0.5*(ruL*ruL + rvL*rvL + rwL*rwL);
-        real rR  = U(q,0,m_offset);
-        real ruR = U(q,1,m_offset) / rR;
-        real rvR = U(q,2,m_offset) / rR;
-        real rwR = U(q,3,m_offset) / rR;
-        real reR = U(q,4,m_offset) / rR - 0.5*(ruR*ruR + rvR*rvR + rwR*rwR);
-
-        // apply stagnation BCs to primitive variables
-        if ( !skipPoint(x[p],y[p],z[p]) && stagPoint(x[p],y[p],z[p]) )
-          ruL = rvL = rwL = 0.0;
-        if ( !skipPoint(x[q],y[q],z[q]) && stagPoint(x[q],y[q],z[q]) )
-          ruR = rvR = rwR = 0.0;
-
-        // compute MUSCL reconstruction in edge-end points
-        muscl( p, q, coord, G, rL, ruL, rvL, rwL, reL,
-               rR, ruR, rvR, rwR, reR );
-
-        // convert back to conserved variables
-        reL = (reL + 0.5*(ruL*ruL + rvL*rvL + rwL*rwL)) * rL;
-        ruL *= rL;
-        rvL *= rL;
-        rwL *= rL;
-        reR = (reR + 0.5*(ruR*ruR + rvR*rvR + rwR*rwR)) * rR;
-        ruR *= rR;
-        rvR *= rR;
-        rwR *= rR;
-
-        // compute Riemann flux using edge-end point states
-        real f[5];
-        Rusanov::flux( dfn[e*6+0], dfn[e*6+1], dfn[e*6+2],
-                       dfn[e*6+3], dfn[e*6+4], dfn[e*6+5],
-                       rL, ruL, rvL, rwL, reL,
-                       rR, ruR, rvR, rwR, reR,
-                       f[0], f[1], f[2], f[3], f[4] );
-        // store flux in edges
-        for (std::size_t c=0; c<m_ncomp; ++c) dflux[e*m_ncomp+c] = f[c];
-      }
+      Assert( nchbndedge <= edgenode.size()/2, "Edge count mismatch" );
+      Assert( chbndpoin.size() + intpoin.size() == U.nunk(),
+              "Node count mismatch" );
+
+      const auto nthread = g_inputdeck.get< tag::discr, tag::nthread >();
+
+      // points at which stagnation BCs apply to primitive variables
+      const auto stag = stagnation( coord );
+
+      // domain-edge integral: compute fluxes in a range of edges, split into
+      // chunks at multiples of the edge block size
+      auto nedge = edgenode.size()/2;
+      std::vector< real > dflux( nedge * m_ncomp );
+      auto flux = [&]( std::size_t begin, std::size_t end ){
+        tk::parallel_for( nthread, begin, end, edgeblock,
+          [&]( std::size_t b, std::size_t e ){
+            if (m_flux == ctr::FluxType::HLLC)
+              edgeflux< HLLC >( coord, edgenode, dfn, stag, U, G, b, e, dflux );
+            else
+              edgeflux< Rusanov >( coord, edgenode, dfn, stag, U, G, b, e,
+                                   dflux );
+          } );
+      };
 
       // access pointer to right hand side at component and offset
       std::array< const real*, m_ncomp > r;
       for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
 
-      // domain-edge integral: sum flux contributions to points
-      for (std::size_t p=0,k=0; p<U.nunk(); ++p)
-        for (auto q : tk::Around(psup,p)) {
-          auto s = gid[p] > gid[q] ? -1.0 : 1.0;
-          auto e = edgeid[k++];
-          // the 2.0 in the following expression is so that the RHS contribution
-          // conforms with Eq 12 (Waltz et al. Computers & fluids (92) 2014);
-          // The 1/2 in Eq 12 is extracted from the flux function (Rusanov).
-          // However, Rusanov::flux computes the flux with the 1/2. This 2
-          // cancels with the 1/2 in Rusanov::flux, so that the 1/2 can be
-          // extracted out and multiplied as in Eq 12
-          for (std::size_t c=0; c<m_ncomp; ++c)
-            R.var(r[c],p) -= 2.0*s*dflux[e*m_ncomp+c];
-        }
+      // domain-edge integral: sum flux contributions to a list of points
+      auto sum = [&]( const std::vector< std::size_t >& points ){
+        tk::parallel_for( nthread, 0, points.size(), 1,
+          [&]( std::size_t begin, std::size_t end ){
+            for (auto i=begin; i<end; ++i) {
+              auto p = points[i];
+              auto k = psup.second[p];
+              for (auto q : tk::Around(psup,p)) {
+                auto s = gid[p] > gid[q] ? -1.0 : 1.0;
+                auto e = edgeid[k++];
+                // the 2.0 in the following expression is so that the RHS
+                // contribution conforms with Eq 12 (Waltz et al. Computers &
+                // fluids (92) 2014); The 1/2 in Eq 12 is extracted from the
+                // flux function (Rusanov). However, Rusanov::flux (and
+                // HLLC::flux) computes the flux with the 1/2. This 2 cancels
+                // with the 1/2 in the flux function, so that the 1/2 can be
+                // extracted out and multiplied as in Eq 12
+                for (std::size_t c=0; c<m_ncomp; ++c)
+                  R.var(r[c],p) -= 2.0*s*dflux[c*nedge+e];
+              }
+            }
+          } );
+      };
+
+      // complete rhs in chare-boundary nodes and let the caller send it
+      flux( 0, nchbndedge );
+      sum( chbndpoin );
+      chbndrhs();
+
+      // complete rhs in internal nodes
+      flux( nchbndedge, nedge );
+      sum( intpoin );
 
       tk::destroy(dflux);
     }
 
+    //! Determine points at which stagnation BCs zero the velocity
+    //! \param[in] coord Mesh node coordinates
+    //! \return Nonzero for points configured as stagnation (and not skip-BC)
+    //!   points by the user
+    std::vector< char >
+    stagnation( const std::array< std::vector< real >, 3 >& coord ) const {
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      std::vector< char > stag( x.size(), 0 );
+      if (!std::get< 1 >( m_stagCnf ).empty())
+        for (std::size_t p=0; p<x.size(); ++p)
+          stag[p] = !skipPoint(x[p],y[p],z[p]) && stagPoint(x[p],y[p],z[p]);
+      return stag;
+    }
+
+    //! Compute Riemann fluxes in all edges for ALECG
+    //! \tparam Flux Riemann solver with the edge-based flux signature of
+    //!   Rusanov::flux()
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] edgenode Local node ids of edges
+    //! \param[in] dfn Dual-face normals
+    //! \param[in] stag Nonzero for points at which stagnation BCs apply
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in] G Nodal gradients
+    //! \param[in] begin Index of first edge to compute flux in
+    //! \param[in] end Index of one past the last edge to compute flux in
+    //! \param[in,out] dflux Fluxes in edges, stored as dflux[c*nedge+e]
+    //! \details Edges are processed in blocks: the edge-end states are
+    //!   gathered, reconstructed, and stored in structure-of-arrays staging
+    //!   buffers, from which the Riemann fluxes of the block are computed in
+    //!   SIMD lanes.
+    template< class Flux >
+    void edgeflux( const std::array< std::vector< real >, 3 >& coord,
+                   const std::vector< std::size_t >& edgenode,
+                   const std::vector< real >& dfn,
+                   const std::vector< char >& stag,
+                   const tk::Fields& U,
+                   const tk::Fields& G,
+                   std::size_t begin,
+                   std::size_t end,
+                   std::vector< real >& dflux ) const
+    {
+      auto nedge = edgenode.size()/2;
+      Assert( dflux.size() == nedge*m_ncomp, "Size mismatch" );
+      Assert( begin <= end && end <= nedge, "Edge range out of bounds" );
+      Assert( stag.size() == U.nunk(), "Size mismatch" );
+
+      // access pointer to solution at component and offset
+      std::array< const real*, m_ncomp > u;
+      for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.cptr( c, m_offset );
+
+      // staging buffers for a block of edges: normals, left and right states
+      real n[6][edgeblock], l[m_ncomp][edgeblock], r[m_ncomp][edgeblock];
+
+      for (std::size_t b=begin; b<end; b+=edgeblock) {
+        auto ne = std::min( edgeblock, end-b );
+
+        for (std::size_t i=0; i<ne; ++i) {
+          auto e = b+i;
+          auto p = edgenode[e*2+0];
+          auto q = edgenode[e*2+1];
+
+          // compute primitive variables at edge-end points
+          real rL  = U.var(u[0],p);
+          real ruL = U.var(u[1],p) / rL;
+          real rvL = U.var(u[2],p) / rL;
+          real rwL = U.var(u[3],p) / rL;
+          real reL = U.var(u[4],p) / rL - 0.5*(ruL*ruL + rvL*rvL + rwL*rwL);
+          real rR  = U.var(u[0],q);
+          real ruR = U.var(u[1],q) / rR;
+          real rvR = U.var(u[2],q) / rR;
+          real rwR = U.var(u[3],q) / rR;
+          real reR = U.var(u[4],q) / rR - 0.5*(ruR*ruR + rvR*rvR + rwR*rwR);
+
+          // apply stagnation BCs to primitive variables
+          if (stag[p]) ruL = rvL = rwL = 0.0;
+          if (stag[q]) ruR = rvR = rwR = 0.0;
+
+          // compute MUSCL reconstruction in edge-end points
+          muscl( p, q, coord, G, rL, ruL, rvL, rwL, reL,
+                 rR, ruR, rvR, rwR, reR );
+
+          // convert back to conserved variables and stage
+          l[0][i] = rL;
+          l[1][i] = ruL * rL;
+          l[2][i] = rvL * rL;
+          l[3][i] = rwL * rL;
+          l[4][i] = (reL + 0.5*(ruL*ruL + rvL*rvL + rwL*rwL)) * rL;
+          r[0][i] = rR;
+          r[1][i] = ruR * rR;
+          r[2][i] = rvR * rR;
+          r[3][i] = rwR * rR;
+          r[4][i] = (reR + 0.5*(ruR*ruR + rvR*rvR + rwR*rwR)) * rR;
+          for (std::size_t j=0; j<6; ++j) n[j][i] = dfn[e*6+j];
+        }
+
+        // compute Riemann flux using edge-end point states and store in edges
+        std::array< real*, m_ncomp > f;
+        for (std::size_t c=0; c<m_ncomp; ++c) f[c] = dflux.data() + c*nedge + b;
+        #pragma omp simd
+        for (std::size_t i=0; i<ne; ++i)
+          Flux::flux( n[0][i], n[1][i], n[2][i], n[3][i], n[4][i], n[5][i],
+                      l[0][i], l[1][i], l[2][i], l[3][i], l[4][i],
+                      r[0][i], r[1][i], r[2][i], r[3][i], r[4][i],
+                      f[0][i], f[1][i], f[2][i], f[3][i], f[4][i] );
+      }
+    }
+
     //! \brief Compute MUSCL reconstruction in edge-end points using a MUSCL
     //!    procedure with van Leer limiting
     //! \param[in] p Left node id of edge-end
@@ -1197,6 +1362,8 @@ class CompFlow {
       const auto& y = coord[1];
       const auto& z = coord[2];
 
+      const auto& mat = eos< eq >( m_system );
+
       // boundary integrals: compute fluxes in edges
       std::vector< real > bflux( triinpoel.size() * m_ncomp * 2 );
 
@@ -1247,21 +1414,21 @@ class CompFlow {
         real f[m_ncomp][3];
         real p, vn;
         int sym = symbctri[e];
-        p = eos_pressure< eq >( m_system, rA, ruA/rA, rvA/rA, rwA/rA, reA );
+        p = mat.pressure( rA, ruA/rA, rvA/rA, rwA/rA, reA );
         vn = sym ? 0.0 : (nx*ruA + ny*rvA + nz*rwA) / rA;
         f[0][0] = rA*vn;
         f[1][0] = ruA*vn + p*nx;
         f[2][0] = rvA*vn + p*ny;
         f[3][0] = rwA*vn + p*nz;
         f[4][0] = (reA + p)*vn;
-        p = eos_pressure< eq >( m_system, rB, ruB/rB, rvB/rB, rwB/rB, reB );
+        p = mat.pressure( rB, ruB/rB, rvB/rB, rwB/rB, reB );
         vn = sym ? 0.0 : (nx*ruB + ny*rvB + nz*rwB) / rB;
         f[0][1] = rB*vn;
         f[1][1] = ruB*vn + p*nx;
         f[2][1] = rvB*vn + p*ny;
         f[3][1] = rwB*vn + p*nz;
         f[4][1] = (reB + p)*vn;
-        p = eos_pressure< eq >( m_system, rC, ruC/rC, rvC/rC, rwC/rC, reC );
+        p = mat.pressure( rC, ruC/rC, rvC/rC, rwC/rC, reC );
         vn = sym ? 0.0 : (nx*ruC + ny*rvC + nz*rwC) / rC;
         f[0][2] = rC*vn;
         f[1][2] = ruC*vn + p*nx;
@@ -221,6 +221,8 @@ class CompFlow {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] invlhs_ls Inverse of least-squares reconstruction lhs matrix
+    //!   of each element, only geometry dependent
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in,out] U Solution vector at recent time step
@@ -229,7 +231,10 @@ class CompFlow {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&,
+                      const std::vector< std::array< std::array< tk::real, 3 >,
+                        3 > >& invlhs_ls,
+                      const std::pair< std::vector< std::size_t >,
+                        std::vector< std::size_t > >&,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
                       tk::Fields& U,
@@ -247,20 +252,13 @@ class CompFlow {
         Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
                 "Mismatch in inpofa size" );
 
-        // allocate and initialize matrix and vector for reconstruction
-        std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-          lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                            {{0.0, 0.0, 0.0}},
-                            {{0.0, 0.0, 0.0}} }} );
+        // allocate and initialize vector for reconstruction
         std::vector< std::vector< std::array< tk::real, 3 > > >
           rhs_ls( nelem, std::vector< std::array< tk::real, 3 > >
             ( m_ncomp,
               {{ 0.0, 0.0, 0.0 }} ) );
 
         // reconstruct x,y,z-derivatives of unknowns
-        // 0. get lhs matrix, which is only geometry dependent
-        tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
-
         // 1. internal face contributions
         tk::intLeastSq_P0P1( m_offset, rdof, fd, geoElem, U, rhs_ls,
           {0, m_ncomp-1} );
@@ -272,7 +270,7 @@ class CompFlow {
             {0, m_ncomp-1} );
 
         // 3. solve 3x3 least-squares system
-        tk::solveLeastSq_P0P1( m_offset, rdof, lhs_ls, rhs_ls, U,
+        tk::solveLeastSq_P0P1( m_offset, rdof, invlhs_ls, rhs_ls, U,
           {0, m_ncomp-1} );
 
         // 4. transform reconstructed derivatives to Dubiner dofs
@@ -295,7 +293,8 @@ class CompFlow {
                 [[maybe_unused]] const tk::Fields& geoFace,
                 [[maybe_unused]] const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >& esup,
+                const std::pair< std::vector< std::size_t >,
+                  std::vector< std::size_t > >& esup,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
@@ -94,7 +94,7 @@ infoCompFlow( std::map< ctr::PDEType, tk::ctr::ncomp_t >& cnt )
   nfo.emplace_back( "number of components", std::to_string( ncomp ) );
 
   const auto scheme = g_inputdeck.get< tag::discr, tag::scheme >();
-  if (scheme != ctr::SchemeType::DiagCG && scheme != ctr::SchemeType::ALECG)
+  if (scheme != ctr::SchemeType::DiagCG)
     nfo.emplace_back( "flux", ctr::Flux().name(
       g_inputdeck.get< tag::param, eq, tag::flux >().at(c) ) );
 
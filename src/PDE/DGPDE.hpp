@@ -173,16 +173,18 @@ class DGPDE {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&
-                        esup,
+                      const std::vector< std::array< std::array< tk::real, 3 >,
+                        3 > >& invlhs_ls,
+                      const std::pair< std::vector< std::size_t >,
+                        std::vector< std::size_t > >& esup,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
                       tk::Fields& U,
                       tk::Fields& P,
                       tk::Fields& VolFracMax ) const
     {
-      self->reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, U, P,
-        VolFracMax );
+      self->reconstruct( t, geoFace, geoElem, fd, invlhs_ls, esup, inpoel,
+        coord, U, P, VolFracMax );
     }
 
     //! Public interface to limiting the second-order solution
@@ -190,7 +192,8 @@ class DGPDE {
                 const tk::Fields& geoFace,
                 const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >& esup,
+                const std::pair< std::vector< std::size_t >,
+                  std::vector< std::size_t > >& esup,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
@@ -309,7 +312,9 @@ class DGPDE {
                                 const tk::Fields&,
                                 const tk::Fields&,
                                 const inciter::FaceData&,
-                                const std::map< std::size_t,
+                                const std::vector< std::array<
+                                  std::array< tk::real, 3 >, 3 > >&,
+                                const std::pair< std::vector< std::size_t >,
                                   std::vector< std::size_t > >&,
                                 const std::vector< std::size_t >&,
                                 const tk::UnsMesh::Coords&,
@@ -320,7 +325,7 @@ class DGPDE {
                           const tk::Fields&,
                           const tk::Fields&,
                           const inciter::FaceData&,
-                          const std::map< std::size_t,
+                          const std::pair< std::vector< std::size_t >,
                             std::vector< std::size_t > >&,
                           const std::vector< std::size_t >&,
                           const tk::UnsMesh::Coords&,
@@ -407,7 +412,9 @@ class DGPDE {
                         const tk::Fields& geoFace,
                         const tk::Fields& geoElem,
                         const inciter::FaceData& fd,
-                        const std::map< std::size_t,
+                        const std::vector< std::array<
+                          std::array< tk::real, 3 >, 3 > >& invlhs_ls,
+                        const std::pair< std::vector< std::size_t >,
                           std::vector< std::size_t > >& esup,
                         const std::vector< std::size_t >& inpoel,
                         const tk::UnsMesh::Coords& coord,
@@ -415,15 +422,15 @@ class DGPDE {
                         tk::Fields& P,
                         tk::Fields& VolFracMax ) const override
       {
-        data.reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, U, P,
-          VolFracMax );
+        data.reconstruct( t, geoFace, geoElem, fd, invlhs_ls, esup, inpoel,
+          coord, U, P, VolFracMax );
       }
       void limit( tk::real t,
                   const tk::Fields& geoFace,
                   const tk::Fields& geoElem,
                   const inciter::FaceData& fd,
-                  const std::map< std::size_t, std::vector< std::size_t > >&
-                    esup,
+                  const std::pair< std::vector< std::size_t >,
+                    std::vector< std::size_t > >& esup,
                   const std::vector< std::size_t >& inpoel,
                   const tk::UnsMesh::Coords& coord,
                   const std::vector< std::size_t >& ndofel,
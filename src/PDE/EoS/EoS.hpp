@@ -6,14 +6,22 @@
              2019-2021 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Equation of state class
-  \details   This file defines functions for equations of state for the
-    compressible flow equations.
+  \details   This file defines the equation of state class and functions for
+    equations of state for the compressible flow equations. The material
+    constants of all materials of an equation system are queried from the input
+    deck only once, when the equation of state object of the system is first
+    used, and are then held by the object contiguously, indexed by material id.
 */
 // *****************************************************************************
 #ifndef EoS_h
 #define EoS_h
 
+#include <vector>
+#include <variant>
+
 #include "Data.hpp"
+#include "Exception.hpp"
+#include "StiffenedGas.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
 namespace inciter {
@@ -22,6 +30,202 @@ extern ctr::InputDeck g_inputdeck;
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
+//! Equations of state of all materials of an equation system
+//! \details Each material holds an equation of state from a closed set of
+//!   types, stored in a std::variant. Adding a new type of equation of state,
+//!   e.g., JWL or tabulated, requires (1) a class with the interface of
+//!   StiffenedGas, i.e., single-state density(), pressure(), soundspeed(),
+//!   totalenergy(), temperature(), and batch pressure(), soundspeed(), (2)
+//!   adding it to the list of types of Material, and (3) constructing it in
+//!   the eos() registry below based on the material's input deck entries. The
+//!   batch functions allow the equation of state to be evaluated for many
+//!   states, e.g., all mesh nodes, with a single dispatch on its type.
+class EoS {
+
+  public:
+    //! Equation of state types a material may use
+    using Material = std::variant< StiffenedGas >;
+
+    //! Constructor
+    //! \param[in] mat Equations of state of all materials
+    explicit EoS( std::vector< Material >&& mat ) : m_mat( std::move(mat) ) {}
+
+    //! Number of materials accessor
+    std::size_t nmat() const { return m_mat.size(); }
+
+    //! Calculate density from the material pressure and temperature
+    //! \param[in] pr Material pressure
+    //! \param[in] temp Material temperature
+    //! \param[in] imat Material id
+    //! \return Material density
+    tk::real density( tk::real pr, tk::real temp, std::size_t imat=0 ) const {
+      return std::visit( [&]( const auto& m ){ return m.density( pr, temp ); },
+                         m_mat[imat] );
+    }
+
+    //! Calculate pressure from the material density, momentum and total energy
+    //! \param[in] arho Material partial density (alpha_k * rho_k)
+    //! \param[in] u X-velocity
+    //! \param[in] v Y-velocity
+    //! \param[in] w Z-velocity
+    //! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+    //! \param[in] alpha Material volume fraction
+    //! \param[in] imat Material id
+    //! \return Material partial pressure (alpha_k * p_k)
+    tk::real pressure( tk::real arho,
+                       tk::real u,
+                       tk::real v,
+                       tk::real w,
+                       tk::real arhoE,
+                       tk::real alpha=1.0,
+                       std::size_t imat=0 ) const
+    {
+      return std::visit( [&]( const auto& m ){
+               return m.pressure( arho, u, v, w, arhoE, alpha ); },
+             m_mat[imat] );
+    }
+
+    //! Calculate speed of sound from the material density and pressure
+    //! \param[in] arho Material partial density (alpha_k * rho_k)
+    //! \param[in] apr Material partial pressure (alpha_k * p_k)
+    //! \param[in] alpha Material volume fraction
+    //! \param[in] imat Material id
+    //! \return Material speed of sound
+    tk::real soundspeed( tk::real arho,
+                         tk::real apr,
+                         tk::real alpha=1.0,
+                         std::size_t imat=0 ) const
+    {
+      return std::visit( [&]( const auto& m ){
+               return m.soundspeed( arho, apr, alpha ); },
+             m_mat[imat] );
+    }
+
+    //! \brief Calculate material specific total energy from the material
+    //!   density, momentum and material pressure
+    //! \param[in] rho Material density
+    //! \param[in] u X-velocity
+    //! \param[in] v Y-velocity
+    //! \param[in] w Z-velocity
+    //! \param[in] pr Material pressure
+    //! \param[in] imat Material id
+    //! \return Material specific total energy
+    tk::real totalenergy( tk::real rho,
+                          tk::real u,
+                          tk::real v,
+                          tk::real w,
+                          tk::real pr,
+                          std::size_t imat=0 ) const
+    {
+      return std::visit( [&]( const auto& m ){
+               return m.totalenergy( rho, u, v, w, pr ); },
+             m_mat[imat] );
+    }
+
+    //! \brief Calculate material temperature from the material density, and
+    //!   material specific total energy
+    //! \param[in] arho Material partial density (alpha_k * rho_k)
+    //! \param[in] u X-velocity
+    //! \param[in] v Y-velocity
+    //! \param[in] w Z-velocity
+    //! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+    //! \param[in] alpha Material volume fraction
+    //! \param[in] imat Material id
+    //! \return Material temperature
+    tk::real temperature( tk::real arho,
+                          tk::real u,
+                          tk::real v,
+                          tk::real w,
+                          tk::real arhoE,
+                          tk::real alpha=1.0,
+                          std::size_t imat=0 ) const
+    {
+      return std::visit( [&]( const auto& m ){
+               return m.temperature( arho, u, v, w, arhoE, alpha ); },
+             m_mat[imat] );
+    }
+
+    //! Calculate pressure of n states from density, momentum, and total energy
+    //! \param[in] n Number of states
+    //! \param[in] arho Material partial densities (alpha_k * rho_k)
+    //! \param[in] aru X-momenta (alpha_k * rho_k * u)
+    //! \param[in] arv Y-momenta (alpha_k * rho_k * v)
+    //! \param[in] arw Z-momenta (alpha_k * rho_k * w)
+    //! \param[in] arhoE Material total energies (alpha_k * rho_k * E_k)
+    //! \param[in] alpha Material volume fractions, nullptr for single-material
+    //! \param[out] apr Material partial pressures (alpha_k * p_k)
+    //! \param[in] imat Material id
+    void pressure( std::size_t n,
+                   const tk::real* arho,
+                   const tk::real* aru,
+                   const tk::real* arv,
+                   const tk::real* arw,
+                   const tk::real* arhoE,
+                   const tk::real* alpha,
+                   tk::real* apr,
+                   std::size_t imat=0 ) const
+    {
+      std::visit( [&]( const auto& m ){
+        m.pressure( n, arho, aru, arv, arw, arhoE, alpha, apr ); },
+        m_mat[imat] );
+    }
+
+    //! Calculate speed of sound of n states from density and pressure
+    //! \param[in] n Number of states
+    //! \param[in] arho Material partial densities (alpha_k * rho_k)
+    //! \param[in] apr Material partial pressures (alpha_k * p_k)
+    //! \param[in] alpha Material volume fractions, nullptr for single-material
+    //! \param[out] a Material speeds of sound
+    //! \param[in] imat Material id
+    void soundspeed( std::size_t n,
+                     const tk::real* arho,
+                     const tk::real* apr,
+                     const tk::real* alpha,
+                     tk::real* a,
+                     std::size_t imat=0 ) const
+    {
+      std::visit( [&]( const auto& m ){
+        m.soundspeed( n, arho, apr, alpha, a ); },
+        m_mat[imat] );
+    }
+
+  private:
+    //! Equations of state of all materials
+    std::vector< Material > m_mat;
+};
+
+//! Access the equations of state of an equation system
+//! \tparam Eq Equation type to operate on, e.g., tag::compflow, tag::multimat
+//! \param[in] system Equation system index
+//! \return Equations of state of all materials of the equation system
+//! \details The equations of state of all systems of type Eq are constructed
+//!   from the input deck at the first call, which must happen after the input
+//!   deck has been parsed, and returned thereafter without querying the input
+//!   deck. Callers evaluating the equation of state in loops are expected to
+//!   hold on to the returned reference outside of the loop.
+template< class Eq >
+const EoS& eos( ncomp_t system ) {
+  static const std::vector< EoS > sys = [](){
+    const auto& gamma = g_inputdeck.get< tag::param, Eq, tag::gamma >();
+    const auto& pstiff = g_inputdeck.get< tag::param, Eq, tag::pstiff >();
+    const auto& cv = g_inputdeck.get< tag::param, Eq, tag::cv >();
+    std::vector< EoS > s;
+    for (std::size_t c=0; c<gamma.size(); ++c) {
+      Assert( pstiff.size() > c && cv.size() > c &&
+              pstiff[c].size() == gamma[c].size() &&
+              cv[c].size() == gamma[c].size(),
+              "Material constants size mismatch" );
+      std::vector< EoS::Material > mat;
+      for (std::size_t k=0; k<gamma[c].size(); ++k)
+        mat.emplace_back( StiffenedGas( gamma[c][k], pstiff[c][k], cv[c][k] ) );
+      s.emplace_back( std::move(mat) );
+    }
+    return s;
+  }();
+  Assert( system < sys.size(), "Equation system index out of bounds" );
+  return sys[ system ];
+}
+
 //! \brief Calculate density from the material pressure and temperature using
 //!   the stiffened-gas equation of state
 //! \tparam Eq Equation type to operate on, e.g., tag::compflow, tag::multimat
@@ -38,16 +242,7 @@ tk::real eos_density( ncomp_t system,
                       tk::real temp,
                       std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c
-  auto g =
-    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-  auto cv =
-    g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ][imat];
-
-  tk::real rho = (pr + p_c) / ((g-1.0) * cv * temp);
-  return rho;
+  return eos< Eq >( system ).density( pr, temp, imat );
 }
 
 //! \brief Calculate pressure from the material density, momentum and total
@@ -67,7 +262,6 @@ tk::real eos_density( ncomp_t system,
 //!   the calling code
 //! \return Material partial pressure (alpha_k * p_k) calculated using the
 //!   stiffened-gas EoS
-#pragma omp declare simd
 template< class Eq >
 tk::real eos_pressure( ncomp_t system,
                        tk::real arho,
@@ -78,13 +272,7 @@ tk::real eos_pressure( ncomp_t system,
                        tk::real alpha=1.0,
                        std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c
-  auto g = g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
-  auto p_c = g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-
-  tk::real partpressure = (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*p_c)
-                          * (g-1.0) - alpha*p_c;
-  return partpressure;
+  return eos< Eq >( system ).pressure( arho, u, v, w, arhoE, alpha, imat );
 }
 
 //! Calculate speed of sound from the material density and material pressure
@@ -104,16 +292,7 @@ tk::real eos_soundspeed( ncomp_t system,
                          tk::real arho, tk::real apr,
                          tk::real alpha=1.0, std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c
-  auto g =
-    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-
-  auto p_eff = std::max( 1.0e-15, apr+(alpha*p_c) );
-
-  tk::real a = std::sqrt( g * p_eff / arho );
-  return a;
+  return eos< Eq >( system ).soundspeed( arho, apr, alpha, imat );
 }
 
 //! \brief Calculate material specific total energy from the material density,
@@ -138,14 +317,7 @@ tk::real eos_totalenergy( ncomp_t system,
                           tk::real pr,
                           std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c
-  auto g =
-    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-
-  tk::real rhoE = (pr + p_c) / (g-1.0) + 0.5 * rho * (u*u + v*v + w*w) + p_c;
-  return rhoE;
+  return eos< Eq >( system ).totalenergy( rho, u, v, w, pr, imat );
 }
 
 //! \brief Calculate material temperature from the material density, and
@@ -174,14 +346,7 @@ tk::real eos_temperature( ncomp_t system,
                           tk::real alpha=1.0,
                           std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c, cv
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-  auto cv =
-    g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ][imat];
-
-  tk::real t = (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*p_c) / (arho*cv);
-  return t;
+  return eos< Eq >( system ).temperature( arho, u, v, w, arhoE, alpha, imat );
 }
 
 } //inciter::
@@ -0,0 +1,199 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/EoS/StiffenedGas.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Stiffened-gas equation of state
+  \details   This file defines the stiffened-gas equation of state of a single
+    material. Besides functions operating on a single state, it defines batch
+    functions operating on arrays of states, whose loops the compiler can
+    vectorize, since the material constants are held by the object and not
+    queried from the input deck.
+*/
+// *****************************************************************************
+#ifndef StiffenedGas_h
+#define StiffenedGas_h
+
+#include <cmath>
+#include <algorithm>
+
+#include "Types.hpp"
+
+namespace inciter {
+
+//! Stiffened-gas equation of state of a single material
+class StiffenedGas {
+
+  public:
+    //! Constructor
+    //! \param[in] gamma Ratio of specific heats
+    //! \param[in] pstiff Stiffness coefficient
+    //! \param[in] cv Specific heat at constant volume
+    explicit StiffenedGas( tk::real gamma, tk::real pstiff, tk::real cv ) :
+      m_gamma( gamma ), m_pstiff( pstiff ), m_cv( cv ) {}
+
+    //! Ratio of specific heats accessor
+    tk::real gamma() const { return m_gamma; }
+    //! Stiffness coefficient accessor
+    tk::real pstiff() const { return m_pstiff; }
+    //! Specific heat at constant volume accessor
+    tk::real cv() const { return m_cv; }
+
+    //! Calculate density from the material pressure and temperature
+    //! \param[in] pr Material pressure
+    //! \param[in] temp Material temperature
+    //! \return Material density
+    tk::real density( tk::real pr, tk::real temp ) const {
+      return (pr + m_pstiff) / ((m_gamma-1.0) * m_cv * temp);
+    }
+
+    //! \brief Calculate pressure from the material density, momentum and total
+    //!   energy
+    //! \param[in] arho Material partial density (alpha_k * rho_k)
+    //! \param[in] u X-velocity
+    //! \param[in] v Y-velocity
+    //! \param[in] w Z-velocity
+    //! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+    //! \param[in] alpha Material volume fraction
+    //! \return Material partial pressure (alpha_k * p_k)
+    tk::real pressure( tk::real arho,
+                       tk::real u,
+                       tk::real v,
+                       tk::real w,
+                       tk::real arhoE,
+                       tk::real alpha = 1.0 ) const
+    {
+      return (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*m_pstiff)
+             * (m_gamma-1.0) - alpha*m_pstiff;
+    }
+
+    //! Calculate speed of sound from the material density and pressure
+    //! \param[in] arho Material partial density (alpha_k * rho_k)
+    //! \param[in] apr Material partial pressure (alpha_k * p_k)
+    //! \param[in] alpha Material volume fraction
+    //! \return Material speed of sound
+    tk::real soundspeed( tk::real arho,
+                         tk::real apr,
+                         tk::real alpha = 1.0 ) const
+    {
+      auto p_eff = std::max( 1.0e-15, apr+(alpha*m_pstiff) );
+      return std::sqrt( m_gamma * p_eff / arho );
+    }
+
+    //! \brief Calculate material specific total energy from the material
+    //!   density, momentum and material pressure
+    //! \param[in] rho Material density
+    //! \param[in] u X-velocity
+    //! \param[in] v Y-velocity
+    //! \param[in] w Z-velocity
+    //! \param[in] pr Material pressure
+    //! \return Material specific total energy
+    tk::real totalenergy( tk::real rho,
+                          tk::real u,
+                          tk::real v,
+                          tk::real w,
+                          tk::real pr ) const
+    {
+      return (pr + m_pstiff) / (m_gamma-1.0) + 0.5 * rho * (u*u + v*v + w*w)
+             + m_pstiff;
+    }
+
+    //! \brief Calculate material temperature from the material density, and
+    //!   material specific total energy
+    //! \param[in] arho Material partial density (alpha_k * rho_k)
+    //! \param[in] u X-velocity
+    //! \param[in] v Y-velocity
+    //! \param[in] w Z-velocity
+    //! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+    //! \param[in] alpha Material volume fraction
+    //! \return Material temperature
+    tk::real temperature( tk::real arho,
+                          tk::real u,
+                          tk::real v,
+                          tk::real w,
+                          tk::real arhoE,
+                          tk::real alpha = 1.0 ) const
+    {
+      return (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*m_pstiff)
+             / (arho*m_cv);
+    }
+
+    //! Calculate pressure of n states from density, momentum, and total energy
+    //! \param[in] n Number of states
+    //! \param[in] arho Material partial densities (alpha_k * rho_k)
+    //! \param[in] aru X-momenta (alpha_k * rho_k * u)
+    //! \param[in] arv Y-momenta (alpha_k * rho_k * v)
+    //! \param[in] arw Z-momenta (alpha_k * rho_k * w)
+    //! \param[in] arhoE Material total energies (alpha_k * rho_k * E_k)
+    //! \param[in] alpha Material volume fractions, nullptr for single-material
+    //! \param[out] apr Material partial pressures (alpha_k * p_k)
+    //! \details Momenta, as opposed to velocities taken by the single-state
+    //!   function, are taken, since those are the conserved variables whose
+    //!   arrays are at hand when computing with many states. The result is
+    //!   identical to that of the single-state function.
+    void pressure( std::size_t n,
+                   const tk::real* arho,
+                   const tk::real* aru,
+                   const tk::real* arv,
+                   const tk::real* arw,
+                   const tk::real* arhoE,
+                   const tk::real* alpha,
+                   tk::real* apr ) const
+    {
+      const auto g = m_gamma, p_c = m_pstiff;
+      if (alpha) {
+        #pragma omp simd
+        for (std::size_t i=0; i<n; ++i) {
+          auto u = aru[i]/arho[i], v = arv[i]/arho[i], w = arw[i]/arho[i];
+          apr[i] = (arhoE[i] - 0.5 * arho[i] * (u*u + v*v + w*w)
+                    - alpha[i]*p_c) * (g-1.0) - alpha[i]*p_c;
+        }
+      } else {
+        #pragma omp simd
+        for (std::size_t i=0; i<n; ++i) {
+          auto u = aru[i]/arho[i], v = arv[i]/arho[i], w = arw[i]/arho[i];
+          apr[i] = (arhoE[i] - 0.5 * arho[i] * (u*u + v*v + w*w) - p_c)
+                   * (g-1.0) - p_c;
+        }
+      }
+    }
+
+    //! Calculate speed of sound of n states from density and pressure
+    //! \param[in] n Number of states
+    //! \param[in] arho Material partial densities (alpha_k * rho_k)
+    //! \param[in] apr Material partial pressures (alpha_k * p_k)
+    //! \param[in] alpha Material volume fractions, nullptr for single-material
+    //! \param[out] a Material speeds of sound
+    void soundspeed( std::size_t n,
+                     const tk::real* arho,
+                     const tk::real* apr,
+                     const tk::real* alpha,
+                     tk::real* a ) const
+    {
+      const auto g = m_gamma, p_c = m_pstiff;
+      if (alpha) {
+        #pragma omp simd
+        for (std::size_t i=0; i<n; ++i)
+          a[i] = std::sqrt( g * std::max( 1.0e-15, apr[i]+alpha[i]*p_c )
+                              / arho[i] );
+      } else {
+        #pragma omp simd
+        for (std::size_t i=0; i<n; ++i)
+          a[i] = std::sqrt( g * std::max( 1.0e-15, apr[i]+p_c ) / arho[i] );
+      }
+    }
+
+  private:
+    //! Ratio of specific heats
+    tk::real m_gamma;
+    //! Stiffness coefficient
+    tk::real m_pstiff;
+    //! Specific heat at constant volume
+    tk::real m_cv;
+};
+
+} //inciter::
+
+#endif // StiffenedGas_h
@@ -84,66 +84,13 @@ tk::eval_dBdx_p1( const std::size_t ndof,
 //! \return Array of the derivatives of basis functions
 // *****************************************************************************
 {
-  // The derivatives of the basis functions dB/dx are easily calculated
-  // via a transformation to the reference space as,
-  // dB/dx = dB/dxi . dxi/dx,
-  // where, x = (x,y,z) are the physical coordinates, and
-  //        xi = (xi, eta, zeta) are the reference coordinates.
-  // The matrix dxi/dx is the inverse of the Jacobian of transformation
-  // and the matrix vector product has to be calculated. This follows.
-
   std::array< std::vector<tk::real>, 3 > dBdx;
   dBdx[0].resize( ndof, 0 );
   dBdx[1].resize( ndof, 0 );
   dBdx[2].resize( ndof, 0 );
 
-  auto db2dxi1 = 2.0;
-  auto db2dxi2 = 1.0;
-  auto db2dxi3 = 1.0;
-
-  auto db3dxi1 = 0.0;
-  auto db3dxi2 = 3.0;
-  auto db3dxi3 = 1.0;
-
-  auto db4dxi1 = 0.0;
-  auto db4dxi2 = 0.0;
-  auto db4dxi3 = 4.0;
-
-  dBdx[0][1] =  db2dxi1 * jacInv[0][0]
-              + db2dxi2 * jacInv[1][0]
-              + db2dxi3 * jacInv[2][0];
-
-  dBdx[1][1] =  db2dxi1 * jacInv[0][1]
-              + db2dxi2 * jacInv[1][1]
-              + db2dxi3 * jacInv[2][1];
-
-  dBdx[2][1] =  db2dxi1 * jacInv[0][2]
-              + db2dxi2 * jacInv[1][2]
-              + db2dxi3 * jacInv[2][2];
-
-  dBdx[0][2] =  db3dxi1 * jacInv[0][0]
-              + db3dxi2 * jacInv[1][0]
-              + db3dxi3 * jacInv[2][0];
-
-  dBdx[1][2] =  db3dxi1 * jacInv[0][1]
-              + db3dxi2 * jacInv[1][1]
-              + db3dxi3 * jacInv[2][1];
-
-  dBdx[2][2] =  db3dxi1 * jacInv[0][2]
-              + db3dxi2 * jacInv[1][2]
-              + db3dxi3 * jacInv[2][2];
-
-  dBdx[0][3] =  db4dxi1 * jacInv[0][0]
-              + db4dxi2 * jacInv[1][0]
-              + db4dxi3 * jacInv[2][0];
-
-  dBdx[1][3] =  db4dxi1 * jacInv[0][1]
-              + db4dxi2 * jacInv[1][1]
-              + db4dxi3 * jacInv[2][1];
-
-  dBdx[2][3] =  db4dxi1 * jacInv[0][2]
-              + db4dxi2 * jacInv[1][2]
-              + db4dxi3 * jacInv[2][2];
+  // The derivatives of the P1 basis functions are constant in reference space
+  eval_dBdx( 4, eval_dBdxi( 4, 0.0, 0.0, 0.0 ), jacInv, dBdx );
 
   return dBdx;
 }
@@ -161,107 +108,87 @@ tk::eval_dBdx_p2( const std::size_t igp,
 //! \param[in,out] dBdx Array of the derivatives of basis function
 // *****************************************************************************
 {
-  auto db5dxi1 = 12.0 * coordgp[0][igp] + 6.0 * coordgp[1][igp]
-               +  6.0 * coordgp[2][igp] - 6.0;
-  auto db5dxi2 =  6.0 * coordgp[0][igp] + 2.0 * coordgp[1][igp]
-               +  2.0 * coordgp[2][igp] - 2.0;
-  auto db5dxi3 =  6.0 * coordgp[0][igp] + 2.0 * coordgp[1][igp]
-               +  2.0 * coordgp[2][igp] - 2.0;
-
-  auto db6dxi1 = 10.0 * coordgp[1][igp] +  2.0 * coordgp[2][igp] - 2.0;
-  auto db6dxi2 = 10.0 * coordgp[0][igp] + 10.0 * coordgp[1][igp]
-               +  6.0 * coordgp[2][igp] - 6.0;
-  auto db6dxi3 =  2.0 * coordgp[0][igp] +  6.0 * coordgp[1][igp]
-               +  2.0 * coordgp[2][igp] - 2.0;
-
-  auto db7dxi1 = 12.0 * coordgp[2][igp] - 2.0;
-  auto db7dxi2 =  6.0 * coordgp[2][igp] - 1.0;
-  auto db7dxi3 = 12.0 * coordgp[0][igp] + 6.0 * coordgp[1][igp]
-               + 12.0 * coordgp[2][igp] - 7.0;
-
-  auto db8dxi1 =  0;
-  auto db8dxi2 = 20.0 * coordgp[1][igp] + 8.0 * coordgp[2][igp] - 8.0;
-  auto db8dxi3 =  8.0 * coordgp[1][igp] + 2.0 * coordgp[2][igp] - 2.0;
-
-  auto db9dxi1 =  0;
-  auto db9dxi2 = 18.0 * coordgp[2][igp] -  3.0;
-  auto db9dxi3 = 18.0 * coordgp[1][igp] + 12.0 * coordgp[2][igp] - 7.0;
-
-  auto db10dxi1 =  0;
-  auto db10dxi2 =  0;
-  auto db10dxi3 = 30.0 * coordgp[2][igp] - 10.0;
-
-  dBdx[0][4] =  db5dxi1 * jacInv[0][0]
-              + db5dxi2 * jacInv[1][0]
-              + db5dxi3 * jacInv[2][0];
-
-  dBdx[1][4] =  db5dxi1 * jacInv[0][1]
-              + db5dxi2 * jacInv[1][1]
-              + db5dxi3 * jacInv[2][1];
-
-  dBdx[2][4] =  db5dxi1 * jacInv[0][2]
-              + db5dxi2 * jacInv[1][2]
-              + db5dxi3 * jacInv[2][2];
-
-  dBdx[0][5] =  db6dxi1 * jacInv[0][0]
-              + db6dxi2 * jacInv[1][0]
-              + db6dxi3 * jacInv[2][0];
-
-  dBdx[1][5] =  db6dxi1 * jacInv[0][1]
-              + db6dxi2 * jacInv[1][1]
-              + db6dxi3 * jacInv[2][1];
-
-  dBdx[2][5] =  db6dxi1 * jacInv[0][2]
-              + db6dxi2 * jacInv[1][2]
-              + db6dxi3 * jacInv[2][2];
-
-  dBdx[0][6] =  db7dxi1 * jacInv[0][0]
-              + db7dxi2 * jacInv[1][0]
-              + db7dxi3 * jacInv[2][0];
-
-  dBdx[1][6] =  db7dxi1 * jacInv[0][1]
-              + db7dxi2 * jacInv[1][1]
-              + db7dxi3 * jacInv[2][1];
-
-  dBdx[2][6] =  db7dxi1 * jacInv[0][2]
-              + db7dxi2 * jacInv[1][2]
-              + db7dxi3 * jacInv[2][2];
-
-  dBdx[0][7] =  db8dxi1 * jacInv[0][0]
-              + db8dxi2 * jacInv[1][0]
-              + db8dxi3 * jacInv[2][0];
-
-  dBdx[1][7] =  db8dxi1 * jacInv[0][1]
-              + db8dxi2 * jacInv[1][1]
-              + db8dxi3 * jacInv[2][1];
-
-  dBdx[2][7] =  db8dxi1 * jacInv[0][2]
-              + db8dxi2 * jacInv[1][2]
-              + db8dxi3 * jacInv[2][2];
-
-  dBdx[0][8] =  db9dxi1 * jacInv[0][0]
-              + db9dxi2 * jacInv[1][0]
-              + db9dxi3 * jacInv[2][0];
+  eval_dBdx( 10,
+             eval_dBdxi( 10, coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] ),
+             jacInv, dBdx );
+}
 
-  dBdx[1][8] =  db9dxi1 * jacInv[0][1]
-              + db9dxi2 * jacInv[1][1]
-              + db9dxi3 * jacInv[2][1];
+std::array< std::array< tk::real, 3 >, 10 >
+tk::eval_dBdxi( const std::size_t ndof,
+                const tk::real xi,
+                const tk::real eta,
+                const tk::real zeta )
+// *****************************************************************************
+//  Compute the derivatives of the Dubiner basis functions in reference space
+//! \param[in] ndof Number of degrees of freedom
+//! \param[in] xi,eta,zeta Coordinates of point in reference space
+//! \return Array of the derivatives of basis functions, dBdxi[i][j] = dB_i /
+//!   dxi_j, with the entries beyond ndof zero
+// *****************************************************************************
+{
+  std::array< std::array< tk::real, 3 >, 10 > dBdxi;
+  for (auto& d : dBdxi) d.fill( 0.0 );
 
-  dBdx[2][8] =  db9dxi1 * jacInv[0][2]
-              + db9dxi2 * jacInv[1][2]
-              + db9dxi3 * jacInv[2][2];
+  if ( ndof > 1 )           // DG(P1)
+  {
+    dBdxi[1] = {{ 2.0, 1.0, 1.0 }};
+    dBdxi[2] = {{ 0.0, 3.0, 1.0 }};
+    dBdxi[3] = {{ 0.0, 0.0, 4.0 }};
 
-  dBdx[0][9] =  db10dxi1 * jacInv[0][0]
-              + db10dxi2 * jacInv[1][0]
-              + db10dxi3 * jacInv[2][0];
+    if( ndof > 4 )         // DG(P2)
+    {
+      dBdxi[4] = {{ 12.0 * xi + 6.0 * eta + 6.0 * zeta - 6.0,
+                     6.0 * xi + 2.0 * eta + 2.0 * zeta - 2.0,
+                     6.0 * xi + 2.0 * eta + 2.0 * zeta - 2.0 }};
+      dBdxi[5] = {{ 10.0 * eta + 2.0 * zeta - 2.0,
+                    10.0 * xi + 10.0 * eta + 6.0 * zeta - 6.0,
+                     2.0 * xi + 6.0 * eta + 2.0 * zeta - 2.0 }};
+      dBdxi[6] = {{ 12.0 * zeta - 2.0,
+                     6.0 * zeta - 1.0,
+                    12.0 * xi + 6.0 * eta + 12.0 * zeta - 7.0 }};
+      dBdxi[7] = {{ 0.0,
+                    20.0 * eta + 8.0 * zeta - 8.0,
+                     8.0 * eta + 2.0 * zeta - 2.0 }};
+      dBdxi[8] = {{ 0.0,
+                    18.0 * zeta - 3.0,
+                    18.0 * eta + 12.0 * zeta - 7.0 }};
+      dBdxi[9] = {{ 0.0,
+                    0.0,
+                    30.0 * zeta - 10.0 }};
+    }
+  }
 
-  dBdx[1][9] =  db10dxi1 * jacInv[0][1]
-              + db10dxi2 * jacInv[1][1]
-              + db10dxi3 * jacInv[2][1];
+  return dBdxi;
+}
 
-  dBdx[2][9] =  db10dxi1 * jacInv[0][2]
-              + db10dxi2 * jacInv[1][2]
-              + db10dxi3 * jacInv[2][2];
+void
+tk::eval_dBdx( const std::size_t ndof,
+               const std::array< std::array< tk::real, 3 >, 10 >& dBdxi,
+               const std::array< std::array< tk::real, 3 >, 3 >& jacInv,
+               std::array< std::vector<tk::real>, 3 >& dBdx )
+// *****************************************************************************
+//  Compute the derivatives of basis functions in physical space
+//! \param[in] ndof Number of degrees of freedom
+//! \param[in] dBdxi Derivatives of basis functions in reference space
+//! \param[in] jacInv Array of the inverse of Jacobian
+//! \param[in,out] dBdx Array of the derivatives of basis functions, whose
+//!   first ndof entries are overwritten
+//! \details The derivatives of the basis functions dB/dx are calculated via a
+//!   transformation to the reference space as, dB/dx = dB/dxi . dxi/dx, where,
+//!   x = (x,y,z) are the physical coordinates, and xi = (xi, eta, zeta) are the
+//!   reference coordinates. The matrix dxi/dx is the inverse of the Jacobian of
+//!   transformation. This function does not allocate, so it can be called at
+//!   every quadrature point with precomputed dBdxi.
+// *****************************************************************************
+{
+  Assert( dBdx[0].size() >= ndof && dBdx[1].size() >= ndof &&
+          dBdx[2].size() >= ndof, "Size mismatch for basis derivatives" );
+
+  for (std::size_t i=0; i<ndof; ++i)
+    for (std::size_t d=0; d<3; ++d)
+      dBdx[d][i] =  dBdxi[i][0] * jacInv[0][d]
+                  + dBdxi[i][1] * jacInv[1][d]
+                  + dBdxi[i][2] * jacInv[2][d];
 }
 
 std::vector< tk::real >
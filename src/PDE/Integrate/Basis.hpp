@@ -56,6 +56,20 @@ eval_dBdx_p2( const std::size_t igp,
               const std::array< std::array< tk::real, 3 >, 3 >& jacInv,
               std::array< std::vector<tk::real>, 3 >& dBdx );
 
+//! Compute the derivatives of the Dubiner basis functions in reference space
+std::array< std::array< tk::real, 3 >, 10 >
+eval_dBdxi( const std::size_t ndof,
+            const tk::real xi,
+            const tk::real eta,
+            const tk::real zeta );
+
+//! Compute the derivatives of basis functions in physical space
+void
+eval_dBdx( const std::size_t ndof,
+           const std::array< std::array< tk::real, 3 >, 10 >& dBdxi,
+           const std::array< std::array< tk::real, 3 >, 3 >& jacInv,
+           std::array< std::vector<tk::real>, 3 >& dBdx );
+
 //! Compute the Dubiner basis functions
 std::vector< tk::real >
 eval_basis( const std::size_t ndof,
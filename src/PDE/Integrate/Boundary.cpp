@@ -18,7 +18,7 @@
 #include "Basis.hpp"
 #include "Boundary.hpp"
 #include "Vector.hpp"
-#include "Quadrature.hpp"
+#include "QuadratureTable.hpp"
 #include "MultiMatTerms.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
 #include "Reconstruction.hpp"
@@ -107,18 +107,11 @@ tk::bndSurfInt( ncomp_t system,
 
         std::size_t el = static_cast< std::size_t >(esuf[2*f]);
 
-        auto ng = tk::NGfa(ndofel[el]);
-
-        // arrays for quadrature points
-        std::array< std::vector< real >, 2 > coordgp;
-        std::vector< real > wgp;
-
-        coordgp[0].resize( ng );
-        coordgp[1].resize( ng );
-        wgp.resize( ng );
-
         // get quadrature point weights and coordinates for triangle
-        GaussQuadratureTri( ng, coordgp, wgp );
+        const auto& q = faceQuadrature( ndofel[el] );
+        const auto& coordgp = q.coordgp;
+        const auto& wgp = q.wgp;
+        auto ng = wgp.size();
 
         // Extract the left element coordinates
         std::array< std::array< tk::real, 3>, 4 > coordel_l {{
@@ -24,7 +24,7 @@
 
 #include "MultiMatTerms.hpp"
 #include "Vector.hpp"
-#include "Quadrature.hpp"
+#include "QuadratureTable.hpp"
 #include "EoS/EoS.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
 #include "Reconstruction.hpp"
@@ -91,18 +91,11 @@ nonConservativeInt( [[maybe_unused]] ncomp_t system,
   // compute volume integrals
   for (std::size_t e=0; e<nelem; ++e)
   {
-    auto ng = tk::NGvol(ndofel[e]);
-
-    // arrays for quadrature points
-    std::array< std::vector< real >, 3 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    coordgp[2].resize( ng );
-    wgp.resize( ng );
-
-    GaussQuadratureTet( ng, coordgp, wgp );
+    // quadrature points and weights
+    const auto& q = volQuadrature( ndofel[e] );
+    const auto& coordgp = q.coordgp;
+    const auto& wgp = q.wgp;
+    auto ng = wgp.size();
 
     // Extract the element coordinates
     std::array< std::array< real, 3>, 4 > coordel {{
@@ -342,23 +335,17 @@ pressureRelaxationInt( ncomp_t system,
 
   auto ncomp = U.nprop()/rdof;
   auto nprim = P.nprop()/rdof;
+  const auto& mat = inciter::eos< tag::multimat >( system );
 
   // compute volume integrals
   for (std::size_t e=0; e<nelem; ++e)
   {
     auto dx = geoElem(e,4,0)/2.0;
-    auto ng = NGvol(ndofel[e]);
-
-    // arrays for quadrature points
-    std::array< std::vector< real >, 3 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    coordgp[2].resize( ng );
-    wgp.resize( ng );
-
-    GaussQuadratureTet( ng, coordgp, wgp );
+    // quadrature points and weights
+    const auto& q = volQuadrature( ndofel[e] );
+    const auto& coordgp = q.coordgp;
+    const auto& wgp = q.wgp;
+    auto ng = wgp.size();
 
     // Compute the derivatives of basis function for DG(P1)
     std::array< std::vector<real>, 3 > dBdx;
@@ -402,8 +389,7 @@ pressureRelaxationInt( ncomp_t system,
         real arhomat = state[densityIdx(nmat, k)];
         real alphamat = state[volfracIdx(nmat, k)];
         apmat[k] = state[ncomp+pressureIdx(nmat, k)];
-        real amat = inciter::eos_soundspeed< tag::multimat >( system, arhomat,
-          apmat[k], alphamat, k );
+        real amat = mat.soundspeed( arhomat, apmat[k], alphamat, k );
         kmat[k] = arhomat * amat * amat;
         pb += apmat[k];
 
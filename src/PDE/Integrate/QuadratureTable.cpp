@@ -0,0 +1,74 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Integrate/QuadratureTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Precomputed quadrature rules and basis functions for DG integrals
+  \details   Precomputed quadrature rules and basis functions for DG integrals.
+*/
+// *****************************************************************************
+
+#include "QuadratureTable.hpp"
+#include "Quadrature.hpp"
+#include "Basis.hpp"
+
+const tk::TetQuadrature&
+tk::volQuadrature( std::size_t ndof )
+// *****************************************************************************
+//  Access quadrature rule and basis for volume integrals
+//! \param[in] ndof Number of degrees of freedom, one of 1, 4, 10
+//! \return Quadrature rule with NGvol(ndof) points, and the ndof basis
+//!   functions and their reference-space derivatives at the points
+//! \details The tables are built on first call. Initialization of the
+//!   function-local static is thread-safe and the tables are read-only
+//!   afterwards.
+// *****************************************************************************
+{
+  auto build = []( std::size_t n ){
+    TetQuadrature q;
+    auto ng = NGvol( n );
+    for (auto& c : q.coordgp) c.resize( ng );
+    q.wgp.resize( ng );
+    GaussQuadratureTet( ng, q.coordgp, q.wgp );
+    for (std::size_t igp=0; igp<ng; ++igp) {
+      const auto xi = q.coordgp[0][igp];
+      const auto eta = q.coordgp[1][igp];
+      const auto zeta = q.coordgp[2][igp];
+      q.B.push_back( eval_basis( n, xi, eta, zeta ) );
+      q.dBdxi.push_back( eval_dBdxi( n, xi, eta, zeta ) );
+    }
+    return q;
+  };
+
+  static const std::array< TetQuadrature, 3 >
+    table{{ build(1), build(4), build(10) }};
+
+  Assert( ndof == 1 || ndof == 4 || ndof == 10, "ndof must be one of 1,4,10" );
+  return table[ ndof == 1 ? 0 : ndof == 4 ? 1 : 2 ];
+}
+
+const tk::TriQuadrature&
+tk::faceQuadrature( std::size_t ndof )
+// *****************************************************************************
+//  Access quadrature rule for face integrals
+//! \param[in] ndof Number of degrees of freedom, one of 1, 4, 10
+//! \return Quadrature rule with NGfa(ndof) points
+// *****************************************************************************
+{
+  auto build = []( std::size_t n ){
+    TriQuadrature q;
+    auto ng = NGfa( n );
+    for (auto& c : q.coordgp) c.resize( ng );
+    q.wgp.resize( ng );
+    GaussQuadratureTri( ng, q.coordgp, q.wgp );
+    return q;
+  };
+
+  static const std::array< TriQuadrature, 3 >
+    table{{ build(1), build(4), build(10) }};
+
+  Assert( ndof == 1 || ndof == 4 || ndof == 10, "ndof must be one of 1,4,10" );
+  return table[ ndof == 1 ? 0 : ndof == 4 ? 1 : 2 ];
+}
@@ -0,0 +1,56 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Integrate/QuadratureTable.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Precomputed quadrature rules and basis functions for DG integrals
+  \details   This file contains functions that provide Gauss quadrature rules
+    on the reference tetrahedron and triangle together with the Dubiner basis
+    functions and their reference-space derivatives evaluated at the quadrature
+    points. Since these only depend on the number of degrees of freedom, they
+    are computed once and reused for every element and face, so that the
+    quadrature loops of the DG integrals do not allocate and recompute them.
+*/
+// *****************************************************************************
+#ifndef QuadratureTable_h
+#define QuadratureTable_h
+
+#include <array>
+#include <vector>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Gauss quadrature rule on the reference tetrahedron with basis functions
+struct TetQuadrature {
+  //! Quadrature point coordinates in reference space
+  std::array< std::vector< real >, 3 > coordgp;
+  //! Quadrature weights
+  std::vector< real > wgp;
+  //! Basis functions at quadrature points, B[igp][idof]
+  std::vector< std::vector< real > > B;
+  //! Reference-space derivatives of basis functions at quadrature points,
+  //! dBdxi[igp][idof][dir]
+  std::vector< std::array< std::array< real, 3 >, 10 > > dBdxi;
+};
+
+//! Gauss quadrature rule on the reference triangle
+struct TriQuadrature {
+  //! Quadrature point coordinates in reference space
+  std::array< std::vector< real >, 2 > coordgp;
+  //! Quadrature weights
+  std::vector< real > wgp;
+};
+
+//! Access quadrature rule and basis for volume integrals
+const TetQuadrature& volQuadrature( std::size_t ndof );
+
+//! Access quadrature rule for face integrals
+const TriQuadrature& faceQuadrature( std::size_t ndof );
+
+} // tk::
+
+#endif // QuadratureTable_h
@@ -17,7 +17,7 @@
 #include <vector>
 
 #include "Source.hpp"
-#include "Quadrature.hpp"
+#include "QuadratureTable.hpp"
 
 void
 tk::srcInt( ncomp_t system,
@@ -52,18 +52,10 @@ tk::srcInt( ncomp_t system,
 
   for (std::size_t e=0; e<nelem; ++e)
   {
-    auto ng = tk::NGvol(ndofel[e]);
-
-    // arrays for quadrature points
-    std::array< std::vector< real >, 3 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    coordgp[2].resize( ng );
-    wgp.resize( ng );
-
-    GaussQuadratureTet( ng, coordgp, wgp );
+    // quadrature points, weights, and basis functions
+    const auto& q = volQuadrature( ndofel[e] );
+    const auto& coordgp = q.coordgp;
+    auto ng = q.wgp.size();
 
     // Extract the element coordinates
     std::array< std::array< real, 3>, 4 > coordel {{
@@ -77,17 +69,13 @@ tk::srcInt( ncomp_t system,
       // Compute the coordinates of quadrature point at physical domain
       auto gp = eval_gp( igp, coordel, coordgp );
 
-      // Compute the basis function
-      auto B =
-        eval_basis( ndofel[e], coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
-
       // Compute the source term variable
       std::array< real, 5 > s;
       src( system, gp[0], gp[1], gp[2], t, s[0], s[1], s[2], s[3], s[4] );
 
-      auto wt = wgp[igp] * geoElem(e, 0, 0);
+      auto wt = q.wgp[igp] * geoElem(e, 0, 0);
 
-      update_rhs( offset, ndof, ndofel[e], wt, e, B, s, R );
+      update_rhs( offset, ndof, ndofel[e], wt, e, q.B[igp], s, R );
     }
   }
 }
@@ -17,7 +17,7 @@
 
 #include "Surface.hpp"
 #include "Vector.hpp"
-#include "Quadrature.hpp"
+#include "QuadratureTable.hpp"
 #include "Reconstruction.hpp"
 
 void
@@ -94,23 +94,12 @@ tk::surfInt( ncomp_t system,
     std::size_t el = static_cast< std::size_t >(esuf[2*f]);
     std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
 
-    auto ng_l = tk::NGfa(ndofel[el]);
-    auto ng_r = tk::NGfa(ndofel[er]);
-
     // When the number of gauss points for the left and right element are
     // different, choose the larger ng
-    auto ng = std::max( ng_l, ng_r );
-
-    // arrays for quadrature points
-    std::array< std::vector< real >, 2 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    wgp.resize( ng );
-
-    // get quadrature point weights and coordinates for triangle
-    GaussQuadratureTri( ng, coordgp, wgp );
+    const auto& q = faceQuadrature( std::max( ndofel[el], ndofel[er] ) );
+    const auto& coordgp = q.coordgp;
+    const auto& wgp = q.wgp;
+    auto ng = wgp.size();
 
     // Extract the element coordinates
     std::array< std::array< tk::real, 3>, 4 > coordel_l {{ 
@@ -15,8 +15,16 @@
 
 #include "Volume.hpp"
 #include "Vector.hpp"
-#include "Quadrature.hpp"
+#include "ParallelFor.hpp"
+#include "QuadratureTable.hpp"
 #include "Reconstruction.hpp"
+#include "Inciter/InputDeck/InputDeck.hpp"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
 
 void
 tk::volInt( ncomp_t system,
@@ -56,6 +64,8 @@ tk::volInt( ncomp_t system,
 //! \param[in,out] R Right-hand side vector added to
 //! \param[in] intsharp Interface compression tag, an optional argument, with
 //!   default 0, so that it is unused for single-material and transport.
+//! \details Elements are split among the worker threads configured per chare.
+//!   This is race-free since each element only adds to its own rhs.
 // *****************************************************************************
 {
   const auto& cx = coord[0];
@@ -65,67 +75,64 @@ tk::volInt( ncomp_t system,
   auto ncomp = U.nprop()/rdof;
   auto nprim = P.nprop()/rdof;
 
-  // compute volume integrals
-  for (std::size_t e=0; e<nelem; ++e)
-  {
-    if(ndofel[e] > 1)
-    {
-      auto ng = tk::NGvol(ndofel[e]);
-
-      // arrays for quadrature points
-      std::array< std::vector< real >, 3 > coordgp;
-      std::vector< real > wgp;
-
-      coordgp[0].resize( ng );
-      coordgp[1].resize( ng );
-      coordgp[2].resize( ng );
-      wgp.resize( ng );
-
-      GaussQuadratureTet( ng, coordgp, wgp );
-
-      // Extract the element coordinates
-      std::array< std::array< real, 3>, 4 > coordel {{
-        {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-        {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-        {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-        {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
-      }};
-
-      auto jacInv =
-              inverseJacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
 
-      // Compute the derivatives of basis function for DG(P1)
-      auto dBdx = eval_dBdx_p1( ndofel[e], jacInv );
+  // compute volume integrals, elements split among worker threads
+  tk::parallel_for( nthread, 0, nelem, 1,
+    [&]( std::size_t begin, std::size_t end ){
+      // derivatives of basis functions, reused across elements
+      std::array< std::vector< real >, 3 > dBdx;
 
-      // Gaussian quadrature
-      for (std::size_t igp=0; igp<ng; ++igp)
+      for (std::size_t e=begin; e<end; ++e)
       {
-        if (ndofel[e] > 4)
-          eval_dBdx_p2( igp, coordgp, jacInv, dBdx );
-
-        // Compute the coordinates of quadrature point at physical domain
-        auto gp = eval_gp( igp, coordel, coordgp );
-
-        // Compute the basis function
-        auto B = eval_basis( ndofel[e], coordgp[0][igp], coordgp[1][igp],
-                             coordgp[2][igp] );
-
-        auto wt = wgp[igp] * geoElem(e, 0, 0);
-
-        auto state = evalPolynomialSol(system, offset, intsharp, ncomp, nprim,
-          rdof, nmat, e, ndofel[e], inpoel, coord, geoElem,
-          {{coordgp[0][igp], coordgp[1][igp], coordgp[2][igp]}}, B, U, P);
-
-        // evaluate prescribed velocity (if any)
-        auto v = vel( system, ncomp, gp[0], gp[1], gp[2], t );
-
-        // comput flux
-        auto fl = flux( system, ncomp, state, v );
-
-        update_rhs( ncomp, offset, ndof, ndofel[e], wt, e, dBdx, fl, R );
+        if(ndofel[e] > 1)
+        {
+          // quadrature points, weights, and basis functions
+          const auto& q = volQuadrature( ndofel[e] );
+          const auto& coordgp = q.coordgp;
+          auto ng = q.wgp.size();
+
+          // Extract the element coordinates
+          std::array< std::array< real, 3>, 4 > coordel {{
+            {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
+            {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
+            {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
+            {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
+          }};
+
+          auto jacInv = inverseJacobian( coordel[0], coordel[1], coordel[2],
+                                         coordel[3] );
+
+          for (auto& d : dBdx) d.resize( ndofel[e] );
+
+          // Gaussian quadrature
+          for (std::size_t igp=0; igp<ng; ++igp)
+          {
+            // Compute the derivatives of basis functions, constant for DG(P1)
+            if (igp == 0 || ndofel[e] > 4)
+              eval_dBdx( ndofel[e], q.dBdxi[igp], jacInv, dBdx );
+
+            // Compute the coordinates of quadrature point at physical domain
+            auto gp = eval_gp( igp, coordel, coordgp );
+
+            auto wt = q.wgp[igp] * geoElem(e, 0, 0);
+
+            auto state = evalPolynomialSol(system, offset, intsharp, ncomp,
+              nprim, rdof, nmat, e, ndofel[e], inpoel, coord, geoElem,
+              {{coordgp[0][igp], coordgp[1][igp], coordgp[2][igp]}}, q.B[igp],
+              U, P);
+
+            // evaluate prescribed velocity (if any)
+            auto v = vel( system, ncomp, gp[0], gp[1], gp[2], t );
+
+            // comput flux
+            auto fl = flux( system, ncomp, state, v );
+
+            update_rhs( ncomp, offset, ndof, ndofel[e], wt, e, dBdx, fl, R );
+          }
+        }
       }
-    }
-  }
+    } );
 }
 
 void
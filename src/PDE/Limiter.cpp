@@ -13,9 +13,12 @@
 // *****************************************************************************
 
 #include <array>
+#include <limits>
 #include <vector>
 
 #include "Vector.hpp"
+#include "Around.hpp"
+#include "ParallelFor.hpp"
 #include "Limiter.hpp"
 #include "DerivedData.hpp"
 #include "Integrate/Quadrature.hpp"
@@ -41,6 +44,7 @@ WENO_P1( const std::vector< int >& esuel,
 {
   const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
   const auto cweight = inciter::g_inputdeck.get< tag::discr, tag::cweight >();
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
   auto nelem = esuel.size()/4;
   std::array< std::vector< tk::real >, 3 >
     limU {{ std::vector< tk::real >(nelem),
@@ -51,10 +55,13 @@ WENO_P1( const std::vector< int >& esuel,
 
   for (inciter::ncomp_t c=0; c<ncomp; ++c)
   {
-    for (std::size_t e=0; e<nelem; ++e)
-    {
-      WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
-    }
+    tk::parallel_for( nthread, 0, nelem, 1,
+      [&]( std::size_t begin, std::size_t end ){
+        for (std::size_t e=begin; e<end; ++e)
+        {
+          WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
+        }
+      } );
 
     auto mark = c*rdof;
 
@@ -158,42 +165,48 @@ Superbee_P1( const std::vector< int >& esuel,
 {
   const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
   const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
   std::size_t ncomp = U.nprop()/rdof;
 
   auto beta_lim = 2.0;
 
-  for (std::size_t e=0; e<esuel.size()/4; ++e)
-  {
-    // If an rDG method is set up (P0P1), then, currently we compute the P1
-    // basis functions and solutions by default. This implies that P0P1 is
-    // unsupported in the p-adaptive DG (PDG). This is a workaround until we
-    // have rdofel, which is needed to distinguish between ndofs and rdofs per
-    // element for pDG.
-    std::size_t dof_el;
-    if (rdof > ndof)
-    {
-      dof_el = rdof;
-    }
-    else
-    {
-      dof_el = ndofel[e];
-    }
-
-    if (dof_el > 1)
-    {
-      auto phi = SuperbeeFunction(U, esuel, inpoel, coord, e, ndof, rdof,
-                   dof_el, offset, ncomp, beta_lim);
-
-      // apply limiter function
-      for (inciter::ncomp_t c=0; c<ncomp; ++c)
+  // elements can be limited concurrently: the limiter function of an element
+  // only depends on the cell averages of its neighbors, which are not modified
+  tk::parallel_for( nthread, 0, esuel.size()/4, 1,
+    [&]( std::size_t begin, std::size_t end ){
+      for (std::size_t e=begin; e<end; ++e)
       {
-        auto mark = c*rdof;
-        U(e, mark+1, offset) = phi[c] * U(e, mark+1, offset);
-        U(e, mark+2, offset) = phi[c] * U(e, mark+2, offset);
-        U(e, mark+3, offset) = phi[c] * U(e, mark+3, offset);
+        // If an rDG method is set up (P0P1), then, currently we compute the
+        // P1 basis functions and solutions by default. This implies that P0P1
+        // is unsupported in the p-adaptive DG (PDG). This is a workaround
+        // until we have rdofel, which is needed to distinguish between ndofs
+        // and rdofs per element for pDG.
+        std::size_t dof_el;
+        if (rdof > ndof)
+        {
+          dof_el = rdof;
+        }
+        else
+        {
+          dof_el = ndofel[e];
+        }
+
+        if (dof_el > 1)
+        {
+          auto phi = SuperbeeFunction(U, esuel, inpoel, coord, e, ndof, rdof,
+                       dof_el, offset, ncomp, beta_lim);
+
+          // apply limiter function
+          for (inciter::ncomp_t c=0; c<ncomp; ++c)
+          {
+            auto mark = c*rdof;
+            U(e, mark+1, offset) = phi[c] * U(e, mark+1, offset);
+            U(e, mark+2, offset) = phi[c] * U(e, mark+2, offset);
+            U(e, mark+3, offset) = phi[c] * U(e, mark+3, offset);
+          }
+        }
       }
-    }
-  }
+    } );
 }
 
 void
@@ -299,7 +312,8 @@ SuperbeeMultiMat_P1(
 
 void
 VertexBasedTransport_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
   std::size_t nelem,
@@ -329,6 +343,10 @@ VertexBasedTransport_P1(
     tag::intsharp >()[system];
   std::size_t ncomp = U.nprop()/rdof;
 
+  // find min/max bounds of cell averages at all nodes
+  std::vector< tk::real > uMin, uMax;
+  VertexBasedBounds( U, esup, rdof, offset, ncomp, uMin, uMax );
+
   for (std::size_t e=0; e<nelem; ++e)
   {
     // If an rDG method is set up (P0P1), then, currently we compute the P1
@@ -349,8 +367,8 @@ VertexBasedTransport_P1(
     if (dof_el > 1)
     {
       // limit conserved quantities
-      auto phi = VertexBasedFunction(U, esup, inpoel, coord, e, rdof, dof_el,
-        offset, ncomp);
+      auto phi = VertexBasedFunction(U, uMin, uMax, inpoel, coord, e, rdof,
+        dof_el, offset, ncomp);
 
       // limits under which compression is to be performed
       std::vector< std::size_t > matInt(ncomp, 0);
@@ -380,7 +398,8 @@ VertexBasedTransport_P1(
 
 void
 VertexBased_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
   std::size_t nelem,
@@ -404,46 +423,57 @@ VertexBased_P1(
 {
   const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
   const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
   std::size_t ncomp = U.nprop()/rdof;
 
-  for (std::size_t e=0; e<nelem; ++e)
-  {
-    // If an rDG method is set up (P0P1), then, currently we compute the P1
-    // basis functions and solutions by default. This implies that P0P1 is
-    // unsupported in the p-adaptive DG (PDG). This is a workaround until we
-    // have rdofel, which is needed to distinguish between ndofs and rdofs per
-    // element for pDG.
-    std::size_t dof_el;
-    if (rdof > ndof)
-    {
-      dof_el = rdof;
-    }
-    else
-    {
-      dof_el = ndofel[e];
-    }
+  // find min/max bounds of cell averages at all nodes
+  std::vector< tk::real > uMin, uMax;
+  VertexBasedBounds( U, esup, rdof, offset, ncomp, uMin, uMax );
 
-    if (dof_el > 1)
-    {
-      // limit conserved quantities
-      auto phi = VertexBasedFunction(U, esup, inpoel, coord, e, rdof, dof_el,
-        offset, ncomp);
-
-      // apply limiter function
-      for (std::size_t c=0; c<ncomp; ++c)
+  // elements can be limited concurrently: the min/max bounds only use cell
+  // averages, which are not modified
+  tk::parallel_for( nthread, 0, nelem, 1,
+    [&]( std::size_t begin, std::size_t end ){
+      for (std::size_t e=begin; e<end; ++e)
       {
-        auto mark = c*rdof;
-        U(e, mark+1, offset) = phi[c] * U(e, mark+1, offset);
-        U(e, mark+2, offset) = phi[c] * U(e, mark+2, offset);
-        U(e, mark+3, offset) = phi[c] * U(e, mark+3, offset);
+        // If an rDG method is set up (P0P1), then, currently we compute the
+        // P1 basis functions and solutions by default. This implies that P0P1
+        // is unsupported in the p-adaptive DG (PDG). This is a workaround
+        // until we have rdofel, which is needed to distinguish between ndofs
+        // and rdofs per element for pDG.
+        std::size_t dof_el;
+        if (rdof > ndof)
+        {
+          dof_el = rdof;
+        }
+        else
+        {
+          dof_el = ndofel[e];
+        }
+
+        if (dof_el > 1)
+        {
+          // limit conserved quantities
+          auto phi = VertexBasedFunction(U, uMin, uMax, inpoel, coord, e,
+            rdof, dof_el, offset, ncomp);
+
+          // apply limiter function
+          for (std::size_t c=0; c<ncomp; ++c)
+          {
+            auto mark = c*rdof;
+            U(e, mark+1, offset) = phi[c] * U(e, mark+1, offset);
+            U(e, mark+2, offset) = phi[c] * U(e, mark+2, offset);
+            U(e, mark+3, offset) = phi[c] * U(e, mark+3, offset);
+          }
+        }
       }
-    }
-  }
+    } );
 }
 
 void
 VertexBasedMultiMat_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
   std::size_t nelem,
@@ -478,6 +508,11 @@ VertexBasedMultiMat_P1(
   std::size_t ncomp = U.nprop()/rdof;
   std::size_t nprim = P.nprop()/rdof;
 
+  // find min/max bounds of cell averages at all nodes
+  std::vector< tk::real > uMin, uMax, pMin, pMax;
+  VertexBasedBounds( U, esup, rdof, offset, ncomp, uMin, uMax );
+  VertexBasedBounds( P, esup, rdof, offset, nprim, pMin, pMax );
+
   for (std::size_t e=0; e<nelem; ++e)
   {
     // If an rDG method is set up (P0P1), then, currently we compute the P1
@@ -498,11 +533,11 @@ VertexBasedMultiMat_P1(
     if (dof_el > 1)
     {
       // limit conserved quantities
-      auto phic = VertexBasedFunction(U, esup, inpoel, coord, e, rdof, dof_el,
-        offset, ncomp);
+      auto phic = VertexBasedFunction(U, uMin, uMax, inpoel, coord, e, rdof,
+        dof_el, offset, ncomp);
       // limit primitive quantities
-      auto phip = VertexBasedFunction(P, esup, inpoel, coord, e, rdof, dof_el,
-        offset, nprim);
+      auto phip = VertexBasedFunction(P, pMin, pMax, inpoel, coord, e, rdof,
+        dof_el, offset, nprim);
 
       if(ndof > 1 && intsharp == 0)
         BoundPreservingLimiting(nmat, offset, ndof, e, inpoel, coord, U, phic);
@@ -815,9 +850,59 @@ SuperbeeFunction( const tk::Fields& U,
   return phi;
 }
 
+void
+VertexBasedBounds( const tk::Fields& U,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
+  std::size_t rdof,
+  std::size_t offset,
+  std::size_t ncomp,
+  std::vector< tk::real >& uMin,
+  std::vector< tk::real >& uMax )
+// *****************************************************************************
+//  Find min/max bounds of cell averages in the neighborhood of all nodes
+//! \param[in] U High-order solution vector whose cell averages to bound
+//! \param[in] esup Elements surrounding points, including node-neighbor ghost
+//!   elements, as linked lists, see tk::genEsup()
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] offset Index for equation systems
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[out] uMin Minimum of cell averages surrounding nodes, size:
+//!   number of points times ncomp, component index running fastest
+//! \param[out] uMax Maximum of cell averages surrounding nodes, size:
+//!   number of points times ncomp, component index running fastest
+//! \details The bounds only depend on cell averages, which are not modified
+//!   by the limiters, so they are found once for all nodes before limiting
+//!   elements, instead of once for each node of each element. Nodes are
+//!   independent, so they are processed concurrently.
+// *****************************************************************************
+{
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
+  const auto npoin = esup.second.size() - 1;
+
+  uMin.assign( npoin*ncomp, std::numeric_limits< tk::real >::max() );
+  uMax.assign( npoin*ncomp, std::numeric_limits< tk::real >::lowest() );
+
+  tk::parallel_for( nthread, 0, npoin, 1,
+    [&]( std::size_t begin, std::size_t end ){
+      for (std::size_t p=begin; p<end; ++p) {
+        auto pmin = uMin.data() + p*ncomp;
+        auto pmax = uMax.data() + p*ncomp;
+        for (auto er : tk::Around(esup,p))
+          for (std::size_t c=0; c<ncomp; ++c)
+          {
+            auto mark = c*rdof;
+            pmin[c] = std::min(pmin[c], U(er, mark, offset));
+            pmax[c] = std::max(pmax[c], U(er, mark, offset));
+          }
+      }
+    } );
+}
+
 std::vector< tk::real >
 VertexBasedFunction( const tk::Fields& U,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< tk::real >& uMin,
+  const std::vector< tk::real >& uMax,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   std::size_t e,
@@ -828,7 +913,10 @@ VertexBasedFunction( const tk::Fields& U,
 // *****************************************************************************
 //  Kuzmin's vertex-based limiter function calculation for P1 dofs
 //! \param[in] U High-order solution vector which is to be limited
-//! \param[in] esup Elements surrounding points
+//! \param[in] uMin Minimum of cell averages surrounding nodes, see
+//!   VertexBasedBounds()
+//! \param[in] uMax Maximum of cell averages surrounding nodes, see
+//!   VertexBasedBounds()
 //! \param[in] inpoel Element connectivity
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] e Id of element whose solution is to be limited
@@ -862,33 +950,16 @@ VertexBasedFunction( const tk::Fields& U,
   auto detT =
     tk::Jacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
 
-  std::vector< tk::real > uMin(ncomp, 0.0), uMax(ncomp, 0.0), phi(ncomp, 1.0);
+  std::vector< tk::real > phi(ncomp, 1.0);
 
   // loop over all nodes of the element e
   for (std::size_t lp=0; lp<4; ++lp)
   {
-    // reset min/max
-    for (std::size_t c=0; c<ncomp; ++c)
-    {
-      auto mark = c*rdof;
-      uMin[c] = U(e, mark, offset);
-      uMax[c] = U(e, mark, offset);
-    }
-
     auto p = inpoel[4*e+lp];
-    const auto& pesup = tk::cref_find(esup, p);
 
-    // ----- Step-1: find min/max in the neighborhood of node p
-    // loop over all the elements surrounding this node p
-    for (auto er : pesup)
-    {
-      for (std::size_t c=0; c<ncomp; ++c)
-      {
-        auto mark = c*rdof;
-        uMin[c] = std::min(uMin[c], U(er, mark, offset));
-        uMax[c] = std::max(uMax[c], U(er, mark, offset));
-      }
-    }
+    // ----- Step-1: min/max in the neighborhood of node p, precomputed
+    const auto pmin = uMin.data() + p*ncomp;
+    const auto pmax = uMax.data() + p*ncomp;
 
     // ----- Step-2: compute the limiter function at this node
 
@@ -913,12 +984,12 @@ VertexBasedFunction( const tk::Fields& U,
       if (uNeg > 1.0e-14)
       {
         uNeg = std::max(uNeg, 1.0e-08);
-        phi_gp = std::min( 1.0, (uMax[c]-U(e, mark, offset))/uNeg );
+        phi_gp = std::min( 1.0, (pmax[c]-U(e, mark, offset))/uNeg );
       }
       else if (uNeg < -1.0e-14)
       {
         uNeg = std::min(uNeg, -1.0e-08);
-        phi_gp = std::min( 1.0, (uMin[c]-U(e, mark, offset))/uNeg );
+        phi_gp = std::min( 1.0, (pmin[c]-U(e, mark, offset))/uNeg );
       }
       else
       {
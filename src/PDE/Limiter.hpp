@@ -62,7 +62,8 @@ SuperbeeMultiMat_P1(
 //! Kuzmin's vertex-based limiter for transport DGP1
 void
 VertexBasedTransport_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
   std::size_t nelem,
@@ -74,7 +75,8 @@ VertexBasedTransport_P1(
 //! Kuzmin's vertex-based limiter for single-material DGP1
 void
 VertexBased_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
   std::size_t nelem,
@@ -85,7 +87,8 @@ VertexBased_P1(
 //! Kuzmin's vertex-based limiter for multi-material DGP1
 void
 VertexBasedMultiMat_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
   std::size_t nelem,
@@ -121,10 +124,22 @@ SuperbeeFunction( const tk::Fields& U,
                   inciter:: ncomp_t ncomp,
                   tk::real beta_lim );
 
+//! Find min/max bounds of cell averages in the neighborhood of all nodes
+void
+VertexBasedBounds( const tk::Fields& U,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
+  std::size_t rdof,
+  std::size_t offset,
+  std::size_t ncomp,
+  std::vector< tk::real >& uMin,
+  std::vector< tk::real >& uMax );
+
 //! Kuzmin's vertex-based limiter function calculation for P1 dofs
 std::vector< tk::real >
 VertexBasedFunction( const tk::Fields& U,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< tk::real >& uMin,
+  const std::vector< tk::real >& uMax,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   std::size_t e,
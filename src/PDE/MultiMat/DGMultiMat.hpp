@@ -538,6 +538,8 @@ class MultiMat {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] invlhs_ls Inverse of least-squares reconstruction lhs matrix
+    //!   of each element, only geometry dependent
     //! \param[in] esup Elements-surrounding-nodes connectivity
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
@@ -547,8 +549,10 @@ class MultiMat {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&
-                        esup,
+                      const std::vector< std::array< std::array< tk::real, 3 >,
+                        3 > >& invlhs_ls,
+                      const std::pair< std::vector< std::size_t >,
+                        std::vector< std::size_t > >& esup,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
                       tk::Fields& U,
@@ -574,18 +578,6 @@ class MultiMat {
         Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
                 "Mismatch in inpofa size" );
 
-        // allocate and initialize matrix and vector for reconstruction:
-        // lhs_ls is the left-hand side matrix for solving the least-squares
-        // system using the normal equation approach, for each mesh element.
-        // It is indexed as follows:
-        // The first index is the element id;
-        // the second index is the row id of the 3-by-3 matrix;
-        // the third index is the column id of the 3-by-3 matrix.
-        std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-          lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                            {{0.0, 0.0, 0.0}},
-                            {{0.0, 0.0, 0.0}} }} );
-
         //----- reconstruction of conserved quantities -----
         //--------------------------------------------------
         // specify how many variables need to be reconstructed
@@ -607,9 +599,6 @@ class MultiMat {
               {{ 0.0, 0.0, 0.0 }} ) );
 
         // reconstruct x,y,z-derivatives of unknowns.
-        // 0. get lhs matrix, which is only geometry dependent
-        tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
-
         // 1. internal face contributions
         tk::intLeastSq_P0P1(m_offset, rdof, fd, geoElem, U, rhsu_ls, varRange);
 
@@ -622,7 +611,7 @@ class MultiMat {
         }
 
         // 3. solve 3x3 least-squares system
-        tk::solveLeastSq_P0P1(m_offset, rdof, lhs_ls, rhsu_ls, U, varRange);
+        tk::solveLeastSq_P0P1(m_offset, rdof, invlhs_ls, rhsu_ls, U, varRange);
 
         for (std::size_t e=0; e<nelem; ++e)
         {
@@ -670,7 +659,7 @@ class MultiMat {
           }
 
           // 3.
-          tk::solveLeastSq_P0P1(m_offset, rdof, lhs_ls, rhsp_ls, P,
+          tk::solveLeastSq_P0P1(m_offset, rdof, invlhs_ls, rhsp_ls, P,
             {0, nprim()-1});
 
           // 4.
@@ -695,7 +684,8 @@ class MultiMat {
                 [[maybe_unused]] const tk::Fields& geoFace,
                 [[maybe_unused]] const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >& esup,
+                const std::pair< std::vector< std::size_t >,
+                  std::vector< std::size_t > >& esup,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
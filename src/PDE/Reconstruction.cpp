@@ -18,6 +18,7 @@
 
 #include "Vector.hpp"
 #include "Around.hpp"
+#include "ParallelFor.hpp"
 #include "Base/HashMapReducer.hpp"
 #include "Reconstruction.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
@@ -110,6 +111,34 @@ tk::lhsLeastSq_P0P1(
   }
 }
 
+std::vector< std::array< std::array< tk::real, 3 >, 3 > >
+tk::invLhsLeastSq_P0P1( const inciter::FaceData& fd,
+                        const Fields& geoElem,
+                        const Fields& geoFace )
+// *****************************************************************************
+//  Compute inverse of lhs matrix for the least-squares reconstruction
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoElem Element geometry array
+//! \param[in] geoFace Face geometry array
+//! \return Inverse of the LHS reconstruction matrix of each element
+//! \details Since the lhs matrix only depends on the geometry, it is computed
+//!   and inverted once for a mesh, and the inverse is then reused by
+//!   solveLeastSq_P0P1() for all reconstructions on that mesh.
+// *****************************************************************************
+{
+  const auto nelem = fd.Esuel().size()/4;
+
+  std::vector< std::array< std::array< real, 3 >, 3 > >
+    lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
+                      {{0.0, 0.0, 0.0}},
+                      {{0.0, 0.0, 0.0}} }} );
+  lhsLeastSq_P0P1( fd, geoElem, geoFace, lhs_ls );
+
+  for (auto& a : lhs_ls) a = tk::inverse( a );
+
+  return lhs_ls;
+}
+
 void
 tk::intLeastSq_P0P1(
   ncomp_t offset,
@@ -370,7 +399,7 @@ void
 tk::solveLeastSq_P0P1(
   ncomp_t offset,
   const std::size_t rdof,
-  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhs,
+  const std::vector< std::array< std::array< real, 3 >, 3 > >& invlhs,
   const std::vector< std::vector< std::array< real, 3 > > >& rhs,
   Fields& W,
   const std::array< std::size_t, 2 >& varRange )
@@ -378,32 +407,39 @@ tk::solveLeastSq_P0P1(
 //  Solve the 3x3 linear system for least-squares reconstruction
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] rdof Maximum number of reconstructed degrees of freedom
-//! \param[in] lhs LHS reconstruction matrix
+//! \param[in] invlhs Inverse of LHS reconstruction matrix, see
+//!   invLhsLeastSq_P0P1()
 //! \param[in] rhs RHS reconstruction vector
 //! \param[in,out] W Solution vector to be reconstructed at recent time step
 //! \param[in] varRange Range of indices in W, that need to be reconstructed
-//! \details Solves the 3x3 linear system for each element, individually. For
+//! \details Solves the 3x3 linear system for each element, individually, by
+//!   multiplying the rhs with the pre-computed inverse of the lhs. For
 //!   systems that require reconstructions of primitive quantities, this should
 //!   be called twice, once with the argument 'W' as U (conserved), and again
-//!   with 'W' as P (primitive).
+//!   with 'W' as P (primitive). The elements are split among the worker
+//!   threads configured per chare.
 // *****************************************************************************
 {
-  auto nelem = lhs.size();
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
+  auto nelem = invlhs.size();
 
-  for (std::size_t e=0; e<nelem; ++e)
-  {
-    for (std::size_t c=varRange[0]; c<=varRange[1]; ++c)
-    {
-      auto mark = c*rdof;
+  tk::parallel_for( nthread, 0, nelem, 1,
+    [&]( std::size_t begin, std::size_t end ){
+      for (std::size_t e=begin; e<end; ++e)
+      {
+        for (std::size_t c=varRange[0]; c<=varRange[1]; ++c)
+        {
+          auto mark = c*rdof;
 
-      // solve system using Cramer's rule
-      auto ux = tk::cramer( lhs[e], rhs[e][c] );
+          // solve system using the inverse of the lhs
+          auto ux = tk::matvec( invlhs[e], rhs[e][c] );
 
-      W(e,mark+1,offset) = ux[0];
-      W(e,mark+2,offset) = ux[1];
-      W(e,mark+3,offset) = ux[2];
-    }
-  }
+          W(e,mark+1,offset) = ux[0];
+          W(e,mark+2,offset) = ux[1];
+          W(e,mark+3,offset) = ux[2];
+        }
+      }
+    } );
 }
 
 void
@@ -411,7 +447,8 @@ tk::recoLeastSqExtStencil(
   std::size_t rdof,
   std::size_t offset,
   std::size_t e,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& geoElem,
   Fields& W,
@@ -449,10 +486,9 @@ tk::recoLeastSqExtStencil(
   for (std::size_t lp=0; lp<4; ++lp)
   {
     auto p = inpoel[4*e+lp];
-    const auto& pesup = cref_find(esup, p);
 
     // loop over all the elements surrounding this node p
-    for (auto er : pesup)
+    for (auto er : tk::Around(esup,p))
     {
       // centroid distance
       std::array< real, 3 > wdeltax{{ geoElem(er,1,0)-geoElem(e,1,0),
@@ -560,7 +596,8 @@ tk::findMaxVolfrac( std::size_t offset,
   std::size_t nmat,
   std::size_t nelem,
   const std::vector< int >& esuel,
-  [[maybe_unused]] const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  [[maybe_unused]] const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   [[maybe_unused]] const std::vector< std::size_t >& inpoel,
   const Fields& U,
   Fields& VolFracMax )
@@ -594,10 +631,9 @@ tk::findMaxVolfrac( std::size_t offset,
     //// find the maximum volume fraction among node-neighbors of cell e
     //for (std::size_t lp=0; lp<4; ++lp) {
     //  auto p = inpoel[4*e+lp];
-    //  const auto& pesup = cref_find(esup, p);
 
     //  // loop over all the elements surrounding this node p
-    //  for (auto er : pesup) {
+    //  for (auto er : tk::Around(esup,p)) {
     //    if (er != e) {
     //      for (std::size_t k=0; k<nmat; ++k) {
     //        auto mark = 2*k;
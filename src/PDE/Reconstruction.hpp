@@ -36,6 +36,12 @@ lhsLeastSq_P0P1(
   const Fields& geoFace,
   std::vector< std::array< std::array< real, 3 >, 3 > >& lhs_ls );
 
+//! Compute inverse of lhs matrix for the least-squares reconstruction
+std::vector< std::array< std::array< real, 3 >, 3 > >
+invLhsLeastSq_P0P1( const inciter::FaceData& fd,
+                    const Fields& geoElem,
+                    const Fields& geoFace );
+
 //! Compute internal surface contributions to the least-squares reconstruction
 void
 intLeastSq_P0P1( ncomp_t offset,
@@ -90,7 +96,7 @@ void
 solveLeastSq_P0P1(
   ncomp_t offset,
   const std::size_t rdof,
-  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhs,
+  const std::vector< std::array< std::array< real, 3 >, 3 > >& invlhs,
   const std::vector< std::vector< std::array< real, 3 > > >& rhs,
   Fields& W,
   const std::array< std::size_t, 2 >& varRange );
@@ -102,7 +108,8 @@ recoLeastSqExtStencil(
   std::size_t rdof,
   std::size_t offset,
   std::size_t e,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& geoElem,
   Fields& W,
@@ -125,7 +132,8 @@ findMaxVolfrac( std::size_t offset,
   std::size_t nmat,
   std::size_t nelem,
   const std::vector< int >& esuel,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+    std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& U,
   Fields& VolFracMax );
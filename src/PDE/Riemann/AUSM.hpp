@@ -44,6 +44,7 @@ struct AUSM {
   {
     const auto nmat =
       g_inputdeck.get< tag::param, tag::multimat, tag::nmat >()[0];
+    const auto& mat = eos< tag::multimat >( 0 );
 
     auto ncomp = u[0].size()-(3+nmat);
     std::vector< tk::real > flx( ncomp, 0 );
@@ -68,17 +69,13 @@ struct AUSM {
       pml[k] = u[0][ncomp+pressureIdx(nmat, k)];
       pl += pml[k];
       hml[k] = u[0][energyIdx(nmat, k)] + pml[k];
-      amatl = eos_soundspeed< tag::multimat >( 0,
-                                               u[0][densityIdx(nmat, k)],
-                                               pml[k], al_l[k], k );
+      amatl = mat.soundspeed( u[0][densityIdx(nmat, k)], pml[k], al_l[k], k );
 
       al_r[k] = u[1][volfracIdx(nmat, k)];
       pmr[k] = u[1][ncomp+pressureIdx(nmat, k)];
       pr += pmr[k];
       hmr[k] = u[1][energyIdx(nmat, k)] + pmr[k];
-      amatr = eos_soundspeed< tag::multimat >( 0,
-                                               u[1][densityIdx(nmat, k)],
-                                               pmr[k], al_r[k], k );
+      amatr = mat.soundspeed( u[1][densityIdx(nmat, k)], pmr[k], al_r[k], k );
 
       // Average states for mixture speed of sound
       arhom12[k] = 0.5*(u[0][densityIdx(nmat, k)] + u[1][densityIdx(nmat, k)]);
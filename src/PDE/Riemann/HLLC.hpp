@@ -13,7 +13,9 @@
 #ifndef HLLC_h
 #define HLLC_h
 
+#include <cmath>
 #include <vector>
+#include <algorithm>
 
 #include "Types.hpp"
 #include "Fields.hpp"
@@ -52,11 +54,12 @@ struct HLLC {
     auto vr = u[1][2]/rhor;
     auto wr = u[1][3]/rhor;
 
-    auto pl = eos_pressure< tag::compflow >( 0, rhol, ul, vl, wl, u[0][4] );
-    auto pr = eos_pressure< tag::compflow >( 0, rhor, ur, vr, wr, u[1][4] );
+    const auto& mat = eos< tag::compflow >( 0 );
+    auto pl = mat.pressure( rhol, ul, vl, wl, u[0][4] );
+    auto pr = mat.pressure( rhor, ur, vr, wr, u[1][4] );
 
-    auto al = eos_soundspeed< tag::compflow >( 0, rhol, pl );
-    auto ar = eos_soundspeed< tag::compflow >( 0, rhor, pr );
+    auto al = mat.soundspeed( rhol, pl );
+    auto ar = mat.soundspeed( rhor, pr );
 
     // Face-normal velocities
     tk::real vnl = ul*fn[0] + vl*fn[1] + wl*fn[2];
@@ -124,6 +127,136 @@ struct HLLC {
     return flx;
   }
 
+  //! HLLC approximate Riemann solver flux function for edge-based schemes
+  //! \param[in] nx X component of the surface normal
+  //! \param[in] ny Y component of the surface normal
+  //! \param[in] nz Z component of the surface normal
+  //! \param[in] mx X component of the weighted surface normal on chare
+  //!   boundary, weighted by the number of contributions to the edge
+  //! \param[in] my Y component of the weighted surface normal on chare
+  //!   boundary, weighted by the number of contributions to the edge
+  //! \param[in] mz Z component of the weighted surface normal on chare
+  //!   boundary, weighted by the number of contributions to the edge
+  //! \param[in] rL Left density
+  //! \param[in] ruL Left X momentum
+  //! \param[in] rvL Left Y momentum
+  //! \param[in] rwL Left Z momentum
+  //! \param[in] reL Left total specific energy
+  //! \param[in] rR Right density
+  //! \param[in] ruR Right X momentum
+  //! \param[in] rvR Right Y momentum
+  //! \param[in] rwR Right Z momentum
+  //! \param[in] reR Right total specific energy
+  //! \param[in,out] fr Riemann solution for density according to HLLC
+  //! \param[in,out] fru Riemann solution for X momenutm according to HLLC
+  //! \param[in,out] frv Riemann solution for Y momenutm according to HLLC
+  //! \param[in,out] frw Riemann solution for Z momenutm according to HLLC
+  //! \param[in,out] fre Riemann solution for specific total energy according
+  //!   to HLLC
+  //! \details This overload follows the signature of Rusanov::flux() and is
+  //!   used by ALECG. The flux is split into the central flux along the
+  //!   (partial) surface normal and the HLLC upwinding along the weighted
+  //!   normal, i.e., F = Fc(n) + F_HLLC(m) - Fc(m). For internal edges n = m
+  //!   and this is the HLLC flux, while on chare-boundary edges, similar to
+  //!   the dissipation in Rusanov::flux(), the upwinding is computed with the
+  //!   full dual-face normal. As Rusanov::flux(), the result contains the
+  //!   factor 1/2 of the central flux.
+  #pragma omp declare simd
+  static void
+  flux( tk::real nx, tk::real ny, tk::real nz,
+        tk::real mx, tk::real my, tk::real mz,
+        tk::real rL, tk::real ruL, tk::real rvL, tk::real rwL, tk::real reL,
+        tk::real rR, tk::real ruR, tk::real rvR, tk::real rwR, tk::real reR,
+        tk::real& fr, tk::real& fru, tk::real& frv, tk::real& frw,
+        tk::real& fre )
+  {
+    auto ul = ruL/rL;
+    auto vl = rvL/rL;
+    auto wl = rwL/rL;
+
+    auto ur = ruR/rR;
+    auto vr = rvR/rR;
+    auto wr = rwR/rR;
+
+    const auto& mat = eos< tag::compflow >( 0 );
+    auto pl = mat.pressure( rL, ul, vl, wl, reL );
+    auto pr = mat.pressure( rR, ur, vr, wr, reR );
+
+    auto al = mat.soundspeed( rL, pl );
+    auto ar = mat.soundspeed( rR, pr );
+
+    // unit weighted normal
+    tk::real len = tk::length( {mx,my,mz} );
+    tk::real ex = mx/len;
+    tk::real ey = my/len;
+    tk::real ez = mz/len;
+
+    // face-normal velocities
+    tk::real vnl = ul*nx + vl*ny + wl*nz;
+    tk::real vnr = ur*nx + vr*ny + wr*nz;
+    tk::real vml = ul*ex + vl*ey + wl*ez;
+    tk::real vmr = ur*ex + vr*ey + wr*ez;
+
+    // Roe-averaged variables
+    auto rlr = std::sqrt(rR/rL);
+    auto rlr1 = 1.0 + rlr;
+
+    auto vmroe = (vmr*rlr + vml)/rlr1;
+    auto aroe = (ar*rlr + al)/rlr1;
+
+    // Signal velocities
+    auto Sl = std::min( vml-al, vmroe-aroe );
+    auto Sr = std::max( vmr+ar, vmroe+aroe );
+    auto Sm = ( rR*vmr*(Sr-vmr) - rL*vml*(Sl-vml) + pl-pr )
+             /( rR*(Sr-vmr) - rL*(Sl-vml) );
+    auto pStar = rL*(vml-Sl)*(vml-Sm) + pl;
+
+    // Upwind side: left if the contact moves to the right
+    bool left = Sm > 0.0;
+    auto r  = left ? rL : rR;
+    auto ru = left ? ruL : ruR;
+    auto rv = left ? rvL : rvR;
+    auto rw = left ? rwL : rwR;
+    auto re = left ? reL : reR;
+    auto p  = left ? pl : pr;
+    auto vm = left ? vml : vmr;
+    auto S  = left ? Sl : Sr;
+
+    // Upwind state (outside the fan) or star state (inside the fan)
+    tk::real h[5], vs, ps;
+    if (left ? Sl > 0.0 : Sr < 0.0) {
+      h[0] = r;
+      h[1] = ru;
+      h[2] = rv;
+      h[3] = rw;
+      h[4] = re;
+      vs = vm;
+      ps = p;
+    } else {
+      auto d = 1.0/(S-Sm);
+      h[0] = (S-vm) * r * d;
+      h[1] = ((S-vm) * ru + (pStar-p)*ex) * d;
+      h[2] = ((S-vm) * rv + (pStar-p)*ey) * d;
+      h[3] = ((S-vm) * rw + (pStar-p)*ez) * d;
+      h[4] = ((S-vm) * re - p*vm + pStar*Sm) * d;
+      vs = Sm;
+      ps = pStar;
+    }
+
+    // numerical fluxes: central along n, HLLC upwinding along m
+    auto vc = 0.5*(vnl - len*vml);
+    auto vd = 0.5*(vnr - len*vmr);
+    vs *= len;
+    fr  = rL*vc + rR*vd + h[0]*vs;
+    fru = ruL*vc + pl*0.5*(nx-mx) + ruR*vd + pr*0.5*(nx-mx) + h[1]*vs
+          + ps*mx;
+    frv = rvL*vc + pl*0.5*(ny-my) + rvR*vd + pr*0.5*(ny-my) + h[2]*vs
+          + ps*my;
+    frw = rwL*vc + pl*0.5*(nz-mz) + rwR*vd + pr*0.5*(nz-mz) + h[3]*vs
+          + ps*mz;
+    fre = (reL + pl)*vc + (reR + pr)*vd + (h[4] + ps)*vs;
+  }
+
   //! Flux type accessor
   //! \return Flux type
   static ctr::FluxType type() noexcept { return ctr::FluxType::HLLC; }
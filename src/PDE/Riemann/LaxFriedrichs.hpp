@@ -52,11 +52,12 @@ struct LaxFriedrichs {
     auto vr = u[1][2]/rhor;
     auto wr = u[1][3]/rhor;
 
-    auto pl = eos_pressure< tag::compflow >( 0, rhol, ul, vl, wl, u[0][4] );
-    auto pr = eos_pressure< tag::compflow >( 0, rhor, ur, vr, wr, u[1][4] );
+    const auto& mat = eos< tag::compflow >( 0 );
+    auto pl = mat.pressure( rhol, ul, vl, wl, u[0][4] );
+    auto pr = mat.pressure( rhor, ur, vr, wr, u[1][4] );
 
-    auto al = eos_soundspeed< tag::compflow >( 0, rhol, pl );
-    auto ar = eos_soundspeed< tag::compflow >( 0, rhor, pr );
+    auto al = mat.soundspeed( rhol, pl );
+    auto ar = mat.soundspeed( rhor, pr );
 
     // Face-normal velocities
     auto vnl = ul*fn[0] + vl*fn[1] + wl*fn[2];
@@ -71,11 +71,12 @@ struct Rusanov {
     auto vr = rvR/rR;
     auto wr = rwR/rR;
 
-    auto pl = eos_pressure< tag::compflow >( 0, rL, ul, vl, wl, reL );
-    auto pr = eos_pressure< tag::compflow >( 0, rR, ur, vr, wr, reR );
+    const auto& mat = eos< tag::compflow >( 0 );
+    auto pl = mat.pressure( rL, ul, vl, wl, reL );
+    auto pr = mat.pressure( rR, ur, vr, wr, reR );
 
-    auto al = eos_soundspeed< tag::compflow >( 0, rL, pl );
-    auto ar = eos_soundspeed< tag::compflow >( 0, rR, pr );
+    auto al = mat.soundspeed( rL, pl );
+    auto ar = mat.soundspeed( rR, pr );
 
     // dissipation
     real len = tk::length( {mx,my,mz} );
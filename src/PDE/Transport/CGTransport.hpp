@@ -19,9 +19,11 @@
 #include <cmath>
 #include <unordered_set>
 #include <unordered_map>
+#include <functional>
 
 #include "Exception.hpp"
 #include "Vector.hpp"
+#include "ContainerUtil.hpp"
 #include "DerivedData.hpp"
 #include "Around.hpp"
 #include "Reconstruction.hpp"
@@ -193,6 +195,8 @@ class Transport {
     //! \param[in] symbcnode Vector with 1 at symmetry BC nodes
     //! \param[in] vol Nodal volumes
     //! \param[in] edgeid Local node id pair -> edge id map
+    //! \param[in] chbndrhs Function to call once the right-hand side is
+    //!   complete in chare-boundary nodes
     //! \param[in] G Nodal gradients in chare-boundary nodes
     //! \param[in] U Solution vector at recent time step
     //! \param[in,out] R Right-hand side vector computed
@@ -213,6 +217,10 @@ class Transport {
       const std::vector< real >& vol,
       const std::vector< std::size_t >&,
       const std::vector< std::size_t >& edgeid,
+      const std::vector< std::size_t >&,
+      const std::vector< std::size_t >&,
+      std::size_t,
+      const std::function< void() >& chbndrhs,
       const std::unordered_set< std::size_t >&,
       const tk::Fields& G,
       const tk::Fields& U,
@@ -239,6 +247,9 @@ class Transport {
 
       // compute boundary integrals
       bndint( coord, triinpoel, symbcnode, U, R );
+
+      // rhs is complete in all points, including chare-boundary points
+      chbndrhs();
     }
 
     //! Compute right hand side for DiagCG (CG+FCT)
@@ -435,50 +446,67 @@ class Transport {
              const tk::Fields&,
              std::vector< tk::real >& ) const {}
 
-    //! \brief Query Dirichlet boundary condition value on a given side set for
-    //!    all components in this PDE system
+    //! Query nodes at which Dirichlet boundary conditions are set
+    //! \param[in] bnode Local node IDs associated to side set IDs
+    //! \return Unique (local) node IDs at which the user has set Dirichlet
+    //!   boundary conditions for this PDE system on any of the side sets
+    std::vector< std::size_t >
+    dirbcNodes( const std::map< int, std::vector< std::size_t > >& bnode ) const
+    {
+      using tag::param; using tag::transport; using tag::bcdir;
+      std::vector< std::size_t > nodes;
+      const auto& ubc = g_inputdeck.get< param, transport, tag::bc, bcdir >();
+      if (!ubc.empty()) {
+        Assert( ubc.size() > m_system, "Indexing out of Dirichlet BC eq-vector" );
+        for (const auto& b : ubc[m_system]) {
+          auto s = bnode.find( std::stoi(b) );
+          if (s != end(bnode))
+            nodes.insert( end(nodes), begin(s->second), end(s->second) );
+        }
+      }
+      tk::unique( nodes );
+      return nodes;
+    }
+
+    //! Evaluate Dirichlet boundary condition values for all components in
+    //! this PDE system
     //! \param[in] t Physical time
     //! \param[in] deltat Time step size
     //! \param[in] tp Physical time for each mesh node
     //! \param[in] dtp Time step size for each mesh node
-    //! \param[in] ss Pair of side set ID and list of node IDs on the side set
+    //! \param[in] nodes Local node IDs at which to set Dirichlet BCs, as
+    //!   returned by dirbcNodes()
     //! \param[in] coord Mesh node coordinates
-    //! \return Vector of pairs of bool and boundary condition value associated
-    //!   to mesh node IDs at which Dirichlet boundary conditions are set. Note
-    //!   that instead of the actual boundary condition value, we return the
-    //!   increment between t+dt and t, since that is what the solution requires
-    //!   as we solve for the soution increments and not the solution itself.
-    std::map< std::size_t, std::vector< std::pair<bool,real> > >
+    //! \param[in,out] bc Vector of pairs of bool and boundary condition value
+    //!   associated to mesh node IDs at which Dirichlet boundary conditions are
+    //!   set. Must already contain all nodes. Note that instead of the actual
+    //!   boundary condition value, we store the increment between t+deltat and
+    //!   t, since that is what the solution requires as we solve for the
+    //!   soution increments and not the solution itself.
+    void
     dirbc( real t,
            real deltat,
            const std::vector< tk::real >& tp,
            const std::vector< tk::real >& dtp,
-           const std::pair< const int, std::vector< std::size_t > >& ss,
-           const std::array< std::vector< real >, 3 >& coord ) const
+           const std::vector< std::size_t >& nodes,
+           const std::array< std::vector< real >, 3 >& coord,
+           std::unordered_map< std::size_t,
+             std::vector< std::pair< bool, real > > >& bc ) const
     {
-      using tag::param; using tag::transport; using tag::bcdir;
-      using NodeBC = std::vector< std::pair< bool, real > >;
-      std::map< std::size_t, NodeBC > bc;
-      const auto& ubc = g_inputdeck.get< param, transport, tag::bc, bcdir >();
       const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
-      if (!ubc.empty()) {
-        Assert( ubc.size() > m_system, "Indexing out of Dirichlet BC eq-vector" );
-        const auto& x = coord[0];
-        const auto& y = coord[1];
-        const auto& z = coord[2];
-        for (const auto& b : ubc[m_system])
-          if (std::stoi(b) == ss.first)
-            for (auto n : ss.second) {
-              Assert( x.size() > n, "Indexing out of coordinate array" );
-              if (steady) { t = tp[n]; deltat = dtp[n]; }
-              const auto s = solinc( m_system, m_ncomp, x[n], y[n], z[n],
-                                     t, deltat, Problem::initialize );
-              auto& nbc = bc[n] = NodeBC( m_ncomp );
-              for (ncomp_t c=0; c<m_ncomp; ++c)
-                nbc[c] = { true, s[c] };
-            }
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      for (auto n : nodes) {
+        Assert( x.size() > n, "Indexing out of coordinate array" );
+        if (steady) { t = tp[n]; deltat = dtp[n]; }
+        const auto s = solinc( m_system, m_ncomp, x[n], y[n], z[n],
+                               t, deltat, Problem::initialize );
+        auto& nbc = tk::ref_find( bc, n );
+        Assert( nbc.size() >= m_offset+m_ncomp, "Size of NodeBC incorrect" );
+        for (ncomp_t c=0; c<m_ncomp; ++c)
+          nbc[m_offset+c] = { true, s[c] };
       }
-      return bc;
     }
 
     //! Set symmetry boundary conditions at nodes
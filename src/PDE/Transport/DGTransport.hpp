@@ -162,6 +162,8 @@ class Transport {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] invlhs_ls Inverse of least-squares reconstruction lhs matrix
+    //!   of each element, only geometry dependent
     //! \param[in] esup Elements-surrounding-nodes connectivity
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
@@ -171,8 +173,10 @@ class Transport {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&
-                        esup,
+                      const std::vector< std::array< std::array< tk::real, 3 >,
+                        3 > >& invlhs_ls,
+                      const std::pair< std::vector< std::size_t >,
+                        std::vector< std::size_t > >& esup,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
                       tk::Fields& U,
@@ -192,23 +196,16 @@ class Transport {
         Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
                 "Mismatch in inpofa size" );
 
-        // allocate and initialize matrix and vector for reconstruction
-        std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-          lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                            {{0.0, 0.0, 0.0}},
-                            {{0.0, 0.0, 0.0}} }} );
         // specify how many variables need to be reconstructed
         std::array< std::size_t, 2 > varRange {{0, m_ncomp-1}};
 
+        // allocate and initialize vector for reconstruction
         std::vector< std::vector< std::array< tk::real, 3 > > >
           rhs_ls( nelem, std::vector< std::array< tk::real, 3 > >
             ( m_ncomp,
               {{ 0.0, 0.0, 0.0 }} ) );
 
         // reconstruct x,y,z-derivatives of unknowns
-        // 0. get lhs matrix, which is only geometry dependent
-        tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
-
         // 1. internal face contributions
         tk::intLeastSq_P0P1( m_offset, rdof, fd, geoElem, U, rhs_ls, varRange );
 
@@ -218,7 +215,7 @@ class Transport {
             b.first, fd, geoFace, geoElem, t, b.second, P, U, rhs_ls, varRange );
 
         // 3. solve 3x3 least-squares system
-        tk::solveLeastSq_P0P1( m_offset, rdof, lhs_ls, rhs_ls, U, varRange );
+        tk::solveLeastSq_P0P1( m_offset, rdof, invlhs_ls, rhs_ls, U, varRange );
 
         for (std::size_t e=0; e<nelem; ++e)
         {
@@ -255,7 +252,8 @@ class Transport {
                 [[maybe_unused]] const tk::Fields& geoFace,
                 [[maybe_unused]] const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >& esup,
+                const std::pair< std::vector< std::size_t >,
+                  std::vector< std::size_t > >& esup,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
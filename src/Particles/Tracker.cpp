@@ -12,6 +12,8 @@
 */
 // *****************************************************************************
 
+#include <algorithm>
+
 #include "NoWarning/threefry.hpp"
 
 #include "Random123.hpp"
@@ -83,41 +85,103 @@ Tracker::addpar( const std::array< std::vector< tk::real >, 3 >& coord,
 {
   Assert( ps.size() == miss.size(), "Size mismatch" );
 
+  index( coord, inpoel );
+
   std::vector< std::size_t > found; // will store indices of particles found
 
-  // try to find particles received
-  for (std::size_t i=0; i<ps.size(); ++i)
-    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-      std::array< tk::real, 4 > N;
-      auto last = m_particles.nunk();
+  // try to find particles received, only storing those found
+  std::array< tk::real, 4 > N;
+  for (std::size_t i=0; i<ps.size(); ++i) {
+    auto e = locate( coord, inpoel, { ps[i][0], ps[i][1], ps[i][2] },
+                     tk::BVH::npos, N );
+    if (e != tk::BVH::npos) {
       m_particles.push_back( ps[i] );
-      if (parinel( coord, inpoel, last, e, N )) {
-        found.push_back( miss[i] );
-        m_elp.resize( last+1 );
-        m_elp[ last ] = e;
-        e = inpoel.size()/4;
-      } else {
-        m_particles.rm( { last } );
-      }
+      m_elp.push_back( e );
+      found.push_back( miss[i] );
     }
+  }
 
   return found;
 }
 
+void
+Tracker::index( const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Generate particle search data structures if needed
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \details The data structures are generated on first use, e.g., also after
+//!   migration, as they are not migrated, and if the number of elements has
+//!   changed.
+// *****************************************************************************
+{
+  if (inpoel.empty()) return;
+
+  if (m_esuel.size() != inpoel.size())
+    m_esuel = tk::genEsuelTet( inpoel, tk::genEsup( inpoel, 4 ) );
+
+  if (m_bvh.nelem() != inpoel.size()/4) m_bvh.build( coord, inpoel );
+}
+
+std::size_t
+Tracker::locate( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 const std::array< tk::real, 3 >& p,
+                 std::size_t e0,
+                 std::array< tk::real, 4 >& N ) const
+// *****************************************************************************
+//  Find mesh cell containing a point
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] p Point coordinates
+//! \param[in] e0 Mesh cell to start the search from, e.g., where the particle
+//!   has last been found, tk::BVH::npos if unknown
+//! \param[in,out] N Shapefunctions evaluated at the point in the mesh cell
+//!   found
+//! \return Mesh cell containing the point, tk::BVH::npos if not found
+//! \details If a starting cell is given, we first walk from cell to cell,
+//!   always crossing the face opposite the node whose shapefunction is the
+//!   smallest, i.e., the face beyond which the point lies. Particles move
+//!   little per time step, so this usually finds the cell in a few steps. If
+//!   the walk leaves our mesh chunk (the chunk may not be convex) or takes
+//!   too long, we fall back to searching the bounding volume hierarchy.
+// *****************************************************************************
+{
+  // Maximum number of cells to walk through before giving up on walking
+  const std::size_t maxwalk = 64;
+
+  if (e0 < inpoel.size()/4) {
+    auto e = e0;
+    for (std::size_t s=0; s<maxwalk; ++s) {
+      if (parinel( coord, inpoel, p, e, N )) return e;
+      // face f of the cell (tk::lpofa) is opposite node f
+      auto f = static_cast< std::size_t >(
+                 std::min_element( begin(N), end(N) ) - begin(N) );
+      auto n = m_esuel[ e*4+f ];
+      if (n < 0) break;  // walked to the boundary of our mesh chunk
+      e = static_cast< std::size_t >( n );
+    }
+  }
+
+  return m_bvh.find( p, [&]( std::size_t e ){
+                          return parinel( coord, inpoel, p, e, N ); } );
+}
+
 bool
 Tracker::parinel( const std::array< std::vector< tk::real >, 3 >& coord,
                   const std::vector< std::size_t >& inpoel,
-                  std::size_t p,
+                  const std::array< tk::real, 3 >& p,
                   std::size_t e,
                   std::array< tk::real, 4 >& N )
 // *****************************************************************************
-//  Search particle in a single mesh cell
+//  Search point in a single mesh cell
 //! \param[in] coord Mesh node coordinates
 //! \param[in] inpoel Mesh element connectivity
-//! \param[in] p Particle index
+//! \param[in] p Point coordinates
 //! \param[in] e Mesh cell index
-//! \param[in,out] N Shapefunctions evaluated at the particle position
-//! \return True if particle is in mesh cell
+//! \param[in,out] N Shapefunctions evaluated at the point
+//! \return True if point is in mesh cell
 // *****************************************************************************
 {
   // Tetrahedron node indices
@@ -131,10 +195,10 @@ Tracker::parinel( const std::array< std::vector< tk::real >, 3 >& coord,
   const auto& y = coord[1];
   const auto& z = coord[2];
 
-  // Particle coordinates
-  const auto& xp = m_particles(p,0,0);
-  const auto& yp = m_particles(p,1,0);
-  const auto& zp = m_particles(p,2,0);
+  // Point coordinates
+  const auto& xp = p[0];
+  const auto& yp = p[1];
+  const auto& zp = p[2];
 
   // Evaluate linear shapefunctions at particle locations using Cramer's Rule
   //    | xp |   | x1 x2 x3 x4 |   | N1 |
@@ -183,16 +247,9 @@ Tracker::parinel( const std::array< std::vector< tk::real >, 3 >& coord,
   N[2] = DetX3/DetX;
   N[3] = DetX4/DetX;
 
-  // if min( N^i, 1-N^i ) > 0 for all i, particle is in cell
-  if ( std::min(N[0],1.0-N[0]) > 0 && std::min(N[1],1.0-N[1]) > 0 &&
-       std::min(N[2],1.0-N[2]) > 0 && std::min(N[3],1.0-N[3]) > 0 )
-  {
-    m_elp.resize( p+1 );
-    m_elp[ p ] = e; // store element of particle
-    return true;
-  } else {
-    return false;
-  }
+  // if min( N^i, 1-N^i ) > 0 for all i, point is in cell
+  return std::min(N[0],1.0-N[0]) > 0 && std::min(N[1],1.0-N[1]) > 0 &&
+         std::min(N[2],1.0-N[2]) > 0 && std::min(N[3],1.0-N[3]) > 0;
 }
 
 void
@@ -24,6 +24,7 @@
 #include "Keywords.hpp"
 #include "Particles.hpp"
 #include "DerivedData.hpp"
+#include "BVH.hpp"
 #include "ParticleWriter.hpp"
 #include "ContainerUtil.hpp"
 #include "PUPUtil.hpp"
@@ -48,10 +49,37 @@ class Tracker {
       m_parmiss(),
       m_parelse(),
       m_nchpar( 0 ),
-      m_esupel( tk::genEsupel( inpoel, 4, tk::genEsup(inpoel,4) ) ),
+      m_esuel(),
+      m_bvh(),
       m_feedback( feedback )
     {}
 
+    //! Rebuild particle search data structures after the mesh has changed
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    //! \details Call this after mesh refinement, i.e., when the connectivity
+    //!   has changed. If only the node coordinates have changed, e.g., due to
+    //!   mesh motion, call meshMoved() instead, which is cheaper.
+    void meshChanged( const std::array< std::vector< tk::real >, 3 >& coord,
+                      const std::vector< std::size_t >& inpoel )
+    {
+      m_esuel.clear();
+      m_bvh = tk::BVH();
+      index( coord, inpoel );
+    }
+
+    //! Update particle search data structures after mesh motion
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    void meshMoved( const std::array< std::vector< tk::real >, 3 >& coord,
+                    const std::vector< std::size_t >& inpoel )
+    {
+      if (m_bvh.nelem() == inpoel.size()/4)
+        m_bvh.refit( coord, inpoel );
+      else
+        meshChanged( coord, inpoel );
+    }
+
     //! Generate particles to each of our mesh cells
     void
     genpar( const std::array< std::vector< tk::real >, 3 >& coord,
@@ -139,40 +167,20 @@ class Tracker {
                 ChareArray* const array,
                 tk::real dt )
     {
-      // Lambda to attempt to find and advance particle i in element e. Returns
-      // true if the particle was found (and advanced), false if was not found.
+      index( coord, inpoel );
+      // Search cells of our mesh chunk for all particles, starting from the
+      // element where the particle has last been seen
       std::array< tk::real, 4 > N;
-      auto adv = [ this, array, &N, &dt, &coord, &inpoel ]
-                ( std::size_t i, std::size_t e ) -> bool
-      {
-        if (this->parinel( coord, inpoel, i, e, N )) {
-          advanceParticle( array, i, e, dt, N );
-          return true;
-        }
-        return false;
-      };
-      // Search cells of our mesh chunk for all particles
       for (std::size_t i=0; i<m_particles.nunk(); ++i) {
-        // Get element ID where particle i has last been seen
-        bool found = adv( i, m_elp[i] );
-        // Next search in the elements surroundings the points of the element
-        // where the particle has last been found
-        if (!found) {
-          auto last = m_esupel.second[m_elp[i]+1];
-          for (auto j=m_esupel.second[m_elp[i]]+1; j<=last; ++j) {
-            found = adv( i, m_esupel.first[j] );
-            if (found) j = last+1;  // search for next particle
-          }
-        }
-        // Next search all cells in our chunk of the mesh
-        if (!found) {
-          for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-            found = adv( i, e );
-            if (found) e = inpoel.size()/4;  // search for next particle
-          }
-          // If the particle still has not been found, it left our chunk of the
+        auto e = locate( coord, inpoel, { m_particles(i,0,0),
+                         m_particles(i,1,0), m_particles(i,2,0) }, m_elp[i], N );
+        if (e != tk::BVH::npos) {
+          m_elp[i] = e;
+          advanceParticle( array, i, e, dt, N );
+        } else {
+          // If the particle has not been found, it left our chunk of the
           // mesh, mark as missing (will initiate communication to find it)
-          if (!found) m_parmiss.insert( i );
+          m_parmiss.insert( i );
         }
       }
       // If we have no missing particles, we are done, if we do, send out
@@ -328,9 +336,11 @@ class Tracker {
     std::set< std::size_t > m_parelse;
     //! Number of chares we received particles from
     std::size_t m_nchpar;
-    //! Elements surrounding points of elements of mesh chunk we operate on
-    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
-      m_esupel;
+    //! \brief Elements surrounding elements of mesh chunk we operate on, used
+    //!   to walk from element to element towards a particle
+    std::vector< int > m_esuel;
+    //! Bounding volume hierarchy of mesh chunk we operate on
+    tk::BVH m_bvh;
     //! Bool that determines whether to send sub-task feedback to host
     bool m_feedback;
 
@@ -341,12 +351,23 @@ class Tracker {
             const std::vector< std::size_t >& miss,
             const std::vector< std::vector< tk::real > >& ps );
 
-    //! Search particle in a single mesh cell
-    bool parinel( const std::array< std::vector< tk::real >, 3 >& coord,
-                  const std::vector< std::size_t >& inpoel,
-                  std::size_t p,
-                  std::size_t e,
-                  std::array< tk::real, 4 >& N );
+    //! Generate particle search data structures if needed
+    void index( const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoel );
+
+    //! Find mesh cell containing a point
+    std::size_t locate( const std::array< std::vector< tk::real >, 3 >& coord,
+                        const std::vector< std::size_t >& inpoel,
+                        const std::array< tk::real, 3 >& p,
+                        std::size_t e0,
+                        std::array< tk::real, 4 >& N ) const;
+
+    //! Search point in a single mesh cell
+    static bool parinel( const std::array< std::vector< tk::real >, 3 >& coord,
+                         const std::vector< std::size_t >& inpoel,
+                         const std::array< tk::real, 3 >& p,
+                         std::size_t e,
+                         std::array< tk::real, 4 >& N );
 
      //! Apply boundary conditions to particles
     void applyParBC( std::size_t i );
@@ -40,30 +40,42 @@ class Random123 {
     using value_type = typename CBRNG::ctr_type::value_type;
     using arg_type = std::vector< std::array< value_type, CBRNG_DATA_SIZE > >;
 
+    //! Number of random words generated by a single call to the generator
+    static constexpr std::size_t WORDS = ctr_type::static_size;
+
     //! Adaptor to use a std distribution with the Random123 generator
+    //! \details All words of a generated block are handed out before the
+    //!   counter is advanced. Words of the last block not used by the time the
+    //!   adaptor is destroyed are discarded.
     //! \see C++ concepts: UniformRandomNumberGenerator
     struct Adaptor {
       using result_type = unsigned long;
-      Adaptor( CBRNG& r, arg_type& d, int t ) : rng(r), data(d), tid(t) {}
+      Adaptor( CBRNG& r, arg_type& d, int t ) :
+        rng(r), data(d), tid(t), res(), next(WORDS) {}
       static constexpr result_type min() { return 0u; }
       static constexpr result_type max() {
         return std::numeric_limits< result_type >::max();
       }
       result_type operator()()
       {
-        auto& d = data[ static_cast< std::size_t >( tid ) ];
-        d[2] = static_cast< result_type >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
-        auto res = rng( ctr, key );           // generate
-        ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
-        return res[0];
+        if (next == WORDS) {
+          auto& d = data[ static_cast< std::size_t >( tid ) ];
+          d[2] = static_cast< result_type >( tid );
+          ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
+          key_type key = {{ d[2] }};            // assemble key
+          res = rng( ctr, key );                // generate
+          ctr.incr();
+          d[0] = ctr[0];
+          d[1] = ctr[1];
+          next = 0;
+        }
+        return res[ next++ ];
       }
       CBRNG& rng;
       arg_type& data;
       int tid;
+      ctr_type res;
+      std::size_t next;
     };
 
   public:
@@ -79,18 +91,31 @@ class Random123 {
     //! \param[in] tid Thread (or more precisely) stream ID
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
+    //! \details Since counter-based generators have no state other than the
+    //!   counter, the blocks are generated from independent counters, which
+    //!   leaves the loop free of dependencies between iterations so the
+    //!   compiler can vectorize it. All words of each block are used.
     void uniform( int tid, ncomp_t num, double* r ) const {
       auto& d = m_data[ static_cast< std::size_t >( tid ) ];
-      for (ncomp_t i=0; i<num; ++i) {
-        d[2] = static_cast< unsigned long >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
+      d[2] = static_cast< unsigned long >( tid );
+      const key_type key = {{ d[2] }};        // assemble key
+      const auto nblock = num / WORDS;
+      for (ncomp_t b=0; b<nblock; ++b) {
+        ctr_type ctr = {{ d[0] + b, d[1] + (d[0] + b < d[0]) }};
         auto res = m_rng( ctr, key );         // generate
-        r[i] = r123::u01fixedpt< double, value_type >( res[0] );
+        for (std::size_t w=0; w<WORDS; ++w)
+          r[b*WORDS+w] = r123::u01fixedpt< double, value_type >( res[w] );
+      }
+      ctr_type ctr = {{ d[0], d[1] }};        // advance counter
+      ctr.incr( nblock );
+      if (num % WORDS) {                      // remainder: partial block
+        auto res = m_rng( ctr, key );
+        for (std::size_t w=0; w<num%WORDS; ++w)
+          r[nblock*WORDS+w] = r123::u01fixedpt< double, value_type >( res[w] );
         ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
       }
+      d[0] = ctr[0];
+      d[1] = ctr[1];
     }
 
     //! Gaussian RNG: Generate Gaussian random numbers
@@ -0,0 +1,185 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/DenseBins.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Dense array of PDF bins over a box of bin ids
+  \details   Dense array of PDF bins over a box of bin ids. This class stores
+    the sample counters of a D-dimensional PDF in a contiguous array covering
+    a box of bin ids, with the bin id along the first dimension varying
+    fastest. Counting a sample into a bin is a single array access, as opposed
+    to a hash and a lookup in an associative container. The box is grown as
+    needed to cover the samples, as long as the number of bins does not become
+    too large compared to the number of samples, see maxbin(). The PDF
+    estimators, tk::UniPDF, tk::BiPDF, and tk::TriPDF, use this as their main
+    container and fall back to a hash map for samples outside of the box.
+*/
+// *****************************************************************************
+#ifndef DenseBins_h
+#define DenseBins_h
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Dense array of PDF bins over a box of bin ids
+template< std::size_t D >
+class DenseBins {
+
+  public:
+    //! Bin id type
+    using key_type = std::array< long, D >;
+
+    //! Minimum number of bins allowed independent of the number of samples
+    static constexpr std::size_t MinBins = 1UL << 16;
+
+    //! Maximum number of bins allowed given a number of samples
+    //! \param[in] nsample Number of samples
+    //! \return Maximum number of bins allowed
+    static std::size_t maxbin( std::size_t nsample )
+    { return std::max( MinBins, 4*nsample ); }
+
+    //! Empty constructor: no bins
+    explicit DenseBins() : m_lo(), m_n(), m_count() {
+      m_lo.fill( 0 );
+      m_n.fill( 0 );
+    }
+
+    //! Query if there are no bins
+    //! \return True if there are no bins
+    bool empty() const noexcept { return m_count.empty(); }
+
+    //! Query if a bin id is inside the box covered
+    //! \param[in] k Bin id to query
+    //! \return True if bin id k is inside the box covered by the bins
+    bool inside( const key_type& k ) const noexcept {
+      for (std::size_t d=0; d<D; ++d)
+        if (k[d] < m_lo[d] || k[d] >= m_lo[d] + static_cast<long>(m_n[d]))
+          return false;
+      return true;
+    }
+
+    //! Access bin counter
+    //! \param[in] k Bin id, must be inside()
+    //! \return Reference to the counter of bin k
+    tk::real& operator[]( const key_type& k ) {
+      Assert( inside(k), "Bin id outside of dense bins" );
+      return m_count[ index(k) ];
+    }
+
+    //! Grow box of bins to cover a box of bin ids keeping the existing counts
+    //! \param[in] lo Lower corner (inclusive) of the bin ids to cover
+    //! \param[in] hi Upper corner (inclusive) of the bin ids to cover
+    //! \param[in] max Maximum number of bins allowed
+    //! \return True if the bins cover [lo,hi] after the call, false if this
+    //!   would require more than max bins or the box is empty, in which case
+    //!   nothing is changed
+    bool cover( key_type lo, key_type hi, std::size_t max ) {
+      if (!empty()) {
+        if (inside(lo) && inside(hi)) return true;
+        for (std::size_t d=0; d<D; ++d) {
+          lo[d] = std::min( lo[d], m_lo[d] );
+          hi[d] = std::max( hi[d], m_lo[d] + static_cast<long>(m_n[d]) - 1 );
+        }
+      }
+      // count bins in floating point to avoid overflow due to outliers
+      tk::real nbin = 1.0;
+      for (std::size_t d=0; d<D; ++d) {
+        if (hi[d] < lo[d]) return false;
+        nbin *= static_cast< tk::real >( hi[d] ) -
+                static_cast< tk::real >( lo[d] ) + 1.0;
+      }
+      if (nbin > static_cast< tk::real >( max )) return false;
+      DenseBins b;
+      b.m_lo = lo;
+      for (std::size_t d=0; d<D; ++d)
+        b.m_n[d] = static_cast< std::size_t >( hi[d] - lo[d] + 1 );
+      b.m_count.resize( static_cast< std::size_t >( nbin ), 0.0 );
+      foreach( [&]( const key_type& k, tk::real c ){ b[k] = c; } );
+      *this = std::move( b );
+      return true;
+    }
+
+    //! Add counts from other bins
+    //! \param[in] b Bins whose counts to add
+    //! \param[in] max Maximum number of bins allowed
+    //! \return True if the counts have been added, false if covering the bins
+    //!   of b would require more than max bins, in which case nothing is
+    //!   changed
+    bool merge( const DenseBins& b, std::size_t max ) {
+      if (b.empty()) return true;
+      key_type hi;
+      for (std::size_t d=0; d<D; ++d)
+        hi[d] = b.m_lo[d] + static_cast<long>(b.m_n[d]) - 1;
+      if (!cover( b.m_lo, hi, max )) return false;
+      b.foreach( [&]( const key_type& k, tk::real c ){ (*this)[k] += c; } );
+      return true;
+    }
+
+    //! Call a function for all nonzero bins
+    //! \param[in] f Function called as f( const key_type& k, tk::real c ) for
+    //!   all bins k with nonzero count c
+    template< class F >
+    void foreach( F&& f ) const {
+      key_type k = m_lo;
+      for (auto c : m_count) {
+        if (c > 0.0) f( k, c );
+        for (std::size_t d=0; d<D; ++d) {
+          if (++k[d] < m_lo[d] + static_cast<long>(m_n[d])) break;
+          k[d] = m_lo[d];
+        }
+      }
+    }
+
+    //! Zero all bins keeping the box covered
+    void zero() noexcept { std::fill( begin(m_count), end(m_count), 0.0 ); }
+
+    //! Remove all bins
+    void clear() noexcept {
+      m_lo.fill( 0 );
+      m_n.fill( 0 );
+      m_count.clear();
+    }
+
+    /** @name Pack/Unpack: Serialize DenseBins object for Charm++ */
+    ///@{
+    //! Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_lo;
+      p | m_n;
+      p | m_count;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] b DenseBins object reference
+    friend void operator|( PUP::er& p, DenseBins& b ) { b.pup(p); }
+    ///@}
+
+  private:
+    key_type m_lo;                      //!< Lower corner of box of bin ids
+    std::array< std::size_t, D > m_n;   //!< Number of bins in each dimension
+    std::vector< tk::real > m_count;    //!< Sample counters
+
+    //! Compute linear index of bin id
+    //! \param[in] k Bin id
+    //! \return Linear index of bin k into m_count
+    std::size_t index( const key_type& k ) const noexcept {
+      std::size_t i = 0;
+      for (std::size_t d=D; d-->0; )
+        i = i*m_n[d] + static_cast< std::size_t >( k[d] - m_lo[d] );
+      return i;
+    }
+};
+
+} // tk::
+
+#endif // DenseBins_h
@@ -16,6 +16,8 @@
 // *****************************************************************************
 
 #include <map>
+#include <array>
+#include <tuple>
 #include <iterator>
 #include <utility>
 #include <algorithm>
@@ -38,7 +40,9 @@ Statistics::Statistics( const tk::Particles& particles,
                         const ctr::OffsetMap& offset,
                         const std::vector< ctr::Product >& stat,
                         const std::vector< ctr::Probability >& pdf,
-                        const std::vector< std::vector< tk::real > >& binsize )
+                        const std::vector< std::vector< tk::real > >& binsize,
+                        const std::vector< std::vector< tk::real > >& extents,
+                        bool onepass )
   : m_particles( particles ),
     m_instOrd(),
     m_ordinary(),
@@ -48,6 +52,18 @@ Statistics::Statistics( const tk::Particles& particles,
     m_central(),
     m_ctr(),
     m_ncen( 0 ),
+    m_onepass( onepass ),
+    m_ordPlan(),
+    m_ordNode(),
+    m_ordSum(),
+    m_cenPlan(),
+    m_cenNode(),
+    m_cenSum(),
+    m_cenSub(),
+    m_refVar(),
+    m_ref(),
+    m_cenRef(),
+    m_val(),
     m_instOrdUniPDF(),
     m_ordupdf(),
     m_instCenUniPDF(),
@@ -70,12 +86,17 @@ Statistics::Statistics( const tk::Particles& particles,
 //! \param[in] stat List of requested statistical moments
 //! \param[in] pdf List of requested probability density functions (PDF)
 //! \param[in] binsize List of binsize vectors configuring the PDF estimators
+//! \param[in] extents List of user-specified sample space extents for the PDF
+//!   estimators, empty vectors for PDFs without user-specified extents
+//! \param[in] onepass True to estimate central moments without a second pass
+//!   over the particles, see accumulateCen()
 // *****************************************************************************
 {
   // Prepare for computing ordinary and central moments, PDFs
   setupOrdinary( offset, stat );
   setupCentral( offset, stat );
-  setupPDF( offset, pdf, binsize );
+  setupPDF( offset, pdf, binsize, extents );
+  setupPlan();
 }
 
 void
@@ -162,28 +183,35 @@ Statistics::setupCentral( const ctr::OffsetMap& offset,
 void
 Statistics::setupPDF( const ctr::OffsetMap& offset,
                       const std::vector< ctr::Probability >& pdf,
-                      const std::vector< std::vector< tk::real > >& binsize )
+                      const std::vector< std::vector< tk::real > >& binsize,
+                      const std::vector< std::vector< tk::real > >& extents )
 // *****************************************************************************
 //  Prepare for computing PDFs
 //! \param[in] offset Map of offsets in memory to address variable fields
 //! \param[in] pdf List of requested probability density functions (PDF)
 //! \param[in] binsize List of binsize vectors configuring the PDF estimators
+//! \param[in] extents List of user-specified sample space extents for the PDF
+//!   estimators, empty vectors for PDFs without user-specified extents
 // *****************************************************************************
 {
+  Assert( binsize.size() == extents.size(),
+          "Length of binsize vector and that of PDF extents must equal" );
+
   std::size_t i = 0;
   for (const auto& probability : pdf) {
     if (ordinary(probability)) {
 
       // Detect number of sample space dimensions and create ordinary PDFs
-      const auto& bs = binsize[i++];
+      const auto& bs = binsize[i];
+      const auto& ext = extents[i++];
       if (bs.size() == 1) {
-        m_ordupdf.emplace_back( bs[0] );
+        m_ordupdf.emplace_back( bs[0], ext );
         m_instOrdUniPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 2) {
-        m_ordbpdf.emplace_back( bs );
+        m_ordbpdf.emplace_back( bs, ext );
         m_instOrdBiPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 3) {
-        m_ordtpdf.emplace_back( bs );
+        m_ordtpdf.emplace_back( bs, ext );
         m_instOrdTriPDF.emplace_back( std::vector< const tk::real* >() );
       }
 
@@ -202,17 +230,18 @@ Statistics::setupPDF( const ctr::OffsetMap& offset,
       // Detect number of sample space dimensions and create central PDFs,
       // create new storage for instantaneous variable pointer, create new
       // storage for center pointer
-      const auto& bs = binsize[i++];
+      const auto& bs = binsize[i];
+      const auto& ext = extents[i++];
       if (bs.size() == 1) {
-        m_cenupdf.emplace_back( bs[0] );
+        m_cenupdf.emplace_back( bs[0], ext );
         m_instCenUniPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrUniPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 2) {
-        m_cenbpdf.emplace_back( bs );
+        m_cenbpdf.emplace_back( bs, ext );
         m_instCenBiPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrBiPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 3) {
-        m_centpdf.emplace_back( bs );
+        m_centpdf.emplace_back( bs, ext );
         m_instCenTriPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrTriPDF.emplace_back( std::vector< const tk::real* >() );
       }
@@ -241,6 +270,145 @@ Statistics::setupPDF( const ctr::OffsetMap& offset,
   }
 }
 
+void
+Statistics::setupPlan()
+// *****************************************************************************
+//  Setup plans evaluating the products required for the moments
+//! \details The terms of each product are sorted so that products sharing
+//!   terms, e.g., <XY> and <XYZ>, or <xx>, <xxy>, and <xxz>, share the nodes
+//!   computing their common leading terms and each distinct sub-product is
+//!   evaluated only once per particle. If m_onepass, the ordinary plan also
+//!   contains the products of all subsets of the terms of the central moments,
+//!   with the fluctuating terms shifted by per-PE reference values, see
+//!   accumulateCen(), and no central plan is built.
+// *****************************************************************************
+{
+  using Term = std::pair< const tk::real*, const tk::real* >;
+  using Key = std::tuple< std::size_t, const tk::real*, const tk::real* >;
+
+  // Find or append the nodes computing a product, return its last node
+  auto product = []( std::vector< Node >& plan,
+                     std::map< Key, std::size_t >& idx,
+                     std::vector< Term > terms )
+  {
+    std::sort( begin(terms), end(terms) );
+    auto n = npos;
+    for (const auto& [ var, ctr ] : terms) {
+      auto it = idx.find( Key{ n, var, ctr } );
+      if (it == end(idx)) {
+        it = idx.emplace( Key{ n, var, ctr }, plan.size() ).first;
+        plan.push_back( { n, var, ctr } );
+      }
+      n = it->second;
+    }
+    return n;
+  };
+
+  std::map< Key, std::size_t > ordIdx, cenIdx;
+
+  for (const auto& inst : m_instOrd) {
+    std::vector< Term > terms;
+    for (auto v : inst) terms.emplace_back( v, nullptr );
+    m_ordNode.push_back( product( m_ordPlan, ordIdx, std::move(terms) ) );
+  }
+
+  // Center of terms of central moments that are full variables
+  const auto zero = m_ordinary.data() + m_nord;
+
+  // Collect the variables of fluctuating terms to be shifted if m_onepass.
+  // Their reference values are allocated before taking their addresses.
+  if (m_onepass) {
+    for (std::size_t i=0; i<m_ncen; ++i)
+      for (std::size_t j=0; j<m_instCen[i].size(); ++j)
+        if (m_ctr[i][j] != zero &&
+            std::find( begin(m_refVar), end(m_refVar), m_instCen[i][j] ) ==
+              end(m_refVar))
+          m_refVar.push_back( m_instCen[i][j] );
+    m_ref.assign( m_refVar.size(), 0.0 );
+  }
+
+  // Return the reference value about which a variable is shifted
+  auto ref = [&]( const tk::real* v ) {
+    auto it = std::find( begin(m_refVar), end(m_refVar), v );
+    Assert( it != end(m_refVar), "No reference value for variable" );
+    return m_ref.data() + std::distance( begin(m_refVar), it );
+  };
+
+  for (std::size_t i=0; i<m_ncen; ++i) {
+    const auto& inst = m_instCen[i];
+    const auto& ctr = m_ctr[i];
+    if (m_onepass) {
+      Assert( inst.size() <= 16, "Too many terms for one-pass central moment" );
+      // Subsets of terms without a full variable have zero coefficient
+      std::size_t full = 0;
+      m_cenRef.emplace_back();
+      for (std::size_t j=0; j<inst.size(); ++j)
+        if (ctr[j] == zero) {
+          full |= 1UL << j;
+          m_cenRef.back().push_back( nullptr );
+        } else {
+          m_cenRef.back().push_back( ref( inst[j] ) );
+        }
+      const auto& cref = m_cenRef.back();
+      const auto fluc = ((1UL << inst.size()) - 1) & ~full;
+      m_cenSub.emplace_back( 1UL << inst.size(), npos );
+      for (auto sub = fluc; ; sub = (sub - 1) & fluc) {
+        const auto s = sub | full;
+        std::vector< Term > terms;
+        for (std::size_t j=0; j<inst.size(); ++j)
+          if (s & (1UL << j)) terms.emplace_back( inst[j], cref[j] );
+        if (!terms.empty())
+          m_cenSub.back()[s] = product( m_ordPlan, ordIdx, std::move(terms) );
+        if (!sub) break;
+      }
+    } else {
+      std::vector< Term > terms;
+      for (std::size_t j=0; j<inst.size(); ++j)
+        terms.emplace_back( inst[j], ctr[j] == zero ? nullptr : ctr[j] );
+      m_cenNode.push_back( product( m_cenPlan, cenIdx, std::move(terms) ) );
+    }
+  }
+}
+
+void
+Statistics::evaluate( const std::vector< Node >& plan,
+                      std::vector< tk::real >& sum )
+// *****************************************************************************
+//  Sum the values of all nodes of a plan over all particles
+//! \param[in] plan Plan whose nodes to evaluate
+//! \param[in,out] sum Sums of the values of the nodes over all particles
+//! \details The particles are processed in blocks of BLOCK particles. For each
+//!   node the variable is gathered for the block into a contiguous array and
+//!   multiplied by the values of its parent node, computed earlier for the
+//!   same block, so the inner loops vectorize. The sum over each block is
+//!   added to the total, which also reduces the round-off error of the sum.
+// *****************************************************************************
+{
+  sum.assign( plan.size(), 0.0 );
+  m_val.resize( plan.size() * BLOCK );
+
+  const auto npar = m_particles.nunk();
+  for (std::size_t p=0; p<npar; p+=BLOCK) {
+    const auto nb = std::min( BLOCK, npar-p );
+    for (std::size_t n=0; n<plan.size(); ++n) {
+      const auto& node = plan[n];
+      auto v = m_val.data() + n*BLOCK;
+      for (std::size_t b=0; b<nb; ++b) v[b] = m_particles.var( node.var, p+b );
+      if (node.ctr) {
+        const auto c = *node.ctr;
+        for (std::size_t b=0; b<nb; ++b) v[b] -= c;
+      }
+      if (node.parent != npos) {
+        const auto u = m_val.data() + node.parent*BLOCK;
+        for (std::size_t b=0; b<nb; ++b) v[b] *= u[b];
+      }
+      tk::real s = 0.0;
+      for (std::size_t b=0; b<nb; ++b) s += v[b];
+      sum[n] += s;
+    }
+  }
+}
+
 std::size_t
 Statistics::mean( const tk::ctr::Term& term ) const
 // *****************************************************************************
@@ -269,22 +437,16 @@ Statistics::accumulateOrd()
   feholdexcept( &fe );
 
   if (m_nord) {
-    // Zero ordinary moment accumulators
-    std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
+    // Take reference values of the shifted variables from the first particle
+    if (m_particles.nunk())
+      for (std::size_t k=0; k<m_refVar.size(); ++k)
+        m_ref[k] = m_particles.var( m_refVar[k], 0 );
 
     // Accumulate sum for ordinary moments. This is a partial sum, so no
     // division by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      for (std::size_t i=0; i<m_nord; ++i) {
-       auto prod = m_particles.var( m_instOrd[i][0], p );
-        const auto s = m_instOrd[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instOrd[i][j], p );
-        }
-        m_ordinary[i] += prod;
-      }
-    }
+    evaluate( m_ordPlan, m_ordSum );
+    for (std::size_t i=0; i<m_nord; ++i)
+      m_ordinary[i] = m_ordSum[ m_ordNode[i] ];
   }
 
   feclearexcept( FE_UNDERFLOW );
@@ -303,27 +465,44 @@ Statistics::accumulateCen( const std::vector< tk::real >& om )
 //!   PEs and thus are the same to be passed here on all PEs. For example
 //!   client-code, see walker::Distributor.
 //! \param[in] om Ordinary moments
+//! \details If m_onepass, the partial sums of the central moments are not
+//!   accumulated over the particles, but computed from the partial sums of
+//!   the products of all subsets of their terms, summed in accumulateOrd(),
+//!   by expanding the product of the fluctuations. The fluctuating terms are
+//!   summed about reference values, X-K, where K is the value on the first
+//!   particle on this PE, so the sums are of the magnitude of the
+//!   fluctuations even if the means are large, e.g., with d = K-<X>,
+//!   sum (X-<X>)^2 = sum (X-K)^2 + 2 d sum (X-K) + d^2 npar.
 // *****************************************************************************
 {
   if (m_ncen) {
     // Overwrite ordinary moments by those computed across all PEs
     for (std::size_t i=0; i<om.size(); ++i) m_ordinary[i] = om[i];
 
-    // Zero central moment accumulators
-    std::fill( begin(m_central), end(m_central), 0.0 );
-
     // Accumulate sum for central moments. This is a partial sum, so no division
     // by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
+    if (m_onepass) {
+      const auto npar = static_cast< tk::real >( m_particles.nunk() );
       for (std::size_t i=0; i<m_ncen; ++i) {
-        auto prod = m_particles.var( m_instCen[i][0], p ) - *(m_ctr[i][0]);
-        const auto s = m_instCen[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instCen[i][j], p ) - *(m_ctr[i][j]);
+        const auto& ctr = m_ctr[i];
+        const auto& ref = m_cenRef[i];
+        const auto& sub = m_cenSub[i];
+        tk::real c = 0.0;
+        for (std::size_t s=0; s<sub.size(); ++s) {
+          if (s && sub[s] == npos) continue;
+          auto v = s ? m_ordSum[ sub[s] ] : npar;
+          // terms not in the subset are fluctuations, except in the empty
+          // subset, whose coefficient is zero if there is a full variable
+          for (std::size_t j=0; j<ctr.size(); ++j)
+            if (!(s & (1UL << j))) v *= ref[j] ? *(ref[j]) - *(ctr[j]) : 0.0;
+          c += v;
         }
-        m_central[i] += prod;
+        m_central[i] = c;
       }
+    } else {
+      evaluate( m_cenPlan, m_cenSum );
+      for (std::size_t i=0; i<m_ncen; ++i)
+        m_central[i] = m_cenSum[ m_cenNode[i] ];
     }
   }
 }
@@ -340,29 +519,30 @@ Statistics::accumulateOrdPDF()
     for (auto& pdf : m_ordbpdf) pdf.zero();
     for (auto& pdf : m_ordtpdf) pdf.zero();
 
-    // Accumulate partial sum for PDFs
+    // Accumulate partial sum for PDFs, all particles in a single batch
     const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      std::size_t i = 0;
-      // Accumulate partial sum for univariate PDFs
-      for (auto& pdf : m_ordupdf) {
-        pdf.add( m_particles.var( m_instOrdUniPDF[i++][0], p ) );
-      }
-      // Accumulate partial sum for bivariate PDFs
-      i = 0;
-      for (auto& pdf : m_ordbpdf) {
-        const auto inst = m_instOrdBiPDF[i++];
-        pdf.add( {{ m_particles.var( inst[0], p ),
-                    m_particles.var( inst[1], p ) }} );
-      }
-      // Accumulate partial sum for trivariate PDFs
-      i = 0;
-      for (auto& pdf : m_ordtpdf) {
-        const auto inst = m_instOrdTriPDF[i++];
-        pdf.add( {{ m_particles.var( inst[0], p ),
+    // Accumulate partial sum for univariate PDFs
+    for (std::size_t i=0; i<m_ordupdf.size(); ++i) {
+      const auto& inst = m_instOrdUniPDF[i];
+      m_ordupdf[i].add( npar, [&]( std::size_t p ){
+        return m_particles.var( inst[0], p ); } );
+    }
+    // Accumulate partial sum for bivariate PDFs
+    for (std::size_t i=0; i<m_ordbpdf.size(); ++i) {
+      const auto& inst = m_instOrdBiPDF[i];
+      m_ordbpdf[i].add( npar,
+        [&]( std::size_t p ) -> std::array< tk::real, 2 > {
+          return {{ m_particles.var( inst[0], p ),
+                    m_particles.var( inst[1], p ) }}; } );
+    }
+    // Accumulate partial sum for trivariate PDFs
+    for (std::size_t i=0; i<m_ordtpdf.size(); ++i) {
+      const auto& inst = m_instOrdTriPDF[i];
+      m_ordtpdf[i].add( npar,
+        [&]( std::size_t p ) -> std::array< tk::real, 3 > {
+          return {{ m_particles.var( inst[0], p ),
                     m_particles.var( inst[1], p ),
-                    m_particles.var( inst[2], p ) }} );
-      }
+                    m_particles.var( inst[2], p ) }}; } );
     }
   }
 }
@@ -390,35 +570,36 @@ Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
     for (auto& pdf : m_cenbpdf) pdf.zero();
     for (auto& pdf : m_centpdf) pdf.zero();
 
-    // Accumulate partial sum for PDFs
+    // Accumulate partial sum for PDFs, all particles in a single batch
     const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      std::size_t i = 0;
-      // Accumulate partial sum for univariate PDFs
-      for (auto& pdf : m_cenupdf) {
-        pdf.add(
-          m_particles.var( m_instCenUniPDF[i][0], p ) - *(m_ctrUniPDF[i][0]) );
-        ++i;
-      }
-      // Accumulate partial sum for bivariate PDFs
-      i = 0;
-      for (auto& pdf : m_cenbpdf) {
-        const auto& inst = m_instCenBiPDF[i];
-        const auto& cen = m_ctrBiPDF[i];
-        pdf.add( {{ m_particles.var( inst[0], p ) - *(cen[0]),
-                    m_particles.var( inst[1], p ) - *(cen[1]) }} );
-        ++i;
-      }
-      // Accumulate partial sum for trivariate PDFs
-      i = 0;
-      for (auto& pdf : m_centpdf) {
-        const auto inst = m_instCenTriPDF[i];
-        const auto& cen = m_ctrTriPDF[i];
-        pdf.add( {{ m_particles.var( inst[0], p ) - *(cen[0]),
-                    m_particles.var( inst[1], p ) - *(cen[1]),
-                    m_particles.var( inst[2], p ) - *(cen[2]) }} );
-        ++i;
-      }
+    // Accumulate partial sum for univariate PDFs
+    for (std::size_t i=0; i<m_cenupdf.size(); ++i) {
+      const auto& inst = m_instCenUniPDF[i];
+      const auto c = *(m_ctrUniPDF[i][0]);
+      m_cenupdf[i].add( npar, [&]( std::size_t p ){
+        return m_particles.var( inst[0], p ) - c; } );
+    }
+    // Accumulate partial sum for bivariate PDFs
+    for (std::size_t i=0; i<m_cenbpdf.size(); ++i) {
+      const auto& inst = m_instCenBiPDF[i];
+      const std::array< tk::real, 2 > c{{ *(m_ctrBiPDF[i][0]),
+                                          *(m_ctrBiPDF[i][1]) }};
+      m_cenbpdf[i].add( npar,
+        [&]( std::size_t p ) -> std::array< tk::real, 2 > {
+          return {{ m_particles.var( inst[0], p ) - c[0],
+                    m_particles.var( inst[1], p ) - c[1] }}; } );
+    }
+    // Accumulate partial sum for trivariate PDFs
+    for (std::size_t i=0; i<m_centpdf.size(); ++i) {
+      const auto& inst = m_instCenTriPDF[i];
+      const std::array< tk::real, 3 > c{{ *(m_ctrTriPDF[i][0]),
+                                          *(m_ctrTriPDF[i][1]),
+                                          *(m_ctrTriPDF[i][2]) }};
+      m_centpdf[i].add( npar,
+        [&]( std::size_t p ) -> std::array< tk::real, 3 > {
+          return {{ m_particles.var( inst[0], p ) - c[0],
+                    m_particles.var( inst[1], p ) - c[1],
+                    m_particles.var( inst[2], p ) - c[2] }}; } );
     }
   }
 }
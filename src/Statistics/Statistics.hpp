@@ -65,6 +65,7 @@
 
 #include <vector>
 #include <cstddef>
+#include <limits>
 
 #include "Types.hpp"
 #include "StatCtr.hpp"
@@ -85,7 +86,9 @@ class Statistics {
                          const ctr::OffsetMap& offset,
                          const std::vector< ctr::Product >& stat,
                          const std::vector< ctr::Probability >& pdf,
-                         const std::vector< std::vector< tk::real > >& binsize );
+                         const std::vector< std::vector< tk::real > >& binsize,
+                         const std::vector< std::vector< tk::real > >& extents,
+                         bool onepass );
 
     //! Accumulate (i.e., only do the sum for) ordinary moments
     void accumulateOrd();
@@ -137,9 +140,33 @@ class Statistics {
     //! Setup PDFs
     void setupPDF( const ctr::OffsetMap& offset,
                    const std::vector< ctr::Probability >& pdf,
-                   const std::vector< std::vector< tk::real > >& binsize  );
+                   const std::vector< std::vector< tk::real > >& binsize,
+                   const std::vector< std::vector< tk::real > >& extents );
+
+    //! Setup plans evaluating the products required for the moments
+    void setupPlan();
     ///@}
 
+    //! Value denoting no node in a plan
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    //! Number of particles whose products are evaluated at a time
+    static constexpr std::size_t BLOCK = 64;
+
+    //! \brief Node of a plan evaluating products for statistical moments
+    //! \details The value of a node is the value of its parent node (if any)
+    //!   times the instantaneous variable of the node minus its center (if any).
+    //!   Products that share leading terms share the nodes computing them.
+    struct Node {
+      std::size_t parent;       //!< Parent node, npos if none
+      const tk::real* var;      //!< Instantaneous variable
+      const tk::real* ctr;      //!< Center, nullptr if none
+    };
+
+    //! Sum the values of all nodes of a plan over all particles
+    void evaluate( const std::vector< Node >& plan,
+                   std::vector< tk::real >& sum );
+
     //! Return mean for fluctuation
     std::size_t mean(const tk::ctr::Term& term) const;
 
@@ -167,6 +194,38 @@ class Statistics {
     std::size_t m_ncen;
     ///@}
 
+    /** @name Data for fused evaluation of statistical moments */
+    ///@{
+    //! True to estimate central moments from sums of products of full variables
+    bool m_onepass;
+    //! Plan of products of full variables to sum over the particles
+    std::vector< Node > m_ordPlan;
+    //! Nodes of m_ordPlan corresponding to the ordinary moments
+    std::vector< std::size_t > m_ordNode;
+    //! Sums of the nodes of m_ordPlan over the particles
+    std::vector< tk::real > m_ordSum;
+    //! Plan of products of centered variables to sum over the particles
+    std::vector< Node > m_cenPlan;
+    //! Nodes of m_cenPlan corresponding to the central moments
+    std::vector< std::size_t > m_cenNode;
+    //! Sums of the nodes of m_cenPlan over the particles
+    std::vector< tk::real > m_cenSum;
+    //! \brief Nodes of m_ordPlan for the subsets of the terms of the central
+    //!   moments if m_onepass, indexed by the bit mask of the subset, npos for
+    //!   the empty subset and subsets whose coefficient is zero
+    std::vector< std::vector< std::size_t > > m_cenSub;
+    //! \brief Variables of the fluctuating terms of the central moments whose
+    //!   products m_ordPlan sums about a reference value if m_onepass
+    std::vector< const tk::real* > m_refVar;
+    //! Reference values of m_refVar on this PE, taken from its first particle
+    std::vector< tk::real > m_ref;
+    //! \brief Reference values of the terms of the central moments if
+    //!   m_onepass, nullptr for terms that are full variables
+    std::vector< std::vector< const tk::real* > > m_cenRef;
+    //! Values of the nodes of a plan for a block of particles
+    std::vector< tk::real > m_val;
+    ///@}
+
     /** @name Data for univariate probability density function estimation */
     ///@{
     //! Instantaneous variable pointers for computing ordinary univariate PDFs
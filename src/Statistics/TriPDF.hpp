@@ -8,9 +8,12 @@
   \brief     Joint trivariate PDF estimator
   \details   Joint trivariate PDF estimator. This class can be used to estimate
     a joint probability density function (PDF) of three scalar variables from an
-    ensemble. The implementation uses the standard container std::unordered_map,
-    which is a hash-based associative container with linear algorithmic
-    complexity for insertion of a new sample.
+    ensemble. Samples are counted into a dense array of bins, tk::DenseBins,
+    covering the sample space extents of the samples added in a batch or the
+    extents given by the user. Samples outside of the dense bins are counted
+    into the standard container std::unordered_map, which is a hash-based
+    associative container with linear algorithmic complexity for insertion of
+    a new sample.
 */
 // *****************************************************************************
 #ifndef TriPDF_h
@@ -18,10 +21,13 @@
 
 #include <array>
 #include <unordered_map>
+#include <vector>
 #include <algorithm>
+#include <cfenv>
 
 #include "Types.hpp"
 #include "PUPUtil.hpp"
+#include "DenseBins.hpp"
 
 namespace tk {
 
@@ -55,14 +61,30 @@ class TriPDF {
     using map_type = std::unordered_map< key_type, tk::real, key_hash >;
 
     //! Empty constructor for Charm++
-    explicit TriPDF() : m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_pdf() {}
+    explicit TriPDF() : m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_pdf(),
+      m_dense() {}
 
     //! Constructor: Initialize joint trivariate PDF container
     //! \param[in] bs Sample space bin size in all three directions
-    explicit TriPDF( const std::vector< tk::real >& bs ) :
+    //! \param[in] ext Optional user-specified sample space extents,
+    //!   {xmin,xmax,ymin,ymax,zmin,zmax}, used to allocate the dense bins
+    //!   upfront
+    explicit TriPDF( const std::vector< tk::real >& bs,
+                     const std::vector< tk::real >& ext = {} ) :
       m_binsize( {{ bs[0], bs[1], bs[2] }} ),
       m_nsample( 0 ),
-      m_pdf() {}
+      m_pdf(),
+      m_dense()
+    {
+      if (ext.size() == 2*dim) {
+        key_type lo, hi;
+        for (std::size_t d=0; d<dim; ++d) {
+          lo[d] = std::lround( ext[d*2] / bs[d] );
+          hi[d] = std::lround( ext[d*2+1] / bs[d] );
+        }
+        m_dense.cover( lo, hi, DenseBins< dim >::maxbin( 0 ) );
+      }
+    }
 
     //! Accessor to number of samples
     //! \return Number of samples collected
@@ -72,9 +94,47 @@ class TriPDF {
     //! \param[in] sample Sample to add
     void add( std::array< tk::real, dim > sample ) {
       ++m_nsample;
-      ++m_pdf[ {{ std::lround( sample[0] / m_binsize[0] ),
-                  std::lround( sample[1] / m_binsize[1] ),
-                  std::lround( sample[2] / m_binsize[2] ) }} ];
+      key_type b{{ std::lround( sample[0] / m_binsize[0] ),
+                   std::lround( sample[1] / m_binsize[1] ),
+                   std::lround( sample[2] / m_binsize[2] ) }};
+      if (m_dense.inside( b )) ++m_dense[ b ]; else ++m_pdf[ b ];
+    }
+
+    //! Add a batch of samples to trivariate PDF
+    //! \param[in] n Number of samples to add
+    //! \param[in] sample Function called as
+    //!   std::array< tk::real, dim > sample( std::size_t i ), returning sample
+    //!   i, i=0...n-1
+    //! \details The bin ids of all samples are computed first, holding the
+    //!   floating point environment once for the whole batch. The dense bins
+    //!   are then grown to cover the extents of the batch, unless that would
+    //!   require too many bins, and the samples are counted into the dense
+    //!   bins. Only samples outside of the dense bins are counted into the map.
+    template< class Sample >
+    void add( std::size_t n, const Sample& sample ) {
+      if (n == 0) return;
+      m_nsample += n;
+      std::vector< key_type > bin( n );
+      fenv_t fe;
+      feholdexcept( &fe );
+      for (std::size_t i=0; i<n; ++i) {
+        const auto s = sample(i);
+        for (std::size_t d=0; d<dim; ++d)
+          bin[i][d] = std::lround( s[d] / m_binsize[d] );
+      }
+      feclearexcept( FE_UNDERFLOW );
+      feupdateenv( &fe );
+      key_type lo = bin[0], hi = bin[0];
+      for (const auto& b : bin)
+        for (std::size_t d=0; d<dim; ++d) {
+          lo[d] = std::min( lo[d], b[d] );
+          hi[d] = std::max( hi[d], b[d] );
+        }
+      if (m_dense.cover( lo, hi, DenseBins< dim >::maxbin( m_nsample ) ))
+        for (const auto& b : bin) ++m_dense[ b ];
+      else
+        for (const auto& b : bin)
+          if (m_dense.inside( b )) ++m_dense[ b ]; else ++m_pdf[ b ];
     }
 
     //! Add multiple samples from a PDF
@@ -82,15 +142,31 @@ class TriPDF {
     void addPDF( const TriPDF& p ) {
       m_binsize = p.binsize();
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      if (!m_dense.merge( p.m_dense, DenseBins< dim >::maxbin( m_nsample ) ))
+        p.m_dense.foreach( [&]( const key_type& k, tk::real c ){
+                             m_pdf[ k ] += c; } );
+      for (const auto& e : p.m_pdf) m_pdf[ e.first ] += e.second;
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
+    void zero() noexcept { m_nsample = 0; m_pdf.clear(); m_dense.zero(); }
+
+    //! Move the nonzero dense bins to the map and remove the dense bins
+    //! \details Must be called before map() and extents(). Samples added
+    //!   afterwards are counted into the map until the dense bins are grown
+    //!   again by a batch add().
+    void flush() {
+      m_dense.foreach( [&]( const key_type& k, tk::real c ){ m_pdf[k] += c; } );
+      m_dense.clear();
+    }
 
     //! Constant accessor to underlying PDF map
     //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    //! \pre The dense bins have been flushed to the map by flush()
+    const map_type& map() const {
+      Assert( m_dense.empty(), "Dense bins not flushed" );
+      return m_pdf;
+    }
 
     //! Constant accessor to bin sizes
     //! \return Constant reference to sample space bin sizes
@@ -100,15 +176,17 @@ class TriPDF {
     //! \brief Return minimum and maximum bin ids of sample space in all three
     //!   dimensions
     //! \return {xmin,xmax,ymin,ymax,zmin,zmax} Minima and maxima of bin the ids
+    //! \pre The dense bins have been flushed to the map by flush()
     std::array< long, 2*dim > extents() const {
-      Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
+      const auto& pdf = map();
+      Assert( !pdf.empty(), "PDF empty" );
+      auto x = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[0] < b.first[0]; } );
-      auto y = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto y = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[1] < b.first[1]; } );
-      auto z = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto z = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[2] < b.first[2]; } );
       return {{ x.first->first[0], x.second->first[0],
@@ -124,6 +202,7 @@ class TriPDF {
       p | m_binsize;
       p | m_nsample;
       p | m_pdf;
+      p | m_dense;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -134,7 +213,10 @@ class TriPDF {
   private:
     std::array< tk::real, dim > m_binsize;   //!< Sample space bin sizes
     std::size_t m_nsample;                   //!< Number of samples collected
-    map_type m_pdf;                          //!< Probability density function
+    //! Probability density function: bins outside of m_dense
+    map_type m_pdf;
+    //! Probability density function: dense bins
+    DenseBins< dim > m_dense;
 };
 
 } // tk::
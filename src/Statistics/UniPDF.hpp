@@ -8,9 +8,11 @@
   \brief     Univariate PDF estimator
   \details   Univariate PDF estimator. This class can be used to estimate a
     probability density function of (PDF) a scalar variable from an ensemble.
-    The implementation uses the standard container std::unordered_map, which is
-    a hash-based associative container with linear algorithmic complexity for
-    insertion of a new sample.
+    Samples are counted into a dense array of bins, tk::DenseBins, covering the
+    sample space extents of the samples added in a batch or the extents given
+    by the user. Samples outside of the dense bins are counted into the
+    standard container std::unordered_map, which is a hash-based associative
+    container with linear algorithmic complexity for insertion of a new sample.
 */
 // *****************************************************************************
 #ifndef UniPDF_h
@@ -19,11 +21,14 @@
 #include <array>
 #include <unordered_map>
 #include <algorithm>
+#include <numeric>
+#include <vector>
 #include <cfenv>
 
 #include "Types.hpp"
 #include "Exception.hpp"
 #include "PUPUtil.hpp"
+#include "DenseBins.hpp"
 
 namespace tk {
 
@@ -48,12 +53,21 @@ class UniPDF {
     using map_type = std::unordered_map< key_type, tk::real >;
 
     //! Empty constructor for Charm++
-    explicit UniPDF() : m_binsize( 0 ), m_nsample( 0 ), m_pdf() {}
+    explicit UniPDF() : m_binsize( 0 ), m_nsample( 0 ), m_pdf(), m_dense() {}
 
     //! Constructor: Initialize univariate PDF container
     //! \param[in] bs Sample space bin size
-    explicit UniPDF( tk::real bs ) :
-      m_binsize( bs ), m_nsample( 0 ), m_pdf() {}
+    //! \param[in] ext Optional user-specified sample space extents, {min,max},
+    //!   used to allocate the dense bins upfront
+    explicit UniPDF( tk::real bs, const std::vector< tk::real >& ext = {} ) :
+      m_binsize( bs ), m_nsample( 0 ), m_pdf(), m_dense()
+    {
+      if (ext.size() == 2*dim) {
+        m_dense.cover( {{ std::lround( ext[0] / bs ) }},
+                       {{ std::lround( ext[1] / bs ) }},
+                       DenseBins< dim >::maxbin( 0 ) );
+      }
+    }
 
     //! Accessor to number of samples
     //! \return Number of samples collected
@@ -66,9 +80,40 @@ class UniPDF {
       ++m_nsample;
       fenv_t fe;
       feholdexcept( &fe );
-      ++m_pdf[ std::lround( sample / m_binsize ) ];
+      auto b = std::lround( sample / m_binsize );
+      feclearexcept( FE_UNDERFLOW );
+      feupdateenv( &fe );
+      if (m_dense.inside( {{b}} )) ++m_dense[ {{b}} ]; else ++m_pdf[ b ];
+    }
+
+    //! Add a batch of samples to univariate PDF
+    //! \param[in] n Number of samples to add
+    //! \param[in] sample Function called as tk::real sample( std::size_t i ),
+    //!   returning sample i, i=0...n-1
+    //! \details The bin ids of all samples are computed first, holding the
+    //!   floating point environment once for the whole batch. The dense bins
+    //!   are then grown to cover the extents of the batch, unless that would
+    //!   require too many bins, and the samples are counted into the dense
+    //!   bins. Only samples outside of the dense bins are counted into the map.
+    template< class Sample >
+    void add( std::size_t n, const Sample& sample ) {
+      Assert( m_binsize > 0, "Bin size must be positive" );
+      if (n == 0) return;
+      m_nsample += n;
+      std::vector< long > bin( n );
+      fenv_t fe;
+      feholdexcept( &fe );
+      for (std::size_t i=0; i<n; ++i)
+        bin[i] = std::lround( sample(i) / m_binsize );
       feclearexcept( FE_UNDERFLOW );
       feupdateenv( &fe );
+      auto e = std::minmax_element( begin(bin), end(bin) );
+      if (m_dense.cover( {{*e.first}}, {{*e.second}},
+                         DenseBins< dim >::maxbin( m_nsample ) ))
+        for (auto b : bin) ++m_dense[ {{b}} ];
+      else
+        for (auto b : bin)
+          if (m_dense.inside( {{b}} )) ++m_dense[ {{b}} ]; else ++m_pdf[ b ];
     }
 
     //! Add multiple samples from a PDF
@@ -76,15 +121,32 @@ class UniPDF {
     void addPDF( const UniPDF& p ) {
       m_binsize = p.binsize();
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      if (!m_dense.merge( p.m_dense, DenseBins< dim >::maxbin( m_nsample ) ))
+        p.m_dense.foreach( [&]( const DenseBins< dim >::key_type& k,
+                                tk::real c ){ m_pdf[ k[0] ] += c; } );
+      for (const auto& e : p.m_pdf) m_pdf[ e.first ] += e.second;
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
+    void zero() noexcept { m_nsample = 0; m_pdf.clear(); m_dense.zero(); }
+
+    //! Move the nonzero dense bins to the map and remove the dense bins
+    //! \details Must be called before map(), extents(), and integral().
+    //!   Samples added afterwards are counted into the map until the dense
+    //!   bins are grown again by a batch add().
+    void flush() {
+      m_dense.foreach( [&]( const DenseBins< dim >::key_type& k, tk::real c ){
+                         m_pdf[ k[0] ] += c; } );
+      m_dense.clear();
+    }
 
     //! Constant accessor to underlying PDF map
     //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    //! \pre The dense bins have been flushed to the map by flush()
+    const map_type& map() const {
+      Assert( m_dense.empty(), "Dense bins not flushed" );
+      return m_pdf;
+    }
 
     //! Constant accessor to bin size
     //! \return Sample space bin size
@@ -92,9 +154,11 @@ class UniPDF {
 
     //! Return minimum and maximum bin ids of sample space
     //! \return {min,max} Minimum and maximum of the bin ids
+    //! \pre The dense bins have been flushed to the map by flush()
     std::array< long, 2*dim > extents() const {
-      Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
+      const auto& pdf = map();
+      Assert( !pdf.empty(), "PDF empty" );
+      auto x = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first < b.first; } );
       return {{ x.first->first, x.second->first }};
@@ -102,8 +166,10 @@ class UniPDF {
 
     //! Compute integral of the distribution across the whole sample space
     //! \return Integral of the distribution
+    //! \pre The dense bins have been flushed to the map by flush()
     tk::real integral() const {
-      return std::accumulate( m_pdf.cbegin(), m_pdf.cend(), 0.0,
+      const auto& pdf = map();
+      return std::accumulate( pdf.cbegin(), pdf.cend(), 0.0,
         [&]( tk::real i, const pair_type& p ){
           return i + p.second; } ) / m_nsample;
     }
@@ -116,6 +182,7 @@ class UniPDF {
       p | m_binsize;
       p | m_nsample;
       p | m_pdf;
+      p | m_dense;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -126,7 +193,10 @@ class UniPDF {
   private:
     tk::real m_binsize;         //!< Sample space bin size
     std::size_t m_nsample;      //!< Number of samples collected
-    map_type m_pdf;             //!< Probability density function
+    //! Probability density function: bins outside of m_dense
+    map_type m_pdf;
+    //! Probability density function: dense bins
+    DenseBins< dim > m_dense;
 };
 
 //! Output univariate PDF to output stream
@@ -68,7 +68,7 @@ class TUTSuite : public CBase_TUTSuite {
       , { "Base/PUPUtil", 14 }
       , { "Base/Timer", 1 }
       , { "Inciter/Scheme", 3 }
-      , { "LinearSolver/ConjugateGradients", 6 }
+      , { "LinearSolver/ConjugateGradients", 18 }
     };
 
     // Tests that must be run on PE 0
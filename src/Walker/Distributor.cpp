@@ -167,7 +167,9 @@ Distributor::info( const WalkerPrint& print,
   print.endpart();
 
   // Instantiate tables to sample and output to statistics file
-  m_tables = stack.tables();
+  auto tables = stack.tables();
+  m_tables.first = std::move( tables.first );
+  for (const auto& t : tables.second) m_tables.second.emplace_back( t );
 
   // Print out information on problem
   print.part( "Problem" );
@@ -299,6 +301,11 @@ Distributor::estimateOrdPDF( CkReductionMsg* msg )
 
   delete msg;
 
+  // Move dense bins to the maps for output
+  for (auto& p : m_ordupdf) p.flush();
+  for (auto& p : m_ordbpdf) p.flush();
+  for (auto& p : m_ordtpdf) p.flush();
+
   // Activate SDAG trigger signaling that ordinary PDFs have been estimated
   estimateOrdPDFDone();
 }
@@ -318,6 +325,11 @@ Distributor::estimateCenPDF( CkReductionMsg* msg )
 
   delete msg;
 
+  // Move dense bins to the maps for output
+  for (auto& p : m_cenupdf) p.flush();
+  for (auto& p : m_cenbpdf) p.flush();
+  for (auto& p : m_centpdf) p.flush();
+
   // Activate SDAG trigger signaling that central PDFs have been estimated
   estimateCenPDFDone();
 }
@@ -332,7 +344,7 @@ Distributor::outStat()
   auto extra = [this]() -> std::vector< tk::real > {
     std::vector< tk::real > x( m_tables.second.size() );
     std::size_t j = 0;
-    for (const auto& t : m_tables.second) x[ j++ ] = tk::sample(m_t,t);
+    for (const auto& t : m_tables.second) x[ j++ ] = t( m_t );
     return x;
   };
 
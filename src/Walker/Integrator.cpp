@@ -38,11 +38,14 @@ Integrator::Integrator( CProxy_Distributor hostproxy,
           g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
           g_inputdeck.get< tag::stat >(),
           g_inputdeck.get< tag::pdf >(),
-          g_inputdeck.get< tag::discr, tag::binsize >() ),
+          g_inputdeck.get< tag::discr, tag::binsize >(),
+          g_inputdeck.get< tag::discr, tag::extent >(),
+          g_inputdeck.get< tag::discr, tag::onepass >() ),
   m_dt( 0.0 ),
   m_t( 0.0 ),
   m_it( 0 ),
-  m_itp( 0 )
+  m_itp( 0 ),
+  m_rnd()
 // *****************************************************************************
 // Constructor
 //! \param[in] hostproxy Host proxy to call back to
@@ -106,7 +109,7 @@ Integrator::advance( tk::real dt,
   // the user).
   if (it > 0)
     for (const auto& e : g_diffeqs)
-      e.advance( m_particles, CkMyPe(), dt, t, moments );
+      e.advance( m_particles, CkMyPe(), dt, t, moments, m_rnd );
 
   // Save time stepping data
   m_dt = dt;
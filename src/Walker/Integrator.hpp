@@ -59,7 +59,9 @@ class Integrator : public CBase_Integrator {
               g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
               g_inputdeck.get< tag::stat >(),
               g_inputdeck.get< tag::pdf >(),
-              g_inputdeck.get< tag::discr, tag::binsize >() ) {}
+              g_inputdeck.get< tag::discr, tag::binsize >(),
+              g_inputdeck.get< tag::discr, tag::extent >(),
+              g_inputdeck.get< tag::discr, tag::onepass >() ) {}
 
     //! Perform setup: set initial conditions and advance a time step
     void setup( tk::real dt,
@@ -98,6 +100,8 @@ class Integrator : public CBase_Integrator {
     tk::real m_t;                  //!< Physical time
     uint64_t m_it;                 //!< Iteration count
     uint64_t m_itp;                //!< Particle position output iteration count
+    //! Buffer for random numbers reused by all equations across time steps
+    std::vector< tk::real > m_rnd;
 
     // Accumulate sums for ordinary moments and ordinary PDFs
     void accumulateOrd( uint64_t it, tk::real t, tk::real dt );
@@ -0,0 +1,517 @@
+// *****************************************************************************
+/*!
+  \file      tests/benchmark/DerivedDataBench.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Benchmark of generating derived data structures of meshes
+  \details   Benchmark of generating derived data structures of meshes. The
+    derived data structures in Mesh/DerivedData, generated by compressed sparse
+    rows and merging sorted lists of elements surrounding points, are compared
+    to their previous implementations, which collected stars and elements
+    surrounding elements in std::map and std::set, and are verified to yield
+    identical data. Usage: derivedbench [n [nthread]], where n (default: 120)
+    controls the problem size: the mesh is a cube of n^3 hexahedra, each split
+    into 6 tetrahedra, i.e., about 10 million tetrahedra by default, and
+    nthread (default: 1) is the number of threads used by the functions that
+    support threads, which requires ENABLE_OPENMP. Node ids are numbered
+    lexicographically, so that all points, except the last one, have edges to
+    points with larger ids, which the previous implementations of tk::genEdsup
+    and tk::genInedel required to yield correct data.
+*/
+// *****************************************************************************
+
+#include <map>
+#include <set>
+#include <array>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <unordered_map>
+
+#include "DerivedData.hpp"
+#include "ContainerUtil.hpp"
+
+//! Required by tk::Exception, do not generate call traces
+bool g_trace = false;
+
+namespace {
+
+//! Number of repetitions of each benchmark, the minimum time is reported
+const std::size_t NREP = 3;
+
+} // ::
+
+namespace ref {
+
+using tk::UnsMesh;
+using tk::lpofa;
+
+//! Previous implementation of tk::genEdsup()
+static std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+genEdsup( const std::vector< std::size_t >& inpoel,
+          std::size_t nnpe,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& esup )
+{
+  // find out number of points in mesh connectivity
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  auto npoin = *minmax.second + 1;
+
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  // allocate and fill with zeros a temporary array, only used locally
+  std::vector< std::size_t > lpoin( npoin, 0 );
+
+  // map to contain stars, a point associated to points connected with edges
+  // storing only the end-point id, q, of point ids p < q
+  std::map< std::size_t, std::vector< std::size_t > > star;
+
+  // generate edge connectivity and store as stars where center id < spike id
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+      for (std::size_t n=0; n<nnpe; ++n) {
+        auto q = inpoel[ esup1[i] * nnpe + n ];
+        if (q != p && lpoin[q] != p+1) {
+          if (p < q) star[p].push_back(q);
+          lpoin[q] = p+1;
+        }
+      }
+
+  // linked lists (vectors) to store edges surrounding points and their indices
+  std::vector< std::size_t > edsup1( 1, 0 ), edsup2( 1, 0 );
+
+  // sort non-center points of each star and store nodes and indices in vectors
+  for (auto& p : star) {
+    std::sort( begin(p.second), end(p.second) );
+    edsup2.push_back( edsup2.back() + p.second.size() );
+    edsup1.insert( end(edsup1), begin(p.second), end(p.second) );
+  }
+  // fill up index array with the last index for points with no new edges
+  for (std::size_t i=0; i<npoin-star.size(); ++i)
+    edsup2.push_back( edsup2.back() );
+
+  // Return (move out) linked lists
+  return std::make_pair( std::move(edsup1), std::move(edsup2) );
+}
+
+//! Previous implementation of tk::genInpoed()
+static std::vector< std::size_t >
+genInpoed( const std::vector< std::size_t >& inpoel,
+           std::size_t nnpe,
+           const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& esup )
+{
+  // find out number of points in mesh connectivity
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  auto npoin = *minmax.second + 1;
+
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  // allocate and fill with zeros a temporary array, only used locally
+  std::vector< std::size_t > lpoin( npoin, 0 );
+
+  // map to contain stars, a point associated to points connected with edges,
+  // storing only the end-point id, q, of point ids p < q
+  std::map< std::size_t, std::vector< std::size_t > > star;
+
+  // generate edge connectivity and store as stars where center id < spike id
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+      for (std::size_t n=0; n<nnpe; ++n) {
+        auto q = inpoel[ esup1[i] * nnpe + n ];
+        if (q != p && lpoin[q] != p+1) {
+          if (p < q) star[p].push_back( q );
+          lpoin[q] = p+1;
+        }
+      }
+
+  // linear vector to store edge connectivity and their indices
+  std::vector< std::size_t > inpoed;
+
+  // sort non-center points of each star and store both start and end points of
+  // each star in linear vector
+  for (auto& p : star) {
+    std::sort( begin(p.second), end(p.second) );
+    for (auto e : p.second) {
+      inpoed.push_back( p.first );
+      inpoed.push_back( e );
+    }
+  }
+
+  // Return (move out) linear vector
+  return inpoed;
+}
+
+//! Previous implementation of tk::genEsupel()
+static std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+genEsupel( const std::vector< std::size_t >& inpoel,
+           std::size_t nnpe,
+           const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& esup )
+{
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  // linked lists storing elements surrounding points of elements, put in a
+  // single zero in both
+  std::vector< std::size_t > esupel2( 1, 0 ), esupel1( 1, 0 );
+
+  std::size_t e = 0;
+  std::set< std::size_t > esuel;
+  for (auto p : inpoel) {       // loop over all points of all elements
+    // collect unique element ids of elements surrounding points of element
+    for (auto i=esup2[p]+1; i<=esup2[p+1]; ++i) esuel.insert( esup1[i] );
+    if (++e%nnpe == 0) {        // when finished checking all nodes of element
+      // erase element whose surrounding elements are considered
+      esuel.erase( e/nnpe-1 );
+      // store unique element ids in esupel1
+      esupel1.insert( end(esupel1), begin(esuel), end(esuel) );
+      // store end-index for element used to address into esupel1
+      esupel2.push_back( esupel2.back() + esuel.size() );
+      esuel.clear();
+    }
+  }
+
+  // Return (move out) linked lists
+  return std::make_pair( std::move(esupel1), std::move(esupel2) );
+}
+
+//! Previous implementation of tk::genEsuel()
+static std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+genEsuel( const std::vector< std::size_t >& inpoel,
+          std::size_t nnpe,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& esup )
+{
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  auto nelem = inpoel.size()/nnpe;
+
+  // lambda that returns 1 if elements hel and gel share a face
+  auto adj = [ &inpoel, nnpe ]( std::size_t hel, std::size_t gel ) -> bool {
+    std::size_t sp = 0;
+    for (std::size_t h=0; h<nnpe; ++h)
+      for (std::size_t g=0; g<nnpe; ++g)
+        if (inpoel[hel*nnpe+h] == inpoel[gel*nnpe+g]) ++sp;
+    if (sp == nnpe-1) return true; else return false;
+  };
+
+  // map to associate unique elements and their surrounding elements
+  std::map< std::size_t, std::vector< std::size_t > > es;
+
+  for (std::size_t e=0; e<nelem; ++e) {
+    std::set< std::size_t > faces; // will collect elem ids of shared faces
+    for (std::size_t n=0; n<nnpe; ++n) {
+      auto i = inpoel[ e*nnpe+n ];
+      for (auto j=esup2[i]+1; j<=esup2[i+1]; ++j)
+        if (adj( e, esup1[j] )) faces.insert( esup1[j] );
+    }
+    // store element ids of shared faces
+    for (auto j : faces) es[e].push_back(j);
+  }
+
+  // storing elements surrounding elements
+  std::vector< std::size_t > esuel1( 1, 0 ), esuel2( 1, 0 );
+
+  // store elements surrounding elements in linked lists
+  for (const auto& e : es) {
+    esuel2.push_back( esuel2.back() + e.second.size() );
+    esuel1.insert( end(esuel1), begin(e.second), end(e.second) );
+  }
+
+  // Return (move out) linked lists
+  return std::make_pair( std::move(esuel1), std::move(esuel2) );
+}
+
+//! Previous implementation of tk::genInedel()
+static std::vector< std::size_t >
+genInedel( const std::vector< std::size_t >& inpoel,
+           std::size_t nnpe,
+           const std::vector< std::size_t >& inpoed )
+{
+  // find out number of points in mesh connectivity
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  auto npoin = *minmax.second + 1;
+
+  // First, generate index of star centers. This is necessary to avoid a
+  // brute-force search for point ids of edges when searching for element edges.
+  // Note that this is the same as edsup2, generated by genEdsup(). However,
+  // because the derived data structure generated here, inedel, is intended to
+  // be used in conjunction with the linear vector inpoed and not with the
+  // linked lists edsup1 and edsup2, this function takes inpoed as an argument,
+  // and so edsup2 is temporarily generated here to avoid a brute-force search.
+
+  // map to contain stars, a point associated to points connected with edges
+  // storing only the end-point id, q, of point ids p < q
+  std::map< std::size_t, std::vector< std::size_t > > star;
+
+  // generate stars from inpoed; starting with zero, every even is a star
+  // center, every odd is a spike
+  for (std::size_t i=0; i<inpoed.size()/2; ++i)
+    star[ inpoed[i*2] ].push_back( inpoed[i*2+1] );
+
+  // store index of star centers in vector; assume non-center points of each
+  // star have already been sorted
+  std::vector< std::size_t > edsup2( 1, 0 );
+  for (const auto& p : star) edsup2.push_back(edsup2.back() + p.second.size());
+  // fill up index array with the last index for points with no new edges
+  for (std::size_t i=0; i<npoin-star.size(); ++i)
+    edsup2.push_back( edsup2.back() );
+  star.clear();
+
+  // Second, generate edges of elements
+
+  auto nelem = inpoel.size()/nnpe;
+
+  // map associating elem id with vector of edge ids
+  std::map< std::size_t, std::vector< std::size_t > > edges;
+
+  // generate map of elements associated to edge ids
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t n=0; n<nnpe; ++n) {
+      auto p = inpoel[e*nnpe+n];
+      for (auto i=edsup2[p]+1; i<=edsup2[p+1]; ++i)
+         for (std::size_t j=0; j<nnpe; ++j)
+            if (inpoed[(i-1)*2+1] == inpoel[e*nnpe+j])
+              edges[e].push_back( i-1 );
+    }
+
+  // linear vector to store the edge ids of all elements
+  std::vector< std::size_t > inedel( tk::sumvalsize(edges) );
+
+  // store edge ids of elements in linear vector
+  std::size_t j = 0;
+  for (const auto& e : edges) for (auto p : e.second) inedel[ j++ ] = p;
+
+  // Return (move out) vector
+  return inedel;
+}
+
+//! Previous implementation of tk::genEsued()
+static std::unordered_map< UnsMesh::Edge, std::vector< std::size_t >,
+                    UnsMesh::Hash<2>, UnsMesh::Eq<2> >
+genEsued( const std::vector< std::size_t >& inpoel,
+          std::size_t nnpe,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& esup )
+{
+  // find out number of points in mesh connectivity
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  auto npoin = *minmax.second + 1;
+
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  // allocate and fill with zeros a temporary array, only used locally
+  std::vector< std::size_t > lpoin( npoin, 0 );
+
+  // lambda that returns true if element e contains edge (p < q)
+  auto has = [ &inpoel, nnpe ]( std::size_t e, std::size_t p, std::size_t q ) {
+    int sp = 0;
+    for (std::size_t n=0; n<nnpe; ++n)
+      if (inpoel[e*nnpe+n] == p || inpoel[e*nnpe+n] == q) ++sp;
+    return sp == 2;
+  };
+
+  // map to associate edges to unique surrounding element ids
+  std::unordered_map< UnsMesh::Edge, std::vector< std::size_t >,
+                      UnsMesh::Hash<2>, UnsMesh::Eq<2> > esued;
+
+  // generate edges and associated vector of unique surrounding element ids
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+      for (std::size_t n=0; n<nnpe; ++n) {
+        auto q = inpoel[ esup1[i] * nnpe + n ];
+        if (q != p && lpoin[q] != p+1) {
+          if (p < q) {  // for edge given point ids p < q
+            for (std::size_t j=esup2[p]+1; j<=esup2[p+1]; ++j ) {
+              auto e = esup1[j];
+              if (has(e,p,q)) esued[{p,q}].push_back(e);
+            }
+          }
+          lpoin[q] = p+1;
+        }
+      }
+
+  // sort element ids surrounding edges for each edge
+  for (auto& p : esued) std::sort( begin(p.second), end(p.second) );
+
+  // Return elements surrounding edges data structure
+  return esued;
+}
+
+//! Previous implementation of tk::genEsuelTet()
+static std::vector< int >
+genEsuelTet( const std::vector< std::size_t >& inpoel,
+             const std::pair< std::vector< std::size_t >,
+                              std::vector< std::size_t > >& esup )
+{
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+
+  // set tetrahedron geometry
+  std::size_t nnpe(4), nfpe(4), nnpf(3);
+
+
+  // get nelem and npoin
+  auto nelem = inpoel.size()/nnpe;
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  auto npoin = *minmax.second + 1;
+
+  std::vector< int > esuelTet(nfpe*nelem, -1);
+  std::vector< std::size_t > lhelp(nnpf,0),
+                             lpoin(npoin,0);
+
+  for (std::size_t e=0; e<nelem; ++e)
+  {
+    auto mark = nnpe*e;
+    for (std::size_t fe=0; fe<nfpe; ++fe)
+    {
+      // array which stores points on this face
+      lhelp[0] = inpoel[mark+lpofa[fe][0]];
+      lhelp[1] = inpoel[mark+lpofa[fe][1]];
+      lhelp[2] = inpoel[mark+lpofa[fe][2]];
+
+      // mark in this array
+      lpoin[lhelp[0]] = 1;
+      lpoin[lhelp[1]] = 1;
+      lpoin[lhelp[2]] = 1;
+
+      // select a point on this face
+      auto ipoin = lhelp[0];
+
+      // loop over elements around this point
+      for (std::size_t j=esup2[ipoin]+1; j<=esup2[ipoin+1]; ++j )
+      {
+        auto jelem = esup1[j];
+        // if this jelem is not e itself then proceed
+        if (jelem != e)
+        {
+          for (std::size_t fj=0; fj<nfpe; ++fj)
+          {
+            std::size_t icoun(0);
+            for (std::size_t jnofa=0; jnofa<nnpf; ++jnofa)
+            {
+              auto markj = jelem*nnpe;
+              auto jpoin = inpoel[markj+lpofa[fj][jnofa]];
+              if (lpoin[jpoin] == 1) { ++icoun; }
+            }
+            //store esuel if
+            if (icoun == nnpf)
+            {
+              auto markf = nfpe*e;
+              esuelTet[markf+fe] = static_cast<int>(jelem);
+
+              markf = nfpe*jelem;
+              esuelTet[markf+fj] = static_cast<int>(e);
+            }
+          }
+        }
+      }
+      // reset this array
+      lpoin[lhelp[0]] = 0;
+      lpoin[lhelp[1]] = 0;
+      lpoin[lhelp[2]] = 0;
+    }
+  }
+
+  return esuelTet;
+}
+
+} // ref::
+
+//! Measure the minimum wall-clock time of a function over repetitions
+//! \param[in] f Function to time
+//! \return Minimum time in seconds
+template< class F >
+static double timeit( F&& f ) {
+  double t = std::numeric_limits< double >::max();
+  for (std::size_t r=0; r<NREP; ++r) {
+    auto s = std::chrono::high_resolution_clock::now();
+    f();
+    std::chrono::duration< double > d =
+      std::chrono::high_resolution_clock::now() - s;
+    t = std::min( t, d.count() );
+  }
+  return t;
+}
+
+//! Time previous and current implementations and compare their results
+//! \param[in] name Name of derived data to print
+//! \param[in] prev Previous implementation to call
+//! \param[in] curr Current implementation to call
+//! \return True if the results are identical
+template< class Prev, class Curr >
+static bool run( const char* name, Prev&& prev, Curr&& curr ) {
+  decltype( prev() ) a, b;
+  auto tprev = timeit( [&](){ a = prev(); } );
+  auto tcurr = timeit( [&](){ b = curr(); } );
+  bool same = a == b;
+  std::printf( "%-12s %12.3f %12.3f %10.1f %10s\n", name, tprev, tcurr,
+               tprev / tcurr, same ? "yes" : "NO" );
+  return same;
+}
+
+int main( int argc, char** argv ) {
+  std::size_t n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 120;
+  std::size_t nthread = argc > 2 ? std::strtoul( argv[2], nullptr, 10 ) : 1;
+  if (n < 1) n = 1;
+
+  // Generate tetrahedron mesh of a cube
+  auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+  { return (k*(n+1) + j)*(n+1) + i; };
+  std::vector< std::size_t > inpoel;
+  inpoel.reserve( n*n*n*24 );
+  for (std::size_t k=0; k<n; ++k)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t i=0; i<n; ++i) {
+        std::array< std::size_t, 8 > h{{
+          id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+          id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+        const std::array< std::array< std::size_t, 2 >, 6 >
+          path{{ {{1,2}}, {{1,5}}, {{3,2}}, {{3,7}}, {{4,5}}, {{4,7}} }};
+        for (const auto& q : path)
+          inpoel.insert( end(inpoel), { h[0], h[q[0]], h[q[1]], h[6] } );
+      }
+
+  std::printf( "Mesh: %zu^3 hexahedra, %zu tetrahedra, %zu thread(s), "
+               "min of %zu runs\n", n, inpoel.size()/4, nthread, NREP );
+  std::printf( "%-12s %12s %12s %10s %10s\n", "data", "previous [s]",
+               "current [s]", "speedup", "identical" );
+
+  auto esup = tk::genEsup( inpoel, 4 );
+  auto inpoed = tk::genInpoed( inpoel, 4, esup );
+
+  bool same = true;
+  same &= run( "edsup",
+    [&](){ return ref::genEdsup( inpoel, 4, esup ); },
+    [&](){ return tk::genEdsup( inpoel, 4, esup ); } );
+  same &= run( "inpoed",
+    [&](){ return ref::genInpoed( inpoel, 4, esup ); },
+    [&](){ return tk::genInpoed( inpoel, 4, esup ); } );
+  same &= run( "esupel",
+    [&](){ return ref::genEsupel( inpoel, 4, esup ); },
+    [&](){ return tk::genEsupel( inpoel, 4, esup, nthread ); } );
+  same &= run( "esuel",
+    [&](){ return ref::genEsuel( inpoel, 4, esup ); },
+    [&](){ return tk::genEsuel( inpoel, 4, esup, nthread ); } );
+  same &= run( "esuelTet",
+    [&](){ return ref::genEsuelTet( inpoel, esup ); },
+    [&](){ return tk::genEsuelTet( inpoel, esup, nthread ); } );
+  same &= run( "inedel",
+    [&](){ return ref::genInedel( inpoel, 4, inpoed ); },
+    [&](){ return tk::genInedel( inpoel, 4, inpoed ); } );
+  same &= run( "esued",
+    [&](){ return ref::genEsued( inpoel, 4, esup ); },
+    [&](){ return tk::genEsued( inpoel, 4, esup ); } );
+
+  return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,168 @@
+// *****************************************************************************
+/*!
+  \file      tests/benchmark/HashBench.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Benchmark of hash sets of mesh edges and faces
+  \details   Benchmark of hash sets of mesh edges and faces. Edge and face sets
+    are built from, and queried with, all element edges and faces of a
+    tetrahedron mesh, the way they are used when reading and partitioning
+    the mesh, matching chare-boundary faces in DG, and refining the mesh. The
+    following containers are compared: (1) std::unordered_set with the
+    SipHash-based hasher previously used by tk::UnsMesh::Hash, (2)
+    std::unordered_set with the current tk::UnsMesh::Hash, and (3)
+    tk::FlatHashSet with keys in canonical order, i.e.,
+    tk::UnsMesh::CanonicalEdgeSet and tk::UnsMesh::CanonicalFaceSet. Usage:
+    hashbench [n], where n (default: 64) controls the problem size: the mesh
+    is a cube of n^3 hexahedra, each split into 6 tetrahedra.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <algorithm>
+
+#include "NoWarning/sip_hash.hpp"
+
+#include "UnsMesh.hpp"
+#include "DerivedData.hpp"
+
+//! Required by tk::Exception, do not generate call traces
+bool g_trace = false;
+
+namespace {
+
+//! Number of repetitions of each benchmark, the minimum time is reported
+const std::size_t NREP = 5;
+
+//! Highway hash "secret" key
+const highwayhash::HH_U64 hh_key[2] =
+  { 0x0706050403020100ULL, 0x0F0E0D0C0B0A0908ULL };
+
+//! SipHash-based hasher of element primitives, sorting node IDs first
+//! \tparam N Number of nodes describing element primitive
+template< std::size_t N >
+struct SipHash {
+  //! Function call operator computing hash of node IDs
+  //! \param[in] p Array of node IDs of element primitive
+  //! \return Hash value of sorted node IDs
+  std::size_t operator()( const std::array< std::size_t, N >& p ) const {
+    auto s = p;
+    std::sort( begin(s), end(s) );
+    return highwayhash::SipHash( hh_key,
+             reinterpret_cast< const char* >( s.data() ), N*sizeof(s[0]) );
+  }
+};
+
+} // ::
+
+//! Measure the minimum wall-clock time of a benchmark over repetitions
+//! \param[in] f Benchmark to time
+//! \return Minimum time in seconds
+template< class F >
+static double timeit( F&& f ) {
+  double t = std::numeric_limits< double >::max();
+  for (std::size_t r=0; r<NREP; ++r) {
+    auto s = std::chrono::high_resolution_clock::now();
+    f();
+    std::chrono::duration< double > d =
+      std::chrono::high_resolution_clock::now() - s;
+    t = std::min( t, d.count() );
+  }
+  return t;
+}
+
+//! Build a set of element primitives and query it with all of them
+//! \tparam Set Set type to benchmark
+//! \param[in] name Name of set type to print
+//! \param[in] prim Element primitives, possibly repeated, as node IDs
+//! \param[in] canonical True to put node IDs in canonical order before
+//!   inserting and querying
+template< class Set, std::size_t N >
+static void run( const char* name,
+                 const std::vector< std::array< std::size_t, N > >& prim,
+                 bool canonical )
+{
+  using tk::UnsMesh;
+  auto key = [canonical]( const std::array< std::size_t, N >& p )
+  { return canonical ? UnsMesh::canonical(p) : p; };
+  std::size_t nunique = 0, nfound = 0;
+  auto tins = timeit( [&](){
+    Set s;
+    for (const auto& p : prim) s.insert( key(p) );
+    nunique = s.size();
+  } );
+  Set s;
+  for (const auto& p : prim) s.insert( key(p) );
+  auto tfind = timeit( [&](){
+    nfound = 0;
+    for (const auto& p : prim) nfound += s.count( key(p) );
+  } );
+  std::printf( "%-36s %10zu %12.6f %12.6f %10.1f %10.1f\n", name, nunique,
+               tins, tfind, static_cast< double >( prim.size() ) / tins * 1e-6,
+               static_cast< double >( nfound ) / tfind * 1e-6 );
+}
+
+int main( int argc, char** argv ) {
+  std::size_t n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 64;
+  if (n < 1) n = 1;
+
+  // Generate tetrahedron mesh of a cube, then shuffle node ids to mimic
+  // global ids of an unstructured mesh
+  auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+  { return (k*(n+1) + j)*(n+1) + i; };
+  std::vector< std::size_t > perm( (n+1)*(n+1)*(n+1) );
+  std::iota( begin(perm), end(perm), 0 );
+  std::shuffle( begin(perm), end(perm), std::mt19937( 1 ) );
+  std::vector< std::size_t > inpoel;
+  for (std::size_t k=0; k<n; ++k)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t i=0; i<n; ++i) {
+        std::array< std::size_t, 8 > h{{
+          id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+          id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+        const std::array< std::array< std::size_t, 2 >, 6 >
+          path{{ {{1,2}}, {{1,5}}, {{3,2}}, {{3,7}}, {{4,5}}, {{4,7}} }};
+        for (const auto& q : path)
+          inpoel.insert( end(inpoel), { perm[h[0]], perm[h[q[0]]],
+                                        perm[h[q[1]]], perm[h[6]] } );
+      }
+
+  // Collect all element edges and faces, in element node order
+  std::vector< tk::UnsMesh::Edge > edges;
+  std::vector< tk::UnsMesh::Face > faces;
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    for (const auto& [a,b] : tk::lpoed)
+      edges.push_back( {{ inpoel[e*4+a], inpoel[e*4+b] }} );
+    for (const auto& f : tk::lpofa)
+      faces.push_back( {{ inpoel[e*4+f[0]], inpoel[e*4+f[1]],
+                          inpoel[e*4+f[2]] }} );
+  }
+
+  std::printf( "Mesh: %zu^3 hexahedra, %zu tetrahedra, min of %zu runs\n",
+               n, inpoel.size()/4, NREP );
+  std::printf( "%-36s %10s %12s %12s %10s %10s\n", "container", "size",
+               "insert [s]", "find [s]", "Mins/s", "Mfind/s" );
+
+  using tk::UnsMesh;
+  run< std::unordered_set< UnsMesh::Edge, SipHash<2>, UnsMesh::Eq<2> > >
+     ( "edges: unordered_set, SipHash", edges, false );
+  run< UnsMesh::EdgeSet >
+     ( "edges: unordered_set, UnsMesh::Hash", edges, false );
+  run< UnsMesh::CanonicalEdgeSet >( "edges: CanonicalEdgeSet", edges, true );
+  run< std::unordered_set< UnsMesh::Face, SipHash<3>, UnsMesh::Eq<3> > >
+     ( "faces: unordered_set, SipHash", faces, false );
+  run< UnsMesh::FaceSet >
+     ( "faces: unordered_set, UnsMesh::Hash", faces, false );
+  run< UnsMesh::CanonicalFaceSet >( "faces: CanonicalFaceSet", faces, true );
+
+  return EXIT_SUCCESS;
+}
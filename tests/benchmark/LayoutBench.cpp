@@ -0,0 +1,186 @@
+// *****************************************************************************
+/*!
+  \file      tests/benchmark/LayoutBench.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Benchmark of typical kernels using the data layouts of tk::Data
+  \details   Benchmark of typical kernels using the data layouts of tk::Data.
+    Since the data layout of tk::Fields and tk::Particles is selected at
+    compile time, this executable instantiates representative kernels for all
+    layouts in a single binary so that the layout can be chosen per workload
+    on a given machine. The kernels mimic the memory access patterns of
+    (1) the edge-based right hand side loop of ALECG: gather-scatter of all
+    components at both end points of edges, (2) the volume integral of DG:
+    dense loops over the degrees of freedom of all components of an element,
+    and (3) the particle advance in Walker: streaming over all components of
+    all particles. Usage: layoutbench [n], where n (default: 64) controls the
+    problem size: n^3 mesh nodes, DG elements, and particles.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+
+#include "Data.hpp"
+
+//! Required by tk::Exception, do not generate call traces
+bool g_trace = false;
+
+namespace {
+
+//! Number of scalar components, e.g., single-material compressible flow
+const std::size_t NCOMP = 5;
+//! Number of degrees of freedom per component for DG(P1)
+const std::size_t NDOF = 4;
+//! Number of repetitions of each kernel, the minimum time is reported
+const std::size_t NREP = 10;
+
+} // ::
+
+//! Measure the minimum wall-clock time of a kernel over repetitions
+//! \param[in] f Kernel to time
+//! \return Minimum time in seconds
+template< class F >
+static double timeit( F&& f ) {
+  f();  // warm up
+  double t = std::numeric_limits< double >::max();
+  for (std::size_t r=0; r<NREP; ++r) {
+    auto s = std::chrono::high_resolution_clock::now();
+    f();
+    std::chrono::duration< double > d =
+      std::chrono::high_resolution_clock::now() - s;
+    t = std::min( t, d.count() );
+  }
+  return t;
+}
+
+//! Sum all values of a Data object to check that layouts compute the same
+//! \param[in] d Data object to sum
+//! \return Sum of all values
+template< uint8_t Layout >
+static tk::real checksum( const tk::Data< Layout >& d ) {
+  tk::real s = 0.0;
+  for (std::size_t i=0; i<d.nunk(); ++i)
+    for (std::size_t c=0; c<d.nprop(); ++c) s += d(i,c,0);
+  return s;
+}
+
+//! Run all kernels with a given data layout
+//! \param[in] n Problem size parameter
+//! \param[in] edge Edge end points, two per edge
+//! \param[in] w Edge weights, two per edge
+//! \param[in] dW Random increments for the particle advance
+template< uint8_t Layout >
+static void run( std::size_t n,
+                 const std::vector< std::size_t >& edge,
+                 const std::vector< tk::real >& w,
+                 const std::vector< tk::real >& dW )
+{
+  using Data = tk::Data< Layout >;
+  const auto npoin = n*n*n;
+
+  // (1) edge loop: gather both end points, scatter flux to both end points
+  Data U( npoin, NCOMP ), R( npoin, NCOMP );
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t c=0; c<NCOMP; ++c)
+      U(p,c,0) = 1.0 + 1.0e-3*static_cast< tk::real >( (p*7 + c) % 101 );
+  auto tedge = timeit( [&](){
+    R.fill( 0.0 );
+    for (std::size_t e=0; e<edge.size()/2; ++e) {
+      auto p = edge[e*2+0];
+      auto q = edge[e*2+1];
+      for (std::size_t c=0; c<NCOMP; ++c) {
+        auto f = w[e*2+0]*(U(p,c,0) + U(q,c,0)) - w[e*2+1]*(U(q,c,0) - U(p,c,0));
+        R(p,c,0) -= f;
+        R(q,c,0) += f;
+      }
+    }
+  } );
+
+  // (2) DG volume integral: dense loops over dofs of all components
+  const std::array< tk::real, 5 > wgp{{ -0.8, 0.45, 0.45, 0.45, 0.45 }};
+  const std::array< std::array< tk::real, NDOF >, 5 > B{{
+    {{ 1.0, 0.0, 0.0, 0.0 }}, {{ 1.0, -0.5, 0.2, 0.1 }},
+    {{ 1.0, 0.3, -0.4, 0.2 }}, {{ 1.0, 0.1, 0.3, -0.6 }},
+    {{ 1.0, 0.2, 0.2, 0.3 }} }};
+  Data V( npoin, NCOMP*NDOF ), S( npoin, NCOMP*NDOF );
+  for (std::size_t e=0; e<npoin; ++e)
+    for (std::size_t c=0; c<NCOMP*NDOF; ++c)
+      V(e,c,0) = 1.0e-2*static_cast< tk::real >( (e*3 + c) % 37 );
+  auto tvol = timeit( [&](){
+    S.fill( 0.0 );
+    for (std::size_t e=0; e<npoin; ++e)
+      for (std::size_t g=0; g<wgp.size(); ++g)
+        for (std::size_t c=0; c<NCOMP; ++c) {
+          tk::real u = 0.0;
+          for (std::size_t k=0; k<NDOF; ++k) u += V(e,c*NDOF+k,0) * B[g][k];
+          auto f = wgp[g] * 0.5 * u * u;
+          for (std::size_t k=1; k<NDOF; ++k) S(e,c*NDOF+k,0) += f * B[g][k];
+        }
+  } );
+
+  // (3) particle advance: stream over all components of all particles
+  Data X( npoin, NCOMP );
+  X.fill( 0.5 );
+  const tk::real dt = 1.0e-3, theta = 1.0, mu = 0.5, sigma = 0.1;
+  auto tsde = timeit( [&](){
+    for (std::size_t c=0; c<NCOMP; ++c) {
+      auto x = X.cptr( c, 0 );
+      for (std::size_t p=0; p<npoin; ++p) {
+        auto& v = X.var( x, p );
+        v += theta*(mu - v)*dt + sigma*dW[p*NCOMP+c];
+      }
+    }
+  } );
+
+  std::printf( "%-16s %12.6f %12.6f %12.6f   %.10e %.10e %.10e\n",
+               Data::layout().c_str(), tedge, tvol, tsde,
+               checksum(R), checksum(S), checksum(X) );
+}
+
+int main( int argc, char** argv ) {
+  std::size_t n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 64;
+  if (n < 2) n = 2;
+
+  // Generate edges of a structured grid of n^3 points connecting each point to
+  // its 7 neighbors in the positive directions, similar to the number of edges
+  // per point in a tetrahedron mesh, then shuffle the points as in an
+  // unstructured mesh, ordered by a bandwidth-reducing renumbering
+  auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+  { return (k*n + j)*n + i; };
+  std::vector< std::size_t > edge;
+  for (std::size_t k=0; k<n; ++k)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t i=0; i<n; ++i)
+        for (std::size_t d=1; d<8; ++d) {
+          auto a = i + (d&1), b = j + ((d>>1)&1), c = k + ((d>>2)&1);
+          if (a<n && b<n && c<n)
+            edge.insert( end(edge), { id(i,j,k), id(a,b,c) } );
+        }
+
+  std::mt19937 gen( 1 );
+  std::uniform_real_distribution< tk::real > u( -1.0, 1.0 );
+  std::vector< tk::real > w( edge.size() );
+  for (auto& v : w) v = u(gen);
+  std::vector< tk::real > dW( n*n*n*NCOMP );
+  for (auto& v : dW) v = u(gen);
+
+  std::printf( "Problem size: %zu^3, block width: %zu, min of %zu runs\n",
+               n, tk::DataBlockWidth, NREP );
+  std::printf( "%-16s %12s %12s %12s   checksums\n",
+               "layout", "edge [s]", "dgvol [s]", "sde [s]" );
+  run< tk::UnkEqComp >( n, edge, w, dW );
+  run< tk::EqCompUnk >( n, edge, w, dW );
+  run< tk::BlkEqCompUnk >( n, edge, w, dW );
+
+  return EXIT_SUCCESS;
+}
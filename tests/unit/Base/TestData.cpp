@@ -10,6 +10,8 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+#include <cfenv>
 #include <limits>
 #include <array>
 #include <vector>
@@ -2353,6 +2355,122 @@ void Data_object::test< 46 >() {
   }
 }
 
+//! Test that tk::Data's update() equals the same expression using operators
+template<> template<>
+void Data_object::test< 47 >() {
+  set_test_name( "update() equals operator expression" );
+
+  tk::Data< tk::UnkEqComp > y( 4, 3 ), x( 4, 3 ), d( 4, 3 ), p;
+  for (std::size_t i=0; i<4; ++i)
+    for (std::size_t c=0; c<3; ++c) {
+      y(i,c,0) = 0.1 * static_cast< tk::real >( i+c );
+      x(i,c,0) = 1.0 - 0.3 * static_cast< tk::real >( i*c );
+      d(i,c,0) = 2.0 + static_cast< tk::real >( i );
+    }
+  const tk::real a = 0.7;
+
+  // update into a default-constructed (empty) object resizes it
+  p.update( y, a, x, d );
+  auto r = y + a * x / d;
+  ensure_equals( "update() nunk incorrect", p.nunk(), 4 );
+  ensure_equals( "update() nprop incorrect", p.nprop(), 3 );
+  ensure( "update() differs from operator expression", p.vec() == r.vec() );
+
+  // update aliasing the first operand, as in u = u + dt * rhs / lhs
+  y.update( y, a, x, d );
+  ensure( "aliased update() differs from operator expression",
+          y.vec() == r.vec() );
+
+  tk::Data< tk::EqCompUnk > ey( 2, 2 ), ex( 2, 2 ), ed( 2, 2 ), e;
+  ey.fill( 1.0 );       ex.fill( 0.5 );       ed.fill( 4.0 );
+  e.update( ey, 2.0, ex, ed );
+  using unittest::veceq;
+  veceq( "<EqCompUnk>::update() at 0,0 incorrect",
+         std::vector< tk::real >{ 1.25, 1.25 }, e.extract( 0, 0 ) );
+}
+
+//! Test access and raw pointer access of tk::Data's block-major layout
+template<> template<>
+void Data_object::test< 48 >() {
+  set_test_name( "block-major access" );
+
+  // number of unknowns not divisible by the block width to test padding
+  const std::size_t nunk = 2*tk::DataBlockWidth + 3;
+  tk::Data< tk::UnkEqComp > p( nunk, 3 );
+  tk::Data< tk::BlkEqCompUnk > b( nunk, 3 );
+  ensure_equals( "<BlkEqCompUnk>::nunk() incorrect", b.nunk(), nunk );
+  ensure_equals( "<BlkEqCompUnk>::nprop() incorrect", b.nprop(), 3 );
+  ensure_equals( "<BlkEqCompUnk>::layout() incorrect", b.layout(),
+                 std::string( "block-major" ) );
+  ensure( "<BlkEqCompUnk> raw data not aligned",
+          reinterpret_cast< std::uintptr_t >( b.vec().data() ) % 64 == 0 );
+
+  for (std::size_t i=0; i<nunk; ++i)
+    for (std::size_t c=0; c<3; ++c)
+      p(i,c,0) = b(i,c,0) = static_cast< tk::real >( i*3+c+1 );
+
+  using unittest::veceq;
+  for (std::size_t c=0; c<3; ++c) {
+    veceq( "<BlkEqCompUnk>::extract() incorrect",
+           p.extract( c, 0 ), b.extract( c, 0 ) );
+    // raw pointer access
+    auto pt = b.cptr( c, 0 );
+    for (std::size_t i=0; i<nunk; ++i)
+      ensure_equals( "<BlkEqCompUnk>::var() incorrect", b.var( pt, i ),
+                     p(i,c,0), prec );
+  }
+
+  // operations on padding must not raise floating point exceptions
+  std::feclearexcept( FE_ALL_EXCEPT );
+  b /= b;
+  b += b;
+  ensure( "<BlkEqCompUnk> operator/= raised floating point exception",
+          !std::fetestexcept( FE_DIVBYZERO | FE_INVALID ) );
+  for (std::size_t i=0; i<nunk; ++i)
+    for (std::size_t c=0; c<3; ++c)
+      ensure_equals( "<BlkEqCompUnk> operator/= incorrect", b(i,c,0), 2.0,
+                     prec );
+  // padding must stay zero
+  std::size_t nval = 0;
+  for (auto v : b.vec()) if (std::abs( v ) > 0.0) ++nval;
+  ensure_equals( "<BlkEqCompUnk> padding nonzero", nval, nunk*3 );
+}
+
+//! Test tk::Data's block-major layout push_back(), resize(), and rm()
+template<> template<>
+void Data_object::test< 49 >() {
+  set_test_name( "block-major push_back, resize, rm" );
+
+  const std::size_t nunk = tk::DataBlockWidth + 1;
+  tk::Data< tk::UnkEqComp > p( nunk, 2 );
+  tk::Data< tk::BlkEqCompUnk > b( nunk, 2 );
+  for (std::size_t i=0; i<nunk; ++i)
+    for (std::size_t c=0; c<2; ++c)
+      p(i,c,0) = b(i,c,0) = static_cast< tk::real >( i*2+c ) + 1.0;
+
+  p.push_back( { 0.5, 0.25 } );
+  b.push_back( { 0.5, 0.25 } );
+  p.resize( nunk + 4, 3.0 );
+  b.resize( nunk + 4, 3.0 );
+  p.rm( { 0, 2, nunk } );
+  b.rm( { 0, 2, nunk } );
+  ensure_equals( "<BlkEqCompUnk>::nunk() incorrect", b.nunk(), p.nunk() );
+
+  using unittest::veceq;
+  for (std::size_t i=0; i<p.nunk(); ++i)
+    veceq( "<BlkEqCompUnk> values incorrect", p.extract( i ),
+           b.extract( i ) );
+
+  // shrinking keeps the padding zero
+  b.resize( 1 );
+  ensure_equals( "<BlkEqCompUnk> raw size incorrect", b.vec().size(),
+                 2*tk::DataBlockWidth );
+  for (std::size_t i=1; i<tk::DataBlockWidth; ++i)
+    for (std::size_t c=0; c<2; ++c)
+      ensure_equals( "<BlkEqCompUnk> padding not zero",
+                     b.vec()[ c*tk::DataBlockWidth + i ], 0.0, prec );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
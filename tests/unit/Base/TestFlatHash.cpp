@@ -0,0 +1,138 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestFlatHash.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/FlatHash.hpp
+  \details   Unit tests for Base/FlatHash.hpp
+*/
+// *****************************************************************************
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "FlatHash.hpp"
+#include "UnsMesh.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct FlatHash_common {};
+
+//! Test group shortcuts
+using FlatHash_group = test_group< FlatHash_common, MAX_TESTS_IN_GROUP >;
+using FlatHash_object = FlatHash_group::object;
+
+//! Define test group
+static FlatHash_group FlatHash( "Base/FlatHash" );
+
+//! Test definitions for group
+
+//! Test inserting, finding, and iterating over a flat hash set
+template<> template<>
+void FlatHash_object::test< 1 >() {
+  set_test_name( "set insert, find, iterate" );
+
+  tk::FlatHashSet< std::size_t > s;
+  ensure( "new set not empty", s.empty() );
+  for (std::size_t i=0; i<1000; ++i) s.insert( i*7 );
+  ensure_equals( "size incorrect", s.size(), std::size_t(1000) );
+  ensure( "reinsert succeeded", !s.insert( 14 ).second );
+  ensure_equals( "size incorrect after reinsert", s.size(),
+                 std::size_t(1000) );
+  ensure_equals( "existing key not found", *s.find( 700 ), std::size_t(700) );
+  ensure( "nonexistent key found", s.find( 701 ) == s.end() );
+  ensure_equals( "count incorrect", s.count( 6993 ), std::size_t(1) );
+
+  std::size_t n = 0, sum = 0;
+  for (auto k : s) { ++n; sum += k; }
+  ensure_equals( "iteration count incorrect", n, std::size_t(1000) );
+  ensure_equals( "iteration sum incorrect", sum, std::size_t(7*999*1000/2) );
+
+  s.clear();
+  ensure( "cleared set not empty", s.empty() && s.begin() == s.end() );
+}
+
+//! Test that a flat hash map agrees with std::unordered_map under random
+//! inserts and erases
+template<> template<>
+void FlatHash_object::test< 2 >() {
+  set_test_name( "map agrees with std::unordered_map" );
+
+  tk::FlatHashMap< std::size_t, std::size_t > f;
+  std::unordered_map< std::size_t, std::size_t > u;
+  std::mt19937 gen( 7 );
+  std::uniform_int_distribution< std::size_t > key( 0, 2000 ), op( 0, 2 );
+  for (std::size_t i=0; i<50000; ++i) {
+    auto k = key( gen );
+    switch (op( gen )) {
+      case 0: f[k] += i; u[k] += i; break;
+      case 1: f.try_emplace( k, i ); u.try_emplace( k, i ); break;
+      default: ensure_equals( "erase count differs", f.erase(k), u.erase(k) );
+    }
+  }
+
+  ensure_equals( "size differs", f.size(), u.size() );
+  for (const auto& [k,v] : u) {
+    auto i = f.find( k );
+    ensure( "key not found", i != f.end() );
+    ensure_equals( "value differs", i->second, v );
+  }
+  std::size_t n = 0;
+  for (const auto& [k,v] : f) {
+    ++n;
+    ensure_equals( "value differs", v, u.at(k) );
+  }
+  ensure_equals( "iteration count differs", n, u.size() );
+}
+
+//! Test that at() throws for a nonexistent key
+template<> template<>
+void FlatHash_object::test< 3 >() {
+  set_test_name( "map at() throws for nonexistent key" );
+
+  tk::FlatHashMap< std::string, int > m;
+  m["a"] = 1;
+  ensure_equals( "value incorrect", m.at("a"), 1 );
+  try {
+    m.at( "b" );
+    fail( "should throw exception" );
+  }
+  catch ( tk::Exception& ) {
+    // exception thrown, test ok
+  }
+}
+
+//! Test that mesh primitive hashes do not depend on the order of node ids
+template<> template<>
+void FlatHash_object::test< 4 >() {
+  set_test_name( "order-independent and canonical face hashes" );
+
+  using tk::UnsMesh;
+  UnsMesh::Face a{{ 3, 1, 2 }}, b{{ 2, 3, 1 }}, c{{ 1, 2, 3 }};
+  ensure_equals( "hash depends on node order", UnsMesh::Hash<3>()(a),
+                 UnsMesh::Hash<3>()(b) );
+  ensure( "faces not equal", UnsMesh::Eq<3>()( a, b ) );
+  ensure( "canonical order incorrect", UnsMesh::canonical(a) == c );
+  ensure_equals( "canonical hash differs from hash",
+                 UnsMesh::CanonicalHash<3>()( UnsMesh::canonical(b) ),
+                 UnsMesh::Hash<3>()(a) );
+
+  UnsMesh::CanonicalFaceSet faces;
+  faces.insert( UnsMesh::canonical(a) );
+  ensure( "face not found", faces.count( UnsMesh::canonical(b) ) );
+  ensure( "nonexistent face found",
+          !faces.count( UnsMesh::canonical< 3 >( {{ 1, 2, 4 }} ) ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
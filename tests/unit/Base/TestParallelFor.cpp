@@ -0,0 +1,121 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestParallelFor.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/ParallelFor.hpp
+  \details   Unit tests for Base/ParallelFor.hpp
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <vector>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "ParallelFor.hpp"
+#include "Types.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct ParallelFor_common {};
+
+//! Test group shortcuts
+using ParallelFor_group = test_group< ParallelFor_common, MAX_TESTS_IN_GROUP >;
+using ParallelFor_object = ParallelFor_group::object;
+
+//! Define test group
+static ParallelFor_group ParallelFor( "Base/ParallelFor" );
+
+//! Test definitions for group
+
+//! Test that chunks cover the range exactly once and start at whole grains
+template<> template<>
+void ParallelFor_object::test< 1 >() {
+  set_test_name( "chunks cover range" );
+
+  const std::size_t begin = 3, end = 1000, grain = 64;
+  for (std::size_t nthread : std::vector< std::size_t >{ 1, 2, 3, 7, 32 }) {
+    // each chunk only writes entries of its own indices
+    std::vector< std::size_t > count( end, 0 ), start( end, 0 );
+    tk::parallel_for( nthread, begin, end, grain,
+      [&]( std::size_t b, std::size_t e ){
+        start[b] = 1;
+        for (auto i=b; i<e; ++i) ++count[i];
+      } );
+    for (std::size_t i=0; i<end; ++i) {
+      ensure_equals( "index not processed exactly once", count[i],
+                     static_cast< std::size_t >( i >= begin ) );
+      if (start[i])
+        ensure_equals( "chunk does not start at a whole grain",
+                       (i-begin) % grain, std::size_t(0) );
+    }
+    ensure( "first chunk does not start at beginning of range", start[begin] );
+  }
+}
+
+//! Test that an empty range does not call the loop body
+template<> template<>
+void ParallelFor_object::test< 2 >() {
+  set_test_name( "empty range" );
+
+  std::size_t ncall = 0;
+  tk::parallel_for( 4, 10, 10, 8,
+    [&]( std::size_t, std::size_t ){ ++ncall; } );
+  ensure_equals( "loop body called for empty range", ncall,
+                 std::size_t(0) );
+}
+
+//! Test that a gather into owned entries is bitwise identical for any number
+//! of threads
+template<> template<>
+void ParallelFor_object::test< 3 >() {
+  set_test_name( "results independent of number of threads" );
+
+  const std::size_t n = 5000;
+  std::vector< tk::real > x( n );
+  for (std::size_t i=0; i<n; ++i) x[i] = std::sin( static_cast<double>(i) );
+
+  // sum of neighbors into each entry, gathered by its owner
+  auto gather = [&]( std::size_t nthread ){
+    std::vector< tk::real > y( n, 0.0 );
+    tk::parallel_for( nthread, 0, n, 16,
+      [&]( std::size_t b, std::size_t e ){
+        for (auto i=b; i<e; ++i)
+          for (std::size_t j=(i<3 ? 0 : i-3); j<std::min(n,i+4); ++j)
+            y[i] += x[j] / 3.0;
+      } );
+    return y;
+  };
+
+  const auto serial = gather( 1 );
+  for (std::size_t nthread : std::vector< std::size_t >{ 2, 4, 13 })
+    ensure( "threaded result differs from serial", gather(nthread) == serial );
+}
+
+//! Test that an exception thrown by the loop body reaches the caller
+template<> template<>
+void ParallelFor_object::test< 4 >() {
+  set_test_name( "exception propagates to caller" );
+
+  try {
+    tk::parallel_for( 4, 0, 100, 1,
+      []( std::size_t b, std::size_t e ){
+        for (auto i=b; i<e; ++i) if (i == 42) Throw( "index 42" );
+      } );
+    fail( "should throw exception" );
+  }
+  catch ( tk::Exception& ) {
+    // exception thrown, test ok
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
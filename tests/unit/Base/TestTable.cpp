@@ -0,0 +1,118 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Table.hpp
+  \details   Unit tests for Base/Table.hpp
+*/
+// *****************************************************************************
+
+#include <random>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Table.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Table_common {
+
+  //! Sample table by linear search as a reference
+  tk::real linear( tk::real x, const tk::Table& table ) const {
+    if (x < table.front().first) return table.front().second;
+    for (std::size_t i=0; i<table.size()-1; ++i) {
+      const auto& [x0,y0] = table[i];
+      const auto& [x1,y1] = table[i+1];
+      if (x0 <= x && x < x1) return y0 + (y1-y0)*(x-x0)/(x1-x0);
+    }
+    return table.back().second;
+  }
+
+  //! Generate table with n rows of random spacing on [0,1]
+  //! \param[in] n Number of rows
+  //! \param[in] uniform True to generate uniformly spaced rows
+  tk::Table table( std::size_t n, bool uniform ) const {
+    std::mt19937 gen( 7 );
+    std::uniform_real_distribution< tk::real > u( 0.0, 1.0 );
+    tk::Table t;
+    tk::real x = 0.0;
+    for (std::size_t i=0; i<n; ++i) {
+      t.emplace_back( x, u(gen) );
+      x += uniform ? 1.0/static_cast<tk::real>(n-1) : u(gen)*u(gen)*u(gen);
+    }
+    return t;
+  }
+};
+
+//! Test group shortcuts
+using Table_group = test_group< Table_common, MAX_TESTS_IN_GROUP >;
+using Table_object = Table_group::object;
+
+//! Define test group
+static Table_group Table( "Base/Table" );
+
+//! Test definitions for group
+
+//! Test tk::sample and tk::IndexedTable against linear search
+template<> template<>
+void Table_object::test< 1 >() {
+  set_test_name( "sample agrees with linear search" );
+
+  for (bool uniform : { true, false }) {
+    auto t = table( 100, uniform );
+    tk::IndexedTable it( t );
+    auto lo = t.front().first - 0.1, hi = t.back().first + 0.1;
+    std::mt19937 gen( 8 );
+    std::uniform_real_distribution< tk::real > u( lo, hi );
+    for (std::size_t s=0; s<10000; ++s) {
+      auto x = u(gen);
+      auto y = linear( x, t );
+      ensure_equals( "sample incorrect", tk::sample(x,t), y, 1.0e-14 );
+      ensure_equals( "indexed sample incorrect", it(x), y, 1.0e-14 );
+    }
+    // sample exactly at the rows
+    for (const auto& [x,y] : t) {
+      ensure_equals( "sample at row incorrect", tk::sample(x,t), y, 1.0e-14 );
+      ensure_equals( "indexed sample at row incorrect", it(x), y, 1.0e-14 );
+    }
+  }
+}
+
+//! Test sampling tk::IndexedTable at multiple abscissas
+template<> template<>
+void Table_object::test< 2 >() {
+  set_test_name( "batch sample" );
+
+  auto t = table( 37, false );
+  tk::IndexedTable it( t );
+  std::vector< tk::real > x{ -1.0, 0.0, 0.1, 0.5, t.back().first, 1.0e3 };
+  std::vector< tk::real > y( x.size() );
+  it.sample( x.size(), x.data(), y.data() );
+  for (std::size_t i=0; i<x.size(); ++i)
+    ensure_equals( "batch sample incorrect", y[i], tk::sample(x[i],t),
+                   1.0e-14 );
+}
+
+//! Test sampling single-row tables
+template<> template<>
+void Table_object::test< 3 >() {
+  set_test_name( "single row" );
+
+  tk::Table t{ { 1.0, 3.0 } };
+  tk::IndexedTable it( t );
+  for (auto x : { 0.0, 1.0, 2.0 }) {
+    ensure_equals( "sample incorrect", tk::sample(x,t), 3.0, 1.0e-14 );
+    ensure_equals( "indexed sample incorrect", it(x), 3.0, 1.0e-14 );
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -128,6 +128,30 @@ void Vector_object::test< 6 >() {
   ensure_equals( "unit incorrect", tk::length(v2), 1.0, precision );
 }
 
+//! Test inverse of 3x3 matrix and matrix-vector product
+template<> template<>
+void Vector_object::test< 7 >() {
+  set_test_name( "inverse and matvec" );
+
+  std::array< std::array< tk::real, 3 >, 3 >
+    a{{ {{ 4.0, -2.0, 1.0 }}, {{ -2.0, 4.0, -2.0 }}, {{ 1.0, -2.0, 4.0 }} }};
+  std::array< tk::real, 3 > b{{ 11.0, -16.0, 17.0 }};
+
+  const auto ainv = tk::inverse( a );
+  for (std::size_t i=0; i<3; ++i)
+    for (std::size_t j=0; j<3; ++j)
+      ensure_equals( "inverse incorrect", tk::dot( a[i],
+        {{ ainv[0][j], ainv[1][j], ainv[2][j] }} ), i==j ? 1.0 : 0.0,
+        precision );
+
+  const auto x = tk::matvec( ainv, b ), xc = tk::cramer( a, b );
+  const std::array< tk::real, 3 > correct_result{{ 1.0, -2.0, 3.0 }};
+  for (std::size_t i=0; i<3; ++i) {
+    ensure_equals( "matvec incorrect", x[i], correct_result[i], 1.0e-14 );
+    ensure_equals( "matvec differs from cramer", x[i], xc[i], 1.0e-14 );
+  }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
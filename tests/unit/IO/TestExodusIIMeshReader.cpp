@@ -12,6 +12,10 @@
 
 #include <iterator>
 #include <algorithm>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <iomanip>
 
 #include "NoWarning/tut.hpp"
 
@@ -21,6 +25,7 @@
 #include "QuinoaConfig.hpp"
 #include "ExodusIIMeshReader.hpp"
 #include "Reorder.hpp"
+#include "Timer.hpp"
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 
@@ -1775,6 +1780,81 @@ void ExodusIIMeshReader_object::test< 8 >() {
   ensure( "element connectivity incorrect", inpoel == box24_inpoel );
 }
 
+//! Test bulk read of node coordinates against reading the whole mesh
+template<> template<>
+void ExodusIIMeshReader_object::test< 9 >() {
+  set_test_name( "bulk coordinate read with gap-merging" );
+
+  // Read in all of the mesh from file as reference
+  tk::UnsMesh inmesh;
+  std::string infile( tk::regression_dir() +
+                      "/meshconv/exo_output/shear_5blocks_coarse.exo" );
+  tk::ExodusIIMeshReader er( infile );
+  er.readMesh( inmesh );
+
+  // Request a shuffled subset of node IDs, including a duplicate
+  std::vector< std::size_t > gid;
+  for (std::size_t p=0; p<inmesh.size(); p+=3) gid.push_back( p );
+  gid.push_back( gid[ gid.size()/2 ] );
+  std::shuffle( begin(gid), end(gid), std::mt19937(0) );
+
+  // Read requested coordinates in bulk using various gap thresholds
+  std::vector< std::size_t > gaps{ 0, 1, 2, 17, tk::ExoMaxNodeGap,
+                                   inmesh.size() };
+  for (auto maxgap : gaps) {
+    auto coord = er.readCoords( gid, maxgap );
+    for (std::size_t i=0; i<gid.size(); ++i) {
+      ensure_equals( "x coord incorrect, maxgap " + std::to_string(maxgap),
+                     coord[0][i], inmesh.x()[gid[i]], 1.0e-15 );
+      ensure_equals( "y coord incorrect, maxgap " + std::to_string(maxgap),
+                     coord[1][i], inmesh.y()[gid[i]], 1.0e-15 );
+      ensure_equals( "z coord incorrect, maxgap " + std::to_string(maxgap),
+                     coord[2][i], inmesh.z()[gid[i]], 1.0e-15 );
+    }
+  }
+
+  // Reading no nodes yields no coordinates
+  auto none = er.readCoords( {} );
+  ensure( "coordinates of no nodes must be empty",
+          none[0].empty() && none[1].empty() && none[2].empty() );
+}
+
+//! Micro-benchmark node-by-node vs. bulk read of node coordinates
+template<> template<>
+void ExodusIIMeshReader_object::test< 10 >() {
+  set_test_name( "bulk coordinate read throughput" );
+
+  std::string infile( tk::regression_dir() +
+                      "/meshconv/exo_output/shear_5blocks_coarse.exo" );
+  tk::ExodusIIMeshReader er( infile );
+
+  // Request all nodes of the mesh in random order
+  std::vector< std::size_t > gid( er.npoin() );
+  std::iota( begin(gid), end(gid), 0 );
+  std::shuffle( begin(gid), end(gid), std::mt19937(0) );
+
+  const std::size_t nrep = 10;
+
+  // Read node coordinates one by one
+  std::array< tk::real, 3 > c;
+  tk::Timer t;
+  for (std::size_t r=0; r<nrep; ++r)
+    for (auto g : gid) er.readNode( g, c );
+  auto single = static_cast< tk::real >( nrep*gid.size() ) / t.dsec();
+
+  // Read node coordinates in bulk
+  t.zero();
+  for (std::size_t r=0; r<nrep; ++r) er.readCoords( gid );
+  auto bulk = static_cast< tk::real >( nrep*gid.size() ) / t.dsec();
+
+  // Report throughputs via the test name
+  std::stringstream ss;
+  ss << "bulk coordinate read throughput: " << std::scientific
+     << std::setprecision(2) << single << " (single), " << bulk
+     << " (bulk) nodes/s";
+  set_test_name( ss.str() );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
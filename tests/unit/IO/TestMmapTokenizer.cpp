@@ -0,0 +1,161 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/IO/TestMmapTokenizer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for IO/MmapTokenizer.hpp
+  \details   Unit tests for IO/MmapTokenizer.hpp
+*/
+// *****************************************************************************
+
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <cstdlib>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "MmapTokenizer.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct MmapTokenizer_common {
+  //! Temporary file removed when going out of scope, even if a test fails
+  struct TmpFile {
+    //! Constructor
+    //! \param[in] n File name
+    explicit TmpFile( const std::string& n ) : name( n ) {}
+    //! Destructor: remove file
+    ~TmpFile() { std::remove( name.c_str() ); }
+    //! Don't permit copy constructor
+    TmpFile( const TmpFile& ) = delete;
+    //! Don't permit copy assignment
+    TmpFile& operator=( const TmpFile& ) = delete;
+    const std::string name;     //!< File name
+  };
+};
+
+//! Test group shortcuts
+using MmapTokenizer_group =
+  test_group< MmapTokenizer_common, MAX_TESTS_IN_GROUP >;
+using MmapTokenizer_object = MmapTokenizer_group::object;
+
+//! Define test group
+static MmapTokenizer_group MmapTokenizer( "IO/MmapTokenizer" );
+
+//! Test definitions for group
+
+//! Test parsing words, lines, integers, and reals
+template<> template<>
+void MmapTokenizer_object::test< 1 >() {
+  set_test_name( "parse words, lines, integers, reals" );
+
+  TmpFile tmp( "mmaptokenizer_1.txt" );
+  {
+    std::ofstream f( tmp.name );
+    f << "$MeshFormat\r\n2.2 0 8\n  -42 +7 1.5e-3 -0.25 3 1E2\n"
+         "0.1234567890123456789 1e-400\n";
+  }
+
+  tk::MmapTokenizer t( tmp.name );
+  ensure_equals( "line incorrect", t.line(), "$MeshFormat" );
+  ensure_equals( "real incorrect", t.real(), 2.2, 0.0 );
+  ensure_equals( "int incorrect", t.integer< int >(), 0 );
+  ensure_equals( "word incorrect", t.word(), "8" );
+  ensure_equals( "negative int incorrect", t.integer< int >(), -42 );
+  ensure_equals( "positive int incorrect", t.integer< long >(), 7L );
+  ensure_equals( "exponent incorrect", t.real(), 1.5e-3, 0.0 );
+  ensure_equals( "negative real incorrect", t.real(), -0.25, 0.0 );
+  ensure_equals( "integral real incorrect", t.real(), 3.0, 0.0 );
+  ensure_equals( "capital exponent incorrect", t.real(), 100.0, 0.0 );
+  ensure_equals( "long real incorrect", t.real(),
+                 std::strtod( "0.1234567890123456789", nullptr ), 0.0 );
+  ensure_equals( "underflow incorrect", t.real(), 0.0, 0.0 );
+  ensure( "eof not detected", t.eof() );
+}
+
+//! Test that parsing garbage throws
+template<> template<>
+void MmapTokenizer_object::test< 2 >() {
+  set_test_name( "throws on garbage" );
+
+  TmpFile tmp( "mmaptokenizer_2.txt" );
+  {
+    std::ofstream f( tmp.name );
+    f << "abc";
+  }
+
+  tk::MmapTokenizer t( tmp.name );
+  try {
+    t.integer< int >();
+    fail( "should throw exception" );
+  }
+  catch ( tk::Exception& ) {}
+  try {
+    t.real();
+    fail( "should throw exception" );
+  }
+  catch ( tk::Exception& ) {}
+}
+
+//! Test parsing lines in parallel chunks
+template<> template<>
+void MmapTokenizer_object::test< 3 >() {
+  set_test_name( "parse lines in parallel" );
+
+  const std::size_t n = 100000;
+  TmpFile tmp( "mmaptokenizer_3.txt" );
+  {
+    std::ofstream f( tmp.name );
+    f << n << '\n';
+    for (std::size_t i=0; i<n; ++i)
+      f << i << ' ' << std::setprecision(16) << 1.0/(i+1.0) << '\n';
+    f << "$End\n";
+  }
+
+  // parse serially as reference
+  std::vector< std::size_t > sid( n );
+  std::vector< tk::real > sv( n );
+  {
+    tk::MmapTokenizer s( tmp.name, 1 );
+    s.skipLine();
+    for (std::size_t i=0; i<n; ++i) {
+      sid[i] = s.integer< std::size_t >();
+      sv[i] = s.real();
+      s.skipLine();
+    }
+  }
+
+  tk::MmapTokenizer t( tmp.name, 4 );
+  auto m = t.integer< std::size_t >();
+  ensure_equals( "number of lines incorrect", m, n );
+  t.skipLine();
+
+  std::vector< std::size_t > id( n );
+  std::vector< tk::real > v( n );
+  t.parallel( n, [&]( tk::TokenCursor& c, std::size_t first, std::size_t last ){
+    for (auto i=first; i<last; ++i) {
+      id[i] = c.integer< std::size_t >();
+      v[i] = c.real();
+      c.skipLine();
+    }
+  } );
+
+  for (std::size_t i=0; i<n; ++i) {
+    ensure_equals( "id incorrect", id[i], i );
+    ensure_equals( "id differs from serial parse", id[i], sid[i] );
+    ensure( "value differs from serial parse", v[i] == sv[i] );
+  }
+  ensure_equals( "position after parallel parse incorrect", t.line(), "$End" );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
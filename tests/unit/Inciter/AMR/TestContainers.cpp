@@ -0,0 +1,229 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Inciter/AMR/TestContainers.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for AMR containers in Inciter/AMR/id_map.hpp and
+    Inciter/AMR/edge_map.hpp
+  \details   Unit tests for AMR containers in Inciter/AMR/id_map.hpp and
+    Inciter/AMR/edge_map.hpp. The containers are exercised with a random
+    sequence of insertions, updates, and erasures and compared against the
+    ordered standard library containers they replace.
+*/
+// *****************************************************************************
+
+#include <map>
+#include <set>
+#include <random>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "ContainerUtil.hpp"
+#include "AMR/AMR_types.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct AMRContainers_common {};
+
+//! Test group shortcuts
+using AMRContainers_group =
+  test_group< AMRContainers_common, MAX_TESTS_IN_GROUP >;
+using AMRContainers_object = AMRContainers_group::object;
+
+//! Define test group
+static AMRContainers_group AMRContainers( "Inciter/AMR/Containers" );
+
+//! Test definitions for group
+
+//! Test id_map_t against std::map
+template<> template<>
+void AMRContainers_object::test< 1 >() {
+  set_test_name( "id_map_t behaves as std::map" );
+
+  AMR::id_map_t< AMR::tet_t > m;
+  std::map< std::size_t, AMR::tet_t > r;
+
+  std::mt19937 gen( 1 );
+  for (std::size_t i=0; i<100000; ++i) {
+    auto id = gen() % 2000;
+    auto op = gen() % 3;
+    if (op == 0) {
+      AMR::tet_t t{{ id, id+1, id+2, id+3 }};
+      ensure_equals( "insert result incorrect",
+                     m.insert( {id,t} ).second, r.insert( {id,t} ).second );
+    } else if (op == 1) {
+      ensure_equals( "erase result incorrect", m.erase(id), r.erase(id) );
+    } else {
+      ++m[id][0];
+      ++r[id][0];
+    }
+  }
+
+  ensure_equals( "size incorrect", m.size(), r.size() );
+  auto e = r.cbegin();
+  for (const auto& [ id, t ] : m) {
+    ensure_equals( "iteration order incorrect", id, e->first );
+    ensure( "value incorrect", t == e->second );
+    ++e;
+  }
+  ensure( "end of iteration incorrect", e == r.cend() );
+
+  const auto& cm = m;
+  for (const auto& [ id, t ] : r) {
+    auto f = cm.find( id );
+    ensure( "find failed", f != end(cm) );
+    ensure( "find value incorrect", f->second == t );
+    ensure( "at value incorrect", cm.at(id) == t );
+  }
+  ensure( "find of missing id incorrect", cm.find( 5000 ) == end(cm) );
+  ensure_equals( "count of missing id incorrect", cm.count( 5000 ), 0UL );
+
+  m.clear();
+  ensure( "clear failed", m.empty() && m.begin() == m.end() );
+}
+
+//! Test edge_map_t against std::map
+template<> template<>
+void AMRContainers_object::test< 2 >() {
+  set_test_name( "edge_map_t behaves as std::map" );
+
+  AMR::edges_t m;
+  std::map< AMR::edge_t, AMR::Edge_Refinement > r;
+
+  std::mt19937 gen( 2 );
+  for (std::size_t i=0; i<200000; ++i) {
+    AMR::edge_t k( gen() % 200, gen() % 200 );
+    auto op = gen() % 3;
+    if (op == 0) {
+      AMR::Edge_Refinement v( k.first(), k.second(), 0, false,
+                              AMR::Edge_Lock_Case::unlocked );
+      ensure_equals( "insert result incorrect",
+                     m.insert( {k,v} ).second, r.insert( {k,v} ).second );
+    } else if (op == 1) {
+      ensure_equals( "erase result incorrect", m.erase(k), r.erase(k) );
+    } else {
+      ++m[k].needs_refining;
+      ++r[k].needs_refining;
+    }
+  }
+
+  ensure_equals( "size incorrect", m.size(), r.size() );
+  std::size_t n = 0;
+  for (const auto& [ k, v ] : m) {
+    const auto& e = tk::cref_find( r, k );
+    ensure_equals( "value incorrect", v.needs_refining, e.needs_refining );
+    ensure_equals( "node A incorrect", v.A, e.A );
+    ++n;
+  }
+  ensure_equals( "number of entries iterated incorrect", n, r.size() );
+  for (const auto& [ k, v ] : r)
+    ensure_equals( "lookup incorrect",
+                   tk::cref_find( m, k ).needs_refining, v.needs_refining );
+  ensure( "find of missing edge incorrect",
+          m.find( AMR::edge_t(1000,1001) ) == end(m) );
+}
+
+//! Test id_set_t against std::set
+template<> template<>
+void AMRContainers_object::test< 3 >() {
+  set_test_name( "id_set_t behaves as std::set" );
+
+  AMR::id_set_t s;
+  std::set< std::size_t > r;
+
+  std::mt19937 gen( 3 );
+  for (std::size_t i=0; i<50000; ++i) {
+    auto id = gen() % 1000;
+    if (gen() % 2)
+      ensure_equals( "insert result incorrect",
+                     s.insert(id), r.insert(id).second );
+    else
+      ensure_equals( "erase result incorrect", s.erase(id), r.erase(id) );
+  }
+
+  ensure_equals( "size incorrect", s.size(), r.size() );
+  ensure( "contents incorrect",
+          std::equal( s.begin(), s.end(), r.begin(), r.end() ) );
+}
+
+//! Test inserting into id_map_t and id_set_t while iterating after erasing
+template<> template<>
+void AMRContainers_object::test< 4 >() {
+  set_test_name( "insert during iteration after erase" );
+
+  // Mimic AMR: insert children, with ids issued after the largest ever
+  // issued, while iterating over the elements, after the elements with the
+  // largest ids have been erased by a derefinement
+  AMR::id_map_t< AMR::tet_t > m;
+  AMR::id_set_t s;
+  std::map< std::size_t, AMR::tet_t > r;
+  std::set< std::size_t > rs;
+  for (std::size_t id=0; id<3000; ++id) {
+    AMR::tet_t t{{ id, id+1, id+2, id+3 }};
+    m.emplace( id, t );
+    r.emplace( id, t );
+    s.insert( id );
+    rs.insert( id );
+  }
+  for (std::size_t id=1000; id<3000; ++id) {
+    m.erase( id );
+    r.erase( id );
+    s.erase( id );
+    rs.erase( id );
+  }
+
+  // Refine every 10th element of those that exist before iterating
+  auto refine = []( auto& c, std::size_t& next ){
+    std::vector< std::size_t > visited;
+    for (const auto& kv : c) {
+      visited.push_back( kv.first );
+      if (kv.first < 1000 && kv.first % 10 == 0)
+        for (std::size_t i=0; i<8; ++i, ++next)
+          c.emplace( next, AMR::tet_t{{ next, next, next, next }} );
+    }
+    return visited;
+  };
+  std::size_t nm = 3000, nr = 3000;
+  auto vm = refine( m, nm );
+  auto vr = refine( r, nr );
+  ensure( "visited ids incorrect", vm == vr );
+  ensure_equals( "size incorrect", m.size(), r.size() );
+  ensure( "contents incorrect", std::equal( m.begin(), m.end(), r.begin(),
+            r.end(), []( const auto& a, const auto& b ){
+              return a.first == b.first && a.second == b.second; } ) );
+
+  std::vector< std::size_t > vs, vrs;
+  std::size_t ns = 3000, nrs = 3000;
+  for (auto id : s) {
+    vs.push_back( id );
+    if (id < 1000 && id % 10 == 0) s.insert( ns++ );
+  }
+  for (auto id : rs) {
+    vrs.push_back( id );
+    if (id < 1000 && id % 10 == 0) rs.insert( nrs++ );
+  }
+  ensure( "visited set ids incorrect", vs == vrs );
+  ensure( "set contents incorrect",
+          std::equal( s.begin(), s.end(), rs.begin(), rs.end() ) );
+
+  // Erase all but the largest ids and iterate again
+  for (std::size_t id=0; id<nm-1; ++id) m.erase( id );
+  for (std::size_t id=0; id<ns-1; ++id) s.erase( id );
+  ensure_equals( "size after erase incorrect", m.size(), 1UL );
+  ensure_equals( "id after erase incorrect", m.begin()->first, nm-1 );
+  ensure( "iteration after erase incorrect", ++m.begin() == m.end() );
+  ensure( "set iteration after erase incorrect",
+          s.begin() != s.end() && *s.begin() == ns-1 &&
+          ++s.begin() == s.end() );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
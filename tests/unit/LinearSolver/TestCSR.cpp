@@ -14,6 +14,8 @@
 
 #include "TUTConfig.hpp"
 #include "CSR.hpp"
+#include "SELL.hpp"
+#include "Preconditioner.hpp"
 #include "Reorder.hpp"
 #include "DerivedData.hpp"
 #include "Vector.hpp"
@@ -61,6 +63,38 @@ struct CSR_common {
     {{ 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 }},
     {{ 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 }},
     {{ 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 }} }};
+
+  //! Assemble Laplacian on the simple mesh above with a Dirichlet node
+  //! \return Assembled matrix
+  tk::CSR laplacian() {
+    tk::shiftToZero( inpoel );
+    auto psup = tk::genPsup( inpoel, 4, tk::genEsup(inpoel,4) );
+    tk::CSR A( 1, psup );
+    const auto& X = coord[0];
+    const auto& Y = coord[1];
+    const auto& Z = coord[2];
+    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      const std::array< std::size_t, 4 >
+        N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+      const std::array< tk::real, 3 >
+        ba{{ X[N[1]]-X[N[0]], Y[N[1]]-Y[N[0]], Z[N[1]]-Z[N[0]] }},
+        ca{{ X[N[2]]-X[N[0]], Y[N[2]]-Y[N[0]], Z[N[2]]-Z[N[0]] }},
+        da{{ X[N[3]]-X[N[0]], Y[N[3]]-Y[N[0]], Z[N[3]]-Z[N[0]] }};
+      const auto J = tk::triple( ba, ca, da );
+      std::array< std::array< tk::real, 3 >, 4 > grad;
+      grad[1] = tk::crossdiv( ca, da, J );
+      grad[2] = tk::crossdiv( da, ba, J );
+      grad[3] = tk::crossdiv( ba, ca, J );
+      for (std::size_t i=0; i<3; ++i)
+        grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+      for (std::size_t a=0; a<4; ++a)
+        for (std::size_t k=0; k<3; ++k)
+           for (std::size_t b=0; b<4; ++b)
+             A(N[a],N[b]) += J/6 * grad[a][k] * grad[b][k];
+    }
+    A.dirichlet( 0 );
+    return A;
+  }
 };
 
 //! Test group shortcuts
@@ -355,6 +389,100 @@ void CSR_object::test< 9 >() {
                    r[i], correct[i], prec );
 }
 
+//! Test extracting the diagonal
+template<> template<>
+void CSR_object::test< 10 >() {
+  set_test_name( "diag" );
+
+  auto A = laplacian();
+  auto d = A.diag();
+  ensure_equals( "diagonal size incorrect", d.size(), A.rsize() );
+  for (std::size_t i=0; i<d.size(); ++i)
+    ensure_equals( "incorrect diagonal", d[i], A(i,i), 0.0 );
+}
+
+//! Test that SELL-C-sigma matrix-vector multiply equals that of CSR
+template<> template<>
+void CSR_object::test< 11 >() {
+  set_test_name( "SELL-C-sigma matrix-vector multiply" );
+
+  auto A = laplacian();
+  auto npoin = A.rsize();
+
+  std::vector< tk::real > x( npoin );
+  std::iota( begin(x), end(x), 0.0 );
+  std::vector< tk::real > r( npoin ), s( npoin );
+  A.mult( x, r );
+
+  tk::real prec = std::numeric_limits< tk::real >::epsilon()*100;
+
+  // sort rows within windows of a single chunk and across all rows
+  for (std::size_t sigma : { tk::SELL::C, 32*tk::SELL::C }) {
+    tk::SELL S( A, sigma );
+    ensure_equals( "SELL::rsize incorrect", S.rsize(), npoin );
+    ensure( "SELL stores fewer entries than nonzeros",
+            S.nstored() >= A.values().size() );
+    S.mult( x, s );
+    for (std::size_t i=0; i<npoin; ++i)
+      ensure_equals( "incorrect SELL matrix-vector product", s[i], r[i],
+                     prec );
+  }
+}
+
+//! Test Jacobi preconditioner
+template<> template<>
+void CSR_object::test< 12 >() {
+  set_test_name( "Jacobi preconditioner" );
+
+  auto A = laplacian();
+  auto d = A.diag();
+  tk::Preconditioner M( tk::CGPrecond::JACOBI, A, d );
+
+  std::vector< tk::real > r( A.rsize() ), z( A.rsize() );
+  std::iota( begin(r), end(r), 1.0 );
+  M.apply( r, z );
+
+  for (std::size_t i=0; i<r.size(); ++i)
+    ensure_equals( "incorrect Jacobi preconditioner", z[i], r[i]/d[i],
+                   1.0e-14 );
+}
+
+//! Test ILU(0) preconditioner on a tridiagonal matrix, where it is exact
+template<> template<>
+void CSR_object::test< 13 >() {
+  set_test_name( "ILU(0) preconditioner" );
+
+  // points surrounding points of a chain of nodes
+  const std::size_t n = 10;
+  std::pair< std::vector< std::size_t >, std::vector< std::size_t > > psup;
+  psup.first.push_back( 0 );
+  psup.second.push_back( 0 );
+  for (std::size_t i=0; i<n; ++i) {
+    if (i > 0) psup.first.push_back( i-1 );
+    if (i < n-1) psup.first.push_back( i+1 );
+    psup.second.push_back( psup.first.size()-1 );
+  }
+
+  // 1D Laplacian with a nonuniform diagonal
+  tk::CSR A( 1, psup );
+  for (std::size_t i=0; i<n; ++i) {
+    A(i,i) = 2.0 + 0.1*static_cast< tk::real >( i );
+    if (i > 0) A(i,i-1) = -1.0;
+    if (i < n-1) A(i,i+1) = -1.0;
+  }
+
+  tk::Preconditioner M( tk::CGPrecond::ILU0, A, A.diag() );
+
+  std::vector< tk::real > r( n ), z( n ), Az( n );
+  std::iota( begin(r), end(r), 1.0 );
+  M.apply( r, z );
+  A.mult( z, Az );
+
+  for (std::size_t i=0; i<n; ++i)
+    ensure_equals( "ILU(0) not exact for tridiagonal matrix", Az[i], r[i],
+                   1.0e-12 );
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
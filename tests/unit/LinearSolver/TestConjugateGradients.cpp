@@ -10,6 +10,8 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
@@ -37,7 +39,230 @@ namespace tut {
 #endif
 
 //! All tests in group inherited from this base
-struct ConjugateGradients_common {};
+struct ConjugateGradients_common {
+
+  //! Relative tolerance to solve to
+  static constexpr tk::real tol = 1.0e-8;
+  //! Max number of iterations the solver is allowed to take
+  static constexpr std::size_t maxit = 100;
+  //! Number of iterations unpreconditioned CG takes to converge to tol
+  static constexpr std::size_t nit = 18;
+
+  //! Add element contributions of a diffusion-reaction operator to a matrix
+  //! \param[in,out] A Sparse matrix to add to
+  //! \param[in] inpoel Mesh connectivity
+  //! \param[in] coord Mesh node coordinates
+  //! \details The diffusivity varies by two orders of magnitude across the
+  //!   domain so that preconditioning pays off, and the consistent mass matrix
+  //!   makes the operator symmetric positive definite without imposing
+  //!   boundary conditions.
+  static void assemble( tk::CSR& A,
+                        const std::vector< std::size_t >& inpoel,
+                        const std::array< std::vector< tk::real >, 3 >& coord )
+  {
+    const auto& X = coord[0];
+    const auto& Y = coord[1];
+    const auto& Z = coord[2];
+
+    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // access node IDs
+      const std::array< std::size_t, 4 >
+        N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+      // compute element Jacobi determinant
+      const std::array< tk::real, 3 >
+        ba{{ X[N[1]]-X[N[0]], Y[N[1]]-Y[N[0]], Z[N[1]]-Z[N[0]] }},
+        ca{{ X[N[2]]-X[N[0]], Y[N[2]]-Y[N[0]], Z[N[2]]-Z[N[0]] }},
+        da{{ X[N[3]]-X[N[0]], Y[N[3]]-Y[N[0]], Z[N[3]]-Z[N[0]] }};
+      const auto J = tk::triple( ba, ca, da );        // J = 6V
+      Assert( J > 0, "Element Jacobian non-positive" );
+
+      // shape function derivatives, nnode*ndim [4][3]
+      std::array< std::array< tk::real, 3 >, 4 > grad;
+      grad[1] = tk::crossdiv( ca, da, J );
+      grad[2] = tk::crossdiv( da, ba, J );
+      grad[3] = tk::crossdiv( ba, ca, J );
+      for (std::size_t i=0; i<3; ++i)
+        grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+
+      // diffusivity at element centroid, between 1 and 100 in the unit cube
+      auto xc = (X[N[0]] + X[N[1]] + X[N[2]] + X[N[3]]) / 4.0;
+      auto yc = (Y[N[0]] + Y[N[1]] + Y[N[2]] + Y[N[3]]) / 4.0;
+      auto zc = (Z[N[0]] + Z[N[1]] + Z[N[2]] + Z[N[3]]) / 4.0;
+      auto k = std::pow( 100.0, xc + yc + zc + 0.5 );
+
+      for (std::size_t a=0; a<4; ++a)
+        for (std::size_t b=0; b<4; ++b) {
+          for (std::size_t j=0; j<3; ++j)
+            A(N[a],N[b]) += k * J/6 * grad[a][j] * grad[b][j];
+          A(N[a],N[b]) += J/120 * (a == b ? 2.0 : 1.0);
+        }
+    }
+  }
+
+  //! Set up CG solve of diffusion-reaction on a simple mesh in serial
+  //! \param[in] label Test label
+  //! \param[in] opt CG options
+  //! \param[in] iter Max number of iterations expected to converge to tol
+  void serial( const std::string& label,
+               const tk::CGOptions& opt,
+               std::size_t iter )
+  {
+    // Mesh connectivity for simple tetrahedron-only mesh
+    std::vector< std::size_t > inpoel { 
+      3, 13, 8, 14,
+      12, 3, 13, 8,
+      8, 3, 14, 11,
+      12, 3, 8, 11,
+      1, 2, 3, 13,
+      6, 13, 7, 8,
+      5, 9, 14, 11,
+      5, 1, 3, 14,
+      10, 4, 12, 11,
+      2, 6, 12, 13,
+      8, 7, 9, 14,
+      13, 1, 7, 14,
+      5, 3, 4, 11,
+      6, 10, 12, 8,
+      3, 2, 4, 12,
+      10, 8, 9, 11,
+      3, 1, 13, 14,
+      13, 7, 8, 14,
+      6, 12, 13, 8,
+      9, 8, 14, 11,
+      3, 5, 14, 11,
+      4, 3, 12, 11,
+      3, 2, 12, 13,
+      10, 12, 8, 11 };
+
+    // Mesh node coordinates for simple tet mesh above
+    std::array< std::vector< tk::real >, 3 > coord {{
+      {{ -0.5, -0.5, -0.5, -0.5, -0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0, 0, 0, 0 }},
+      {{ 0.5, 0.5, 0, -0.5, -0.5, 0.5, 0.5, 0, -0.5, -0.5, -0.5, 0, 0.5, 0 }},
+      {{ -0.5, 0.5, 0, 0.5, -0.5, 0.5, -0.5, 0, -0.5, 0.5, 0, 0.5, 0, -0.5 }} }};
+
+    // Shift node IDs to start from zero
+    tk::shiftToZero( inpoel );
+    // Generate points surrounding points
+    auto psup = tk::genPsup( inpoel, 4, tk::genEsup(inpoel,4) );
+    // Query number of nodes in mesh
+    auto npoin = psup.second.size()-1;
+
+    // Create CSR matrix based on mesh with psup
+    tk::CSR A( /* DOF = */ 1, psup );
+
+    // Fill matrix with diffusion-reaction operator
+    assemble( A, inpoel, coord );
+
+    // Create RHS and solution/unknown vectors
+    std::vector< tk::real > b(npoin), x(npoin,0.0);
+    for (std::size_t i=0; i<npoin; ++i)
+      b[i] = 1.0 + static_cast< tk::real >( i % 5 );
+
+    // Create CG solver (chare array with a single element)
+    tk::CProxy_ConjugateGradients cg =
+      tk::CProxy_ConjugateGradients::ckNew( A, x, b, maxit, tol, {}, {}, {},
+                                            opt, 1 );
+
+    // Create receiver chare whose callbacks are called when a CG task is done
+    CProxy_CGReceiver host =
+      CProxy_CGReceiver::ckNew( label, cg, tol, iter, 1 );
+
+    // Initialize CG solve
+    cg[0].init( CkCallback(CkIndex_CGReceiver::initialized(nullptr), host[0]) );
+  }
+
+  //! Set up CG solve of diffusion-reaction on a simple mesh partitioned to 2
+  //! PEs
+  //! \param[in] label Test label
+  //! \param[in] opt CG options
+  //! \param[in] iter Max number of iterations expected to converge to tol
+  void parallel( const std::string& label,
+                 const tk::CGOptions& opt,
+                 std::size_t iter )
+  {
+    // Initialize psup for PE0 and PE1
+    std::vector< std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > > > psup {
+      { { 0,1,2,4,8,9,0,2,3,7,8,0,1,3,4,5,6,7,8,9,1,2,4,6,7,0,2,3,6,9,2,6,7,8,
+          9,2,3,4,5,7,9,1,2,3,5,6,8,0,1,2,5,7,9,0,2,4,5,6,8 },
+      { 0,5,10,19,24,29,34,40,46,52,58 } },
+      { { 0,5,11,12,4,10,11,8,9,10,7,9,12,1,5,6,8,10,11,0,4,6,7,11,12,4,5,7,8,
+          9,10,11,12,3,5,6,8,9,12,2,4,6,7,9,10,2,3,6,7,8,10,12,1,2,4,6,8,9,11,
+          0,1,4,5,6,10,12,0,3,5,6,7,9,11 },
+      { 0,3,6,9,12,18,24,32,38,44,51,58,65,72 } } };
+
+    // Initialize node coordinates for PE0 and PE1
+    std::vector< std::array< std::vector< tk::real >, 3 > > coord {{
+      {{ {{ -0.5,-0.5,-0.5,-0.5,-0.5,0.5,0,0,0,0 }},
+         {{ 0.5,0.5,0,-0.5,-0.5,0,-0.5,0,0.5,0 }},
+         {{ -0.5,0.5,0,0.5,-0.5,0,0,0.5,0,-0.5 }} }},
+      {{ {{ -0.5,-0.5,-0.5,-0.5,0.5,0.5,0.5,0.5,0.5,0,0,0,0 }},
+         {{ 0.5,0.5,-0.5,-0.5,0.5,0.5,0,-0.5,-0.5,-0.5,0,0.5,0 }},
+         {{ -0.5,0.5,0.5,-0.5,0.5,-0.5,0,-0.5,0.5,0,0.5,0,-0.5 }} }} }};
+
+    // Initialize mesh connectivity for PE0 and PE1
+    std::vector< std::vector< std::size_t > > inpoel {
+      { 2,8,5,9,7,2,8,5,5,2,9,6,7,2,5,6,0,1,2,8,4,0,2,9,4,2,3,6,2,1,3,7,
+        2,0,8,9,2,4,9,6,3,2,7,6,2,1,7,8 },
+      { 4,8,10,6,8,6,7,9,11,5,6,12,4,10,11,6,7,6,12,9,8,10,6,9,4,11,5,6,
+        3,7,12,9,8,2,10,9,1,4,10,11,6,5,7,12,11,0,5,12 } };
+
+    // Initialize global mesh node IDs for PE0 and PE1
+    std::vector< std::vector< std::size_t > > gid {
+      { 0,1,2,3,4,7,10,11,12,13 },
+      { 0,1,3,4,5,6,7,8,9,10,11,12,13 } };
+
+    // Initialize local->global mesh node ID map for PE0 and PE1
+    std::vector< std::unordered_map< std::size_t, std::size_t > > lid{
+      { {0,0},{11,7},{1,1},{12,8},{2,2},{13,9},{3,3},{4,4},{7,5},{10,6} },
+      { {0,0},{11,10},{5,4},{1,1},{3,2},{4,3},{6,5},{7,6},{8,7},{9,8},
+        {10,9},{12,11},{13,12} } };
+
+    // Initialize node communication map for PE0 and PE1
+    std::vector< tk::NodeCommMap > nodecommap;
+    nodecommap.push_back({});
+    nodecommap.back()[1].insert( { 7,4,10,12,1,13,3,0,11 } );
+    nodecommap.push_back({});
+    nodecommap.back()[0].insert( { 7,4,3,10,1,12,11,0,13 } );
+
+    // Create CG solver (empty chare array, will use dynamic insertion)
+    tk::CProxy_ConjugateGradients cg = tk::CProxy_ConjugateGradients::ckNew();
+
+    // Create receiver chare array (2 elements) whose callbacks are called when
+    // a CG task is done on a PE
+    CProxy_CGReceiver host =
+      CProxy_CGReceiver::ckNew( label, cg, tol, iter, 2 );
+
+    for (std::size_t m=0; m<2; ++m) {  // for both mesh partitions
+
+      // Query number of nodes in mesh partition
+      auto npoin = psup[m].second.size()-1;
+
+      // Create CSR matrix based on mesh partition with psup
+      tk::CSR A( /* DOF = */ 1, psup[m] );
+
+      // Fill matrix for mesh partition with diffusion-reaction operator
+      assemble( A, inpoel[m], coord[m] );
+
+      // Create RHS and solution/unknown vectors for mesh partition
+      std::vector< tk::real > b(npoin), x(npoin,0.0);
+      for (std::size_t i=0; i<npoin; ++i)
+        b[i] = 1.0 + static_cast< tk::real >( gid[m][i] % 5 );
+
+      // Dynamically insert array element with mesh partition
+      auto M = static_cast< int >( m );
+      cg[M].insert( A, x, b, maxit, tol, gid[m], lid[m], nodecommap[m], opt );
+
+      // Initialize CG solve for mesh partition
+      cg[M].init( CkCallback( CkIndex_CGReceiver::initialized(nullptr),
+                              host[M] ) );
+
+    }
+
+    // Start reduction manager on CG chare array
+    cg.doneInserting();
+  }
+};
 
 //! Test group shortcuts
 using ConjugateGradients_group =
@@ -52,37 +277,56 @@ static ConjugateGradients_group
 class CGReceiver : public CBase_CGReceiver {
   public:
     //! Constructor
-    CGReceiver( const std::string& label, tk::CProxy_ConjugateGradients cg )
-      : m_label( label ), m_cg( cg ) {}
+    CGReceiver( const std::string& label,
+                tk::CProxy_ConjugateGradients cg,
+                tk::real tol,
+                std::size_t maxit )
+      : m_label( label ), m_cg( cg ), m_tol( tol ), m_maxit( maxit ),
+        m_normb( 0.0 ) {}
     //! Called after CG init() finished
     void initialized( CkDataMsg* msg ) {
-      auto normb = static_cast<tk::real*>( msg->getData() );
-      received( "initialized", *normb, 3.7416573867739413 );
+      m_normb = *static_cast<tk::real*>( msg->getData() );
+      received( "initialized", [&]{
+        ensure_equals( "CG norm of b", m_normb, 11.832159566199232, 1.0e-12 );
+      } );
       m_cg[thisIndex].solve(
         CkCallback(CkIndex_CGReceiver::solved(nullptr),thisProxy[thisIndex]) );
     }
     //! Called after CG solve() finished
     void solved( CkDataMsg* msg ) {
-      auto residual = static_cast<tk::real*>( msg->getData() );
-      received( "solved", *residual, 6.684025456497797 );
+      auto r = static_cast<tk::real*>( msg->getData() );
+      auto residual = r[0];
+      auto it = static_cast< std::size_t >( r[1] );
+      received( "solved", [&]{
+        ensure( "CG did not converge, residual: " + std::to_string(residual),
+                residual <= m_tol * m_normb );
+        ensure( "CG took too many iterations: " + std::to_string(it) + " > " +
+                std::to_string(m_maxit), it <= m_maxit );
+      } );
     }
   private:
     //! Test label this is a receiver for
     std::string m_label;
     //! CG solver proxy
     tk::CProxy_ConjugateGradients m_cg;
+    //! Relative tolerance the solve must converge to
+    tk::real m_tol;
+    //! Max number of iterations expected to converge to m_tol
+    std::size_t m_maxit;
+    //! L2 norm of the right hand side
+    tk::real m_normb;
     //! Function creating a TUT test on completing a CG task
-    void received( const std::string& msg,
-                   tk::real computed,
-                   tk::real expected )
-    {
+    //! \param[in] msg Name of the CG task completed
+    //! \param[in] eval Function evaluating the test
+    template< class Eval >
+    void received( const std::string& msg, Eval&& eval ) {
       // Create test result struct
       tut::test_result tr( "LinearSolver/ConjugateGradients", 1,
                            m_label + " " + msg,
                            tut::test_result::result_type::ok );
       try {
         // Evaluate test
-        ensure_equals( "CG error", computed, expected, 1.0e-12 );
+        eval();
       } catch ( const failure& ex ) {
         tr.result = ex.result();
         tr.exception_typeid = ex.type();
@@ -97,216 +341,75 @@ class CGReceiver : public CBase_CGReceiver {
 
 //! Test definitions for group
 
-//! Test simple CG solve of Laplacian in serial
+//! Test simple CG solve of diffusion-reaction in serial
 template<> template<>
 void ConjugateGradients_object::test< 1 >() {
-  set_test_name( "Laplacian 1PE setup" );
-
-  // Mesh connectivity for simple tetrahedron-only mesh
-  std::vector< std::size_t > inpoel { 
-    3, 13, 8, 14,
-    12, 3, 13, 8,
-    8, 3, 14, 11,
-    12, 3, 8, 11,
-    1, 2, 3, 13,
-    6, 13, 7, 8,
-    5, 9, 14, 11,
-    5, 1, 3, 14,
-    10, 4, 12, 11,
-    2, 6, 12, 13,
-    8, 7, 9, 14,
-    13, 1, 7, 14,
-    5, 3, 4, 11,
-    6, 10, 12, 8,
-    3, 2, 4, 12,
-    10, 8, 9, 11,
-    3, 1, 13, 14,
-    13, 7, 8, 14,
-    6, 12, 13, 8,
-    9, 8, 14, 11,
-    3, 5, 14, 11,
-    4, 3, 12, 11,
-    3, 2, 12, 13,
-    10, 12, 8, 11 };
-
-  // Mesh node coordinates for simple tet mesh above
-  std::array< std::vector< tk::real >, 3 > coord {{
-    {{ -0.5, -0.5, -0.5, -0.5, -0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0, 0, 0, 0 }},
-    {{ 0.5, 0.5, 0, -0.5, -0.5, 0.5, 0.5, 0, -0.5, -0.5, -0.5, 0, 0.5, 0 }},
-    {{ -0.5, 0.5, 0, 0.5, -0.5, 0.5, -0.5, 0, -0.5, 0.5, 0, 0.5, 0, -0.5 }} }};
-
-  // Shift node IDs to start from zero
-  tk::shiftToZero( inpoel );
-  // Generate points surrounding points
-  auto psup = tk::genPsup( inpoel, 4, tk::genEsup(inpoel,4) );
-  // Query number of nodes in mesh
-  auto npoin = psup.second.size()-1;
-
-  // Create CSR matrix based on mesh with psup
-  tk::CSR A( /* DOF = */ 1, psup );
-
-  const auto& X = coord[0];
-  const auto& Y = coord[1];
-  const auto& Z = coord[2];
-
-  // fill matrix with Laplacian
-  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-    // access node IDs
-    const std::array< std::size_t, 4 >
-      N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
-    // compute element Jacobi determinant
-    const std::array< tk::real, 3 >
-      ba{{ X[N[1]]-X[N[0]], Y[N[1]]-Y[N[0]], Z[N[1]]-Z[N[0]] }},
-      ca{{ X[N[2]]-X[N[0]], Y[N[2]]-Y[N[0]], Z[N[2]]-Z[N[0]] }},
-      da{{ X[N[3]]-X[N[0]], Y[N[3]]-Y[N[0]], Z[N[3]]-Z[N[0]] }};
-    const auto J = tk::triple( ba, ca, da );        // J = 6V
-    Assert( J > 0, "Element Jacobian non-positive" );
-
-    // shape function derivatives, nnode*ndim [4][3]
-    std::array< std::array< tk::real, 3 >, 4 > grad;
-    grad[1] = tk::crossdiv( ca, da, J );
-    grad[2] = tk::crossdiv( da, ba, J );
-    grad[3] = tk::crossdiv( ba, ca, J );
-    for (std::size_t i=0; i<3; ++i)
-      grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-    for (std::size_t a=0; a<4; ++a)
-      for (std::size_t k=0; k<3; ++k)
-         for (std::size_t b=0; b<4; ++b)
-           A(N[a],N[b]) += J/6 * grad[a][k] * grad[b][k];
-  }
+  set_test_name( "diffusion-reaction 1PE setup" );
 
-  // Create RHS and solution/unknown vectors
-  std::vector< tk::real > b(npoin,1.0), x(npoin,0.0);
-
-  // Grab a node (id=0) as Dirichlet BC
-  A.dirichlet( 0 );
-
-  // Create CG solver (chare array with a single element)
-  tk::CProxy_ConjugateGradients cg =
-    tk::CProxy_ConjugateGradients::ckNew( A, x, b, 10, 1.0e-3, {}, {}, {}, 1 );
-
-  // Create receiver chare whose callbacks are called when a CG task is done
-  CProxy_CGReceiver host = CProxy_CGReceiver::ckNew( "Laplacian 1PE", cg, 1 );
-
-  // Initialize CG solve
-  cg[0].init( CkCallback(CkIndex_CGReceiver::initialized(nullptr), host[0]) );
+  serial( "diffusion-reaction 1PE", tk::CGOptions(), nit );
 }
 
-//! Test simple CG solve of Laplacian on 2 PEs
+//! Test simple CG solve of diffusion-reaction on 2 PEs
 template<> template<>
 void ConjugateGradients_object::test< 2 >() {
-  set_test_name( "Laplacian 2PEs setup" );
-
-  // Initialize psup for PE0 and PE1
-  std::vector<
-    std::pair< std::vector< std::size_t >, std::vector< std::size_t > > > psup {
-    { { 0,1,2,4,8,9,0,2,3,7,8,0,1,3,4,5,6,7,8,9,1,2,4,6,7,0,2,3,6,9,2,6,7,8,9,2,
-        3,4,5,7,9,1,2,3,5,6,8,0,1,2,5,7,9,0,2,4,5,6,8 },
-    { 0,5,10,19,24,29,34,40,46,52,58 } },
-    { { 0,5,11,12,4,10,11,8,9,10,7,9,12,1,5,6,8,10,11,0,4,6,7,11,12,4,5,7,8,9,10,
-      11,12,3,5,6,8,9,12,2,4,6,7,9,10,2,3,6,7,8,10,12,1,2,4,6,8,9,11,0,1,4,5,6,
-      10,12,0,3,5,6,7,9,11 },
-    { 0,3,6,9,12,18,24,32,38,44,51,58,65,72 } } };
-
-  // Initialize node coordinates for PE0 and PE1
-  std::vector< std::array< std::vector< tk::real >, 3 > > coord {{
-    {{ {{ -0.5,-0.5,-0.5,-0.5,-0.5,0.5,0,0,0,0 }},
-       {{ 0.5,0.5,0,-0.5,-0.5,0,-0.5,0,0.5,0 }},
-       {{ -0.5,0.5,0,0.5,-0.5,0,0,0.5,0,-0.5 }} }},
-    {{ {{ -0.5,-0.5,-0.5,-0.5,0.5,0.5,0.5,0.5,0.5,0,0,0,0 }},
-       {{ 0.5,0.5,-0.5,-0.5,0.5,0.5,0,-0.5,-0.5,-0.5,0,0.5,0 }},
-       {{ -0.5,0.5,0.5,-0.5,0.5,-0.5,0,-0.5,0.5,0,0.5,0,-0.5 }} }} }};
-
-  // Initialize mesh connectivity for PE0 and PE1
-  std::vector< std::vector< std::size_t > > inpoel {
-    { 2,8,5,9,7,2,8,5,5,2,9,6,7,2,5,6,0,1,2,8,4,0,2,9,4,2,3,6,2,1,3,7,
-      2,0,8,9,2,4,9,6,3,2,7,6,2,1,7,8 },
-    { 4,8,10,6,8,6,7,9,11,5,6,12,4,10,11,6,7,6,12,9,8,10,6,9,4,11,5,6,
-      3,7,12,9,8,2,10,9,1,4,10,11,6,5,7,12,11,0,5,12 } };
-
-  // Initialize global mesh node IDs for PE0 and PE1
-  std::vector< std::vector< std::size_t > > gid {
-    { 0,1,2,3,4,7,10,11,12,13 },
-    { 0,1,3,4,5,6,7,8,9,10,11,12,13 } };
-
-  // Initialize local->global mesh node ID map for PE0 and PE1
-  std::vector< std::unordered_map< std::size_t, std::size_t > > lid{
-    { {0,0},{11,7},{1,1},{12,8},{2,2},{13,9},{3,3},{4,4},{7,5},{10,6} },
-    { {0,0},{11,10},{5,4},{1,1},{3,2},{4,3},{6,5},{7,6},{8,7},{9,8},
-      {10,9},{12,11},{13,12} } };
-
-  // Initialize node communication map for PE0 and PE1
-  std::vector< tk::NodeCommMap > nodecommap;
-  nodecommap.push_back({});
-  nodecommap.back()[1].insert( { 7,4,10,12,1,13,3,0,11 } );
-  nodecommap.push_back({});
-  nodecommap.back()[0].insert( { 7,4,3,10,1,12,11,0,13 } );
-
-  // Create CG solver (empty chare array, will use dynamic insertion)
-  tk::CProxy_ConjugateGradients cg = tk::CProxy_ConjugateGradients::ckNew();
-
-  // Create receiver chare array (2 elements) whose callbacks are called when a
-  // CG task is done on a PE
-  CProxy_CGReceiver host = CProxy_CGReceiver::ckNew( "Laplacian 2PEs", cg, 2 );
-
-  for (std::size_t m=0; m<2; ++m) {  // for both mesh partitions
-
-    // Query number of nodes in mesh partition
-    auto npoin = psup[m].second.size()-1;
-
-    // Create CSR matrix based on mesh partition with psup
-    tk::CSR A( /* DOF = */ 1, psup[m] );
-
-    const auto& X = coord[m][0];
-    const auto& Y = coord[m][1];
-    const auto& Z = coord[m][2];
-
-    // fill matrix for mesh partition with Laplacian
-    for (std::size_t e=0; e<inpoel[m].size()/4; ++e) {
-      // access node IDs
-      const std::array< std::size_t, 4 >
-        N{{ inpoel[m][e*4+0], inpoel[m][e*4+1],
-            inpoel[m][e*4+2], inpoel[m][e*4+3] }};
-      // compute element Jacobi determinant
-      const std::array< tk::real, 3 >
-        ba{{ X[N[1]]-X[N[0]], Y[N[1]]-Y[N[0]], Z[N[1]]-Z[N[0]] }},
-        ca{{ X[N[2]]-X[N[0]], Y[N[2]]-Y[N[0]], Z[N[2]]-Z[N[0]] }},
-        da{{ X[N[3]]-X[N[0]], Y[N[3]]-Y[N[0]], Z[N[3]]-Z[N[0]] }};
-      const auto J = tk::triple( ba, ca, da );        // J = 6V
-      Assert( J > 0, "Element Jacobian non-positive" );
+  set_test_name( "diffusion-reaction 2PEs setup" );
 
-      // shape function derivatives, nnode*ndim [4][3]
-      std::array< std::array< tk::real, 3 >, 4 > grad;
-      grad[1] = tk::crossdiv( ca, da, J );
-      grad[2] = tk::crossdiv( da, ba, J );
-      grad[3] = tk::crossdiv( ba, ca, J );
-      for (std::size_t i=0; i<3; ++i)
-        grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+  parallel( "diffusion-reaction 2PEs", tk::CGOptions(), nit );
+}
 
-      for (std::size_t a=0; a<4; ++a)
-        for (std::size_t k=0; k<3; ++k)
-           for (std::size_t b=0; b<4; ++b)
-             A(N[a],N[b]) += J/6 * grad[a][k] * grad[b][k];
-    }
+//! Test ILU(0)-preconditioned CG solve of diffusion-reaction in serial
+//! \details Expected to take less than half of the iterations of
+//!   unpreconditioned CG.
+template<> template<>
+void ConjugateGradients_object::test< 3 >() {
+  set_test_name( "diffusion-reaction 1PE ILU(0) setup" );
 
-    // Create RHS and solution/unknown vectors for mesh partition
-    std::vector< tk::real > b(npoin,1.0), x(npoin,0.0);
+  tk::CGOptions opt;
+  opt.precond = tk::CGPrecond::ILU0;
+  serial( "diffusion-reaction 1PE ILU(0)", opt, 8 );
+}
 
-    // Grab a node (gid=0) as Dirichlet BC if on partition
-    A.dirichlet( 0, lid[m], nodecommap[m] );
+//! Test pipelined ILU(0)-preconditioned CG solve of diffusion-reaction in
+//! serial
+//! \details Expected to take less than half of the iterations of
+//!   unpreconditioned CG.
+template<> template<>
+void ConjugateGradients_object::test< 4 >() {
+  set_test_name( "diffusion-reaction 1PE pipelined ILU(0) SELL setup" );
+
+  tk::CGOptions opt;
+  opt.precond = tk::CGPrecond::ILU0;
+  opt.pipelined = true;
+  opt.sell = true;
+  serial( "diffusion-reaction 1PE pipelined ILU(0) SELL", opt, 8 );
+}
 
-    // Dynamically insert array element with mesh partition
-    auto M = static_cast< int >( m );
-    cg[M].insert( A, x, b, 10, 1.0e-3, gid[m], lid[m], nodecommap[m] );
+//! Test Jacobi-preconditioned CG solve of diffusion-reaction on 2 PEs
+//! \details The diagonal is assembled across chares before setting up the
+//!   preconditioner. Expected to take fewer iterations than unpreconditioned
+//!   CG.
+template<> template<>
+void ConjugateGradients_object::test< 5 >() {
+  set_test_name( "diffusion-reaction 2PEs Jacobi setup" );
 
-    // Initialize CG solve for mesh partition
-    cg[M].init( CkCallback(CkIndex_CGReceiver::initialized(nullptr), host[M]) );
+  tk::CGOptions opt;
+  opt.precond = tk::CGPrecond::JACOBI;
+  parallel( "diffusion-reaction 2PEs Jacobi", opt, 14 );
+}
 
-  }
+//! Test pipelined block-Jacobi ILU(0)-preconditioned CG solve of
+//! diffusion-reaction on 2 PEs
+//! \details Exercises summing the preconditioned vectors on chare-boundaries
+//!   and the double-buffered exchanges of pipelined CG. Expected to take fewer
+//!   iterations than unpreconditioned CG.
+template<> template<>
+void ConjugateGradients_object::test< 6 >() {
+  set_test_name( "diffusion-reaction 2PEs pipelined ILU(0) setup" );
 
-  // Start reduction manager on CG chare array
-  cg.doneInserting();
+  tk::CGOptions opt;
+  opt.precond = tk::CGPrecond::ILU0;
+  opt.pipelined = true;
+  parallel( "diffusion-reaction 2PEs pipelined ILU(0)", opt, 14 );
 }
 
 #if defined(STRICT_GNUC)
@@ -0,0 +1,157 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestBVH.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/BVH
+  \details   Unit tests for Mesh/BVH
+*/
+// *****************************************************************************
+
+#include <random>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "BVH.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct BVH_common {
+
+  //! Mesh node coordinates
+  std::array< std::vector< tk::real >, 3 > coord;
+  //! Mesh connectivity
+  std::vector< std::size_t > inpoel;
+
+  //! Generate tetrahedron mesh of the unit cube with n^3 hexahedra, each
+  //! split into 6 tetrahedra
+  void cube( std::size_t n ) {
+    auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+    { return (k*(n+1) + j)*(n+1) + i; };
+    for (std::size_t k=0; k<=n; ++k)
+      for (std::size_t j=0; j<=n; ++j)
+        for (std::size_t i=0; i<=n; ++i) {
+          coord[0].push_back( static_cast< tk::real >(i) / n );
+          coord[1].push_back( static_cast< tk::real >(j) / n );
+          coord[2].push_back( static_cast< tk::real >(k) / n );
+        }
+    for (std::size_t k=0; k<n; ++k)
+      for (std::size_t j=0; j<n; ++j)
+        for (std::size_t i=0; i<n; ++i) {
+          std::array< std::size_t, 8 > h{{
+            id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+            id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+          // Kuhn triangulation along the diagonal 0-6
+          const std::array< std::array< std::size_t, 2 >, 6 >
+            path{{ {{1,2}}, {{1,5}}, {{3,2}}, {{3,7}}, {{4,5}}, {{4,7}} }};
+          for (const auto& q : path)
+            inpoel.insert( end(inpoel), { h[0], h[q[0]], h[q[1]], h[6] } );
+        }
+  }
+
+  //! Test if a point is in a tetrahedron (inclusive within a tolerance)
+  bool inside( std::size_t e, const std::array< tk::real, 3 >& p ) const {
+    std::array< std::array< tk::real, 3 >, 4 > v;
+    for (std::size_t a=0; a<4; ++a)
+      for (std::size_t d=0; d<3; ++d)
+        v[a][d] = coord[d][ inpoel[e*4+a] ];
+    auto vol = [&]( std::size_t f, const std::array< tk::real, 3 >& q ) {
+      std::array< std::array< tk::real, 3 >, 4 > w = v;
+      w[f] = q;
+      std::array< tk::real, 3 > a{{ w[1][0]-w[0][0], w[1][1]-w[0][1],
+                                    w[1][2]-w[0][2] }},
+                                b{{ w[2][0]-w[0][0], w[2][1]-w[0][1],
+                                    w[2][2]-w[0][2] }},
+                                c{{ w[3][0]-w[0][0], w[3][1]-w[0][1],
+                                    w[3][2]-w[0][2] }};
+      return a[0]*(b[1]*c[2]-b[2]*c[1]) - a[1]*(b[0]*c[2]-b[2]*c[0]) +
+             a[2]*(b[0]*c[1]-b[1]*c[0]);
+    };
+    auto V = vol( 0, v[0] );
+    for (std::size_t f=0; f<4; ++f)
+      if (vol( f, p ) / V < -1.0e-12) return false;
+    return true;
+  }
+};
+
+//! Test group shortcuts
+using BVH_group = test_group< BVH_common, MAX_TESTS_IN_GROUP >;
+using BVH_object = BVH_group::object;
+
+//! Define test group
+static BVH_group BVH( "Mesh/BVH" );
+
+//! Test definitions for group
+
+//! Test that BVH finds the same element as brute-force search
+template<> template<>
+void BVH_object::test< 1 >() {
+  set_test_name( "find agrees with brute-force search" );
+
+  cube( 6 );
+  tk::BVH bvh( coord, inpoel );
+  ensure_equals( "number of elements incorrect", bvh.nelem(),
+                 inpoel.size()/4 );
+
+  std::mt19937 gen( 4 );
+  std::uniform_real_distribution< tk::real > u( 0.0, 1.0 );
+  for (std::size_t s=0; s<2000; ++s) {
+    std::array< tk::real, 3 > p{{ u(gen), u(gen), u(gen) }};
+    std::size_t ntest = 0;
+    auto e = bvh.find( p, [&]( std::size_t c ){
+                            ++ntest; return inside( c, p ); } );
+    ensure( "point not found", e != tk::BVH::npos );
+    ensure( "element found does not contain point", inside( e, p ) );
+    ensure( "too many elements tested", ntest < inpoel.size()/4/8 );
+  }
+
+  // points outside of the mesh are not found
+  ensure( "point outside found",
+          bvh.find( {{ 1.5, 0.5, 0.5 }}, [&]( std::size_t c ){
+                      return inside( c, {{ 1.5, 0.5, 0.5 }} ); } ) ==
+          tk::BVH::npos );
+}
+
+//! Test that refitting BVH after mesh motion finds moved elements
+template<> template<>
+void BVH_object::test< 2 >() {
+  set_test_name( "refit after mesh motion" );
+
+  cube( 4 );
+  tk::BVH bvh( coord, inpoel );
+
+  // stretch and shift the mesh
+  for (auto& x : coord[0]) x = 3.0*x + 1.0;
+  for (auto& z : coord[2]) z = z*z;
+  bvh.refit( coord, inpoel );
+
+  std::mt19937 gen( 5 );
+  std::uniform_real_distribution< tk::real > u( 0.0, 1.0 );
+  for (std::size_t s=0; s<1000; ++s) {
+    std::array< tk::real, 3 > p{{ 1.0 + 3.0*u(gen), u(gen), u(gen) }};
+    auto e = bvh.find( p, [&]( std::size_t c ){ return inside( c, p ); } );
+    ensure( "point not found after refit", e != tk::BVH::npos );
+  }
+}
+
+//! Test that an empty BVH finds nothing
+template<> template<>
+void BVH_object::test< 3 >() {
+  set_test_name( "empty" );
+
+  tk::BVH bvh;
+  ensure( "default BVH not empty", bvh.empty() );
+  ensure( "empty BVH found element",
+          bvh.find( {{ 0.0, 0.0, 0.0 }}, []( std::size_t ){ return true; } ) ==
+          tk::BVH::npos );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
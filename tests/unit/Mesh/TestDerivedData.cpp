@@ -113,6 +113,13 @@
 */
 // *****************************************************************************
 
+#include <set>
+#include <array>
+#include <random>
+#include <numeric>
+#include <iterator>
+#include <algorithm>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
@@ -129,7 +136,33 @@ namespace tut {
 #endif
 
 //! All tests in group inherited from this base
-struct DerivedData_common {};
+struct DerivedData_common {
+  //! \brief Generate tetrahedron mesh of a cube of n^3 hexahedra, each split
+  //!   into 6 tetrahedra, with randomly shuffled node ids
+  //! \param[in] n Number of hexahedra in each direction
+  //! \return Mesh connectivity
+  static std::vector< std::size_t > cube( std::size_t n ) {
+    auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+    { return (k*(n+1) + j)*(n+1) + i; };
+    std::vector< std::size_t > perm( (n+1)*(n+1)*(n+1) );
+    std::iota( begin(perm), end(perm), 0 );
+    std::shuffle( begin(perm), end(perm), std::mt19937( 1 ) );
+    std::vector< std::size_t > inpoel;
+    for (std::size_t k=0; k<n; ++k)
+      for (std::size_t j=0; j<n; ++j)
+        for (std::size_t i=0; i<n; ++i) {
+          std::array< std::size_t, 8 > h{{
+            id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+            id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+          const std::array< std::array< std::size_t, 2 >, 6 >
+            path{{ {{1,2}}, {{1,5}}, {{3,2}}, {{3,7}}, {{4,5}}, {{4,7}} }};
+          for (const auto& q : path)
+            inpoel.insert( end(inpoel), { perm[h[0]], perm[h[q[0]]],
+                                          perm[h[q[1]]], perm[h[6]] } );
+        }
+    return inpoel;
+  }
+};
 
 // Test group shortcuts
 // The 2nd template argument is the max number of tests in this group. If
@@ -3386,6 +3419,150 @@ void DerivedData_object::test< 75 >() {
   #endif
 }
 
+//! \brief Test derived data generated with compressed sparse rows against
+//!   their definitions on a larger mesh with shuffled node ids
+template<> template<>
+void DerivedData_object::test< 76 >() {
+  set_test_name( "derived data on shuffled mesh match definitions" );
+
+  std::size_t nnpe = 4;
+  auto inpoel = cube( 4 );
+  auto nelem = inpoel.size()/nnpe;
+  auto npoin = *std::max_element( begin(inpoel), end(inpoel) ) + 1;
+  auto esup = tk::genEsup( inpoel, nnpe );
+
+  // elements surrounding points as sets
+  std::vector< std::set< std::size_t > > es( npoin );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t n=0; n<nnpe; ++n) es[ inpoel[e*nnpe+n] ].insert( e );
+
+  // unique edges p < q, sorted
+  std::set< std::pair< std::size_t, std::size_t > > edges;
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t a=0; a<nnpe; ++a)
+      for (std::size_t b=0; b<nnpe; ++b) {
+        auto p = inpoel[e*nnpe+a], q = inpoel[e*nnpe+b];
+        if (p < q) edges.insert( {p,q} );
+      }
+
+  // edges surrounding points and edge connectivity
+  std::vector< std::size_t > edsup1( 1, 0 ), edsup2( npoin+1, 0 ), inpoed;
+  for (const auto& [p,q] : edges) {
+    edsup1.push_back( q );
+    ++edsup2[p+1];
+    inpoed.push_back( p );
+    inpoed.push_back( q );
+  }
+  std::partial_sum( begin(edsup2), end(edsup2), begin(edsup2) );
+  auto edsup = tk::genEdsup( inpoel, nnpe, esup );
+  ensure( "edsup1 incorrect", edsup.first == edsup1 );
+  ensure( "edsup2 incorrect", edsup.second == edsup2 );
+  ensure( "inpoed incorrect", tk::genInpoed( inpoel, nnpe, esup ) == inpoed );
+
+  // elements surrounding points of elements, and elements sharing a face
+  std::vector< std::size_t > esupel1( 1, 0 ), esupel2( 1, 0 ),
+                             esuel1( 1, 0 ), esuel2( 1, 0 );
+  for (std::size_t e=0; e<nelem; ++e) {
+    std::set< std::size_t > s;
+    for (std::size_t n=0; n<nnpe; ++n)
+      s.insert( begin(es[inpoel[e*nnpe+n]]), end(es[inpoel[e*nnpe+n]]) );
+    s.erase( e );
+    esupel1.insert( end(esupel1), begin(s), end(s) );
+    esupel2.push_back( esupel1.size()-1 );
+    for (auto g : s) {
+      std::size_t sp = 0;
+      for (std::size_t n=0; n<nnpe; ++n) sp += es[inpoel[e*nnpe+n]].count( g );
+      if (sp == nnpe-1) esuel1.push_back( g );
+    }
+    esuel2.push_back( esuel1.size()-1 );
+  }
+  auto esupel = tk::genEsupel( inpoel, nnpe, esup );
+  ensure( "esupel1 incorrect", esupel.first == esupel1 );
+  ensure( "esupel2 incorrect", esupel.second == esupel2 );
+  auto esuel = tk::genEsuel( inpoel, nnpe, esup );
+  ensure( "esuel1 incorrect", esuel.first == esuel1 );
+  ensure( "esuel2 incorrect", esuel.second == esuel2 );
+
+  // elements surrounding elements across tetrahedron faces
+  auto esuelTet = tk::genEsuelTet( inpoel, esup );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t f=0; f<4; ++f) {
+      std::set< std::size_t > s = es[ inpoel[e*4+tk::lpofa[f][0]] ];
+      for (std::size_t n=1; n<3; ++n) {
+        std::set< std::size_t > t;
+        for (auto g : es[ inpoel[e*4+tk::lpofa[f][n]] ])
+          if (s.count(g)) t.insert( g );
+        s = std::move( t );
+      }
+      s.erase( e );
+      ensure_equals( "esuelTet incorrect", esuelTet[e*4+f],
+                     s.empty() ? -1 : static_cast< int >( *s.begin() ) );
+    }
+
+  // edges of elements and elements surrounding edges
+  std::vector< std::size_t > inedel;
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t a=0; a<nnpe; ++a)
+      for (std::size_t i=0; i<inpoed.size()/2; ++i)
+        for (std::size_t b=0; b<nnpe; ++b)
+          if (inpoed[i*2] == inpoel[e*nnpe+a] &&
+              inpoed[i*2+1] == inpoel[e*nnpe+b])
+            inedel.push_back( i );
+  ensure( "inedel incorrect", tk::genInedel( inpoel, nnpe, inpoed ) == inedel );
+  auto esued = tk::genEsued( inpoel, nnpe, esup );
+  ensure_equals( "number of edges in esued incorrect", esued.size(),
+                 edges.size() );
+  for (const auto& [p,q] : edges) {
+    std::vector< std::size_t > s;
+    std::set_intersection( begin(es[p]), end(es[p]), begin(es[q]), end(es[q]),
+                           std::back_inserter(s) );
+    ensure( "esued incorrect", esued.at( {{p,q}} ) == s );
+  }
+}
+
+//! \brief Test edges surrounding points and edges of elements with points that
+//!   have no edges to points with larger ids
+//! \details Point 2 below only has edges to points 0 and 1, and so it has no
+//!   edge p < q, yet the index of edges of point 3 must follow that of point 2.
+template<> template<>
+void DerivedData_object::test< 77 >() {
+  set_test_name( "genEdsup & genInedel with points without edges p < q" );
+
+  std::vector< std::size_t > inpoel { 0, 1, 2,
+                                      0, 3, 4 };
+  auto esup = tk::genEsup( inpoel, 3 );
+
+  auto edsup = tk::genEdsup( inpoel, 3, esup );
+  std::vector< std::size_t > edsup1{ 0, 1, 2, 3, 4, 2, 4 },
+                             edsup2{ 0, 4, 5, 5, 6, 6 };
+  ensure( "edsup1 incorrect", edsup.first == edsup1 );
+  ensure( "edsup2 incorrect", edsup.second == edsup2 );
+
+  auto inpoed = tk::genInpoed( inpoel, 3, esup );
+  std::vector< std::size_t > inedel{ 0, 1, 4, 2, 3, 5 };
+  ensure( "inedel incorrect", tk::genInedel( inpoel, 3, inpoed ) == inedel );
+}
+
+//! Test that derived data generated by multiple threads equal that by one
+template<> template<>
+void DerivedData_object::test< 78 >() {
+  set_test_name( "derived data independent of number of threads" );
+
+  auto inpoel = cube( 5 );
+  auto esup = tk::genEsup( inpoel, 4 );
+  auto esupel = tk::genEsupel( inpoel, 4, esup );
+  auto esuel = tk::genEsuel( inpoel, 4, esup );
+  auto esuelTet = tk::genEsuelTet( inpoel, esup );
+  for (std::size_t nthread : std::vector< std::size_t >{ 2, 3, 8, 1000 }) {
+    ensure( "esupel differs from serial",
+            tk::genEsupel( inpoel, 4, esup, nthread ) == esupel );
+    ensure( "esuel differs from serial",
+            tk::genEsuel( inpoel, 4, esup, nthread ) == esuel );
+    ensure( "esuelTet differs from serial",
+            tk::genEsuelTet( inpoel, esup, nthread ) == esuelTet );
+  }
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
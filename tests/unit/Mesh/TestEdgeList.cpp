@@ -0,0 +1,187 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestEdgeList.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/EdgeList
+  \details   Unit tests for Mesh/EdgeList
+*/
+// *****************************************************************************
+
+#include <set>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "EdgeList.hpp"
+#include "DerivedData.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct EdgeList_common {
+
+  //! Mesh connectivity
+  std::vector< std::size_t > inpoel;
+
+  //! Generate tetrahedron mesh of the unit cube with n^3 hexahedra, each
+  //! split into 6 tetrahedra
+  //! \return Number of mesh nodes
+  std::size_t cube( std::size_t n ) {
+    auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+    { return (k*(n+1) + j)*(n+1) + i; };
+    for (std::size_t k=0; k<n; ++k)
+      for (std::size_t j=0; j<n; ++j)
+        for (std::size_t i=0; i<n; ++i) {
+          std::array< std::size_t, 8 > h{{
+            id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+            id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+          const std::array< std::array< std::size_t, 2 >, 6 >
+            path{{ {{1,2}}, {{1,5}}, {{3,2}}, {{3,7}}, {{4,5}}, {{4,7}} }};
+          for (const auto& q : path)
+            inpoel.insert( end(inpoel), { h[0], h[q[0]], h[q[1]], h[6] } );
+        }
+    return (n+1)*(n+1)*(n+1);
+  }
+
+  //! Bisect all elements sharing an edge by adding a new node
+  //! \param[in] p One end point of the edge to bisect
+  //! \param[in] q Other end point of the edge to bisect
+  //! \param[in] m Id of the new node
+  //! \return Connectivity of the bisected mesh
+  std::vector< std::size_t >
+  bisect( std::size_t p, std::size_t q, std::size_t m ) const {
+    std::vector< std::size_t > bisected;
+    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      std::array< std::size_t, 4 > t{{ inpoel[e*4+0], inpoel[e*4+1],
+                                       inpoel[e*4+2], inpoel[e*4+3] }};
+      auto ip = std::find( begin(t), end(t), p );
+      auto iq = std::find( begin(t), end(t), q );
+      if (ip != end(t) && iq != end(t)) {
+        auto t1 = t, t2 = t;
+        t1[ static_cast< std::size_t >( iq - begin(t) ) ] = m;
+        t2[ static_cast< std::size_t >( ip - begin(t) ) ] = m;
+        bisected.insert( end(bisected), begin(t1), end(t1) );
+        bisected.insert( end(bisected), begin(t2), end(t2) );
+      } else {
+        bisected.insert( end(bisected), begin(t), end(t) );
+      }
+    }
+    return bisected;
+  }
+
+  //! Verify edge list against mesh connectivity and points surrounding points
+  //! \param[in] edges Edge list to verify
+  //! \param[in] conn Mesh connectivity the edge list is expected to represent
+  void verify( const tk::EdgeList& edges,
+               const std::vector< std::size_t >& conn ) const
+  {
+    auto psup = tk::genPsup( conn, 4, tk::genEsup( conn, 4 ) );
+    auto npoin = psup.second.size()-1;
+    ensure_equals( "number of points incorrect", edges.npoin(), npoin );
+
+    // points surrounding points equal those of genPsup() up to ordering
+    const auto& epsup = edges.psup();
+    ensure( "psup2 incorrect", epsup.second == psup.second );
+    std::set< std::size_t > ids;
+    for (std::size_t p=0; p<npoin; ++p) {
+      std::vector< std::size_t >
+        a( begin(psup.first) + static_cast< long >( psup.second[p]+1 ),
+           begin(psup.first) + static_cast< long >( psup.second[p+1]+1 ) ),
+        b( begin(epsup.first) + static_cast< long >( epsup.second[p]+1 ),
+           begin(epsup.first) + static_cast< long >( epsup.second[p+1]+1 ) );
+      std::sort( begin(a), end(a) );
+      ensure( "points surrounding point not sorted or incorrect", a == b );
+      for (auto i=epsup.second[p]+1; i<=epsup.second[p+1]; ++i) {
+        auto q = epsup.first[i];
+        auto e = edges.nodeedge()[i];
+        ensure_equals( "edge lookup incorrect", edges.edge(p,q), e );
+        ensure_equals( "edge lookup not symmetric", edges.edge(q,p), e );
+        ensure_equals( "edge end point incorrect", edges.edgenode()[e*2+0],
+                       std::min(p,q) );
+        ensure_equals( "edge end point incorrect", edges.edgenode()[e*2+1],
+                       std::max(p,q) );
+        ids.insert( e );
+      }
+    }
+    ensure_equals( "edge ids not dense", ids.size(), edges.nedge() );
+    const auto& en = edges.edgenode();
+    for (std::size_t e=1; e<edges.nedge(); ++e)
+      ensure( "edges not ordered by end points",
+              std::make_pair( en[e*2-2], en[e*2-1] ) <
+                std::make_pair( en[e*2], en[e*2+1] ) );
+    ensure( "edge ids not dense",
+            ids.empty() || *ids.rbegin()+1 == ids.size() );
+
+    // element edges
+    ensure_equals( "size of element edges incorrect", edges.inedel().size(),
+                   conn.size()/4*6 );
+    for (std::size_t e=0; e<conn.size()/4; ++e)
+      for (std::size_t k=0; k<6; ++k)
+        ensure_equals( "element edge incorrect", edges.inedel()[e*6+k],
+                       edges.edge( conn[e*4+tk::lpoed[k][0]],
+                                   conn[e*4+tk::lpoed[k][1]] ) );
+  }
+};
+
+//! Test group shortcuts
+using EdgeList_group = test_group< EdgeList_common, MAX_TESTS_IN_GROUP >;
+using EdgeList_object = EdgeList_group::object;
+
+//! Define test group
+static EdgeList_group EdgeList( "Mesh/EdgeList" );
+
+//! Test definitions for group
+
+//! Test that the edge list agrees with points surrounding points
+template<> template<>
+void EdgeList_object::test< 1 >() {
+  set_test_name( "build" );
+
+  auto npoin = cube( 3 );
+  tk::EdgeList edges( inpoel, npoin );
+  verify( edges, inpoel );
+  ensure_equals( "nonexistent edge found", edges.edge( 0, npoin-1 ),
+                 tk::EdgeList::npos );
+}
+
+//! Test that rebuilding after refinement/derefinement equals building
+template<> template<>
+void EdgeList_object::test< 2 >() {
+  set_test_name( "rebuild equals build" );
+
+  auto npoin = cube( 3 );
+  tk::EdgeList edges( inpoel, npoin );
+  auto p = std::min( inpoel[0], inpoel[1] );
+  auto q = std::max( inpoel[0], inpoel[1] );
+
+  // refine: bisect all elements around edge p-q
+  auto refined = bisect( p, q, npoin );
+  edges.rebuild( refined, npoin+1 );
+  verify( edges, refined );
+  ensure_equals( "bisected edge found", edges.edge( p, q ),
+                 tk::EdgeList::npos );
+  tk::EdgeList fine( refined, npoin+1 );
+  ensure( "edge-to-node differs from build after refinement",
+          edges.edgenode() == fine.edgenode() );
+  ensure( "element-to-edge differs from build after refinement",
+          edges.inedel() == fine.inedel() );
+
+  // derefine
+  edges.rebuild( inpoel, npoin );
+  verify( edges, inpoel );
+  tk::EdgeList coarse( inpoel, npoin );
+  ensure( "edge-to-node differs from build after derefinement",
+          edges.edgenode() == coarse.edgenode() );
+  ensure( "element-to-edge differs from build after derefinement",
+          edges.inedel() == coarse.inedel() );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,101 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestNodeCommPlan.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/NodeCommPlan
+  \details   Unit tests for Mesh/NodeCommPlan
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "NodeCommPlan.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct NodeCommPlan_common {};
+
+//! Test group shortcuts
+using NodeCommPlan_group =
+  test_group< NodeCommPlan_common, MAX_TESTS_IN_GROUP >;
+using NodeCommPlan_object = NodeCommPlan_group::object;
+
+//! Define test group
+static NodeCommPlan_group NodeCommPlan( "Mesh/NodeCommPlan" );
+
+//! Test definitions for group
+
+//! Test exchanging data between two chares sharing nodes in different orders
+template<> template<>
+void NodeCommPlan_object::test< 1 >() {
+  set_test_name( "exchange between two chares" );
+
+  // Chare 3 holds global nodes 10..15, chare 7 holds global nodes 13..19,
+  // with local ids assigned in different orders, sharing global nodes 13..15
+  std::unordered_map< std::size_t, std::size_t >
+    lid3{ {10,0}, {11,1}, {12,2}, {13,3}, {14,4}, {15,5} },
+    lid7{ {19,0}, {15,1}, {18,2}, {14,3}, {17,4}, {13,5}, {16,6} },
+    bid3{ {14,0}, {13,1}, {15,2} },
+    bid7{ {15,0}, {13,1}, {14,2} };
+  tk::NodeCommMap map3{ { 7, { 15, 13, 14 } } },
+                  map7{ { 3, { 14, 15, 13 } } };
+
+  tk::NodeCommPlan p3( map3, lid3, bid3 ), p7( map7, lid7, bid7 );
+  ensure_equals( "number of neighbors incorrect", p3.size(), 1UL );
+  ensure_equals( "neighbor chare incorrect", p3.chare(0), 7 );
+  ensure_equals( "neighbor index incorrect", p7.neighbor(3), 0UL );
+  ensure( "local ids incorrect",
+          p3.lid(0) == std::vector< std::size_t >{ 3, 4, 5 } );
+  ensure( "chare-boundary ids incorrect",
+          p7.bid(0) == std::vector< std::size_t >{ 1, 2, 0 } );
+
+  // Data on chare 3 and 7 at their local nodes: 2 components, the first of
+  // which is the global id
+  tk::Fields f3( lid3.size(), 2 ), f7( lid7.size(), 2 );
+  for (const auto& [g,l] : lid3) { f3(l,0,0) = g; f3(l,1,0) = 1.0; }
+  for (const auto& [g,l] : lid7) { f7(l,0,0) = g; f7(l,1,0) = 2.0; }
+
+  // Send from 3 to 7 and from 7 to 3, then add
+  auto b3 = tk::NodeCommPlan::pack( f3, p3.lid(0) );
+  auto b7 = tk::NodeCommPlan::pack( f7, p7.lid(0) );
+  ensure_equals( "buffer size incorrect", b3.size(), 6UL );
+  tk::NodeCommPlan::add( b7, p3.lid( p3.neighbor(7) ), f3 );
+  tk::NodeCommPlan::add( b3, p7.lid( p7.neighbor(3) ), f7 );
+
+  // Shared nodes hold the sum from both sides, others are unchanged
+  for (const auto& [g,l] : lid3) {
+    auto shared = g >= 13 && g <= 15;
+    ensure_equals( "first component on chare 3 incorrect",
+                   f3(l,0,0), shared ? 2.0*g : g, 1.0e-15 );
+    ensure_equals( "second component on chare 3 incorrect",
+                   f3(l,1,0), shared ? 3.0 : 1.0, 1.0e-15 );
+  }
+  for (const auto& [g,l] : lid7) {
+    auto shared = g >= 13 && g <= 15;
+    ensure_equals( "first component on chare 7 incorrect",
+                   f7(l,0,0), shared ? 2.0*g : g, 1.0e-15 );
+    ensure_equals( "second component on chare 7 incorrect",
+                   f7(l,1,0), shared ? 3.0 : 2.0, 1.0e-15 );
+  }
+}
+
+//! Test that an empty node communication map yields an empty plan
+template<> template<>
+void NodeCommPlan_object::test< 2 >() {
+  set_test_name( "empty" );
+
+  tk::NodeCommPlan p( {}, {}, {} );
+  ensure( "plan not empty", p.empty() );
+  ensure( "default plan not empty", tk::NodeCommPlan().empty() );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -113,6 +113,10 @@
 */
 // *****************************************************************************
 
+#include <random>
+#include <numeric>
+#include <algorithm>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
@@ -162,6 +166,42 @@ struct Reorder_common {
                                          7,  10, 13, 12,
                                          14,  4, 13,  9,
                                          14,  1,  9, 11 };
+
+  //! Generate tetrahedron mesh of the unit cube with n^3 hexahedra, each
+  //! split into 6 tetrahedra
+  void cube( std::size_t n,
+             std::vector< std::size_t >& inpoel,
+             std::array< std::vector< tk::real >, 3 >& coord ) const
+  {
+    auto id = [n]( std::size_t i, std::size_t j, std::size_t k )
+    { return (k*(n+1) + j)*(n+1) + i; };
+    for (std::size_t k=0; k<=n; ++k)
+      for (std::size_t j=0; j<=n; ++j)
+        for (std::size_t i=0; i<=n; ++i) {
+          coord[0].push_back( static_cast< tk::real >(i) / n );
+          coord[1].push_back( static_cast< tk::real >(j) / n );
+          coord[2].push_back( static_cast< tk::real >(k) / n );
+        }
+    const std::array< std::array< std::size_t, 2 >, 6 >
+      path{{ {{1,2}}, {{1,5}}, {{3,2}}, {{3,7}}, {{4,5}}, {{4,7}} }};
+    for (std::size_t k=0; k<n; ++k)
+      for (std::size_t j=0; j<n; ++j)
+        for (std::size_t i=0; i<n; ++i) {
+          std::array< std::size_t, 8 > h{{
+            id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+            id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+          for (const auto& q : path)
+            inpoel.insert( end(inpoel), { h[0], h[q[0]], h[q[1]], h[6] } );
+        }
+  }
+
+  //! Test if a map is a permutation
+  bool permutation( const std::vector< std::size_t >& map ) const {
+    auto m = map;
+    std::sort( begin(m), end(m) );
+    for (std::size_t i=0; i<m.size(); ++i) if (m[i] != i) return false;
+    return true;
+  }
 };
 
 // Test group shortcuts
@@ -796,6 +836,99 @@ void Reorder_object::test< 18 >() {
   #endif
 }
 
+//! Renumber disconnected mesh using the advancing front technique
+template<> template<>
+void Reorder_object::test< 19 >() {
+  set_test_name( "renumber disconnected mesh" );
+
+  std::vector< std::size_t > inpoel{ 0, 2, 4, 6,  1, 3, 5, 7 };
+  const auto psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto map = tk::renumber( psup );
+  ensure( "renumbering not a permutation", permutation( map ) );
+  tk::remap( inpoel, map );
+  ensure( "renumbered disconnected mesh incorrect",
+          inpoel == std::vector< std::size_t >{ 0, 1, 2, 3,  4, 5, 6, 7 } );
+}
+
+//! Renumber tetrahedron mesh using reverse Cuthill-McKee
+template<> template<>
+void Reorder_object::test< 20 >() {
+  set_test_name( "reverse Cuthill-McKee" );
+
+  std::vector< std::size_t > inpoel;
+  std::array< std::vector< tk::real >, 3 > coord;
+  cube( 8, inpoel, coord );
+  auto npoin = coord[0].size();
+
+  // Scramble node ids
+  std::vector< std::size_t > scramble( npoin );
+  std::iota( begin(scramble), end(scramble), 0 );
+  std::shuffle( begin(scramble), end(scramble), std::mt19937( 11 ) );
+  tk::remap( inpoel, scramble );
+  auto psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto bw = tk::bandwidth( psup );
+  auto pr = tk::profile( psup );
+
+  auto map = tk::rcm( psup );
+  ensure( "reverse Cuthill-McKee not a permutation", permutation( map ) );
+  tk::remap( inpoel, map );
+  psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+
+  // The bandwidth of an n^3 structured mesh numbered along its planes is
+  // about (n+1)^2, the scrambled mesh has a bandwidth close to npoin
+  ensure( "bandwidth of scrambled mesh too small", bw > npoin/2 );
+  ensure( "bandwidth after reverse Cuthill-McKee too large",
+          tk::bandwidth( psup ) < 2*9*9 );
+  ensure( "profile after reverse Cuthill-McKee too large",
+          tk::profile( psup ) < pr/4 );
+
+  // Also renumber disconnected mesh
+  std::vector< std::size_t > inpoel2{ 0, 2, 4, 6,  1, 3, 5, 7 };
+  map = tk::rcm( tk::genPsup( inpoel2, 4, tk::genEsup( inpoel2, 4 ) ) );
+  ensure( "reverse Cuthill-McKee of disconnected mesh not a permutation",
+          permutation( map ) );
+}
+
+//! Renumber mesh nodes along space-filling curves
+template<> template<>
+void Reorder_object::test< 21 >() {
+  set_test_name( "space-filling curves" );
+
+  std::vector< std::size_t > inpoel;
+  std::array< std::vector< tk::real >, 3 > coord;
+  cube( 7, inpoel, coord );
+  auto npoin = coord[0].size();
+
+  // Consecutive nodes along the Hilbert curve of a 2^3^3 grid are neighbors
+  auto map = tk::spaceFillingCurve( coord, tk::SFCType::HILBERT );
+  ensure( "Hilbert ordering not a permutation", permutation( map ) );
+  std::vector< std::size_t > order( npoin );
+  for (std::size_t p=0; p<npoin; ++p) order[ map[p] ] = p;
+  for (std::size_t i=1; i<npoin; ++i) {
+    auto a = order[i-1], b = order[i];
+    tk::real d = 0.0;
+    for (std::size_t j=0; j<3; ++j)
+      d += std::abs( coord[j][a] - coord[j][b] );
+    ensure_equals( "consecutive Hilbert nodes not neighbors", d, 1.0/7, 1e-12 );
+  }
+
+  // Morton ordering of a 2^3 grid: z varies fastest, then y, then x
+  std::array< std::vector< tk::real >, 3 > c{{
+    { 0, 1, 0, 1, 0, 1, 0, 1 },
+    { 0, 0, 1, 1, 0, 0, 1, 1 },
+    { 0, 0, 0, 0, 1, 1, 1, 1 } }};
+  map = tk::spaceFillingCurve( c, tk::SFCType::MORTON );
+  ensure( "Morton ordering incorrect",
+          map == std::vector< std::size_t >{ 0, 4, 2, 6, 1, 5, 3, 7 } );
+
+  // Space-filling curves of a single point and no points
+  ensure( "single point ordering incorrect",
+          tk::spaceFillingCurve( {{ {1.0}, {2.0}, {3.0} }},
+            tk::SFCType::HILBERT ) == std::vector< std::size_t >{ 0 } );
+  ensure( "empty ordering incorrect",
+          tk::spaceFillingCurve( {}, tk::SFCType::MORTON ).empty() );
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
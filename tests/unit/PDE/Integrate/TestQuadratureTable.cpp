@@ -0,0 +1,135 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/PDE/Integrate/TestQuadratureTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for PDE/Integrate/QuadratureTable.hpp
+  \details   Unit tests for PDE/Integrate/QuadratureTable.hpp. The precomputed
+    quadrature rules and basis functions are compared against those computed
+    by Quadrature.hpp and Basis.hpp at the Gauss points for each ndof.
+*/
+// *****************************************************************************
+
+#include <cmath>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "PDE/Integrate/QuadratureTable.hpp"
+#include "PDE/Integrate/Quadrature.hpp"
+#include "PDE/Integrate/Basis.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct QuadratureTable_common {
+  //! Numbers of degrees of freedom to test
+  const std::array< std::size_t, 3 > ndofs{{ 1, 4, 10 }};
+};
+
+//! Test group shortcuts
+using QuadratureTable_group =
+  test_group< QuadratureTable_common, MAX_TESTS_IN_GROUP >;
+using QuadratureTable_object = QuadratureTable_group::object;
+
+//! Define test group
+static QuadratureTable_group QuadratureTable( "PDE/Integrate/QuadratureTable" );
+
+//! Test definitions for group
+
+//! Test volume quadrature table against computing it at the Gauss points
+template<> template<>
+void QuadratureTable_object::test< 1 >() {
+  set_test_name( "volume table equals basis at Gauss points" );
+
+  for (auto ndof : ndofs) {
+    const auto& q = tk::volQuadrature( ndof );
+    auto ng = tk::NGvol( ndof );
+
+    std::array< std::vector< tk::real >, 3 > coordgp;
+    std::vector< tk::real > wgp( ng );
+    for (auto& c : coordgp) c.resize( ng );
+    tk::GaussQuadratureTet( ng, coordgp, wgp );
+
+    ensure_equals( "number of weights incorrect", q.wgp.size(), ng );
+    ensure_equals( "number of basis functions incorrect", q.B.size(), ng );
+    ensure_equals( "number of derivatives incorrect", q.dBdxi.size(), ng );
+    ensure( "weights differ", q.wgp == wgp );
+    ensure( "quadrature points differ", q.coordgp == coordgp );
+
+    for (std::size_t igp=0; igp<ng; ++igp) {
+      auto B = tk::eval_basis( ndof, coordgp[0][igp], coordgp[1][igp],
+                               coordgp[2][igp] );
+      auto dBdxi = tk::eval_dBdxi( ndof, coordgp[0][igp], coordgp[1][igp],
+                                   coordgp[2][igp] );
+      ensure( "basis functions differ", q.B[igp] == B );
+      for (std::size_t i=0; i<ndof; ++i)
+        ensure( "basis function derivatives differ",
+                q.dBdxi[igp][i] == dBdxi[i] );
+    }
+  }
+}
+
+//! Test face quadrature table against computing it
+template<> template<>
+void QuadratureTable_object::test< 2 >() {
+  set_test_name( "face table equals quadrature" );
+
+  for (auto ndof : ndofs) {
+    const auto& q = tk::faceQuadrature( ndof );
+    auto ng = tk::NGfa( ndof );
+
+    std::array< std::vector< tk::real >, 2 > coordgp;
+    std::vector< tk::real > wgp( ng );
+    for (auto& c : coordgp) c.resize( ng );
+    tk::GaussQuadratureTri( ng, coordgp, wgp );
+
+    ensure_equals( "number of weights incorrect", q.wgp.size(), ng );
+    ensure( "weights differ", q.wgp == wgp );
+    ensure( "quadrature points differ", q.coordgp == coordgp );
+  }
+}
+
+//! Test that the tabulated basis functions are orthogonal under the volume
+//! quadrature and that the weights sum to one
+template<> template<>
+void QuadratureTable_object::test< 3 >() {
+  set_test_name( "tabulated basis orthogonal" );
+
+  for (auto ndof : ndofs) {
+    const auto& q = tk::volQuadrature( ndof );
+    tk::real sum = 0.0;
+    for (auto w : q.wgp) sum += w;
+    ensure_equals( "volume weights do not sum to one", sum, 1.0, 1.0e-14 );
+
+    for (std::size_t i=0; i<ndof; ++i)
+      for (std::size_t j=0; j<ndof; ++j) {
+        if (i == j) continue;
+        tk::real m = 0.0;
+        for (std::size_t igp=0; igp<q.wgp.size(); ++igp)
+          m += q.wgp[igp] * q.B[igp][i] * q.B[igp][j];
+        ensure_equals( "basis functions not orthogonal", m, 0.0, 1.0e-14 );
+      }
+  }
+}
+
+//! Test that the tables are built once and the same tables are returned
+template<> template<>
+void QuadratureTable_object::test< 4 >() {
+  set_test_name( "tables built once" );
+
+  for (auto ndof : ndofs) {
+    ensure( "volume table rebuilt",
+            &tk::volQuadrature( ndof ) == &tk::volQuadrature( ndof ) );
+    ensure( "face table rebuilt",
+            &tk::faceQuadrature( ndof ) == &tk::faceQuadrature( ndof ) );
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
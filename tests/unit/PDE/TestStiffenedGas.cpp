@@ -0,0 +1,128 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/PDE/TestStiffenedGas.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for PDE/EoS/StiffenedGas.hpp
+  \details   Unit tests for PDE/EoS/StiffenedGas.hpp. The batch functions,
+    operating on arrays of states, are compared bitwise against the
+    single-state functions.
+*/
+// *****************************************************************************
+
+#include <random>
+#include <vector>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "PDE/EoS/StiffenedGas.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct StiffenedGas_common {
+  //! Number of states, not a multiple of the vector width to test remainders
+  static constexpr std::size_t n = 1003;
+
+  //! Materials to test: ideal gas and stiffened gas (water)
+  const std::vector< inciter::StiffenedGas > mat{
+    inciter::StiffenedGas( 1.4, 0.0, 717.5 ),
+    inciter::StiffenedGas( 4.4, 6.0e8, 4186.0 ) };
+
+  //! Arrays of random states
+  struct States {
+    std::vector< tk::real > arho, aru, arv, arw, arhoE, alpha;
+  };
+
+  //! Generate random states
+  //! \param[in] m Material to generate states for
+  //! \param[in] multimat True to generate volume fractions less than one
+  //! \param[in,out] g Random number generator
+  //! \return Random states
+  //! \details Pressures are drawn such that some states have negative
+  //!   effective pressure, on which the speed of sound is clipped.
+  static States states( const inciter::StiffenedGas& m, bool multimat,
+                        std::mt19937& g )
+  {
+    std::uniform_real_distribution< tk::real > rho( 0.1, 1.0e3 ),
+      vel( -1.0e2, 1.0e2 ), pr( -2.0, 1.0e2 ), vf( 1.0e-3, 1.0 );
+    States s;
+    for (std::size_t i=0; i<n; ++i) {
+      auto a = multimat ? vf( g ) : 1.0;
+      auto r = a * rho( g );
+      auto u = vel( g ), v = vel( g ), w = vel( g );
+      auto p = a * (pr( g ) * 1.0e3 - 0.01*m.pstiff());
+      s.arho.push_back( r );
+      s.aru.push_back( r*u );
+      s.arv.push_back( r*v );
+      s.arw.push_back( r*w );
+      s.arhoE.push_back( (p + a*m.pstiff()) / (m.gamma()-1.0)
+                         + 0.5*r*(u*u + v*v + w*w) + a*m.pstiff() );
+      s.alpha.push_back( a );
+    }
+    return s;
+  }
+
+  //! Compare batch against single-state pressure and speed of sound
+  //! \param[in] m Material to test
+  //! \param[in] s States to test
+  //! \param[in] multimat True to pass volume fractions to the batch functions
+  static void compare( const inciter::StiffenedGas& m, const States& s,
+                       bool multimat )
+  {
+    const tk::real* alpha = multimat ? s.alpha.data() : nullptr;
+    std::vector< tk::real > apr( n ), a( n );
+    m.pressure( n, s.arho.data(), s.aru.data(), s.arv.data(), s.arw.data(),
+                s.arhoE.data(), alpha, apr.data() );
+    m.soundspeed( n, s.arho.data(), apr.data(), alpha, a.data() );
+    for (std::size_t i=0; i<n; ++i) {
+      auto u = s.aru[i]/s.arho[i], v = s.arv[i]/s.arho[i],
+           w = s.arw[i]/s.arho[i];
+      auto p = multimat ?
+        m.pressure( s.arho[i], u, v, w, s.arhoE[i], s.alpha[i] ) :
+        m.pressure( s.arho[i], u, v, w, s.arhoE[i] );
+      ensure( "batch pressure differs", apr[i] == p );
+      auto c = multimat ?
+        m.soundspeed( s.arho[i], p, s.alpha[i] ) :
+        m.soundspeed( s.arho[i], p );
+      ensure( "batch speed of sound differs", a[i] == c );
+    }
+  }
+};
+
+//! Test group shortcuts
+using StiffenedGas_group =
+  test_group< StiffenedGas_common, MAX_TESTS_IN_GROUP >;
+using StiffenedGas_object = StiffenedGas_group::object;
+
+//! Define test group
+static StiffenedGas_group StiffenedGas( "PDE/EoS/StiffenedGas" );
+
+//! Test definitions for group
+
+//! Test batch functions without volume fractions against single-state ones
+template<> template<>
+void StiffenedGas_object::test< 1 >() {
+  set_test_name( "batch equals single-state, single-material" );
+
+  std::mt19937 g( 1 );
+  for (const auto& m : mat) compare( m, states( m, false, g ), false );
+}
+
+//! Test batch functions with volume fractions against single-state ones
+template<> template<>
+void StiffenedGas_object::test< 2 >() {
+  set_test_name( "batch equals single-state, multi-material" );
+
+  std::mt19937 g( 2 );
+  for (const auto& m : mat) compare( m, states( m, true, g ), true );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
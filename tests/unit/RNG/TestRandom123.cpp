@@ -10,6 +10,9 @@
 */
 // *****************************************************************************
 
+#include <vector>
+#include <algorithm>
+
 #include "NoWarning/tut.hpp"
 
 #include "NoWarning/threefry.hpp"
@@ -259,6 +262,26 @@ void Random123_object::test< 21 >() {
   RNG_common::test_move_assignment( r );
 }
 
+//! Test that uniform numbers generated in blocks equal those from one call
+template<> template<>
+void Random123_object::test< 22 >() {
+  set_test_name( "uniform in blocks equals uniform at once" );
+
+  tk::Random123< r123::Threefry2x64 > a( 1 ), b( 1 );
+  std::vector< double > x( 1000 ), y( 1000 );
+  a.uniform( 0, 1000, x.data() );
+  for (std::size_t i=0; i<1000; i+=100) b.uniform( 0, 100, y.data()+i );
+  ensure( "uniform numbers generated in blocks differ", x == y );
+
+  // odd block sizes skip the unused words but must not repeat numbers
+  tk::Random123< r123::Philox2x64 > c( 1 );
+  std::vector< double > z( 1000 );
+  for (std::size_t i=0; i<1000; i+=5) c.uniform( 0, 5, z.data()+i );
+  std::sort( begin(z), end(z) );
+  ensure( "uniform numbers repeat", std::adjacent_find( begin(z), end(z) ) ==
+                                    end(z) );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,171 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Statistics/TestStatistics.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Statistics/Statistics.hpp
+  \details   Unit tests for Statistics/Statistics.hpp. Ordinary and central
+    moments estimated from known samples are compared against moments
+    computed directly, and the one-pass central moments are compared against
+    the two-pass ones.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Statistics/Statistics.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Statistics_common {
+  //! Number of particles
+  static constexpr std::size_t npar = 1000;
+
+  //! Offsets of variables X and Y in particle properties
+  const tk::ctr::OffsetMap offset{ {'X',0}, {'Y',1} };
+
+  //! Requested moments: ordinary first, then central ones
+  const std::vector< tk::ctr::Product > stat{
+    { tk::ctr::Term( 'X', 0, tk::ctr::Moment::ORDINARY ) },
+    { tk::ctr::Term( 'Y', 0, tk::ctr::Moment::ORDINARY ) },
+    { tk::ctr::Term( 'X', 0, tk::ctr::Moment::ORDINARY ),
+      tk::ctr::Term( 'Y', 0, tk::ctr::Moment::ORDINARY ) },
+    { tk::ctr::Term( 'x', 0, tk::ctr::Moment::CENTRAL ),
+      tk::ctr::Term( 'x', 0, tk::ctr::Moment::CENTRAL ) },
+    { tk::ctr::Term( 'x', 0, tk::ctr::Moment::CENTRAL ),
+      tk::ctr::Term( 'y', 0, tk::ctr::Moment::CENTRAL ) },
+    { tk::ctr::Term( 'x', 0, tk::ctr::Moment::CENTRAL ),
+      tk::ctr::Term( 'x', 0, tk::ctr::Moment::CENTRAL ),
+      tk::ctr::Term( 'x', 0, tk::ctr::Moment::CENTRAL ) },
+    { tk::ctr::Term( 'X', 0, tk::ctr::Moment::ORDINARY ),
+      tk::ctr::Term( 'y', 0, tk::ctr::Moment::CENTRAL ),
+      tk::ctr::Term( 'y', 0, tk::ctr::Moment::CENTRAL ) } };
+
+  //! Fill particles with known samples
+  //! \param[in,out] p Particles to fill
+  //! \param[in] X Offset of the samples of X
+  //! \param[in] Y Offset of the samples of Y
+  static void fill( tk::Particles& p, tk::real X = 1.0, tk::real Y = -2.0 ) {
+    for (std::size_t i=0; i<p.nunk(); ++i) {
+      p( i, 0, 0 ) = X + 0.5 * static_cast< tk::real >( i % 7 );
+      p( i, 0, 1 ) = Y + 0.25 * static_cast< tk::real >( (3*i) % 11 );
+    }
+  }
+
+  //! Estimate ordinary and central moments
+  //! \param[in] p Particles to estimate from
+  //! \param[in] onepass True to estimate central moments in one pass
+  //! \return Ordinary and central moments
+  std::pair< std::vector< tk::real >, std::vector< tk::real > >
+  moments( const tk::Particles& p, bool onepass ) const {
+    tk::Statistics s( p, offset, stat, {}, {}, {}, onepass );
+    s.accumulateOrd();
+    auto ord = s.ord();
+    for (auto& m : ord) m /= static_cast< tk::real >( p.nunk() );
+    s.accumulateCen( ord );
+    auto cen = s.ctr();
+    for (auto& m : cen) m /= static_cast< tk::real >( p.nunk() );
+    return { ord, cen };
+  }
+};
+
+//! Test group shortcuts
+using Statistics_group = test_group< Statistics_common, MAX_TESTS_IN_GROUP >;
+using Statistics_object = Statistics_group::object;
+
+//! Define test group
+static Statistics_group Statistics( "Statistics/Statistics" );
+
+//! Test definitions for group
+
+//! Test two-pass moments against moments computed directly
+template<> template<>
+void Statistics_object::test< 1 >() {
+  set_test_name( "moments of known samples" );
+
+  tk::Particles p( npar, 2 );
+  fill( p );
+
+  // compute moments directly
+  tk::real X = 0.0, Y = 0.0, XY = 0.0;
+  for (std::size_t i=0; i<npar; ++i) {
+    X += p( i, 0, 0 );
+    Y += p( i, 0, 1 );
+    XY += p( i, 0, 0 ) * p( i, 0, 1 );
+  }
+  X /= npar;
+  Y /= npar;
+  XY /= npar;
+  tk::real xx = 0.0, xy = 0.0, xxx = 0.0, Xyy = 0.0;
+  for (std::size_t i=0; i<npar; ++i) {
+    auto x = p( i, 0, 0 ) - X, y = p( i, 0, 1 ) - Y;
+    xx += x*x;
+    xy += x*y;
+    xxx += x*x*x;
+    Xyy += p( i, 0, 0 )*y*y;
+  }
+
+  auto [ ord, cen ] = moments( p, false );
+  const tk::real prec = 1.0e-12;
+  ensure_equals( "<X> incorrect", ord[0], X, prec );
+  ensure_equals( "<Y> incorrect", ord[1], Y, prec );
+  ensure_equals( "<XY> incorrect", ord[2], XY, prec );
+  ensure_equals( "<xx> incorrect", cen[0], xx/npar, prec );
+  ensure_equals( "<xy> incorrect", cen[1], xy/npar, prec );
+  ensure_equals( "<xxx> incorrect", cen[2], xxx/npar, prec );
+  ensure_equals( "<Xyy> incorrect", cen[3], Xyy/npar, prec );
+}
+
+//! Test one-pass central moments against two-pass ones
+template<> template<>
+void Statistics_object::test< 2 >() {
+  set_test_name( "one-pass central moments equal two-pass" );
+
+  tk::Particles p( npar, 2 );
+  fill( p );
+
+  auto [ ord1, cen1 ] = moments( p, true );
+  auto [ ord2, cen2 ] = moments( p, false );
+
+  ensure_equals( "number of ordinary moments incorrect",
+                 ord1.size(), ord2.size() );
+  for (std::size_t i=0; i<ord1.size(); ++i)
+    ensure_equals( "ordinary moment differs", ord1[i], ord2[i], 1.0e-14 );
+  ensure_equals( "number of central moments incorrect",
+                 cen1.size(), cen2.size() );
+  for (std::size_t i=0; i<cen1.size(); ++i)
+    ensure_equals( "central moment differs", cen1[i], cen2[i], 1.0e-12 );
+}
+
+//! Test one-pass central moments of samples with large means
+//! \details The means are 1e8 and the variance of X is about 1, so expanding
+//!   sums of products of the full variables would lose all significant
+//!   digits of the central moments.
+template<> template<>
+void Statistics_object::test< 3 >() {
+  set_test_name( "one-pass central moments with large means" );
+
+  tk::Particles p( npar, 2 );
+  fill( p, 1.0e8 - 1.5, -1.0e8 );
+
+  auto [ ord1, cen1 ] = moments( p, true );
+  auto [ ord2, cen2 ] = moments( p, false );
+
+  ensure_equals( "<xx> incorrect", cen2[0], 1.0, 1.0e-2 );
+  for (std::size_t i=0; i<cen1.size(); ++i)
+    ensure_equals( "central moment differs", cen1[i], cen2[i],
+                   1.0e-6 * std::max( 1.0, std::abs(cen2[i]) ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,222 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Statistics/TestUniPDF.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2021 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Statistics/DenseBins.hpp and Statistics/UniPDF.hpp
+  \details   Unit tests for Statistics/DenseBins.hpp and Statistics/UniPDF.hpp.
+    The PDFs, counting samples into dense bins and a map, are compared against
+    counting the same samples into a map only.
+*/
+// *****************************************************************************
+
+#include <map>
+#include <random>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Statistics/UniPDF.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct UniPDF_common {
+  //! Map-only reference PDF
+  using ref_type = std::map< long, tk::real >;
+
+  //! Count samples into map-only reference PDF
+  //! \param[in] bs Bin size
+  //! \param[in] s Samples to count
+  //! \param[in,out] r Reference PDF to count samples into
+  static void count( tk::real bs, const std::vector< tk::real >& s,
+                     ref_type& r )
+  { for (auto x : s) ++r[ std::lround( x / bs ) ]; }
+
+  //! Compare PDF to map-only reference PDF
+  //! \param[in,out] p PDF to compare, its dense bins flushed to its map
+  //! \param[in] r Reference PDF to compare to
+  static void compare( tk::UniPDF& p, const ref_type& r ) {
+    p.flush();
+    ref_type m( p.map().cbegin(), p.map().cend() );
+    ensure_equals( "number of bins incorrect", m.size(), r.size() );
+    for (const auto& [ b, c ] : r) {
+      auto i = m.find( b );
+      ensure( "bin missing", i != m.end() );
+      ensure_equals( "bin count incorrect", i->second, c );
+    }
+    std::size_t n = 0;
+    for (const auto& [ b, c ] : r) n += static_cast< std::size_t >( c );
+    ensure_equals( "number of samples incorrect", p.nsample(), n );
+    ensure_equals( "integral incorrect", p.integral(), 1.0, 1.0e-14 );
+  }
+
+  //! Generate normally distributed samples
+  //! \param[in] n Number of samples
+  //! \param[in] mean Mean
+  //! \param[in] sigma Standard deviation
+  //! \param[in,out] g Random number generator
+  //! \return Samples
+  static std::vector< tk::real >
+  normal( std::size_t n, tk::real mean, tk::real sigma, std::mt19937& g ) {
+    std::normal_distribution< tk::real > d( mean, sigma );
+    std::vector< tk::real > s( n );
+    for (auto& x : s) x = d( g );
+    return s;
+  }
+};
+
+//! Test group shortcuts
+using UniPDF_group = test_group< UniPDF_common, MAX_TESTS_IN_GROUP >;
+using UniPDF_object = UniPDF_group::object;
+
+//! Define test group
+static UniPDF_group UniPDF( "Statistics/UniPDF" );
+
+//! Test definitions for group
+
+//! Test covering, counting, and merging dense bins
+template<> template<>
+void UniPDF_object::test< 1 >() {
+  set_test_name( "dense bins cover and merge" );
+
+  tk::DenseBins< 2 > a, b;
+  ensure( "new bins not empty", a.empty() );
+  ensure( "cover failed", a.cover( {{-2,1}}, {{3,4}}, 100 ) );
+  ensure( "corner outside", a.inside( {{-2,1}} ) && a.inside( {{3,4}} ) );
+  ensure( "outside bin inside", !a.inside( {{4,1}} ) && !a.inside( {{0,0}} ) );
+  a[ {{-2,1}} ] = 1.0;
+  a[ {{3,4}} ] = 2.0;
+
+  // growing keeps the counts, too many bins leave the bins unchanged
+  ensure( "grow failed", a.cover( {{0,-1}}, {{5,2}}, 100 ) );
+  ensure( "grow beyond max changed bins",
+          !a.cover( {{0,0}}, {{100,100}}, 100 ) && !a.inside( {{6,0}} ) );
+
+  ensure( "cover failed", b.cover( {{5,4}}, {{5,4}}, 100 ) );
+  b[ {{5,4}} ] = 3.0;
+  ensure( "merge failed", a.merge( b, 100 ) );
+
+  std::map< std::array< long, 2 >, tk::real > m;
+  a.foreach( [&]( const std::array< long, 2 >& k, tk::real c ){ m[k] = c; } );
+  std::map< std::array< long, 2 >, tk::real >
+    r{ {{{-2,1}},1.0}, {{{3,4}},2.0}, {{{5,4}},3.0} };
+  ensure( "bins after merge incorrect", m == r );
+
+  a.zero();
+  std::size_t n = 0;
+  a.foreach( [&]( const std::array< long, 2 >&, tk::real ){ ++n; } );
+  ensure_equals( "zero incorrect", n, 0UL );
+  ensure( "zero changed box", a.inside( {{-2,-1}} ) && a.inside( {{5,4}} ) );
+}
+
+//! Test adding single samples and batches of samples against a map-only PDF
+template<> template<>
+void UniPDF_object::test< 2 >() {
+  set_test_name( "add matches map-only counting" );
+
+  const tk::real bs = 0.05;
+  std::mt19937 g( 1 );
+  tk::UniPDF p( bs );
+  ref_type r;
+
+  // single samples before any batch: counted into the map
+  auto s = normal( 100, 0.0, 1.0, g );
+  for (auto x : s) p.add( x );
+  count( bs, s, r );
+  compare( p, r );
+
+  // batch: dense bins cover its extents
+  s = normal( 10000, 0.5, 1.0, g );
+  p.add( s.size(), [&]( std::size_t i ){ return s[i]; } );
+  count( bs, s, r );
+
+  // single samples inside and outside of the dense bins
+  s = normal( 1000, 0.0, 3.0, g );
+  s.push_back( 1.0e3 );
+  s.push_back( -1.0e4 );
+  for (auto x : s) p.add( x );
+  count( bs, s, r );
+
+  // batch with outliers requiring too many dense bins: samples outside of
+  // the dense bins are counted into the map
+  s = normal( 1000, -0.5, 2.0, g );
+  s.push_back( 1.0e6 );
+  s.push_back( -1.0e7 );
+  p.add( s.size(), [&]( std::size_t i ){ return s[i]; } );
+  count( bs, s, r );
+  compare( p, r );
+
+  // flush() moved the dense bins into the map, continue adding
+  s = normal( 5000, 0.0, 1.0, g );
+  p.add( s.size(), [&]( std::size_t i ){ return s[i]; } );
+  for (std::size_t i=0; i<100; ++i) p.add( s[i] );
+  count( bs, s, r );
+  count( bs, std::vector< tk::real >( s.begin(), s.begin()+100 ), r );
+  compare( p, r );
+
+  p.flush();
+  auto e = p.extents();
+  ensure_equals( "min extent incorrect", e[0], r.begin()->first );
+  ensure_equals( "max extent incorrect", e[1], r.rbegin()->first );
+}
+
+//! Test adding samples outside of user-specified extents
+template<> template<>
+void UniPDF_object::test< 3 >() {
+  set_test_name( "add outside of user extents" );
+
+  const tk::real bs = 0.1;
+  std::mt19937 g( 2 );
+  tk::UniPDF p( bs, { -1.0, 1.0 } );
+  ref_type r;
+
+  auto s = normal( 2000, 0.0, 2.0, g );
+  for (std::size_t i=0; i<1000; ++i) p.add( s[i] );
+  p.add( 1000, [&]( std::size_t i ){ return s[1000+i]; } );
+  count( bs, s, r );
+  compare( p, r );
+}
+
+//! Test merging PDFs against merging map-only PDFs
+template<> template<>
+void UniPDF_object::test< 4 >() {
+  set_test_name( "addPDF matches map-only merge" );
+
+  const tk::real bs = 0.02;
+  std::mt19937 g( 3 );
+  ref_type r;
+
+  // PDFs with overlapping, disjoint, and far apart dense bins, the latter
+  // requiring too many bins to merge into dense bins
+  std::vector< tk::UniPDF > p;
+  for (auto mean : { 0.0, 0.5, 30.0, 1.0e5 }) {
+    auto s = normal( 3000, mean, 1.0, g );
+    p.emplace_back( bs );
+    p.back().add( s.size(), [&]( std::size_t i ){ return s[i]; } );
+    p.back().add( -1.0e3 );     // outside of dense bins
+    s.push_back( -1.0e3 );
+    count( bs, s, r );
+  }
+
+  tk::UniPDF q;
+  for (const auto& x : p) q.addPDF( x );
+  compare( q, r );
+
+  // merge twice into a PDF with a sample in the map only
+  tk::UniPDF m( bs );
+  m.add( 0.0 );
+  for (std::size_t i=0; i<2; ++i)
+    for (const auto& x : p) m.addPDF( x );
+  ref_type rm{ {0,1.0} };
+  for (const auto& [ b, c ] : r) rm[b] += 2.0*c;
+  compare( m, rm );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT